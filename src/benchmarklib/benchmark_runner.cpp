@@ -5,6 +5,7 @@
 #include "benchmark_runner.hpp"
 #include "constant_mappings.hpp"
 #include "import_export/csv_parser.hpp"
+#include "operators/abstract_operator.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -27,6 +28,13 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config, const NamedQueri
     _performance_warning_disabler.emplace();
   }
 
+  if (config.enable_hardware_counters) {
+    if (!HardwareCounters::is_available()) {
+      config.out << "- perf_event_open is not available, no hardware counters will be recorded" << std::endl;
+    }
+    HardwareCounters::set_enabled(true);
+  }
+
   // Initialise the scheduler if the benchmark was requested to run multi-threaded
   if (config.enable_scheduler) {
     Topology::use_default_topology(config.cores);
@@ -79,6 +87,13 @@ void BenchmarkRunner::run() {
     _create_report(std::cout);
   }
 
+  // Write the traces of the queries
+  for (const auto& [name, execution_trace] : _query_traces) {
+    auto file_name = name;
+    boost::replace_all(file_name, " ", "_");
+    execution_trace->write_chrome_trace(file_name + "-trace.json");
+  }
+
   // Visualize query plans
   if (_config.enable_visualization) {
     for (const auto& name_and_plans : _query_plans) {
@@ -139,7 +154,8 @@ void BenchmarkRunner::_benchmark_permuted_query_set() {
         // to measure its duration as well as signal that the query was finished
         const auto query_run_begin = std::chrono::steady_clock::now();
         auto on_query_done = [query_run_begin, named_query, number_of_queries, &currently_running_clients,
-                              &finished_query_set_runs, &finished_queries_total, &state, this]() {
+                              &finished_query_set_runs, &finished_queries_total, &state,
+                              this](const HardwareCounterValues& hardware_counters) {
           if (finished_queries_total++ % number_of_queries == 0) {
             currently_running_clients--;
             finished_query_set_runs++;
@@ -150,6 +166,7 @@ void BenchmarkRunner::_benchmark_permuted_query_set() {
             auto& result = _query_results_by_query_name[named_query.first];
             result.duration += duration;
             result.iteration_durations.push_back(duration);
+            if (_config.enable_hardware_counters) result.iteration_hardware_counters.push_back(hardware_counters);
             result.num_iterations++;
           }
         };
@@ -193,12 +210,14 @@ void BenchmarkRunner::_benchmark_individual_queries() {
         // The on_query_done callback will be appended to the last Task of the query,
         // to measure its duration as well as signal that the query was finished
         const auto query_run_begin = std::chrono::steady_clock::now();
-        auto on_query_done = [query_run_begin, &currently_running_clients, &result, &state]() {
+        auto on_query_done = [query_run_begin, &currently_running_clients, &result, &state,
+                              this](const HardwareCounterValues& hardware_counters) {
           currently_running_clients--;
           if (!state.is_done()) {  // To prevent queries to add their results after the time is up
             const auto query_run_end = std::chrono::steady_clock::now();
             result.num_iterations++;
             result.iteration_durations.push_back(query_run_end - query_run_begin);
+            if (_config.enable_hardware_counters) result.iteration_hardware_counters.push_back(hardware_counters);
           }
         };
 
@@ -248,7 +267,7 @@ void BenchmarkRunner::_warmup_query(const NamedQuery& named_query) {
 
       // The on_query_done callback will be appended to the last Task of the query,
       // to signal that the query was finished
-      auto on_query_done = [&currently_running_clients]() { currently_running_clients--; };
+      auto on_query_done = [&currently_running_clients](const HardwareCounterValues&) { currently_running_clients--; };
 
       auto query_tasks = _schedule_or_execute_query(named_query, on_query_done);
       tasks.insert(tasks.end(), query_tasks.begin(), query_tasks.end());
@@ -266,7 +285,7 @@ void BenchmarkRunner::_warmup_query(const NamedQuery& named_query) {
 }
 
 std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_or_execute_query(
-    const NamedQuery& named_query, const std::function<void()>& done_callback) {
+    const NamedQuery& named_query, const QueryDoneCallback& done_callback) {
   // Some queries (like TPC-H 15) require execution before we can call get_tasks() on the pipeline.
   // These queries can't be scheduled yet, therefore we fall back to "just" executing the query
   // when we don't use the scheduler anyway, so that they can be executed.
@@ -278,7 +297,7 @@ std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_or_execute
 }
 
 std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_query(
-    const NamedQuery& named_query, const std::function<void()>& done_callback) {
+    const NamedQuery& named_query, const QueryDoneCallback& done_callback) {
   const auto& name = named_query.first;
   const auto& sql = named_query.second;
 
@@ -286,10 +305,28 @@ std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_query(
 
   auto pipeline_builder = SQLPipelineBuilder{sql}.with_mvcc(_config.use_mvcc);
   if (_config.enable_visualization) pipeline_builder.dont_cleanup_temporaries();
+  if (_config.enable_tracing && !_query_traces.count(name)) {
+    const auto execution_trace = std::make_shared<ExecutionTrace>(name);
+    _query_traces.emplace(name, execution_trace);
+    pipeline_builder.with_execution_trace(execution_trace);
+  }
   auto pipeline = pipeline_builder.create_pipeline();
 
   auto tasks_per_statement = pipeline.get_tasks();
-  tasks_per_statement.back().back()->set_done_callback(done_callback);
+
+  // All operators of the last statement are executed before its last task. The callback must not reference the tasks,
+  // as it is owned by one of them.
+  auto last_statement_operators = std::vector<std::shared_ptr<const AbstractOperator>>{};
+  for (const auto& task : tasks_per_statement.back()) {
+    last_statement_operators.emplace_back(task->get_operator());
+  }
+  tasks_per_statement.back().back()->set_done_callback([done_callback, last_statement_operators]() {
+    auto hardware_counters = HardwareCounterValues{};
+    for (const auto& op : last_statement_operators) {
+      if (op->performance_data().hardware_counters) hardware_counters += *op->performance_data().hardware_counters;
+    }
+    if (done_callback) done_callback(hardware_counters);
+  });
 
   for (auto tasks : tasks_per_statement) {
     CurrentScheduler::schedule_tasks(tasks);
@@ -307,17 +344,28 @@ std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_query(
   return query_tasks;
 }
 
-void BenchmarkRunner::_execute_query(const NamedQuery& named_query, const std::function<void()>& done_callback) {
+void BenchmarkRunner::_execute_query(const NamedQuery& named_query, const QueryDoneCallback& done_callback) {
   const auto& name = named_query.first;
   const auto& sql = named_query.second;
 
   auto pipeline_builder = SQLPipelineBuilder{sql}.with_mvcc(_config.use_mvcc);
   if (_config.enable_visualization) pipeline_builder.dont_cleanup_temporaries();
+  if (_config.enable_tracing && !_query_traces.count(name)) {
+    const auto execution_trace = std::make_shared<ExecutionTrace>(name);
+    _query_traces.emplace(name, execution_trace);
+    pipeline_builder.with_execution_trace(execution_trace);
+  }
   auto pipeline = pipeline_builder.create_pipeline();
   // Execute the query, we don't care about the results
   pipeline.get_result_table();
 
-  if (done_callback) done_callback();
+  auto hardware_counters = HardwareCounterValues{};
+  for (const auto& statement_metrics : pipeline.metrics().statement_metrics) {
+    for (const auto& operator_hardware_counters : statement_metrics->operator_hardware_counters) {
+      hardware_counters += operator_hardware_counters.second;
+    }
+  }
+  if (done_callback) done_callback(hardware_counters);
 
   // If necessary, keep plans for visualization
   if (_config.enable_visualization) {
@@ -359,6 +407,18 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
                              {"items_per_second", items_per_second},
                              {"time_unit", "ns"}};
 
+    // Average counters of all operators of the query, see HardwareCounters
+    if (_config.enable_hardware_counters && !query_result.iteration_hardware_counters.empty()) {
+      auto total = HardwareCounterValues{};
+      for (const auto& hardware_counters : query_result.iteration_hardware_counters) {
+        total += hardware_counters;
+      }
+      const auto iterations = query_result.iteration_hardware_counters.size();
+      const auto average = HardwareCounterValues{total.cycles / iterations, total.instructions / iterations,
+                                                 total.llc_misses / iterations, total.branch_misses / iterations};
+      benchmark["avg_hardware_counters_per_iteration"] = average.to_json();
+    }
+
     benchmarks.push_back(benchmark);
   }
 
@@ -519,7 +579,9 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("cores", "Specify the number of cores used by the scheduler (if active). 0 means all available cores", cxxopts::value<uint>()->default_value("0")) // NOLINT
     ("clients", "Specify how many queries should run in parallel if the scheduler is active", cxxopts::value<uint>()->default_value("1")) // NOLINT
     ("mvcc", "Enable MVCC", cxxopts::value<bool>()->default_value("false")) // NOLINT
-    ("visualize", "Create a visualization image of one LQP and PQP for each query", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("visualize", "Create a visualization image of one LQP and PQP for each query", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("trace", "Write a Chrome trace of the first execution of each query to <query name>-trace.json", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("hardware_counters", "Record CPU cycles, instructions, LLC and branch misses of each query's operators (requires perf_event_open)", cxxopts::value<bool>()->default_value("false")); // NOLINT
   // clang-format on
 
   return cli_options;
@@ -556,6 +618,8 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"warmup_duration_in_s", std::chrono::duration_cast<std::chrono::seconds>(config.warmup_duration).count()},
       {"using_mvcc", config.use_mvcc == UseMvcc::Yes},
       {"using_visualization", config.enable_visualization},
+      {"using_tracing", config.enable_tracing},
+      {"using_hardware_counters", config.enable_hardware_counters},
       {"output_file_path", config.output_file_path ? *(config.output_file_path) : "stdout"},
       {"using_scheduler", config.enable_scheduler},
       {"cores", config.cores},
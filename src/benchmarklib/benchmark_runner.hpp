@@ -15,6 +15,7 @@
 #include "storage/chunk.hpp"
 #include "storage/encoding_type.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/tracing/execution_trace.hpp"
 
 namespace opossum {
 
@@ -42,16 +43,19 @@ class BenchmarkRunner {
   // Execute warmup run of a query
   void _warmup_query(const NamedQuery& named_query);
 
+  // Called once a query is done, with the hardware counters of all its operators (zero unless they are enabled)
+  using QueryDoneCallback = std::function<void(const HardwareCounterValues&)>;
+
   // Calls _schedule_query if the scheduler is active, otherwise calls _execute_query and returns no tasks
   std::vector<std::shared_ptr<AbstractTask>> _schedule_or_execute_query(const NamedQuery& named_query,
-                                                                        const std::function<void()>& done_callback);
+                                                                        const QueryDoneCallback& done_callback);
 
   // Schedule and return all tasks for named_query
   std::vector<std::shared_ptr<AbstractTask>> _schedule_query(const NamedQuery& named_query,
-                                                             const std::function<void()>& done_callback);
+                                                             const QueryDoneCallback& done_callback);
 
   // Execute named_query
-  void _execute_query(const NamedQuery& named_query, const std::function<void()>& done_callback);
+  void _execute_query(const NamedQuery& named_query, const QueryDoneCallback& done_callback);
 
   // Create a report in roughly the same format as google benchmarks do when run with --benchmark_format=json
   void _create_report(std::ostream& stream) const;
@@ -70,6 +74,9 @@ class BenchmarkRunner {
 
   std::unordered_map<std::string, QueryPlans> _query_plans;
 
+  // If tracing is enabled, the trace of the first execution of each query
+  std::unordered_map<std::string, std::shared_ptr<ExecutionTrace>> _query_traces;
+
   const BenchmarkConfig _config;
 
   // NamedQuery = <name, sql>
@@ -63,7 +63,7 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode benchmark_mode, const bool
                                  const Duration& max_duration, const Duration& warmup_duration, const UseMvcc use_mvcc,
                                  const std::optional<std::string>& output_file_path, const bool enable_scheduler,
                                  const uint cores, const uint clients, const bool enable_visualization,
-                                 std::ostream& out)
+                                 const bool enable_tracing, const bool enable_hardware_counters, std::ostream& out)
     : benchmark_mode(benchmark_mode),
       verbose(verbose),
       chunk_size(chunk_size),
@@ -77,6 +77,8 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode benchmark_mode, const bool
       cores(cores),
       clients(clients),
       enable_visualization(enable_visualization),
+      enable_tracing(enable_tracing),
+      enable_hardware_counters(enable_hardware_counters),
       out(out) {}
 
 BenchmarkConfig BenchmarkConfig::get_default_config() { return BenchmarkConfig(); }
@@ -153,6 +155,12 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
   const auto enable_visualization = json_config.value("visualize", default_config.enable_visualization);
   out << "- Visualization is " << (enable_visualization ? "on" : "off") << std::endl;
 
+  const auto enable_tracing = json_config.value("trace", default_config.enable_tracing);
+  out << "- Tracing is " << (enable_tracing ? "on" : "off") << std::endl;
+
+  const auto enable_hardware_counters = json_config.value("hardware_counters", default_config.enable_hardware_counters);
+  out << "- Hardware performance counters are " << (enable_hardware_counters ? "on" : "off") << std::endl;
+
   // Get the specified encoding type
   std::unique_ptr<EncodingConfig> encoding_config{};
   const auto encoding_type_str = json_config.value("encoding", "Dictionary");
@@ -190,9 +198,22 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
   }
   const Duration warmup_duration = std::chrono::duration_cast<opossum::Duration>(std::chrono::seconds{warmup});
 
-  return BenchmarkConfig{benchmark_mode,       verbose,  chunk_size,       *encoding_config, max_runs, timeout_duration,
-                         warmup_duration,      use_mvcc, output_file_path, enable_scheduler, cores,    clients,
-                         enable_visualization, out};
+  return BenchmarkConfig{benchmark_mode,
+                         verbose,
+                         chunk_size,
+                         *encoding_config,
+                         max_runs,
+                         timeout_duration,
+                         warmup_duration,
+                         use_mvcc,
+                         output_file_path,
+                         enable_scheduler,
+                         cores,
+                         clients,
+                         enable_visualization,
+                         enable_tracing,
+                         enable_hardware_counters,
+                         out};
 }
 
 BenchmarkConfig CLIConfigParser::parse_basic_cli_options(const cxxopts::ParseResult& parse_result) {
@@ -215,6 +236,8 @@ nlohmann::json CLIConfigParser::basic_cli_options_to_json(const cxxopts::ParseRe
   json_config.emplace("clients", parse_result["clients"].as<uint>());
   json_config.emplace("mvcc", parse_result["mvcc"].as<bool>());
   json_config.emplace("visualize", parse_result["visualize"].as<bool>());
+  json_config.emplace("trace", parse_result["trace"].as<bool>());
+  json_config.emplace("hardware_counters", parse_result["hardware_counters"].as<bool>());
   json_config.emplace("output", parse_result["output"].as<std::string>());
 
   return json_config;
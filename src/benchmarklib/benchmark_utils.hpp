@@ -11,6 +11,7 @@
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
+#include "utils/tracing/hardware_counters.hpp"
 
 namespace opossum {
 
@@ -42,6 +43,8 @@ struct QueryBenchmarkResult {
   std::atomic<size_t> num_iterations = 0;
   Duration duration = Duration{};
   tbb::concurrent_vector<Duration> iteration_durations;
+  // Only filled if hardware counters are enabled, see HardwareCounters
+  tbb::concurrent_vector<HardwareCounterValues> iteration_hardware_counters;
 };
 
 using QueryID = size_t;
@@ -101,7 +104,8 @@ struct BenchmarkConfig {
                   const EncodingConfig& encoding_config, const size_t max_num_query_runs, const Duration& max_duration,
                   const Duration& warmup_duration, const UseMvcc use_mvcc,
                   const std::optional<std::string>& output_file_path, const bool enable_scheduler, const uint cores,
-                  const uint clients, const bool enable_visualization, std::ostream& out);
+                  const uint clients, const bool enable_visualization, const bool enable_tracing,
+                  const bool enable_hardware_counters, std::ostream& out);
 
   static BenchmarkConfig get_default_config();
 
@@ -118,6 +122,8 @@ struct BenchmarkConfig {
   const uint cores = 0;
   const uint clients = 1;
   const bool enable_visualization = false;
+  const bool enable_tracing = false;
+  const bool enable_hardware_counters = false;
   std::ostream& out;
 
   static const char* description;
@@ -72,6 +72,16 @@ bool TransactionContext::rollback() {
 }
 
 bool TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
+  // Constraints are checked while the transaction can still be rolled back
+  if (_phase == TransactionPhase::Active) {
+    for (const auto& op : _rw_operators) {
+      if (!op->can_commit_records()) {
+        rollback();
+        return false;
+      }
+    }
+  }
+
   const auto success = _prepare_commit();
 
   if (!success) return false;
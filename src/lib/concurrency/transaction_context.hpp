@@ -90,10 +90,11 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   bool rollback();
 
   /**
-   * Commits the transaction.
+   * Commits the transaction. If one of the operators cannot commit its changes (e.g., because an Insert violates a
+   * unique constraint), the transaction is rolled back instead.
    *
    * @param callback called when transaction is actually committed
-   * @return false if called a second time
+   * @return false if called a second time or if the transaction was rolled back
    */
   bool commit_async(const std::function<void(TransactionID)>& callback);
 
@@ -102,7 +103,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    *
    * Blocks until transaction is actually committed.
    *
-   * @return false if called a second time
+   * @return false if called a second time or if the transaction was rolled back, see commit_async()
    */
   bool commit();
 
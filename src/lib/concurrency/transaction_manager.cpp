@@ -13,6 +13,9 @@ void TransactionManager::reset() {
   manager._next_transaction_id = INITIAL_TRANSACTION_ID;
   manager._last_commit_id = INITIAL_COMMIT_ID;
   manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID);
+
+  std::lock_guard<std::mutex> lock(manager._active_snapshot_commit_ids_mutex);
+  manager._active_snapshot_commit_ids.clear();
 }
 
 TransactionManager::TransactionManager()
@@ -23,7 +26,22 @@ TransactionManager::TransactionManager()
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
 std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
-  return std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id);
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+  const auto snapshot_commit_id = _last_commit_id.load();
+  _active_snapshot_commit_ids.insert(snapshot_commit_id);
+
+  return std::shared_ptr<TransactionContext>(new TransactionContext(_next_transaction_id++, snapshot_commit_id),
+                                             [](TransactionContext* context) {
+                                               const auto released_snapshot_commit_id = context->snapshot_commit_id();
+                                               delete context;
+                                               get()._release_snapshot_commit_id(released_snapshot_commit_id);
+                                             });
+}
+
+CommitID TransactionManager::lowest_active_snapshot_commit_id() const {
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+  if (_active_snapshot_commit_ids.empty()) return _last_commit_id;
+  return *_active_snapshot_commit_ids.cbegin();
 }
 
 /**
@@ -82,4 +100,14 @@ void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<Com
   }
 }
 
+void TransactionManager::_release_snapshot_commit_id(const CommitID snapshot_commit_id) {
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+
+  // The commit id is not found if the manager was reset while the context was referenced
+  const auto snapshot_commit_id_iter = _active_snapshot_commit_ids.find(snapshot_commit_id);
+  if (snapshot_commit_id_iter != _active_snapshot_commit_ids.end()) {
+    _active_snapshot_commit_ids.erase(snapshot_commit_id_iter);
+  }
+}
+
 }  // namespace opossum
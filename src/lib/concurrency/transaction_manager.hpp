@@ -3,6 +3,8 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <set>
 
 #include "types.hpp"
 #include "utils/singleton.hpp"
@@ -53,10 +55,18 @@ class TransactionManager : public Singleton<TransactionManager> {
   CommitID last_commit_id() const;
 
   /**
-   * Creates a new transaction context
+   * Creates a new transaction context. Its snapshot commit id counts as active until the last reference to the context
+   * is released, see lowest_active_snapshot_commit_id().
    */
   std::shared_ptr<TransactionContext> new_transaction_context();
 
+  /**
+   * The lowest snapshot commit id of the transaction contexts created by new_transaction_context() that are still
+   * referenced, or the last commit id if there are none. As later transactions get at least the last commit id as
+   * their snapshot, rows that were deleted up to this commit id are not visible to any current or future transaction.
+   */
+  CommitID lowest_active_snapshot_commit_id() const;
+
   // TransactionID = 0 means "not set" in the MVCC data. This is the case if the row has (a) just been reserved, but
   // not yet filled with content, (b) been inserted, committed and not marked for deletion, or (c) inserted but
   // deleted in the same transaction (which has not yet committed)
@@ -71,6 +81,7 @@ class TransactionManager : public Singleton<TransactionManager> {
 
   std::shared_ptr<CommitContext> _new_commit_context();
   void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
+  void _release_snapshot_commit_id(const CommitID snapshot_commit_id);
 
   std::atomic<TransactionID> _next_transaction_id;
 
@@ -80,5 +91,10 @@ class TransactionManager : public Singleton<TransactionManager> {
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
   std::shared_ptr<CommitContext> _last_commit_context;
+
+  // The snapshot commit ids of the referenced transaction contexts. New contexts read the last commit id while holding
+  // the mutex, so that lowest_active_snapshot_commit_id() does not miss a context that is being created.
+  std::multiset<CommitID> _active_snapshot_commit_ids;
+  mutable std::mutex _active_snapshot_commit_ids_mutex;
 };
 }  // namespace opossum
@@ -84,6 +84,10 @@ const boost::bimap<EncodingType, std::string> encoding_type_to_string = make_bim
     {EncodingType::RunLength, "RunLength"},
     {EncodingType::FixedStringDictionary, "FixedStringDictionary"},
     {EncodingType::FrameOfReference, "FrameOfReference"},
+    {EncodingType::FrontCodedDictionary, "FrontCodedDictionary"},
+    {EncodingType::FSST, "FSST"},
+    {EncodingType::PFORDelta, "PFORDelta"},
+    {EncodingType::ALP, "ALP"},
     {EncodingType::Unencoded, "Unencoded"},
 });
 
@@ -91,6 +95,7 @@ const boost::bimap<VectorCompressionType, std::string> vector_compression_type_t
     make_bimap<VectorCompressionType, std::string>({
         {VectorCompressionType::FixedSizeByteAligned, "Fixed-size byte-aligned"},
         {VectorCompressionType::SimdBp128, "SIMD-BP128"},
+        {VectorCompressionType::BitPacked, "Bit-packed"},
     });
 
 const boost::bimap<TableType, std::string> table_type_to_string =
@@ -244,6 +244,17 @@ bool expression_contains_placeholders(const std::shared_ptr<AbstractExpression>&
   return placeholder_found;
 }
 
+bool expression_contains_pqp_select(const std::shared_ptr<AbstractExpression>& expression) {
+  auto select_found = false;
+
+  visit_expression(expression, [&](const auto& sub_expression) {
+    select_found |= sub_expression->type == ExpressionType::PQPSelect;
+    return select_found ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+
+  return select_found;
+}
+
 std::optional<AllTypeVariant> expression_get_value_or_parameter(const AbstractExpression& expression) {
   if (expression.type == ExpressionType::Parameter) {
     const auto& parameter_expression = static_cast<const ParameterExpression&>(expression);
@@ -144,6 +144,11 @@ void expressions_set_transaction_context(const std::vector<std::shared_ptr<Abstr
 
 bool expression_contains_placeholders(const std::shared_ptr<AbstractExpression>& expression);
 
+/**
+ * @return  Whether the expression contains a PQPSelectExpression (i.e., a sub-SELECT), correlated or not
+ */
+bool expression_contains_pqp_select(const std::shared_ptr<AbstractExpression>& expression);
+
 /**
  * @return  The value of a ParameterExpression or ValueExpression
  *          std::nullopt for other expression types
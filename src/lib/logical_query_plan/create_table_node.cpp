@@ -6,8 +6,12 @@
 
 namespace opossum {
 
-CreateTableNode::CreateTableNode(const std::string& table_name, const TableColumnDefinitions& column_definitions)
-    : BaseNonQueryNode(LQPNodeType::CreateTable), table_name(table_name), column_definitions(column_definitions) {}
+CreateTableNode::CreateTableNode(const std::string& table_name, const TableColumnDefinitions& column_definitions,
+                                 const TableConstraintDefinitions& constraint_definitions)
+    : BaseNonQueryNode(LQPNodeType::CreateTable),
+      table_name(table_name),
+      column_definitions(column_definitions),
+      constraint_definitions(constraint_definitions) {}
 
 std::string CreateTableNode::description() const {
   std::ostringstream stream;
@@ -27,18 +31,27 @@ std::string CreateTableNode::description() const {
       stream << ", ";
     }
   }
+  for (const auto& constraint_definition : constraint_definitions) {
+    stream << ", " << (constraint_definition.is_primary_key == IsPrimaryKey::Yes ? "PRIMARY KEY" : "UNIQUE") << " (";
+    for (auto column_idx = size_t{0}; column_idx < constraint_definition.column_ids.size(); ++column_idx) {
+      stream << "'" << column_definitions[constraint_definition.column_ids[column_idx]].name << "'";
+      if (column_idx + 1u < constraint_definition.column_ids.size()) stream << ", ";
+    }
+    stream << ")";
+  }
   stream << ")";
 
   return stream.str();
 }
 
 std::shared_ptr<AbstractLQPNode> CreateTableNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return CreateTableNode::make(table_name, column_definitions);
+  return CreateTableNode::make(table_name, column_definitions, constraint_definitions);
 }
 
 bool CreateTableNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& create_table_node = static_cast<const CreateTableNode&>(rhs);
-  return table_name == create_table_node.table_name && column_definitions == create_table_node.column_definitions;
+  return table_name == create_table_node.table_name && column_definitions == create_table_node.column_definitions &&
+         constraint_definitions == create_table_node.constraint_definitions;
 }
 
 }  // namespace opossum
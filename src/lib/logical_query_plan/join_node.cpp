@@ -1,5 +1,6 @@
 #include "join_node.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <numeric>
@@ -13,6 +14,7 @@
 #include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_column_expression.hpp"
+#include "lqp_utils.hpp"
 #include "operators/operator_join_predicate.hpp"
 #include "statistics/table_statistics.hpp"
 #include "types.hpp"
@@ -88,9 +90,31 @@ std::shared_ptr<TableStatistics> JoinNode::derive_statistics_from(
     // TODO(anybody) (Complex) predicate we can't build statistics for
     if (!operator_join_predicate) return cross_join_statistics;
 
-    return std::make_shared<TableStatistics>(left_input->get_statistics()->estimate_predicated_join(
-        *right_input->get_statistics(), join_mode, operator_join_predicate->column_ids,
-        operator_join_predicate->predicate_condition));
+    const auto& left_statistics = left_input->get_statistics();
+    const auto& right_statistics = right_input->get_statistics();
+    const auto join_statistics =
+        left_statistics->estimate_predicated_join(*right_statistics, join_mode, operator_join_predicate->column_ids,
+                                                  operator_join_predicate->predicate_condition);
+
+    if (operator_join_predicate->predicate_condition != PredicateCondition::Equals) {
+      return std::make_shared<TableStatistics>(join_statistics);
+    }
+
+    // If the join column of one side is unique (see lqp_is_unique_on()), each row of the other side finds at most one
+    // join partner. The estimation does not know about the constraint and might return more rows.
+    const auto& [left_column_id, right_column_id] = operator_join_predicate->column_ids;
+    auto max_row_count = join_statistics.row_count();
+    if ((join_mode == JoinMode::Inner || join_mode == JoinMode::Left) &&
+        lqp_is_unique_on(right_input, {right_input->column_expressions()[right_column_id]})) {
+      max_row_count = std::min(max_row_count, left_statistics->row_count());
+    }
+    if ((join_mode == JoinMode::Inner || join_mode == JoinMode::Right) &&
+        lqp_is_unique_on(left_input, {left_input->column_expressions()[left_column_id]})) {
+      max_row_count = std::min(max_row_count, right_statistics->row_count());
+    }
+
+    return std::make_shared<TableStatistics>(join_statistics.table_type(), max_row_count,
+                                             join_statistics.column_statistics());
   }
 }
 
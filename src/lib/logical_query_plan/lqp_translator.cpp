@@ -25,7 +25,6 @@
 #include "expression/lqp_select_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_select_expression.hpp"
-#include "expression/value_expression.hpp"
 #include "insert_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
@@ -44,6 +43,7 @@
 #include "operators/maintenance/drop_view.hpp"
 #include "operators/maintenance/show_columns.hpp"
 #include "operators/maintenance/show_tables.hpp"
+#include "operators/operator_index_scan_predicate.hpp"
 #include "operators/operator_join_predicate.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "operators/product.hpp"
@@ -58,6 +58,7 @@
 #include "projection_node.hpp"
 #include "show_columns_node.hpp"
 #include "sort_node.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
@@ -155,61 +156,50 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_index_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
-  /**
-   * Not using OperatorScanPredicate, since it splits up BETWEEN into two scans for some cases that TableScan cannot handle
-   */
-
-  auto column_id = ColumnID{0};
-  auto value_variant = AllTypeVariant{NullValue{}};
-  auto value2_variant = std::optional<AllTypeVariant>{};
-
   // Currently, we will only use IndexScans if the predicate node directly follows a StoredTableNode.
   // Our IndexScan implementation does not work on reference segments yet.
   Assert(node->left_input()->type == LQPNodeType::StoredTable, "IndexScan must follow a StoredTableNode.");
 
-  const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(node->predicate);
-  Assert(predicate, "Expected predicate");
-  Assert(!predicate->arguments.empty(), "Expected arguments");
-
-  column_id = node->left_input()->get_column_id(*predicate->arguments[0]);
-  if (predicate->arguments.size() > 1) {
-    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[1]);
-    // This is necessary because we currently support single column indexes only
-    Assert(value_expression, "Expected value as second argument for IndexScan");
-    value_variant = value_expression->value;
-  }
-  if (predicate->arguments.size() > 2) {
-    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[2]);
-    // This is necessary because we currently support single column indexes only
-    Assert(value_expression, "Expected value as third argument for IndexScan");
-    value2_variant = value_expression->value;
-  }
-
-  const std::vector<ColumnID> column_ids = {column_id};
-  const std::vector<AllTypeVariant> right_values = {value_variant};
-  std::vector<AllTypeVariant> right_values2 = {};
-  if (value2_variant) right_values2.emplace_back(*value2_variant);
+  const auto index_scan_predicate = OperatorIndexScanPredicate::from_expression(*node->predicate, *node->left_input());
+  Assert(index_scan_predicate, "Predicate cannot be executed by an IndexScan");
+  const auto& column_ids = index_scan_predicate->column_ids;
 
   auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
   const auto table_name = stored_table_node->table_name;
   const auto table = StorageManager::get().get_table(table_name);
+
+  // Multi-column predicates and prefixes of multiple columns are answered by CompositeGroupKeyIndexes
+  auto index_type = SegmentIndexType::GroupKey;
+  for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (chunk->get_index(SegmentIndexType::GroupKey, column_ids)) break;
+    if (chunk->get_index(SegmentIndexType::CompositeGroupKey, column_ids)) {
+      index_type = SegmentIndexType::CompositeGroupKey;
+      break;
+    }
+  }
+
+  auto index_scan =
+      std::make_shared<IndexScan>(input_operator, index_type, column_ids, index_scan_predicate->key_ranges);
+
+  // A TableIndex covers all chunks, so no TableScan is needed
+  if (table->get_table_index(column_ids)) return index_scan;
+
   std::vector<ChunkID> indexed_chunks;
 
   for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
     const auto chunk = table->get_chunk(chunk_id);
-    if (chunk->get_index(SegmentIndexType::GroupKey, column_ids)) {
+    if (chunk->get_index(index_type, column_ids) || chunk->get_delta_index(column_ids)) {
       indexed_chunks.emplace_back(chunk_id);
     }
   }
 
   // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
   // TableScan(s).
-  auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
-                                                predicate->predicate_condition, right_values, right_values2);
-
   const auto table_scan = _translate_predicate_node_to_table_scan(node, input_operator);
 
   index_scan->set_included_chunk_ids(indexed_chunks);
+  index_scan->pin_indexes(*table);
   table_scan->set_excluded_chunk_ids(indexed_chunks);
 
   return std::make_shared<UnionPositions>(index_scan, table_scan);
@@ -438,7 +428,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_drop_view_node(
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_create_table_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto create_table_node = std::dynamic_pointer_cast<CreateTableNode>(node);
-  return std::make_shared<CreateTable>(create_table_node->table_name, create_table_node->column_definitions);
+  return std::make_shared<CreateTable>(create_table_node->table_name, create_table_node->column_definitions,
+                                       create_table_node->constraint_definitions);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_drop_table_node(
@@ -1,12 +1,19 @@
 #include "lqp_utils.hpp"
 
+#include <algorithm>
 #include <set>
 
 #include "expression/expression_functional.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -77,6 +84,95 @@ void lqp_find_subplan_roots_impl(std::vector<std::shared_ptr<AbstractLQPNode>>&
   });
 }
 
+// @param is_validated is whether a ValidateNode lies on the path from the node that asked to @param lqp
+bool lqp_is_unique_on_impl(const std::shared_ptr<AbstractLQPNode>& lqp, const ExpressionUnorderedSet& expressions,
+                           const bool is_validated) {
+  switch (lqp->type) {
+    case LQPNodeType::StoredTable: {
+      const auto& table_name = std::static_pointer_cast<StoredTableNode>(lqp)->table_name;
+      if (!StorageManager::get().has_table(table_name)) return false;
+      const auto table = StorageManager::get().get_table(table_name);
+
+      // Without validation, the output contains all versions of the rows, e.g., a deleted row and its re-insertion
+      if (!is_validated && table->has_mvcc() == UseMvcc::Yes) return false;
+
+      const auto& column_expressions = lqp->column_expressions();
+      for (const auto& constraint_definition : table->get_unique_constraints()) {
+        // Rows with NULLs in a UNIQUE column are not unique if NULLs are considered to be equal
+        const auto& column_ids = constraint_definition.column_ids;
+        const auto is_covered = std::all_of(column_ids.cbegin(), column_ids.cend(), [&](const auto column_id) {
+          return !table->column_is_nullable(column_id) && expressions.count(column_expressions[column_id]) > 0;
+        });
+        if (is_covered) return true;
+      }
+      return false;
+    }
+
+    // These nodes do not add rows or change the values of columns
+    case LQPNodeType::Alias:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Sort:
+      return lqp_is_unique_on_impl(lqp->left_input(), expressions, is_validated);
+
+    case LQPNodeType::Validate:
+      return lqp_is_unique_on_impl(lqp->left_input(), expressions, true);
+
+    case LQPNodeType::Aggregate: {
+      const auto& group_by_expressions = std::static_pointer_cast<AggregateNode>(lqp)->group_by_expressions;
+      return std::all_of(group_by_expressions.cbegin(), group_by_expressions.cend(),
+                         [&](const auto& expression) { return expressions.count(expression) > 0; });
+    }
+
+    case LQPNodeType::Join: {
+      const auto join_node = std::static_pointer_cast<JoinNode>(lqp);
+      if (join_node->join_mode == JoinMode::Semi || join_node->join_mode == JoinMode::Anti) {
+        return lqp_is_unique_on_impl(lqp->left_input(), expressions, is_validated);
+      }
+
+      const auto join_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node->join_predicate);
+      if (!join_predicate || join_predicate->predicate_condition != PredicateCondition::Equals) return false;
+
+      auto left_join_expression = join_predicate->left_operand();
+      auto right_join_expression = join_predicate->right_operand();
+      if (!lqp->left_input()->find_column_id(*left_join_expression)) {
+        std::swap(left_join_expression, right_join_expression);
+      }
+
+      // If the join column of one side is unique, every row of the other side is joined with at most one row. Such a
+      // join is 1:1 if both join columns are unique.
+      const auto left_rows_are_unique_on = [&]() {
+        return lqp_is_unique_on_impl(lqp->left_input(), expressions, is_validated);
+      };
+      const auto right_rows_are_unique_on = [&]() {
+        return lqp_is_unique_on_impl(lqp->right_input(), expressions, is_validated);
+      };
+      const auto left_join_column_is_unique = [&]() {
+        return lqp_is_unique_on_impl(lqp->left_input(), {left_join_expression}, is_validated);
+      };
+      const auto right_join_column_is_unique = [&]() {
+        return lqp_is_unique_on_impl(lqp->right_input(), {right_join_expression}, is_validated);
+      };
+
+      switch (join_node->join_mode) {
+        case JoinMode::Inner:
+          return (left_rows_are_unique_on() && right_join_column_is_unique()) ||
+                 (right_rows_are_unique_on() && left_join_column_is_unique());
+        case JoinMode::Left:
+          return left_rows_are_unique_on() && right_join_column_is_unique();
+        case JoinMode::Right:
+          return right_rows_are_unique_on() && left_join_column_is_unique();
+        default:
+          return false;
+      }
+    }
+
+    default:
+      return false;
+  }
+}
+
 }  // namespace
 
 namespace opossum {
@@ -218,4 +314,9 @@ std::vector<std::shared_ptr<AbstractLQPNode>> lqp_find_subplan_roots(const std::
   return root_nodes;
 }
 
+bool lqp_is_unique_on(const std::shared_ptr<AbstractLQPNode>& lqp,
+                      const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  return lqp_is_unique_on_impl(lqp, ExpressionUnorderedSet{expressions.cbegin(), expressions.cend()}, false);
+}
+
 }  // namespace opossum
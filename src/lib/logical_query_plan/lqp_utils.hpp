@@ -48,6 +48,15 @@ bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp);
  */
 std::shared_ptr<AbstractExpression> lqp_subplan_to_boolean_expression(const std::shared_ptr<AbstractLQPNode>& lqp);
 
+/**
+ * @return whether no two rows in the output of @param lqp have the same values for @param expressions, as derived from
+ *         the unique constraints of the stored tables (see Table::add_unique_constraint()). NULLs are considered to be
+ *         equal, as in GROUP BY and DISTINCT. The constraints of tables with MVCC only hold below a ValidateNode.
+ *         A false result only means that uniqueness could not be shown.
+ */
+bool lqp_is_unique_on(const std::shared_ptr<AbstractLQPNode>& lqp,
+                      const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
 enum class LQPVisitation { VisitInputs, DoNotVisitInputs };
 
 /**
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -12,6 +13,8 @@
 #include "utils/format_duration.hpp"
 #include "utils/print_directed_acyclic_graph.hpp"
 #include "utils/timer.hpp"
+#include "utils/tracing/execution_trace.hpp"
+#include "utils/tracing/hardware_counters.hpp"
 #include "utils/tracing/probes.hpp"
 
 namespace opossum {
@@ -30,6 +33,12 @@ void AbstractOperator::execute() {
   DebugAssert(!_output, "Operator has already been executed");
 
   Timer performance_timer;
+  auto trace_scope = TraceScope{name(), "Operator"};
+
+  // Counts the operator and all jobs it spawns, no matter which Worker executes them
+  const auto hardware_counters = HardwareCounters::is_enabled() ? std::make_shared<HardwareCounters>() : nullptr;
+  auto counter_attribution = std::optional<HardwareCounters::ScopedAttribution>{};
+  if (hardware_counters) counter_attribution.emplace(hardware_counters);
 
   auto transaction_context = this->transaction_context();
 
@@ -53,6 +62,14 @@ void AbstractOperator::execute() {
   _on_cleanup();
 
   _performance_data->walltime = performance_timer.lap();
+  if (hardware_counters) {
+    counter_attribution.reset();
+    _performance_data->hardware_counters = hardware_counters->values();
+  }
+
+  if (ExecutionTrace::current()) {
+    trace_scope.arguments() = {{"description", description()}, {"output_rows", _output ? _output->row_count() : 0}};
+  }
 
   DTRACE_PROBE5(HYRISE, OPERATOR_EXECUTED, name().c_str(), _performance_data->walltime.count(),
                 _output ? _output->row_count() : 0, _output ? _output->chunk_count() : 0,
@@ -156,6 +173,31 @@ void AbstractOperator::set_parameters(const std::unordered_map<ParameterID, AllT
   if (input_right()) mutable_input_right()->set_parameters(parameters);
 }
 
+bool AbstractOperator::is_pipeline_breaker() const { return true; }
+
+std::optional<OperatorInputSide> AbstractOperator::pipelined_input_side() const {
+  if (is_pipeline_breaker() || !_input_left || _input_right) return std::nullopt;
+  return OperatorInputSide::Left;
+}
+
+void AbstractOperator::set_row_budget(const std::optional<size_t>& row_budget) { _row_budget = row_budget; }
+
+const std::optional<size_t>& AbstractOperator::row_budget() const { return _row_budget; }
+
+std::optional<size_t> AbstractOperator::input_row_budget() const { return std::nullopt; }
+
+std::shared_ptr<Table> AbstractOperator::_create_output_table(const std::shared_ptr<const Table>& input_table) const {
+  Fail("Operator " + name() + " cannot be executed chunk by chunk");
+}
+
+void AbstractOperator::_prepare_chunk_execution(const std::shared_ptr<const Table>& input_table) {}
+
+std::shared_ptr<Chunk> AbstractOperator::_on_execute_chunk(
+    const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+    const std::shared_ptr<TransactionContext>& transaction_context) {
+  Fail("Operator " + name() + " cannot be executed chunk by chunk");
+}
+
 void AbstractOperator::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {}
 
 void AbstractOperator::_on_cleanup() {}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -12,6 +13,7 @@
 
 namespace opossum {
 
+class Chunk;
 class OperatorTask;
 class Table;
 class TransactionContext;
@@ -55,6 +57,8 @@ enum class OperatorType {
   Mock  // for Tests that need to Mock operators
 };
 
+enum class OperatorInputSide { Left, Right };
+
 // AbstractOperator is the abstract super class for all operators.
 // All operators have up to two input tables and one output table.
 // Their lifecycle has three phases:
@@ -130,12 +134,50 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Parameters can be ValuePlaceholders of prepared SQL statements, or external values in correlated subslects
   void set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
 
+  // Operators that are no pipeline breakers compute each output chunk from exactly one chunk of their left input.
+  // Such operators can be executed chunk by chunk as part of an OperatorPipeline, without the whole input being
+  // materialized first. They implement _create_output_table() and _on_execute_chunk().
+  virtual bool is_pipeline_breaker() const;
+
+  // The input whose chunks the operator can consume one at a time as part of an OperatorPipeline, std::nullopt if it
+  // needs all of its inputs at once. This is the left input of operators that are no pipeline breakers. Pipeline
+  // breakers can consume one input chunk by chunk as well if they only need the other input as a whole, e.g., the probe
+  // side of a JoinHash. The other input is executed before the pipeline.
+  virtual std::optional<OperatorInputSide> pipelined_input_side() const;
+
+  // The consumer of this operator needs at most @param row_budget rows of its output, e.g., because it is a Limit.
+  // Operators that support this stop processing further chunks once their output contains enough rows. Their output
+  // then still contains min(row_budget, unlimited output row count) rows or more, but not necessarily the rows of the
+  // first chunks. Only valid for operators with a single consumer, see OperatorTask::make_tasks_from_operator().
+  void set_row_budget(const std::optional<size_t>& row_budget);
+  const std::optional<size_t>& row_budget() const;
+
+  // The row budget that this operator imposes on its inputs. For example, a Limit passes on its row count and operators
+  // that do not change the number of rows (e.g., Projection) pass on their own row budget.
+  virtual std::optional<size_t> input_row_budget() const;
+
  protected:
+  friend class OperatorPipeline;
+
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
   // asynchronous execution
   virtual std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) = 0;
 
+  // Only for operators with a pipelined_input_side(): Creates the empty output table for @param input_table, which has
+  // the columns of that input
+  virtual std::shared_ptr<Table> _create_output_table(const std::shared_ptr<const Table>& input_table) const;
+
+  // Only for operators with a pipelined_input_side(): Called once before _on_execute_chunk() is called for the chunks
+  // of tables with the same columns as @param input_table, e.g., to set up state that is shared by all chunks
+  virtual void _prepare_chunk_execution(const std::shared_ptr<const Table>& input_table);
+
+  // Only for operators with a pipelined_input_side(): Processes the chunk @param chunk_id of @param input_table, which
+  // does not have to be the output of that input. Returns the output chunk, or nullptr if it would be empty.
+  // Must be safe to call concurrently for different chunks.
+  virtual std::shared_ptr<Chunk> _on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                                                   const std::shared_ptr<TransactionContext>& transaction_context);
+
   // method that allows operator-specific cleanups for temporary data.
   // separate from _on_execute for readability and as a reminder to
   // clean up after execution (if it makes sense)
@@ -170,6 +212,9 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
+  // See set_row_budget(), unlimited if not set
+  std::optional<size_t> _row_budget;
+
   const std::unique_ptr<OperatorPerformanceData> _performance_data;
 };
 
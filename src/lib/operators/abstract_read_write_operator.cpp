@@ -33,6 +33,12 @@ void AbstractReadWriteOperator::execute() {
   _state = ReadWriteOperatorState::Executed;
 }
 
+bool AbstractReadWriteOperator::can_commit_records() const {
+  Assert(_state == ReadWriteOperatorState::Executed, "Operator needs to have state Executed in order to be committed.");
+
+  return _on_can_commit_records();
+}
+
 void AbstractReadWriteOperator::commit_records(const CommitID commit_id) {
   Assert(_state == ReadWriteOperatorState::Executed, "Operator needs to have state Executed in order to be committed.");
 
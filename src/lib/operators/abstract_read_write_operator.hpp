@@ -34,6 +34,13 @@ class AbstractReadWriteOperator : public AbstractOperator {
 
   void execute() override;
 
+  /**
+   * Checks whether the changes of the operator can be committed, e.g., whether they keep the constraints of the
+   * modified table satisfied. Called by the TransactionContext before the commit id is assigned, so that the
+   * transaction can still be rolled back.
+   */
+  bool can_commit_records() const;
+
   /**
    * Commits the operator and triggers any potential work following commits.
    */
@@ -73,6 +80,11 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_commit_records(const CommitID commit_id) = 0;
 
+  /**
+   * Called by can_commit_records(). Returning false makes the transaction roll back instead of committing.
+   */
+  virtual bool _on_can_commit_records() const { return true; }
+
   /**
    * Called immediately after commit_records().
    * This is the place to do any work after modifying operators were successful, e.g. updating statistics.
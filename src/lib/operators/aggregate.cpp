@@ -6,6 +6,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -17,6 +18,12 @@
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "type_comparison.hpp"
 #include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
@@ -202,7 +209,7 @@ struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Co
 
 template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
 void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                                   const KeysPerChunk<AggregateKey>& keys_per_chunk) {
+                                   const KeysPerChunk<AggregateKey>& keys_per_chunk, const bool keys_are_clustered) {
   using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
 
   auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
@@ -213,33 +220,92 @@ void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, cons
   auto& results = *context.results;
   const auto& hash_keys = keys_per_chunk[chunk_id];
 
+  /**
+   * Run-length encoded segments are aggregated run by run. Consecutive rows of a run that belong to the same group
+   * (e.g., all rows if there is no GROUP BY) update the aggregate only once.
+   */
+  if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<ColumnDataType>*>(&base_segment)) {
+    const auto& values = *run_length_segment->values();
+    const auto& null_values = *run_length_segment->null_values();
+    const auto& end_positions = *run_length_segment->end_positions();
+
+    auto run_begin = ChunkOffset{0};
+    for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+      const auto run_end = static_cast<ChunkOffset>(end_positions[run_index] + 1);
+
+      auto range_begin = run_begin;
+      while (range_begin < run_end) {
+        auto range_end = static_cast<ChunkOffset>(range_begin + 1);
+        while (range_end < run_end && hash_keys[range_end] == hash_keys[range_begin]) ++range_end;
+
+        auto& hash_entry = results[hash_keys[range_begin]];
+        hash_entry.row_id = RowID(chunk_id, static_cast<ChunkOffset>(range_end - 1));
+
+        if (!null_values[run_index]) {
+          const auto& value = values[run_index];
+          const auto row_count = size_t{range_end - range_begin};
+
+          if constexpr ((function == AggregateFunction::Sum || function == AggregateFunction::Avg) &&
+                        std::is_arithmetic_v<ColumnDataType>) {
+            // Adding the value once per row equals adding its product with the number of rows
+            const auto range_sum = static_cast<AggregateType>(value) * static_cast<AggregateType>(row_count);
+            if (hash_entry.current_aggregate) {
+              *hash_entry.current_aggregate += range_sum;
+            } else {
+              hash_entry.current_aggregate = range_sum;
+            }
+          } else {
+            // MIN, MAX, and the COUNTs are not affected by repeating the same value
+            aggregator(value, hash_entry.current_aggregate);
+          }
+
+          hash_entry.aggregate_count += row_count;
+
+          if constexpr (function == AggregateFunction::CountDistinct) {  // NOLINT
+            hash_entry.distinct_values.insert(value);
+          }
+        }
+
+        range_begin = range_end;
+      }
+
+      run_begin = run_end;
+    }
+    return;
+  }
+
   // clang-format off
   resolve_segment_type<ColumnDataType>(
       // clang-format on
-      base_segment, [&results, &hash_keys, chunk_id, aggregator](const auto& typed_segment) {
+      base_segment, [&results, &hash_keys, chunk_id, aggregator, keys_are_clustered](const auto& typed_segment) {
         auto iterable = create_iterable_from_segment<ColumnDataType>(typed_segment);
 
         ChunkOffset chunk_offset{0};
 
+        // If the keys are clustered, the result entry of the previous row is reused as long as the key does not change
+        auto* hash_entry = static_cast<typename std::decay_t<decltype(results)>::mapped_type*>(nullptr);
+
         // Now that all relevant types have been resolved, we can iterate over the segment and build the aggregations.
         iterable.for_each([&, chunk_id, aggregator](const auto& value) {
-          auto& hash_entry = results[hash_keys[chunk_offset]];
-          hash_entry.row_id = RowID(chunk_id, chunk_offset);
+          if (!hash_entry || !keys_are_clustered || hash_keys[chunk_offset] != hash_keys[chunk_offset - 1]) {
+            hash_entry = &results[hash_keys[chunk_offset]];
+          }
+          hash_entry->row_id = RowID(chunk_id, chunk_offset);
 
           /**
           * If the value is NULL, the current aggregate value does not change.
           */
           if (!value.is_null()) {
             // If we have a value, use the aggregator lambda to update the current aggregate value for this group
-            aggregator(value.value(), hash_entry.current_aggregate);
+            aggregator(value.value(), hash_entry->current_aggregate);
 
             // increase value counter
-            ++hash_entry.aggregate_count;
+            ++hash_entry->aggregate_count;
 
             if constexpr (function == AggregateFunction::CountDistinct) {  // NOLINT
               // clang-tidy error: https://bugs.llvm.org/show_bug.cgi?id=35824
               // for the case of CountDistinct, insert this value into the set to keep track of distinct values
-              hash_entry.distinct_values.insert(value.value());
+              hash_entry->distinct_values.insert(value.value());
             }
           }
 
@@ -354,34 +420,184 @@ void Aggregate::_aggregate() {
                                          std::equal_to<ColumnDataType>, decltype(allocator)>(allocator);
         AggregateKeyEntry id_counter = 1u;
 
+        /*
+        If the DictionarySegments of all immutable chunks share a global dictionary (see GlobalDictionaryEncoder), the
+        value ID + 1 is used as ID, so that the values of these segments do not have to be looked up. Values of other
+        segments are looked up in the dictionary, values that it does not hold get IDs after those of the dictionary.
+        For reference segments, this applies to the segments that they reference.
+        */
+        auto segments = std::vector<std::shared_ptr<const BaseSegment>>{};
+        segments.reserve(input_table->chunk_count());
+        auto global_dictionary = std::shared_ptr<const pmr_vector<ColumnDataType>>{};
+        auto has_global_dictionary = true;
+
+        const auto check_segment = [&](const Chunk& chunk, const std::shared_ptr<const BaseSegment>& segment) {
+          if (const auto dictionary_segment =
+                  std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment)) {
+            if (!global_dictionary) global_dictionary = dictionary_segment->dictionary();
+            has_global_dictionary &= dictionary_segment->dictionary() == global_dictionary;
+          } else {
+            // Reclaimed chunks hold empty ValueSegments, see Chunk::reclaim()
+            has_global_dictionary &= (chunk.is_mutable() || segment->size() == 0) &&
+                                     std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment);
+          }
+        };
+
         for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
           const auto chunk_in = input_table->get_chunk(chunk_id);
-          const auto base_segment = chunk_in->get_segment(column_id);
+          segments.emplace_back(chunk_in->get_segment(column_id));
+
+          const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segments.back());
+          if (!reference_segment) {
+            check_segment(*chunk_in, segments.back());
+            continue;
+          }
+
+          // The rows of a PosList are usually grouped by chunk, so that each referenced segment is checked once
+          const auto& referenced_table = *reference_segment->referenced_table();
+          auto previous_chunk_id = INVALID_CHUNK_ID;
+          for (const auto& row_id : *reference_segment->pos_list()) {
+            if (!has_global_dictionary) break;
+            if (row_id.is_null() || row_id.chunk_id == previous_chunk_id) continue;
+
+            previous_chunk_id = row_id.chunk_id;
+            const auto referenced_chunk = referenced_table.get_chunk(row_id.chunk_id);
+            check_segment(*referenced_chunk, referenced_chunk->get_segment(reference_segment->referenced_column_id()));
+          }
+        }
+        if (!has_global_dictionary) global_dictionary = nullptr;
+        if (global_dictionary) id_counter = global_dictionary->size() + 1u;
+
+        const auto get_id = [&](const ColumnDataType& value) {
+          if (global_dictionary) {
+            const auto value_it = std::lower_bound(global_dictionary->cbegin(), global_dictionary->cend(), value);
+            if (value_it != global_dictionary->cend() && *value_it == value) {
+              return static_cast<AggregateKeyEntry>(std::distance(global_dictionary->cbegin(), value_it)) + 1u;
+            }
+          }
+
+          // Store either the current id_counter or the existing ID of the value
+          const auto inserted = id_map.try_emplace(value, id_counter);
+          if (inserted.second) ++id_counter;
+          return inserted.first->second;
+        };
+
+        const auto set_id = [&](const ChunkID chunk_id, const ChunkOffset chunk_offset, const AggregateKeyEntry id) {
+          if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+            keys_per_chunk[chunk_id][chunk_offset] = id;
+          } else {
+            keys_per_chunk[chunk_id][chunk_offset][group_column_index] = id;
+          }
+        };
+
+        for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+          const auto& base_segment = segments[chunk_id];
+
+          if (global_dictionary) {
+            if (const auto dictionary_segment =
+                    std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(base_segment)) {
+              const auto null_value_id = dictionary_segment->null_value_id();
+              resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& vector) {
+                auto chunk_offset = ChunkOffset{0};
+                for (auto value_id_it = vector.cbegin(); value_id_it != vector.cend(); ++value_id_it, ++chunk_offset) {
+                  const auto value_id = static_cast<ValueID>(*value_id_it);
+                  set_id(chunk_id, chunk_offset, value_id == null_value_id ? 0u : AggregateKeyEntry{value_id} + 1u);
+                }
+              });
+              continue;
+            }
+
+            if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(base_segment)) {
+              const auto& referenced_table = *reference_segment->referenced_table();
+
+              // The referenced segment of the previous row, with its value IDs if it is a DictionarySegment. Otherwise,
+              // it is the ValueSegment of a mutable chunk (see above).
+              auto previous_chunk_id = INVALID_CHUNK_ID;
+              auto decompressor = std::unique_ptr<BaseVectorDecompressor>{};
+              auto null_value_id = ValueID{0};
+              auto value_segment = std::shared_ptr<const ValueSegment<ColumnDataType>>{};
+
+              auto chunk_offset = ChunkOffset{0};
+              for (const auto& row_id : *reference_segment->pos_list()) {
+                auto id = AggregateKeyEntry{0u};
+                if (!row_id.is_null()) {
+                  if (row_id.chunk_id != previous_chunk_id) {
+                    previous_chunk_id = row_id.chunk_id;
+                    const auto referenced_segment = referenced_table.get_chunk(row_id.chunk_id)
+                                                        ->get_segment(reference_segment->referenced_column_id());
+                    const auto dictionary_segment =
+                        std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(referenced_segment);
+                    if (dictionary_segment) {
+                      decompressor = dictionary_segment->attribute_vector()->create_base_decompressor();
+                      null_value_id = dictionary_segment->null_value_id();
+                      value_segment = nullptr;
+                    } else {
+                      decompressor = nullptr;
+                      value_segment = std::static_pointer_cast<const ValueSegment<ColumnDataType>>(referenced_segment);
+                    }
+                  }
+
+                  if (decompressor) {
+                    const auto value_id = static_cast<ValueID>(decompressor->get(row_id.chunk_offset));
+                    id = value_id == null_value_id ? 0u : AggregateKeyEntry{value_id} + 1u;
+                  } else if (!value_segment->is_null(row_id.chunk_offset)) {
+                    id = get_id(value_segment->get(row_id.chunk_offset));
+                  }
+                }
+
+                set_id(chunk_id, chunk_offset, id);
+                ++chunk_offset;
+              }
+              continue;
+            }
+          }
+
+          // For run-length encoded segments, each run's value is only looked up once
+          if (const auto run_length_segment =
+                  std::dynamic_pointer_cast<const RunLengthSegment<ColumnDataType>>(base_segment)) {
+            const auto& values = *run_length_segment->values();
+            const auto& null_values = *run_length_segment->null_values();
+            const auto& end_positions = *run_length_segment->end_positions();
+
+            auto run_begin = ChunkOffset{0};
+            for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+              const auto run_end = static_cast<ChunkOffset>(end_positions[run_index] + 1);
+              const auto id = null_values[run_index] ? AggregateKeyEntry{0u} : get_id(values[run_index]);
+
+              for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+                set_id(chunk_id, chunk_offset, id);
+              }
+
+              run_begin = run_end;
+            }
+            continue;
+          }
+
+          // If the chunk is ordered by the column, equal values are adjacent, so that each value is only looked up once
+          const auto ordered_by = input_table->get_chunk(chunk_id)->ordered_by();
+          const auto is_ordered = ordered_by && ordered_by->first == column_id;
 
           resolve_segment_type<ColumnDataType>(*base_segment, [&](auto& typed_segment) {
             auto iterable = create_iterable_from_segment<ColumnDataType>(typed_segment);
 
             ChunkOffset chunk_offset{0};
+            auto previous_value = std::optional<ColumnDataType>{};
+            auto previous_id = AggregateKeyEntry{0u};
             iterable.for_each([&](const auto& value) {
-              if (value.is_null()) {
-                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                  keys_per_chunk[chunk_id][chunk_offset] = 0u;
-                } else {
-                  keys_per_chunk[chunk_id][chunk_offset][group_column_index] = 0u;
-                }
-              } else {
-                auto inserted = id_map.try_emplace(value.value(), id_counter);
-                // store either the current id_counter or the existing ID of the value
-                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                  keys_per_chunk[chunk_id][chunk_offset] = inserted.first->second;
+              auto id = AggregateKeyEntry{0u};
+              if (!value.is_null()) {
+                if (is_ordered && previous_value && *previous_value == value.value()) {
+                  id = previous_id;
                 } else {
-                  keys_per_chunk[chunk_id][chunk_offset][group_column_index] = inserted.first->second;
+                  id = get_id(value.value());
+                  if (is_ordered) {
+                    previous_value = value.value();
+                    previous_id = id;
+                  }
                 }
-
-                // if the id_map didn't have the value as a key and a new element was inserted
-                if (inserted.second) ++id_counter;
               }
 
+              set_id(chunk_id, chunk_offset, id);
               ++chunk_offset;
             });
           });
@@ -440,6 +656,15 @@ void Aggregate::_aggregate() {
 
     const auto& hash_keys = keys_per_chunk[chunk_id];
 
+    /**
+     * If the chunk is ordered by a group-by column, the rows of a group follow each other. In this case, the chunk is
+     * aggregated in a streaming fashion: The result of a group is only looked up when the group key changes.
+     */
+    const auto ordered_by = chunk_in->ordered_by();
+    const auto keys_are_clustered =
+        ordered_by && std::find(_groupby_column_ids.cbegin(), _groupby_column_ids.cend(), ordered_by->first) !=
+                          _groupby_column_ids.cend();
+
     // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
     const auto input_chunk_size = chunk_in->size();
 
@@ -471,6 +696,12 @@ void Aggregate::_aggregate() {
       auto& results = *context->results;
 
       for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+        // Only the last row of a group is needed
+        if (keys_are_clustered && chunk_offset + 1 < input_chunk_size &&
+            hash_keys[chunk_offset + 1] == hash_keys[chunk_offset]) {
+          continue;
+        }
+
         results[hash_keys[chunk_offset]].row_id = RowID(chunk_id, chunk_offset);
       }
     } else {
@@ -490,10 +721,13 @@ void Aggregate::_aggregate() {
           auto& results = *context->results;
 
           // count occurrences for each group key
+          auto* hash_entry = static_cast<typename std::decay_t<decltype(results)>::mapped_type*>(nullptr);
           for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-            auto& hash_entry = results[hash_keys[chunk_offset]];
-            hash_entry.row_id = RowID(chunk_id, chunk_offset);
-            ++hash_entry.aggregate_count;
+            if (!hash_entry || !keys_are_clustered || hash_keys[chunk_offset] != hash_keys[chunk_offset - 1]) {
+              hash_entry = &results[hash_keys[chunk_offset]];
+            }
+            hash_entry->row_id = RowID(chunk_id, chunk_offset);
+            ++hash_entry->aggregate_count;
           }
 
           ++column_index;
@@ -512,28 +746,28 @@ void Aggregate::_aggregate() {
 
           switch (aggregate.function) {
             case AggregateFunction::Min:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
+              _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(
+                  chunk_id, column_index, *base_segment, keys_per_chunk, keys_are_clustered);
               break;
             case AggregateFunction::Max:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
+              _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(
+                  chunk_id, column_index, *base_segment, keys_per_chunk, keys_are_clustered);
               break;
             case AggregateFunction::Sum:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
+              _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(
+                  chunk_id, column_index, *base_segment, keys_per_chunk, keys_are_clustered);
               break;
             case AggregateFunction::Avg:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
+              _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(
+                  chunk_id, column_index, *base_segment, keys_per_chunk, keys_are_clustered);
               break;
             case AggregateFunction::Count:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(chunk_id, column_index,
-                                                                                         *base_segment, keys_per_chunk);
+              _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(
+                  chunk_id, column_index, *base_segment, keys_per_chunk, keys_are_clustered);
               break;
             case AggregateFunction::CountDistinct:
               _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, column_index, *base_segment, keys_per_chunk);
+                  chunk_id, column_index, *base_segment, keys_per_chunk, keys_are_clustered);
               break;
           }
         });
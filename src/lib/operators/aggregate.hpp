@@ -117,9 +117,10 @@ class Aggregate : public AbstractReadOnlyOperator {
 
   void _write_groupby_output(PosList& pos_list);
 
+  // If @param keys_are_clustered, the rows of a group follow each other (see Chunk::ordered_by())
   template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
   void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                          const KeysPerChunk<AggregateKey>& keys_per_chunk);
+                          const KeysPerChunk<AggregateKey>& keys_per_chunk, const bool keys_are_clustered);
 
   template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
@@ -25,6 +25,8 @@ const std::string AliasOperator::description(DescriptionMode description_mode) c
   return stream.str();
 }
 
+std::optional<size_t> AliasOperator::input_row_budget() const { return _row_budget; }
+
 std::shared_ptr<AbstractOperator> AliasOperator::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -16,6 +16,8 @@ class AliasOperator : public AbstractReadOnlyOperator {
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
 
+  std::optional<size_t> input_row_budget() const override;
+
  protected:
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
@@ -279,6 +279,12 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseDictionarySe
     // Write the dictionary size and dictionary
     export_value(context->ofstream, static_cast<ValueID>(segment.dictionary()->size()));
     export_values(context->ofstream, *segment.dictionary());
+  } else if (base_segment.encoding_type() == EncodingType::FrontCodedDictionary) {
+    const auto& segment = static_cast<const FrontCodedDictionarySegment<std::string>&>(base_segment);
+
+    // Write the dictionary size and the decoded dictionary
+    export_value(context->ofstream, static_cast<ValueID>(segment.unique_values_count()));
+    export_values(context->ofstream, *segment.dictionary());
   } else {
     const auto& segment = static_cast<const DictionarySegment<T>&>(base_segment);
 
@@ -1,13 +1,22 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 
 #include "storage/index/base_index.hpp"
+#include "storage/index/delta_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
 
 #include "utils/assert.hpp"
 
@@ -16,24 +25,44 @@ namespace opossum {
 IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator>& in, const SegmentIndexType index_type,
                      const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
                      const std::vector<AllTypeVariant>& right_values, const std::vector<AllTypeVariant>& right_values2)
+    : IndexScan{in, index_type, left_column_ids,
+                IndexKeyRange::from_predicate(predicate_condition, right_values, right_values2)} {}
+
+IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator>& in, const SegmentIndexType index_type,
+                     const std::vector<ColumnID>& left_column_ids, const std::vector<IndexKeyRange>& key_ranges)
     : AbstractReadOnlyOperator{OperatorType::IndexScan, in},
       _index_type{index_type},
       _left_column_ids{left_column_ids},
-      _predicate_condition{predicate_condition},
-      _right_values{right_values},
-      _right_values2{right_values2} {}
+      _key_ranges{key_ranges} {}
 
 const std::string IndexScan::name() const { return "IndexScan"; }
 
 void IndexScan::set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _included_chunk_ids = chunk_ids; }
 
+void IndexScan::pin_indexes(const Table& table) {
+  _pinned_indexes.clear();
+  for (const auto chunk_id : _included_chunk_ids) {
+    const auto chunk = table.get_chunk(chunk_id);
+    _pinned_indexes.emplace(chunk_id, PinnedIndexes{chunk->get_index(_index_type, _left_column_ids),
+                                                    chunk->get_delta_index(_left_column_ids)});
+  }
+}
+
+const std::vector<IndexKeyRange>& IndexScan::key_ranges() const { return _key_ranges; }
+
 std::shared_ptr<const Table> IndexScan::_on_execute() {
   _in_table = input_table_left();
 
   _validate_input();
+  _prepare_key_ranges();
 
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  if (const auto table_index = _in_table->get_table_index(_left_column_ids)) {
+    _scan_table_index(*table_index);
+    return _out_table;
+  }
+
   std::mutex output_mutex;
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -57,8 +86,10 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 std::shared_ptr<AbstractOperator> IndexScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids, _predicate_condition,
-                                     _right_values, _right_values2);
+  const auto index_scan = std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids, _key_ranges);
+  index_scan->_included_chunk_ids = _included_chunk_ids;
+  index_scan->_pinned_indexes = _pinned_indexes;
+  return index_scan;
 }
 
 void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -88,81 +119,144 @@ std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID
 }
 
 void IndexScan::_validate_input() {
-  Assert(_predicate_condition != PredicateCondition::Like, "Predicate condition not supported by index scan.");
-  Assert(_predicate_condition != PredicateCondition::NotLike, "Predicate condition not supported by index scan.");
-
-  Assert(_left_column_ids.size() == _right_values.size(),
-         "Count mismatch: left column IDs and right values don’t have same size.");
-  if (_predicate_condition == PredicateCondition::Between) {
-    Assert(_left_column_ids.size() == _right_values2.size(),
-           "Count mismatch: left column IDs and right values don’t have same size.");
+  Assert(!_left_column_ids.empty(), "IndexScan needs at least one column.");
+
+  for (const auto& key_range : _key_ranges) {
+    Assert(key_range.lower_values.size() <= _left_column_ids.size() &&
+               key_range.upper_values.size() <= _left_column_ids.size(),
+           "Count mismatch: key ranges have more values than there are left column IDs.");
   }
 
   Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
 }
 
-PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
-  const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
+void IndexScan::_prepare_key_ranges() {
+  const auto cast_to_column_types = [&](const std::vector<AllTypeVariant>& values) {
+    auto cast_values = std::vector<AllTypeVariant>(values.size());
+    for (auto value_idx = size_t{0}; value_idx < values.size(); ++value_idx) {
+      resolve_data_type(_in_table->column_data_type(_left_column_ids[value_idx]), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        cast_values[value_idx] = type_cast<ColumnDataType>(values[value_idx]);
+      });
+    }
+    return cast_values;
+  };
+
+  _sorted_key_ranges.clear();
+  _sorted_key_ranges.reserve(_key_ranges.size());
+  for (const auto& key_range : _key_ranges) {
+    if (key_range.has_null_value()) continue;
+    _sorted_key_ranges.emplace_back(IndexKeyRange{cast_to_column_types(key_range.lower_values),
+                                                  key_range.lower_inclusive,
+                                                  cast_to_column_types(key_range.upper_values),
+                                                  key_range.upper_inclusive});
+  }
+
+  // Probing the ranges in the order of their values walks through the indexes front to back. Open lower bounds first.
+  std::sort(_sorted_key_ranges.begin(), _sorted_key_ranges.end(), [](const auto& lhs, const auto& rhs) {
+    if (lhs.lower_values.empty() || rhs.lower_values.empty()) {
+      return lhs.lower_values.empty() && !rhs.lower_values.empty();
+    }
+    return lhs.lower_values < rhs.lower_values;
+  });
+}
 
-  auto range_begin = BaseIndex::Iterator{};
-  auto range_end = BaseIndex::Iterator{};
+void IndexScan::_scan_table_index(const TableIndex& table_index) {
+  auto matches_out = std::make_shared<PosList>();
+  for (const auto& key_range : _sorted_key_ranges) {
+    const auto range_matches = table_index.lookup(key_range);
+    matches_out->insert(matches_out->end(), range_matches.cbegin(), range_matches.cend());
+  }
+
+  if (!_included_chunk_ids.empty()) {
+    const auto included_chunk_ids =
+        std::unordered_set<ChunkID>{_included_chunk_ids.cbegin(), _included_chunk_ids.cend()};
+    matches_out->erase(std::remove_if(matches_out->begin(), matches_out->end(),
+                                      [&](const auto& row_id) { return !included_chunk_ids.count(row_id.chunk_id); }),
+                       matches_out->end());
+  }
 
+  // Ordering the matches by their positions removes the duplicates of overlapping ranges and groups them by chunk
+  std::sort(matches_out->begin(), matches_out->end());
+  matches_out->erase(std::unique(matches_out->begin(), matches_out->end()), matches_out->end());
+
+  Segments segments;
+  for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+    segments.push_back(std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out));
+  }
+  _out_table->append_chunk(segments);
+}
+
+PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   const auto chunk = _in_table->get_chunk_with_access_counting(chunk_id);
-  auto matches_out = PosList{};
+  auto chunk_offsets = std::vector<ChunkOffset>{};
 
-  const auto index = chunk->get_index(_index_type, _left_column_ids);
-  Assert(index != nullptr, "Index of specified type not found for segment (vector).");
+  auto index = chunk->get_index(_index_type, _left_column_ids);
+  auto delta_index = index ? nullptr : chunk->get_delta_index(_left_column_ids);
 
-  switch (_predicate_condition) {
-    case PredicateCondition::Equals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values);
-      break;
-    }
-    case PredicateCondition::NotEquals: {
-      // first, get all values less than the search value
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
-
-      matches_out.reserve(std::distance(range_begin, range_end));
-      std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
-
-      // set range for second half to all values greater than the search value
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
-      break;
-    }
-    case PredicateCondition::LessThan: {
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
-      break;
+  // The indexes were dropped after the scan was planned
+  if (!index && !delta_index) {
+    const auto pinned_indexes_iter = _pinned_indexes.find(chunk_id);
+    if (pinned_indexes_iter != _pinned_indexes.end()) {
+      index = pinned_indexes_iter->second.index;
+      delta_index = pinned_indexes_iter->second.delta_index;
     }
-    case PredicateCondition::LessThanEquals: {
-      range_begin = index->cbegin();
-      range_end = index->upper_bound(_right_values);
-      break;
-    }
-    case PredicateCondition::GreaterThan: {
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
-      break;
+  }
+
+  if (index) {
+    // Collect the positions of all ranges in the index first. The ranges are ordered by their lower bounds, but
+    // prefixes of different lengths and exclusive bounds can still lead to unordered positions.
+    auto index_ranges = std::vector<std::pair<BaseIndex::Iterator, BaseIndex::Iterator>>{};
+    index_ranges.reserve(_sorted_key_ranges.size());
+    for (const auto& key_range : _sorted_key_ranges) {
+      auto range_begin = index->cbegin();
+      if (!key_range.lower_values.empty()) {
+        range_begin = key_range.lower_inclusive ? index->lower_bound(key_range.lower_values)
+                                                : index->upper_bound(key_range.lower_values);
+      }
+
+      auto range_end = index->cend();
+      if (!key_range.upper_values.empty()) {
+        range_end = key_range.upper_inclusive ? index->upper_bound(key_range.upper_values)
+                                              : index->lower_bound(key_range.upper_values);
+      }
+
+      if (range_begin < range_end) index_ranges.emplace_back(range_begin, range_end);
     }
-    case PredicateCondition::GreaterThanEquals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->cend();
-      break;
+
+    std::sort(index_ranges.begin(), index_ranges.end());
+
+    // Overlapping parts of the ranges are only added once
+    auto covered_end = index->cbegin();
+    for (const auto& [range_begin, range_end] : index_ranges) {
+      const auto uncovered_begin = std::max(range_begin, covered_end);
+      if (uncovered_begin >= range_end) continue;
+
+      chunk_offsets.insert(chunk_offsets.end(), uncovered_begin, range_end);
+      covered_end = range_end;
     }
-    case PredicateCondition::Between: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values2);
-      break;
+
+    // The index returns the positions ordered by value. Ordering them by position makes the accesses through the
+    // ReferenceSegments sequential.
+    std::sort(chunk_offsets.begin(), chunk_offsets.end());
+  } else {
+    // Mutable chunks have no regular indexes, but may have a DeltaIndex
+    Assert(delta_index != nullptr, "Index of specified type not found for segment (vector).");
+
+    for (const auto& key_range : _sorted_key_ranges) {
+      const auto range_offsets = delta_index->lookup(key_range);
+      chunk_offsets.insert(chunk_offsets.end(), range_offsets.cbegin(), range_offsets.cend());
     }
-    default:
-      Fail("Unsupported comparison type encountered");
+
+    std::sort(chunk_offsets.begin(), chunk_offsets.end());
+    chunk_offsets.erase(std::unique(chunk_offsets.begin(), chunk_offsets.end()), chunk_offsets.end());
   }
 
-  matches_out.reserve(matches_out.size() + std::distance(range_begin, range_end));
-  std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
+  auto matches_out = PosList{};
+  matches_out.reserve(chunk_offsets.size());
+  std::transform(chunk_offsets.cbegin(), chunk_offsets.cend(), std::back_inserter(matches_out),
+                 [chunk_id](const ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; });
+  matches_out.guarantee_single_chunk();
 
   return matches_out;
 }
@@ -1,32 +1,54 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
 
 #include "abstract_read_only_operator.hpp"
 
 #include "all_type_variant.hpp"
+#include "storage/index/index_key_range.hpp"
 #include "storage/index/segment_index_type.hpp"
 #include "storage/pos_list.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
-class Table;
 class AbstractTask;
+class BaseIndex;
+class DeltaIndex;
+class Table;
+class TableIndex;
 
 /**
  * Operator that performs a predicate search using indices
  *
+ * The predicate is given as a list of key ranges on the leading columns of an index, see IndexKeyRange. This covers
+ * single comparisons, BETWEEN, IN lists (one range per value), and predicates on prefixes of composite indexes. The
+ * ranges are probed in the order of their lower bounds and the matches of overlapping ranges are only returned once.
+ * The positions in each output chunk are ordered.
+ *
+ * If the input table has a TableIndex on the columns, all chunks are searched with a single lookup per range in it.
+ * Otherwise, the index of type index_type of every chunk is searched. Mutable chunks are searched using their
+ * DeltaIndex.
+ *
  * Note: Scans only the set of chunks passed to the constructor
+ *
+ * Indexes can be dropped (e.g., by the IndexAdvisor) between the planning and the execution of a scan. Therefore, the
+ * indexes of the included chunks are pinned when the scan is planned (see pin_indexes()) and used if the chunk no
+ * longer has them. A dropped index is only freed once no plan that uses it exists anymore.
  */
 class IndexScan : public AbstractReadOnlyOperator {
   friend class LQPTranslatorTest;
 
  public:
+  // Scans for a single comparison, see IndexKeyRange::from_predicate()
   IndexScan(const std::shared_ptr<const AbstractOperator>& in, const SegmentIndexType index_type,
             const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
             const std::vector<AllTypeVariant>& right_values, const std::vector<AllTypeVariant>& right_values2 = {});
 
+  IndexScan(const std::shared_ptr<const AbstractOperator>& in, const SegmentIndexType index_type,
+            const std::vector<ColumnID>& left_column_ids, const std::vector<IndexKeyRange>& key_ranges);
+
   const std::string name() const final;
 
   /**
@@ -36,6 +58,11 @@ class IndexScan : public AbstractReadOnlyOperator {
    */
   void set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids);
 
+  // Keeps the current indexes of the included chunks of @param table alive for the lifetime of the operator
+  void pin_indexes(const Table& table);
+
+  const std::vector<IndexKeyRange>& key_ranges() const;
+
  protected:
   std::shared_ptr<const Table> _on_execute() final;
 
@@ -45,17 +72,29 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
   void _validate_input();
+
+  // Casts the values of the key ranges to the column types, removes ranges that cannot match, and orders the ranges
+  void _prepare_key_ranges();
+
   std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
   PosList _scan_chunk(const ChunkID chunk_id);
+  void _scan_table_index(const TableIndex& table_index);
 
  private:
+  struct PinnedIndexes {
+    std::shared_ptr<BaseIndex> index;
+    std::shared_ptr<DeltaIndex> delta_index;
+  };
+
   const SegmentIndexType _index_type;
   const std::vector<ColumnID> _left_column_ids;
-  const PredicateCondition _predicate_condition;
-  const std::vector<AllTypeVariant> _right_values;
-  const std::vector<AllTypeVariant> _right_values2;
+  const std::vector<IndexKeyRange> _key_ranges;
+
+  // The ranges that are probed, see _prepare_key_ranges()
+  std::vector<IndexKeyRange> _sorted_key_ranges;
 
   std::vector<ChunkID> _included_chunk_ids;
+  std::unordered_map<ChunkID, PinnedIndexes> _pinned_indexes;
 
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<Table> _out_table;
@@ -1,6 +1,7 @@
 #include "insert.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
@@ -8,7 +9,10 @@
 #include "concurrency/transaction_context.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/index/delta_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/unique_constraint_checker.hpp"
 #include "storage/value_segment.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
@@ -116,6 +120,9 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 
   auto total_rows_to_insert = static_cast<uint32_t>(input_table_left()->row_count());
 
+  // Indexes that are created concurrently must not see the allocated rows before they are written and indexed
+  const auto insert_lock = _target_table->acquire_insert_mutex();
+
   // First, allocate space for all the rows to insert. Do so while locking the table to prevent multiple threads
   // modifying the table's size simultaneously.
   auto start_index = 0u;
@@ -210,6 +217,14 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
       _inserted_rows.emplace_back(RowID{target_chunk_id, i});
     }
 
+    // The indexes also contain rows that are not committed yet. Validate filters them out.
+    for (const auto& delta_index : target_chunk->delta_indexes()) {
+      delta_index->insert(*target_chunk, start_index, start_index + current_num_rows_to_insert);
+    }
+    for (const auto& table_index : _target_table->table_indexes()) {
+      table_index->insert(*target_chunk, target_chunk_id, start_index, start_index + current_num_rows_to_insert);
+    }
+
     input_offset += current_num_rows_to_insert;
     start_index = 0u;
   }
@@ -217,6 +232,12 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
   return nullptr;
 }
 
+bool Insert::_on_can_commit_records() const {
+  // The rows are already contained in the TableIndexes backing the constraints, so inserts of the same key by
+  // concurrent transactions see each other
+  return !find_violated_unique_constraint(*_target_table, _inserted_rows, transaction_context()->transaction_id());
+}
+
 void Insert::_on_commit_records(const CommitID cid) {
   for (auto row_id : _inserted_rows) {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
@@ -228,6 +249,25 @@ void Insert::_on_commit_records(const CommitID cid) {
 }
 
 void Insert::_on_rollback_records() {
+  // The inserted rows of a chunk are consecutive. They are removed from the indexes before they become invisible,
+  // because a chunk whose rows are all visible or invisible may be compressed, which merges its delta indexes.
+  const auto insert_lock = _target_table->acquire_insert_mutex();
+  auto row_id_iter = _inserted_rows.cbegin();
+  while (row_id_iter != _inserted_rows.cend()) {
+    const auto chunk_id = row_id_iter->chunk_id;
+    const auto begin_offset = row_id_iter->chunk_offset;
+    while (row_id_iter != _inserted_rows.cend() && row_id_iter->chunk_id == chunk_id) ++row_id_iter;
+    const auto end_offset = static_cast<ChunkOffset>(std::prev(row_id_iter)->chunk_offset + 1);
+
+    const auto chunk = _target_table->get_chunk(chunk_id);
+    for (const auto& delta_index : chunk->delta_indexes()) {
+      delta_index->remove(*chunk, begin_offset, end_offset);
+    }
+    for (const auto& table_index : _target_table->table_indexes()) {
+      table_index->remove(*chunk, chunk_id, begin_offset, end_offset);
+    }
+  }
+
   for (auto row_id : _inserted_rows) {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
     // We set the begin and end cids to 0 (effectively making it invisible for everyone) so that the ChunkCompression
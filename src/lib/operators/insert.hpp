@@ -18,6 +18,8 @@ class TransactionContext;
  * the values to insert in a separate table using the same column layout.
  *
  * Assumption: The input has been validated before.
+ * The unique constraints of the target table are checked when the transaction commits. If the inserted rows violate
+ * one, the transaction is rolled back.
  * Note: Insert does not support null values at the moment
  */
 class Insert : public AbstractReadWriteOperator {
@@ -32,6 +34,7 @@ class Insert : public AbstractReadWriteOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  bool _on_can_commit_records() const override;
   void _on_commit_records(const CommitID cid) override;
   void _on_rollback_records() override;
 
@@ -20,6 +20,21 @@
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/timer.hpp"
+#include "utils/tracing/execution_trace.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The probe side's columns come first if the inputs were swapped. Semi/Anti joins only output the probe side.
+TableColumnDefinitions output_column_definitions(const Table& build_table, const Table& probe_table,
+                                                 const JoinMode mode, const bool inputs_swapped) {
+  if (!inputs_swapped) return concatenated(build_table.column_definitions(), probe_table.column_definitions());
+  if (mode == JoinMode::Semi || mode == JoinMode::Anti) return probe_table.column_definitions();
+  return concatenated(probe_table.column_definitions(), build_table.column_definitions());
+}
+
+}  // namespace
 
 namespace opossum {
 
@@ -42,6 +57,49 @@ std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
+std::optional<OperatorInputSide> JoinHash::pipelined_input_side() const {
+  switch (_mode) {
+    case JoinMode::Inner:
+    case JoinMode::Right:
+      return OperatorInputSide::Right;
+    case JoinMode::Left:
+    case JoinMode::Semi:
+    case JoinMode::Anti:
+      return OperatorInputSide::Left;
+    default:
+      return std::nullopt;
+  }
+}
+
+std::shared_ptr<Table> JoinHash::_create_output_table(const std::shared_ptr<const Table>& input_table) const {
+  const auto inputs_swapped = *pipelined_input_side() == OperatorInputSide::Left;
+  const auto build_table = inputs_swapped ? input_table_right() : input_table_left();
+  return std::make_shared<Table>(output_column_definitions(*build_table, *input_table, _mode, inputs_swapped),
+                                 TableType::References);
+}
+
+void JoinHash::_prepare_chunk_execution(const std::shared_ptr<const Table>& input_table) {
+  // Only the input_table's layout is known at this point, the build side has already been executed
+  const auto inputs_swapped = *pipelined_input_side() == OperatorInputSide::Left;
+  const auto& build_operator = inputs_swapped ? _input_right : _input_left;
+  const auto& probe_operator = inputs_swapped ? _input_left : _input_right;
+  const auto adjusted_column_ids =
+      inputs_swapped ? std::make_pair(_column_ids.second, _column_ids.first) : _column_ids;
+
+  // The probe chunks are too small to be worth partitioning, so neither is the build side
+  _impl = make_unique_by_data_types<AbstractJoinHashImpl, JoinHashImpl>(
+      build_operator->get_output()->column_data_type(adjusted_column_ids.first),
+      input_table->column_data_type(adjusted_column_ids.second), build_operator, probe_operator, _mode,
+      adjusted_column_ids, _predicate_condition, inputs_swapped, size_t{0});
+  _impl->prepare_chunk_probing();
+}
+
+std::shared_ptr<Chunk> JoinHash::_on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                                                   const std::shared_ptr<TransactionContext>& transaction_context) {
+  DebugAssert(_impl, "_prepare_chunk_execution() was not called");
+  return _impl->probe_chunk(input_table, chunk_id);
+}
+
 std::shared_ptr<const Table> JoinHash::_on_execute() {
   std::shared_ptr<const AbstractOperator> build_operator;
   std::shared_ptr<const AbstractOperator> probe_operator;
@@ -76,7 +134,7 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
   auto build_input = build_operator->get_output();
   auto probe_input = probe_operator->get_output();
 
-  _impl = make_unique_by_data_types<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
+  _impl = make_unique_by_data_types<AbstractJoinHashImpl, JoinHashImpl>(
       build_input->column_data_type(build_column_id), probe_input->column_data_type(probe_column_id), build_operator,
       probe_operator, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped, _radix_bits);
   return _impl->_on_execute();
@@ -85,7 +143,7 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 void JoinHash::_on_cleanup() { _impl.reset(); }
 
 template <typename LeftType, typename RightType>
-class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
+class JoinHash::JoinHashImpl : public AbstractJoinHashImpl {
  public:
   JoinHashImpl(const std::shared_ptr<const AbstractOperator>& left,
                const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
@@ -118,6 +176,10 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<LeftType, RightType>::HashType;
 
+  // Only used for probing single chunks, see prepare_chunk_probing()
+  std::vector<std::optional<HashTable<HashedType>>> _hashtables;
+  PosListsBySegment _build_pos_lists_by_segment;
+
   size_t _calculate_radix_bits() {
     /*
       Setting number of bits for radix clustering:
@@ -166,28 +228,11 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   }
 
   std::shared_ptr<const Table> _on_execute() override {
-    /*
-    Preparing output table by adding columns from left table.
-    */
-    TableColumnDefinitions output_column_definitions;
-
     auto right_in_table = _right->get_output();
     auto left_in_table = _left->get_output();
 
-    if (_inputs_swapped) {
-      // Semi/Anti joins are always swapped but do not need the outer relation
-      if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
-        output_column_definitions = right_in_table->column_definitions();
-      } else {
-        output_column_definitions =
-            concatenated(right_in_table->column_definitions(), left_in_table->column_definitions());
-      }
-    } else {
-      output_column_definitions =
-          concatenated(left_in_table->column_definitions(), right_in_table->column_definitions());
-    }
-
-    _output_table = std::make_shared<Table>(output_column_definitions, TableType::References);
+    _output_table = std::make_shared<Table>(
+        output_column_definitions(*left_in_table, *right_in_table, _mode, _inputs_swapped), TableType::References);
 
     /*
      * This flag is used in the materialization and probing phases.
@@ -262,12 +307,16 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
     // Pre-Probing path of left relation
     jobs.emplace_back(std::make_shared<JobTask>([&]() {
-      // materialize left table
-      materialized_left =
-          materialize_input<LeftType, HashedType>(left_in_table, _column_ids.first, histograms_left, _radix_bits);
+      {
+        // materialize left table
+        auto trace_scope = TraceScope{"Materialize left", "JoinHash"};
+        materialized_left =
+            materialize_input<LeftType, HashedType>(left_in_table, _column_ids.first, histograms_left, _radix_bits);
+      }
 
       if (_radix_bits > 0) {
         // radix partition the left table
+        auto trace_scope = TraceScope{"Partition left", "JoinHash"};
         radix_left =
             partition_radix_parallel<LeftType>(materialized_left, left_chunk_offsets, histograms_left, _radix_bits);
       } else {
@@ -276,19 +325,24 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       }
 
       // build hash tables
+      auto trace_scope = TraceScope{"Build", "JoinHash"};
       hashtables = build<LeftType, HashedType>(radix_left);
     }));
     jobs.back()->schedule();
 
     jobs.emplace_back(std::make_shared<JobTask>([&]() {
-      // Materialize right table. 'keep_nulls' makes sure that the relation on
-      // the right materializes NULL values when executing an OUTER join.
-      materialized_right = materialize_input<RightType, HashedType>(right_in_table, _column_ids.second,
-                                                                    histograms_right, _radix_bits, keep_nulls);
+      {
+        // Materialize right table. 'keep_nulls' makes sure that the relation on
+        // the right materializes NULL values when executing an OUTER join.
+        auto trace_scope = TraceScope{"Materialize right", "JoinHash"};
+        materialized_right = materialize_input<RightType, HashedType>(right_in_table, _column_ids.second,
+                                                                      histograms_right, _radix_bits, keep_nulls);
+      }
 
       if (_radix_bits > 0) {
         // radix partition the right table. 'keep_nulls' makes sure that the
         // relation on the right keeps NULL values when executing an OUTER join.
+        auto trace_scope = TraceScope{"Partition right", "JoinHash"};
         radix_right = partition_radix_parallel<RightType>(materialized_right, right_chunk_offsets, histograms_right,
                                                           _radix_bits, keep_nulls);
       } else {
@@ -318,10 +372,13 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     The workers for each radix partition P should be scheduled on the same node as the input data:
     leftP, rightP and hashtableP.
     */
-    if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
-      probe_semi_anti<RightType, HashedType>(radix_right, hashtables, right_pos_lists, _mode);
-    } else {
-      probe<RightType, HashedType>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
+    {
+      auto trace_scope = TraceScope{"Probe", "JoinHash"};
+      if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
+        probe_semi_anti<RightType, HashedType>(radix_right, hashtables, right_pos_lists, _mode);
+      } else {
+        probe<RightType, HashedType>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
+      }
     }
 
     auto only_output_right_input = _inputs_swapped && (_mode == JoinMode::Semi || _mode == JoinMode::Anti);
@@ -338,6 +395,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
      *
      * They hold one entry per column in the table, not per BaseSegment in a single chunk
      */
+    auto trace_scope = TraceScope{"Write output", "JoinHash"};
+
     PosListsBySegment left_pos_lists_by_segment;
     PosListsBySegment right_pos_lists_by_segment;
 
@@ -381,6 +440,72 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
     return _output_table;
   }
+
+  void prepare_chunk_probing() override {
+    DebugAssert(_radix_bits == 0, "Chunks are probed without radix partitioning");
+    const auto left_in_table = _left->get_output();
+
+    auto histograms = std::vector<std::vector<size_t>>{};
+    const auto materialized_left =
+        materialize_input<LeftType, HashedType>(left_in_table, _column_ids.first, histograms, _radix_bits);
+    _hashtables = build<LeftType, HashedType>(materialized_left);
+
+    if (left_in_table->type() == TableType::References && _mode != JoinMode::Semi && _mode != JoinMode::Anti) {
+      _build_pos_lists_by_segment = setup_pos_lists_by_segment(left_in_table);
+    }
+  }
+
+  std::shared_ptr<Chunk> probe_chunk(const std::shared_ptr<const Table>& probe_table,
+                                     const ChunkID chunk_id) const override {
+    // materialize_input() works on tables, so the chunk is probed as part of a single-chunk table
+    const auto chunk_table = std::make_shared<Table>(probe_table->column_definitions(), probe_table->type(),
+                                                     probe_table->max_chunk_size(), probe_table->has_mvcc());
+    chunk_table->append_chunk(probe_table->chunks()[chunk_id]);
+
+    const auto keep_nulls = (_mode == JoinMode::Left || _mode == JoinMode::Right);
+    auto histograms = std::vector<std::vector<size_t>>{};
+    const auto materialized_right = materialize_input<RightType, HashedType>(chunk_table, _column_ids.second,
+                                                                             histograms, _radix_bits, keep_nulls);
+
+    auto left_pos_lists = std::vector<PosList>(1);
+    auto right_pos_lists = std::vector<PosList>(1);
+    if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
+      probe_semi_anti<RightType, HashedType>(materialized_right, _hashtables, right_pos_lists, _mode);
+    } else {
+      probe<RightType, HashedType>(materialized_right, _hashtables, left_pos_lists, right_pos_lists, _mode);
+    }
+
+    if (right_pos_lists.front().empty()) return nullptr;
+
+    const auto left = std::make_shared<PosList>(std::move(left_pos_lists.front()));
+    const auto right = std::make_shared<PosList>(std::move(right_pos_lists.front()));
+
+    // Rows of data tables are referenced in the probe_table itself, rows of reference tables are resolved through
+    // the chunk's PosLists
+    auto right_in_table = std::shared_ptr<const Table>{chunk_table};
+    auto right_pos_lists_by_segment = PosListsBySegment{};
+    if (probe_table->type() == TableType::References) {
+      right_pos_lists_by_segment = setup_pos_lists_by_segment(chunk_table);
+    } else {
+      right_in_table = probe_table;
+      for (auto& row_id : *right) {
+        row_id.chunk_id = chunk_id;
+      }
+    }
+
+    auto output_segments = Segments{};
+    if (_inputs_swapped) {
+      write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
+      if (_mode != JoinMode::Semi && _mode != JoinMode::Anti) {
+        write_output_segments(output_segments, _left->get_output(), _build_pos_lists_by_segment, left);
+      }
+    } else {
+      write_output_segments(output_segments, _left->get_output(), _build_pos_lists_by_segment, left);
+      write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
+    }
+
+    return std::make_shared<Chunk>(output_segments);
+  }
 };
 
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -20,6 +21,10 @@ namespace opossum {
  * i.e., your sorting order might be disturbed.
  *
  * Find more information in our Wiki: https://github.com/hyrise/hyrise/wiki/Radix-Partitioned-and-Hash-Based-Join
+ *
+ * As part of an OperatorPipeline, the join consumes the chunks of its probe side one at a time (see
+ * pipelined_input_side()). The hash table of the build side is built without radix partitioning when the pipeline
+ * starts, and every probe chunk results in one output chunk.
  */
 class JoinHash : public AbstractJoinOperator {
  public:
@@ -29,15 +34,38 @@ class JoinHash : public AbstractJoinOperator {
 
   const std::string name() const override;
 
+  /**
+   * The probe side, which has to be fixed before the input is known: The outer input of LEFT and RIGHT joins, the
+   * left input of SEMI and ANTI joins (see _on_execute()), and the right input of INNER joins. FULL OUTER joins need
+   * all probe rows to find the unmatched build rows and cannot be pipelined.
+   */
+  std::optional<OperatorInputSide> pipelined_input_side() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _create_output_table(const std::shared_ptr<const Table>& input_table) const override;
+  void _prepare_chunk_execution(const std::shared_ptr<const Table>& input_table) override;
+  std::shared_ptr<Chunk> _on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                                           const std::shared_ptr<TransactionContext>& transaction_context) override;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_cleanup() override;
 
-  std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
+  class AbstractJoinHashImpl : public AbstractJoinOperatorImpl {
+   public:
+    // Builds the hash table of the build side for probing chunks with probe_chunk()
+    virtual void prepare_chunk_probing() = 0;
+
+    // Probes the chunk @param chunk_id of @param probe_table, nullptr if there are no matches
+    virtual std::shared_ptr<Chunk> probe_chunk(const std::shared_ptr<const Table>& probe_table,
+                                               const ChunkID chunk_id) const = 0;
+  };
+
+  std::unique_ptr<AbstractJoinHashImpl> _impl;
   const std::optional<size_t> _radix_bits;
 
   template <typename LeftType, typename RightType>
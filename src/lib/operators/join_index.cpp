@@ -13,6 +13,7 @@
 #include "resolve_type.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
@@ -101,53 +102,78 @@ void JoinIndex::_perform_join() {
 
   auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
 
-  // Scan all chunks for right input
-  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < _right_in_table->chunk_count(); ++chunk_id_right) {
-    const auto chunk_right = _right_in_table->get_chunk(chunk_id_right);
-    const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_right_column_id});
-    if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
+  const auto table_index = _right_in_table->get_table_index({_right_column_id});
+  if (table_index) {
+    if (track_right_matches) {
+      for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < _right_in_table->chunk_count(); ++chunk_id_right) {
+        _right_matches[chunk_id_right].resize(_right_in_table->get_chunk(chunk_id_right)->size());
+      }
+    }
+
+    for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
+      const auto segment_left = _left_in_table->get_chunk(chunk_id_left)->get_segment(_left_column_id);
 
-    std::shared_ptr<BaseIndex> index = nullptr;
+      resolve_data_and_segment_type(*segment_left, [&](auto left_type, auto& typed_left_segment) {
+        using LeftType = typename decltype(left_type)::type;
 
-    if (!indices.empty()) {
-      // We assume the first index to be efficient for our join
-      // as we do not want to spend time on evaluating the best index inside of this join loop
-      index = indices.front();
+        auto iterable_left = create_iterable_from_segment<LeftType>(typed_left_segment);
+        iterable_left.with_iterators([&](auto left_it, auto left_end) {
+          _join_segment_using_table_index(left_it, left_end, chunk_id_left, *table_index);
+        });
+      });
     }
+    performance_data.table_index_used = true;
+    performance_data.chunks_scanned_with_index = _right_in_table->chunk_count();
+  } else {
+    // Scan all chunks for right input
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < _right_in_table->chunk_count(); ++chunk_id_right) {
+      const auto chunk_right = _right_in_table->get_chunk(chunk_id_right);
+      const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_right_column_id});
+      if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
+
+      std::shared_ptr<BaseIndex> index = nullptr;
+
+      if (!indices.empty()) {
+        // We assume the first index to be efficient for our join
+        // as we do not want to spend time on evaluating the best index inside of this join loop
+        index = indices.front();
+      }
 
-    // Scan all chunks from left input
-    if (index != nullptr) {
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = _left_in_table->get_chunk(chunk_id_left)->get_segment(_left_column_id);
+      // Scan all chunks from left input
+      if (index != nullptr) {
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
+          const auto segment_left = _left_in_table->get_chunk(chunk_id_left)->get_segment(_left_column_id);
 
-        resolve_data_and_segment_type(*segment_left, [&](auto left_type, auto& typed_left_segment) {
-          using LeftType = typename decltype(left_type)::type;
+          resolve_data_and_segment_type(*segment_left, [&](auto left_type, auto& typed_left_segment) {
+            using LeftType = typename decltype(left_type)::type;
 
-          auto iterable_left = create_iterable_from_segment<LeftType>(typed_left_segment);
+            auto iterable_left = create_iterable_from_segment<LeftType>(typed_left_segment);
 
-          // utilize index for join
-          iterable_left.with_iterators([&](auto left_it, auto left_end) {
-            _join_two_segments_using_index(left_it, left_end, chunk_id_left, chunk_id_right, index);
+            // utilize index for join
+            iterable_left.with_iterators([&](auto left_it, auto left_end) {
+              _join_two_segments_using_index(left_it, left_end, chunk_id_left, chunk_id_right, index);
+            });
           });
-        });
-      }
-      performance_data.chunks_scanned_with_index++;
-    } else {
-      // Fall back to NestedLoopJoin
-      const auto segment_right = _right_in_table->get_chunk(chunk_id_right)->get_segment(_right_column_id);
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = _left_in_table->get_chunk(chunk_id_left)->get_segment(_left_column_id);
-        JoinNestedLoop::JoinParams params{*_pos_list_left,
-                                          *_pos_list_right,
-                                          _left_matches[chunk_id_left],
-                                          _right_matches[chunk_id_right],
-                                          track_left_matches,
-                                          track_right_matches,
-                                          _mode,
-                                          _predicate_condition};
-        JoinNestedLoop::_join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right, params);
+        }
+        performance_data.chunks_scanned_with_index++;
+      } else {
+        // Fall back to NestedLoopJoin
+        const auto segment_right = _right_in_table->get_chunk(chunk_id_right)->get_segment(_right_column_id);
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
+          const auto segment_left = _left_in_table->get_chunk(chunk_id_left)->get_segment(_left_column_id);
+          JoinNestedLoop::JoinParams params{*_pos_list_left,
+                                            *_pos_list_right,
+                                            _left_matches[chunk_id_left],
+                                            _right_matches[chunk_id_right],
+                                            track_left_matches,
+                                            track_right_matches,
+                                            _mode,
+                                            _predicate_condition};
+          JoinNestedLoop::_join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right,
+                                                     params);
+        }
+        performance_data.chunks_scanned_without_index++;
       }
-      performance_data.chunks_scanned_without_index++;
     }
   }
 
@@ -284,6 +310,36 @@ void JoinIndex::_join_two_segments_nested_loop(const BinaryFunctor& func, LeftIt
   }
 }
 
+// join loop that probes the TableIndex of the right input for each value of the left segment
+template <typename LeftIterator>
+void JoinIndex::_join_segment_using_table_index(LeftIterator left_it, LeftIterator left_end,
+                                                const ChunkID chunk_id_left, const TableIndex& table_index) {
+  // The index is searched for right values, the join predicate is formulated as "left <predicate> right"
+  const auto index_predicate_condition = flip_predicate_condition(_predicate_condition);
+
+  for (; left_it != left_end; ++left_it) {
+    const auto left_value = *left_it;
+    if (left_value.is_null()) continue;
+
+    const auto right_row_ids = table_index.lookup(index_predicate_condition, {left_value.value()});
+    if (right_row_ids.empty()) continue;
+
+    if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
+      _left_matches[chunk_id_left][left_value.chunk_offset()] = true;
+    }
+
+    std::fill_n(std::back_inserter(*_pos_list_left), right_row_ids.size(),
+                RowID{chunk_id_left, left_value.chunk_offset()});
+    _pos_list_right->insert(_pos_list_right->end(), right_row_ids.cbegin(), right_row_ids.cend());
+
+    if (_mode == JoinMode::Outer || _mode == JoinMode::Right) {
+      for (const auto& right_row_id : right_row_ids) {
+        _right_matches[right_row_id.chunk_id][right_row_id.chunk_offset] = true;
+      }
+    }
+  }
+}
+
 void JoinIndex::_append_matches(const BaseIndex::Iterator& range_begin, const BaseIndex::Iterator& range_end,
                                 const ChunkOffset chunk_offset_left, const ChunkID chunk_id_left,
                                 const ChunkID chunk_id_right) {
@@ -376,6 +432,7 @@ std::string JoinIndex::PerformanceData::to_string(DescriptionMode description_mo
   string += (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
   string += std::to_string(chunks_scanned_with_index) + " of " +
             std::to_string(chunks_scanned_with_index + chunks_scanned_without_index) + " chunks used an index";
+  if (table_index_used) string += " (table index)";
   return string;
 }
 
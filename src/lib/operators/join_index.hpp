@@ -12,12 +12,15 @@
 #include "types.hpp"
 
 namespace opossum {
+
+class TableIndex;
 /**
    * This operator joins two tables using one column of each table.
    * A speedup compared to the Nested Loop Join is achieved by avoiding the inner loop, and instead
    * finding the right values utilizing the index.
    *
-   * Note: An index needs to be present on the right table in order to execute an index join.
+   * Note: An index needs to be present on the right table in order to execute an index join. If the right input is a
+   *       table with a TableIndex on the join column, a single lookup per left row finds the matches of all chunks.
    * Note: Cross joins are not supported. Use the product operator instead.
    */
 class JoinIndex : public AbstractJoinOperator {
@@ -31,6 +34,7 @@ class JoinIndex : public AbstractJoinOperator {
   struct PerformanceData : public OperatorPerformanceData {
     size_t chunks_scanned_with_index{0};
     size_t chunks_scanned_without_index{0};
+    bool table_index_used{false};
 
     std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
   };
@@ -54,6 +58,10 @@ class JoinIndex : public AbstractJoinOperator {
                                       RightIterator right_begin, RightIterator right_end, const ChunkID chunk_id_left,
                                       const ChunkID chunk_id_right);
 
+  template <typename LeftIterator>
+  void _join_segment_using_table_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
+                                       const TableIndex& table_index);
+
   void _append_matches(const BaseIndex::Iterator& range_begin, const BaseIndex::Iterator& range_end,
                        const ChunkOffset chunk_offset_left, const ChunkID chunk_id_left, const ChunkID chunk_id_right);
 
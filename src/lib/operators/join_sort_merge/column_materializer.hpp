@@ -69,19 +69,32 @@ class ColumnMaterializer {
                                                                   ChunkID chunk_id, std::shared_ptr<const Table> input,
                                                                   ColumnID column_id) {
     return std::make_shared<JobTask>([this, &output, &null_rows_output, input, column_id, chunk_id] {
-      auto segment = input->get_chunk(chunk_id)->get_segment(column_id);
+      const auto chunk = input->get_chunk(chunk_id);
+      auto segment = chunk->get_segment(column_id);
+
+      // The values of a chunk that is ordered by the column are materialized in order and do not need to be sorted.
+      // Descending values only need to be reversed.
+      const auto ordered_by = chunk->ordered_by();
+      const auto is_ordered = ordered_by && ordered_by->first == column_id;
+
       resolve_segment_type<T>(*segment, [&](auto& typed_segment) {
-        (*output)[chunk_id] = _materialize_segment(typed_segment, chunk_id, null_rows_output);
+        (*output)[chunk_id] = _materialize_segment(typed_segment, chunk_id, null_rows_output, _sort && !is_ordered);
       });
+
+      if (_sort && is_ordered &&
+          (ordered_by->second == OrderByMode::Descending || ordered_by->second == OrderByMode::DescendingNullsLast)) {
+        std::reverse((*output)[chunk_id]->begin(), (*output)[chunk_id]->end());
+      }
     });
   }
 
   /**
-   * Materialization works of all types of segments
+   * Materialization works of all types of segments. The materialized values are sorted if @param sort is set.
    */
   template <typename SegmentType>
   std::shared_ptr<MaterializedSegment<T>> _materialize_segment(const SegmentType& segment, ChunkID chunk_id,
-                                                               std::unique_ptr<PosList>& null_rows_output) {
+                                                               std::unique_ptr<PosList>& null_rows_output,
+                                                               const bool sort) {
     auto output = MaterializedSegment<T>{};
     output.reserve(segment.size());
 
@@ -98,7 +111,7 @@ class ColumnMaterializer {
       }
     });
 
-    if (_sort) {
+    if (sort) {
       std::sort(output.begin(), output.end(),
                 [](const auto& left, const auto& right) { return left.value < right.value; });
     }
@@ -110,14 +123,15 @@ class ColumnMaterializer {
    * Specialization for dictionary segments
    */
   std::shared_ptr<MaterializedSegment<T>> _materialize_segment(const DictionarySegment<T>& segment, ChunkID chunk_id,
-                                                               std::unique_ptr<PosList>& null_rows_output) {
+                                                               std::unique_ptr<PosList>& null_rows_output,
+                                                               const bool sort) {
     auto output = MaterializedSegment<T>{};
     output.reserve(segment.size());
 
     auto base_attribute_vector = segment.attribute_vector();
     auto dict = segment.dictionary();
 
-    if (_sort) {
+    if (sort) {
       // Works like Bucket Sort
       // Collect for every value id, the set of rows that this value appeared in
       // value_count is used as an inverted index
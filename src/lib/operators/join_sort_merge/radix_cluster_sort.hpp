@@ -162,6 +162,44 @@ class RadixClusterSort {
     return output_table;
   }
 
+  /**
+  * Merges the runs of @param segment that are sorted in themselves, so that the whole segment is sorted. The runs are
+  * given by their end positions in @param run_ends, which starts with 0. Neighboring runs are merged pairwise until a
+  * single one is left.
+  **/
+  static void _merge_sorted_runs(MaterializedSegment<T>& segment, std::vector<size_t> run_ends) {
+    while (run_ends.size() > 2) {
+      auto merged_run_ends = std::vector<size_t>{0};
+      for (auto run_index = size_t{0}; run_index + 1 < run_ends.size(); run_index += 2) {
+        if (run_index + 2 == run_ends.size()) {
+          merged_run_ends.emplace_back(run_ends[run_index + 1]);
+          break;
+        }
+
+        std::inplace_merge(segment.begin() + run_ends[run_index], segment.begin() + run_ends[run_index + 1],
+                           segment.begin() + run_ends[run_index + 2],
+                           [](auto& left, auto& right) { return left.value < right.value; });
+        merged_run_ends.emplace_back(run_ends[run_index + 2]);
+      }
+      run_ends = std::move(merged_run_ends);
+    }
+  }
+
+  /**
+  * Merges materialized segments that are sorted in themselves into a single sorted materialized segment
+  **/
+  static std::unique_ptr<MaterializedSegmentList<T>> _merge_sorted_chunks(
+      std::unique_ptr<MaterializedSegmentList<T>>& input_chunks) {
+    auto run_ends = std::vector<size_t>{0};
+    for (const auto& chunk : *input_chunks) {
+      run_ends.emplace_back(run_ends.back() + chunk->size());
+    }
+
+    auto output_table = _concatenate_chunks(input_chunks);
+    _merge_sorted_runs(*(*output_table)[0], std::move(run_ends));
+    return output_table;
+  }
+
   /**
   * Performs the clustering on a materialized table using a clustering function that determines for each
   * value the appropriate cluster id. This is how the clustering works:
@@ -170,9 +208,12 @@ class RadixClusterSort {
   *    it will be inserting values in each cluster.
   * -> Reserve the appropriate space for each output cluster to avoid ongoing vector resizing.
   * -> At last, each value of each chunk is moved to the appropriate cluster.
+  * The entries of a chunk keep their order within each cluster. If @param cluster_run_ends is set, it receives for
+  * each cluster the end positions of the entries of each chunk (starting with 0), see _merge_sorted_runs().
   **/
   std::unique_ptr<MaterializedSegmentList<T>> _cluster(std::unique_ptr<MaterializedSegmentList<T>>& input_chunks,
-                                                       std::function<size_t(const T&)> clusterer) {
+                                                       std::function<size_t(const T&)> clusterer,
+                                                       std::vector<std::vector<size_t>>* cluster_run_ends = nullptr) {
     auto output_table = std::make_unique<MaterializedSegmentList<T>>(_cluster_count);
     TableInformation table_information(input_chunks->size(), _cluster_count);
 
@@ -230,6 +271,16 @@ class RadixClusterSort {
 
     CurrentScheduler::wait_for_tasks(cluster_jobs);
 
+    // After the entries were moved, the insert position of a chunk is the end of its entries in the cluster
+    if (cluster_run_ends) {
+      cluster_run_ends->assign(_cluster_count, std::vector<size_t>{0});
+      for (const auto& chunk_information : table_information.chunk_information) {
+        for (size_t cluster_id = 0; cluster_id < _cluster_count; ++cluster_id) {
+          (*cluster_run_ends)[cluster_id].emplace_back(chunk_information.insert_position[cluster_id]);
+        }
+      }
+    }
+
     return output_table;
   }
 
@@ -241,9 +292,11 @@ class RadixClusterSort {
   * - consolidate clusters in order to reduce skew.
   **/
   std::unique_ptr<MaterializedSegmentList<T>> _radix_cluster(
-      std::unique_ptr<MaterializedSegmentList<T>>& input_chunks) {
+      std::unique_ptr<MaterializedSegmentList<T>>& input_chunks,
+      std::vector<std::vector<size_t>>* cluster_run_ends = nullptr) {
     auto radix_bitmask = _cluster_count - 1;
-    return _cluster(input_chunks, [=](const T& value) { return get_radix<T>(value, radix_bitmask); });
+    return _cluster(
+        input_chunks, [=](const T& value) { return get_radix<T>(value, radix_bitmask); }, cluster_run_ends);
   }
 
   /**
@@ -274,8 +327,9 @@ class RadixClusterSort {
   * right table in a pair.
   **/
   std::pair<std::unique_ptr<MaterializedSegmentList<T>>, std::unique_ptr<MaterializedSegmentList<T>>> _range_cluster(
-      std::unique_ptr<MaterializedSegmentList<T>>& input_left,
-      std::unique_ptr<MaterializedSegmentList<T>>& input_right) {
+      std::unique_ptr<MaterializedSegmentList<T>>& input_left, std::unique_ptr<MaterializedSegmentList<T>>& input_right,
+      std::vector<std::vector<size_t>>* cluster_run_ends_left = nullptr,
+      std::vector<std::vector<size_t>>* cluster_run_ends_right = nullptr) {
     std::vector<std::map<T, size_t>> sample_values(_cluster_count - 1);
 
     _pick_sample_values(sample_values, input_left);
@@ -310,8 +364,8 @@ class RadixClusterSort {
       return cluster_count - 1;
     };
 
-    auto output_left = _cluster(input_left, clusterer);
-    auto output_right = _cluster(input_right, clusterer);
+    auto output_left = _cluster(input_left, clusterer, cluster_run_ends_left);
+    auto output_right = _cluster(input_right, clusterer, cluster_run_ends_right);
 
     return {std::move(output_left), std::move(output_right)};
   }
@@ -326,15 +380,33 @@ class RadixClusterSort {
   }
 
  public:
+  /**
+  * Whether all chunks of @param table are ordered by @param column_id (see Chunk::ordered_by()). If this is the case
+  * for both inputs, the chunks are not sorted again and the clusters are merged from the sorted runs of the chunks
+  * instead of being sorted.
+  **/
+  static bool is_ordered_by(const Table& table, const ColumnID column_id) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto ordered_by = table.get_chunk(chunk_id)->ordered_by();
+      if (!ordered_by || ordered_by->first != column_id) return false;
+    }
+    return true;
+  }
+
   /**
   * Executes the clustering and sorting.
   **/
   RadixClusterOutput<T> execute() {
     RadixClusterOutput<T> output;
 
-    // Sort the chunks of the input tables in the non-equi cases
-    ColumnMaterializer<T> left_column_materializer(!_equi_case, _materialize_null_left);
-    ColumnMaterializer<T> right_column_materializer(!_equi_case, _materialize_null_right);
+    const auto inputs_are_ordered =
+        is_ordered_by(*_input_table_left, _left_column_id) && is_ordered_by(*_input_table_right, _right_column_id);
+
+    // Sort the chunks of the input tables in the non-equi cases and if the sorted chunks are merged. Chunks that are
+    // ordered by the join column are not sorted again.
+    const auto chunks_are_sorted = !_equi_case || inputs_are_ordered;
+    ColumnMaterializer<T> left_column_materializer(chunks_are_sorted, _materialize_null_left);
+    ColumnMaterializer<T> right_column_materializer(chunks_are_sorted, _materialize_null_right);
     auto materialization_left = left_column_materializer.materialize(_input_table_left, _left_column_id);
     auto materialization_right = right_column_materializer.materialize(_input_table_right, _right_column_id);
     auto materialized_left_segments = std::move(materialization_left.first);
@@ -342,18 +414,39 @@ class RadixClusterSort {
     output.null_rows_left = std::move(materialization_left.second);
     output.null_rows_right = std::move(materialization_right.second);
 
+    if (inputs_are_ordered && _cluster_count == 1) {
+      output.clusters_left = _merge_sorted_chunks(materialized_left_segments);
+      output.clusters_right = _merge_sorted_chunks(materialized_right_segments);
+      return output;
+    }
+
+    // The clusters consist of the sorted runs of the chunks if these are ordered, so they only need to be merged
+    auto cluster_run_ends_left = std::vector<std::vector<size_t>>{};
+    auto cluster_run_ends_right = std::vector<std::vector<size_t>>{};
+    auto* cluster_run_ends_left_ptr = inputs_are_ordered ? &cluster_run_ends_left : nullptr;
+    auto* cluster_run_ends_right_ptr = inputs_are_ordered ? &cluster_run_ends_right : nullptr;
+
     if (_cluster_count == 1) {
       output.clusters_left = _concatenate_chunks(materialized_left_segments);
       output.clusters_right = _concatenate_chunks(materialized_right_segments);
     } else if (_equi_case) {
-      output.clusters_left = _radix_cluster(materialized_left_segments);
-      output.clusters_right = _radix_cluster(materialized_right_segments);
+      output.clusters_left = _radix_cluster(materialized_left_segments, cluster_run_ends_left_ptr);
+      output.clusters_right = _radix_cluster(materialized_right_segments, cluster_run_ends_right_ptr);
     } else {
-      auto result = _range_cluster(materialized_left_segments, materialized_right_segments);
+      auto result = _range_cluster(materialized_left_segments, materialized_right_segments, cluster_run_ends_left_ptr,
+                                   cluster_run_ends_right_ptr);
       output.clusters_left = std::move(result.first);
       output.clusters_right = std::move(result.second);
     }
 
+    if (inputs_are_ordered) {
+      for (size_t cluster_id = 0; cluster_id < _cluster_count; ++cluster_id) {
+        _merge_sorted_runs(*(*output.clusters_left)[cluster_id], cluster_run_ends_left[cluster_id]);
+        _merge_sorted_runs(*(*output.clusters_right)[cluster_id], cluster_run_ends_right[cluster_id]);
+      }
+      return output;
+    }
+
     // Sort each cluster (right now std::sort -> but maybe can be replaced with
     // an more efficient algorithm, if subparts are already sorted [InsertionSort?!])
     _sort_clusters(output.clusters_left);
@@ -2,14 +2,18 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "expression/evaluation/expression_evaluator.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/parameter_expression.hpp"
+#include "expression/value_expression.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
+#include "type_cast.hpp"
 
 namespace opossum {
 
@@ -21,6 +25,23 @@ const std::string Limit::name() const { return "Limit"; }
 
 std::shared_ptr<AbstractExpression> Limit::row_count_expression() const { return _row_count_expression; }
 
+std::optional<size_t> Limit::input_row_budget() const {
+  auto row_count = std::optional<AllTypeVariant>{};
+  if (const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(_row_count_expression)) {
+    row_count = value_expression->value;
+  } else if (const auto parameter_expression = std::dynamic_pointer_cast<ParameterExpression>(_row_count_expression)) {
+    row_count = parameter_expression->value();
+  }
+
+  // Invalid row counts are left to _on_execute() to complain about
+  if (!row_count || variant_is_null(*row_count)) return _row_budget;
+  const auto signed_row_count = type_cast<int64_t>(*row_count);
+  if (signed_row_count < 0) return _row_budget;
+
+  const auto limit_row_count = static_cast<size_t>(signed_row_count);
+  return _row_budget ? std::min(*_row_budget, limit_row_count) : limit_row_count;
+}
+
 std::shared_ptr<AbstractOperator> Limit::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -41,7 +62,8 @@ std::shared_ptr<const Table> Limit::_on_execute() {
   const auto signed_num_rows = num_rows_expression_result->value(0);
   Assert(signed_num_rows >= 0, "Can't Limit to a negative number of Rows");
 
-  const auto num_rows = static_cast<size_t>(signed_num_rows);
+  // Our consumer might need even fewer rows (see set_row_budget())
+  const auto num_rows = std::min(static_cast<size_t>(signed_num_rows), _row_budget.value_or(signed_num_rows));
 
   /**
    * Perform the actual limitting
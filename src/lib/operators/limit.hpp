@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -18,6 +19,9 @@ class Limit : public AbstractReadOnlyOperator {
 
   std::shared_ptr<AbstractExpression> row_count_expression() const;
 
+  // The row count, if it is known before execution, i.e., if it is a literal or a set value placeholder
+  std::optional<size_t> input_row_budget() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -8,10 +8,12 @@
 
 namespace opossum {
 
-CreateTable::CreateTable(const std::string& table_name, const TableColumnDefinitions& column_definitions)
+CreateTable::CreateTable(const std::string& table_name, const TableColumnDefinitions& column_definitions,
+                         const TableConstraintDefinitions& constraint_definitions)
     : AbstractReadOnlyOperator(OperatorType::CreateTable),
       table_name(table_name),
-      column_definitions(column_definitions) {}
+      column_definitions(column_definitions),
+      constraint_definitions(constraint_definitions) {}
 
 const std::string CreateTable::name() const { return "Create Table"; }
 
@@ -35,6 +37,15 @@ const std::string CreateTable::description(DescriptionMode description_mode) con
       stream << separator;
     }
   }
+  for (const auto& constraint_definition : constraint_definitions) {
+    stream << separator << (constraint_definition.is_primary_key == IsPrimaryKey::Yes ? "PRIMARY KEY" : "UNIQUE")
+           << " (";
+    for (auto column_idx = size_t{0}; column_idx < constraint_definition.column_ids.size(); ++column_idx) {
+      stream << "'" << column_definitions[constraint_definition.column_ids[column_idx]].name << "'";
+      if (column_idx + 1u < constraint_definition.column_ids.size()) stream << ", ";
+    }
+    stream << ")";
+  }
   stream << ")";
 
   return stream.str();
@@ -43,6 +54,9 @@ const std::string CreateTable::description(DescriptionMode description_mode) con
 std::shared_ptr<const Table> CreateTable::_on_execute() {
   // TODO(anybody) chunk size and mvcc not yet specifiable
   const auto table = std::make_shared<Table>(column_definitions, TableType::Data, Chunk::MAX_SIZE, UseMvcc::Yes);
+  for (const auto& constraint_definition : constraint_definitions) {
+    table->add_unique_constraint(constraint_definition.column_ids, constraint_definition.is_primary_key);
+  }
 
   StorageManager::get().add_table(table_name, table);
 
@@ -52,7 +66,7 @@ std::shared_ptr<const Table> CreateTable::_on_execute() {
 std::shared_ptr<AbstractOperator> CreateTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<CreateTable>(table_name, column_definitions);
+  return std::make_shared<CreateTable>(table_name, column_definitions, constraint_definitions);
 }
 
 void CreateTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
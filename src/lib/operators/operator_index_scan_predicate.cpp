@@ -0,0 +1,183 @@
+#include "operator_index_scan_predicate.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "expression/between_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/in_expression.hpp"
+#include "expression/list_expression.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// A predicate of the conjunction. IN lists are handled as Equals with multiple values.
+struct ColumnRestriction {
+  ColumnID column_id;
+  PredicateCondition predicate_condition;
+  std::vector<AllTypeVariant> values;
+};
+
+// Unlike flatten_logical_expressions(), this keeps the order of the predicates, which determines the column order
+void flatten_conjunction(const AbstractExpression& expression, std::vector<const AbstractExpression*>& predicates) {
+  if (const auto* logical_expression = dynamic_cast<const LogicalExpression*>(&expression)) {
+    if (logical_expression->logical_operator == LogicalOperator::And) {
+      flatten_conjunction(*logical_expression->left_operand(), predicates);
+      flatten_conjunction(*logical_expression->right_operand(), predicates);
+      return;
+    }
+  }
+  predicates.emplace_back(&expression);
+}
+
+std::optional<AllTypeVariant> resolve_value(const AbstractExpression& expression) {
+  const auto* value_expression = dynamic_cast<const ValueExpression*>(&expression);
+  if (!value_expression) return std::nullopt;
+  return value_expression->value;
+}
+
+std::optional<ColumnRestriction> resolve_column_restriction(const AbstractExpression& expression,
+                                                            const AbstractLQPNode& node) {
+  if (const auto* in_expression = dynamic_cast<const InExpression*>(&expression)) {
+    const auto column_id = node.find_column_id(*in_expression->value());
+    const auto* list_expression = dynamic_cast<const ListExpression*>(in_expression->set().get());
+    if (in_expression->is_negated() || !column_id || !list_expression) return std::nullopt;
+
+    auto values = std::vector<AllTypeVariant>{};
+    values.reserve(list_expression->elements().size());
+    for (const auto& element : list_expression->elements()) {
+      const auto value = resolve_value(*element);
+      if (!value) return std::nullopt;
+      values.emplace_back(*value);
+    }
+    return ColumnRestriction{*column_id, PredicateCondition::Equals, std::move(values)};
+  }
+
+  if (const auto* between_expression = dynamic_cast<const BetweenExpression*>(&expression)) {
+    const auto column_id = node.find_column_id(*between_expression->value());
+    const auto lower_value = resolve_value(*between_expression->lower_bound());
+    const auto upper_value = resolve_value(*between_expression->upper_bound());
+    if (!column_id || !lower_value || !upper_value) return std::nullopt;
+
+    return ColumnRestriction{*column_id, PredicateCondition::Between, {*lower_value, *upper_value}};
+  }
+
+  if (const auto* binary_predicate_expression = dynamic_cast<const BinaryPredicateExpression*>(&expression)) {
+    auto predicate_condition = binary_predicate_expression->predicate_condition;
+    if (predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike) {
+      return std::nullopt;
+    }
+
+    auto column_id = node.find_column_id(*binary_predicate_expression->left_operand());
+    auto value = resolve_value(*binary_predicate_expression->right_operand());
+    if (!column_id) {
+      column_id = node.find_column_id(*binary_predicate_expression->right_operand());
+      value = resolve_value(*binary_predicate_expression->left_operand());
+      predicate_condition = flip_predicate_condition(predicate_condition);
+    }
+    if (!column_id || !value) return std::nullopt;
+
+    return ColumnRestriction{*column_id, predicate_condition, {*value}};
+  }
+
+  return std::nullopt;
+}
+
+// Ranges of the keys that start with @param prefix and whose next value satisfies @param restriction
+void append_key_ranges(const std::vector<AllTypeVariant>& prefix, const ColumnRestriction& restriction,
+                       std::vector<IndexKeyRange>& key_ranges) {
+  const auto extend_prefix = [&](const AllTypeVariant& value) {
+    auto key = prefix;
+    key.emplace_back(value);
+    return key;
+  };
+  const auto& value = restriction.values.front();
+
+  // A bound that only consists of the prefix includes all keys that start with it (or all keys, if it is empty)
+  switch (restriction.predicate_condition) {
+    case PredicateCondition::NotEquals:
+      key_ranges.emplace_back(IndexKeyRange{prefix, true, extend_prefix(value), false});
+      key_ranges.emplace_back(IndexKeyRange{extend_prefix(value), false, prefix, true});
+      break;
+    case PredicateCondition::LessThan:
+      key_ranges.emplace_back(IndexKeyRange{prefix, true, extend_prefix(value), false});
+      break;
+    case PredicateCondition::LessThanEquals:
+      key_ranges.emplace_back(IndexKeyRange{prefix, true, extend_prefix(value), true});
+      break;
+    case PredicateCondition::GreaterThan:
+      key_ranges.emplace_back(IndexKeyRange{extend_prefix(value), false, prefix, true});
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      key_ranges.emplace_back(IndexKeyRange{extend_prefix(value), true, prefix, true});
+      break;
+    case PredicateCondition::Between:
+      key_ranges.emplace_back(IndexKeyRange{extend_prefix(value), true, extend_prefix(restriction.values[1]), true});
+      break;
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::optional<OperatorIndexScanPredicate> OperatorIndexScanPredicate::from_expression(
+    const AbstractExpression& expression, const AbstractLQPNode& node) {
+  auto predicates = std::vector<const AbstractExpression*>{};
+  flatten_conjunction(expression, predicates);
+
+  auto index_scan_predicate = OperatorIndexScanPredicate{};
+  auto& column_ids = index_scan_predicate.column_ids;
+  auto& key_ranges = index_scan_predicate.key_ranges;
+
+  // The values of the leading columns that matching keys can start with, i.e., the cross product of the values of the
+  // equality predicates so far
+  auto prefixes = std::vector<std::vector<AllTypeVariant>>{{}};
+
+  for (auto predicate_idx = size_t{0}; predicate_idx < predicates.size(); ++predicate_idx) {
+    const auto restriction = resolve_column_restriction(*predicates[predicate_idx], node);
+    if (!restriction) return std::nullopt;
+
+    if (std::find(column_ids.cbegin(), column_ids.cend(), restriction->column_id) != column_ids.cend()) {
+      return std::nullopt;
+    }
+    column_ids.emplace_back(restriction->column_id);
+
+    if (restriction->predicate_condition == PredicateCondition::Equals) {
+      auto extended_prefixes = std::vector<std::vector<AllTypeVariant>>{};
+      extended_prefixes.reserve(prefixes.size() * restriction->values.size());
+      for (const auto& prefix : prefixes) {
+        for (const auto& value : restriction->values) {
+          extended_prefixes.emplace_back(prefix);
+          extended_prefixes.back().emplace_back(value);
+        }
+      }
+      prefixes = std::move(extended_prefixes);
+      continue;
+    }
+
+    // Keys are ordered by the leading columns first, so only the last predicate can restrict its column to a range
+    if (predicate_idx + 1 != predicates.size()) return std::nullopt;
+
+    for (const auto& prefix : prefixes) {
+      append_key_ranges(prefix, *restriction, key_ranges);
+    }
+    return index_scan_predicate;
+  }
+
+  key_ranges.reserve(prefixes.size());
+  for (const auto& prefix : prefixes) {
+    key_ranges.emplace_back(IndexKeyRange::equal_to(prefix));
+  }
+  return index_scan_predicate;
+}
+
+}  // namespace opossum
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "storage/index/index_key_range.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+class AbstractLQPNode;
+
+/**
+ * Predicate representation for the IndexScan: Ranges of keys on the leading columns of an index.
+ *
+ * It is built from a conjunction of predicates, which are read from left to right, each one restricting the next
+ * column. All but the last predicate have to be equality or IN predicates, the last one may also compare the column
+ * using <, <=, >, >=, != or BETWEEN. For example, `a IN (1, 2) AND b BETWEEN 5 AND 7` is represented as the ranges
+ * [(1, 5), (1, 7)] and [(2, 5), (2, 7)] on the columns (a, b) and can be answered by an index on (a, b) or (a, b, c).
+ */
+struct OperatorIndexScanPredicate {
+  /**
+   * Try to build an OperatorIndexScanPredicate from an @param expression executed on @param node.
+   * @return std::nullopt if that fails (e.g., a predicate compares two columns or a column is restricted twice)
+   */
+  static std::optional<OperatorIndexScanPredicate> from_expression(const AbstractExpression& expression,
+                                                                   const AbstractLQPNode& node);
+
+  // The restricted columns in the order of the predicates, which has to match the leading columns of the index
+  std::vector<ColumnID> column_ids;
+  std::vector<IndexKeyRange> key_ranges;
+};
+
+}  // namespace opossum
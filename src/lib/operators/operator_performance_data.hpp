@@ -1,9 +1,11 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
+#include "utils/tracing/hardware_counters.hpp"
 
 namespace opossum {
 
@@ -14,6 +16,9 @@ struct OperatorPerformanceData : public Noncopyable {
 
   std::chrono::microseconds walltime{0};
 
+  // Summed up over all threads that executed the operator, only set if HardwareCounters::is_enabled()
+  std::optional<HardwareCounterValues> hardware_counters;
+
   virtual std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const;
 };
 
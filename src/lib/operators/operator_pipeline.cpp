@@ -0,0 +1,137 @@
+#include "operator_pipeline.hpp"
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "operators/abstract_operator.hpp"
+#include "scheduler/job_batch.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+#include "utils/tracing/execution_trace.hpp"
+#include "utils/tracing/hardware_counters.hpp"
+
+namespace opossum {
+
+OperatorPipeline::OperatorPipeline(const std::vector<std::shared_ptr<AbstractOperator>>& operators)
+    : _operators(operators) {
+  Assert(!_operators.empty(), "OperatorPipeline needs at least one operator");
+
+  for (auto operator_idx = size_t{0}; operator_idx < _operators.size(); ++operator_idx) {
+    const auto& op = _operators[operator_idx];
+    const auto input_side = op->pipelined_input_side();
+    Assert(input_side, "Operator " + op->description() + " cannot consume its input chunk by chunk");
+
+    const auto& input = *input_side == OperatorInputSide::Left ? op->input_left() : op->input_right();
+    Assert(input, "Operators in an OperatorPipeline need an input");
+    Assert(operator_idx == 0 || input == _operators[operator_idx - 1],
+           "Operators in an OperatorPipeline need to form a chain");
+  }
+}
+
+const std::vector<std::shared_ptr<AbstractOperator>>& OperatorPipeline::operators() const { return _operators; }
+
+void OperatorPipeline::execute() {
+  const auto& top_operator = _operators.back();
+  DebugAssert(!top_operator->_output, "OperatorPipeline has already been executed");
+
+  const auto& bottom_operator = _operators.front();
+  const auto input_table = *bottom_operator->pipelined_input_side() == OperatorInputSide::Left
+                               ? bottom_operator->input_table_left()
+                               : bottom_operator->input_table_right();
+  DebugAssert(input_table, "Input of the OperatorPipeline has not yet been executed");
+
+  Timer performance_timer;
+  auto trace_scope = TraceScope{"Pipeline", "Operator"};
+
+  // The counters of the whole pipeline are reported by its top operator
+  const auto hardware_counters = HardwareCounters::is_enabled() ? std::make_shared<HardwareCounters>() : nullptr;
+  auto counter_attribution = std::optional<HardwareCounters::ScopedAttribution>{};
+  if (hardware_counters) counter_attribution.emplace(hardware_counters);
+
+  // The operators of a pipeline always belong to the same query and thus to the same transaction
+  const auto transaction_context = top_operator->transaction_context();
+  if (transaction_context) {
+    // See AbstractOperator::execute()
+    if (transaction_context->aborted()) return;
+    transaction_context->on_operator_started();
+  }
+
+  // Run the (empty) input table through all operators to determine the output table's layout. The operators prepare
+  // the execution of the chunks with the same layout.
+  auto output_table = std::shared_ptr<Table>{};
+  auto stage_input_table = input_table;
+  for (const auto& op : _operators) {
+    op->_prepare_chunk_execution(stage_input_table);
+    output_table = op->_create_output_table(stage_input_table);
+    stage_input_table = output_table;
+  }
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(input_table->chunk_count());
+
+  // Once the top operator's consumer has enough rows (see AbstractOperator::set_row_budget()), no further input chunks
+  // are pushed through the pipeline
+  const auto& row_budget = top_operator->row_budget();
+  auto output_row_count = std::atomic<size_t>{0};
+
+  // Each job pushes one input chunk through all operators. The output of an intermediate operator is wrapped in a
+  // single-chunk Table that lives only as long as it is referenced by the following operators' output.
+  const auto push_chunk = [&](const size_t job_index) {
+    if (row_budget && output_row_count >= *row_budget) return;
+
+    auto chunk_input_table = input_table;
+    auto chunk_id = static_cast<ChunkID>(job_index);
+
+    for (auto operator_idx = size_t{0}; operator_idx < _operators.size(); ++operator_idx) {
+      const auto& op = _operators[operator_idx];
+
+      const auto chunk_out = op->_on_execute_chunk(chunk_input_table, chunk_id, transaction_context);
+      if (!chunk_out) return;
+
+      if (operator_idx + 1 == _operators.size()) {
+        output_chunks[job_index] = chunk_out;
+        output_row_count += chunk_out->size();
+        return;
+      }
+
+      const auto chunk_output_table = op->_create_output_table(chunk_input_table);
+      chunk_output_table->append_chunk(chunk_out);
+
+      chunk_input_table = chunk_output_table;
+      chunk_id = ChunkID{0};
+    }
+  };
+
+  JobBatch{output_chunks.size(), push_chunk}.schedule_and_wait();
+
+  for (const auto& chunk : output_chunks) {
+    if (chunk) output_table->append_chunk(chunk);
+  }
+
+  top_operator->_output = output_table;
+
+  if (transaction_context) transaction_context->on_operator_finished();
+
+  for (const auto& op : _operators) {
+    op->_on_cleanup();
+  }
+
+  top_operator->_performance_data->walltime = performance_timer.lap();
+  if (hardware_counters) {
+    counter_attribution.reset();
+    top_operator->_performance_data->hardware_counters = hardware_counters->values();
+  }
+
+  if (ExecutionTrace::current()) {
+    auto operator_descriptions = nlohmann::json::array();
+    for (const auto& op : _operators) {
+      operator_descriptions.push_back(op->description());
+    }
+    trace_scope.arguments() = {{"operators", operator_descriptions}, {"output_rows", output_table->row_count()}};
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Chunk;
+
+/**
+ * Executes a chain of operators that consume their input chunk by chunk (see
+ * AbstractOperator::pipelined_input_side()). Every chunk of the bottom operator's input is pushed through the entire
+ * chain before its result is emitted, so that e.g. a TableScan->Validate->Projection chain never materializes the full
+ * intermediate results of the TableScan and the Validate. Only the output of the top operator is materialized as a
+ * Table.
+ *
+ * Each operator consumes an output chunk of the operator below as soon as it is done. This includes the probe side of
+ * a JoinHash: The chain below the JoinHash streams its chunks into the probe, and the join's output chunks stream on
+ * into the operators above it. The build side of the JoinHash is executed before the pipeline, and its hash table is
+ * built once when the pipeline starts.
+ *
+ * The input chunks are processed in parallel and the output chunks keep the order of their input chunks. The operators
+ * below the top operator do not get an output table of their own, so they must not be consumed by any operator outside
+ * of the pipeline.
+ */
+class OperatorPipeline {
+ public:
+  /**
+   * @param operators   Ordered from bottom to top, i.e., the pipelined input of operators[n + 1] is operators[n]
+   */
+  explicit OperatorPipeline(const std::vector<std::shared_ptr<AbstractOperator>>& operators);
+
+  const std::vector<std::shared_ptr<AbstractOperator>>& operators() const;
+
+  /**
+   * Executes the pipeline and sets the output of the top operator. The pipelined input of the bottom operator and the
+   * other inputs of all operators need to have been executed before.
+   */
+  void execute();
+
+ private:
+  const std::vector<std::shared_ptr<AbstractOperator>> _operators;
+};
+
+}  // namespace opossum
@@ -36,7 +36,34 @@ void Projection::_on_set_transaction_context(const std::weak_ptr<TransactionCont
   expressions_set_transaction_context(expressions, transaction_context);
 }
 
+bool Projection::is_pipeline_breaker() const {
+  return std::any_of(expressions.begin(), expressions.end(), expression_contains_pqp_select);
+}
+
 std::shared_ptr<const Table> Projection::_on_execute() {
+  const auto output_table = _create_output_table(input_table_left());
+
+  const auto uncorrelated_select_results = ExpressionEvaluator::populate_uncorrelated_select_results_cache(expressions);
+
+  /**
+   * Perform the projection. Once the output contains the rows needed by our consumer (see set_row_budget()), the
+   * remaining chunks are skipped.
+   */
+  auto output_row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
+    if (_row_budget && output_row_count >= *_row_budget) break;
+
+    const auto output_chunk = _project_chunk(input_table_left(), chunk_id, uncorrelated_select_results);
+    output_row_count += output_chunk->size();
+    output_table->append_chunk(output_chunk);
+  }
+
+  return output_table;
+}
+
+std::optional<size_t> Projection::input_row_budget() const { return _row_budget; }
+
+std::shared_ptr<Table> Projection::_create_output_table(const std::shared_ptr<const Table>& input_table) const {
   /**
    * Determine the TableColumnDefinitions
    */
@@ -53,39 +80,43 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     return expression->type == ExpressionType::PQPColumn;
   });
 
-  const auto output_table_type = only_projects_columns ? input_table_left()->type() : TableType::Data;
-  const auto forward_columns = input_table_left()->type() == output_table_type;
+  const auto output_table_type = only_projects_columns ? input_table->type() : TableType::Data;
 
-  const auto output_table = std::make_shared<Table>(
-      column_definitions, output_table_type, input_table_left()->max_chunk_size(), input_table_left()->has_mvcc());
+  return std::make_shared<Table>(column_definitions, output_table_type, input_table->max_chunk_size(),
+                                 input_table->has_mvcc());
+}
 
-  const auto uncorrelated_select_results = ExpressionEvaluator::populate_uncorrelated_select_results_cache(expressions);
+std::shared_ptr<Chunk> Projection::_on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                                                     const std::shared_ptr<TransactionContext>& transaction_context) {
+  // There are no sub-SELECTs, otherwise the Projection would be a pipeline breaker
+  return _project_chunk(input_table, chunk_id, nullptr);
+}
 
-  /**
-   * Perform the projection
-   */
-  for (auto chunk_id = ChunkID{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
-    Segments output_segments;
-    output_segments.reserve(expressions.size());
-
-    const auto input_chunk = input_table_left()->get_chunk(chunk_id);
-
-    ExpressionEvaluator evaluator(input_table_left(), chunk_id, uncorrelated_select_results);
-    for (const auto& expression : expressions) {
-      // Forward input column if possible
-      if (expression->type == ExpressionType::PQPColumn && forward_columns) {
-        const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
-        output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
-      } else {
-        output_segments.emplace_back(evaluator.evaluate_expression_to_segment(*expression));
-      }
-    }
+std::shared_ptr<Chunk> Projection::_project_chunk(
+    const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+    const std::shared_ptr<const ExpressionEvaluator::UncorrelatedSelectResults>& uncorrelated_select_results) const {
+  const auto only_projects_columns = std::all_of(expressions.begin(), expressions.end(), [&](const auto& expression) {
+    return expression->type == ExpressionType::PQPColumn;
+  });
+  const auto forward_columns = only_projects_columns || input_table->type() == TableType::Data;
+
+  Segments output_segments;
+  output_segments.reserve(expressions.size());
+
+  const auto input_chunk = input_table->get_chunk(chunk_id);
 
-    output_table->append_chunk(output_segments);
-    output_table->get_chunk(chunk_id)->set_mvcc_data(input_chunk->mvcc_data());
+  ExpressionEvaluator evaluator(input_table, chunk_id, uncorrelated_select_results);
+  for (const auto& expression : expressions) {
+    // Forward input column if possible
+    if (expression->type == ExpressionType::PQPColumn && forward_columns) {
+      const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
+      output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
+    } else {
+      output_segments.emplace_back(evaluator.evaluate_expression_to_segment(*expression));
+    }
   }
 
-  return output_table;
+  return std::make_shared<Chunk>(output_segments, input_chunk->mvcc_data());
 }
 
 // returns the singleton dummy table used for literal projections
@@ -12,6 +12,7 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "expression/abstract_expression.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
 
 namespace opossum {
 
@@ -25,6 +26,11 @@ class Projection : public AbstractReadOnlyOperator {
 
   const std::string name() const override;
 
+  // Projections with sub-SELECTs are pipeline breakers, since uncorrelated sub-SELECTs are evaluated once per execution
+  bool is_pipeline_breaker() const override;
+
+  std::optional<size_t> input_row_budget() const override;
+
   /**
    * The dummy table is used for literal projections that have no input table.
    * This was introduce to allow queries like INSERT INTO tbl VALUES (1, 2, 3);
@@ -47,12 +53,21 @@ class Projection : public AbstractReadOnlyOperator {
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _create_output_table(const std::shared_ptr<const Table>& input_table) const override;
+  std::shared_ptr<Chunk> _on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                                           const std::shared_ptr<TransactionContext>& transaction_context) override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
 
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+
+ private:
+  std::shared_ptr<Chunk> _project_chunk(
+      const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+      const std::shared_ptr<const ExpressionEvaluator::UncorrelatedSelectResults>& uncorrelated_select_results) const;
 };
 
 }  // namespace opossum
@@ -50,8 +50,12 @@ class Sort::SortImplMaterializeOutput {
   // creates a new table with reference segments
   SortImplMaterializeOutput(const std::shared_ptr<const Table>& in,
                             const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>>& id_value_map,
-                            const size_t output_chunk_size)
-      : _table_in(in), _output_chunk_size(output_chunk_size), _row_id_value_vector(id_value_map) {}
+                            const ColumnID column_id, const OrderByMode order_by_mode, const size_t output_chunk_size)
+      : _table_in(in),
+        _column_id(column_id),
+        _order_by_mode(order_by_mode),
+        _output_chunk_size(output_chunk_size),
+        _row_id_value_vector(id_value_map) {}
 
   std::shared_ptr<const Table> execute() {
     // First we create a new table as the output
@@ -143,8 +147,11 @@ class Sort::SortImplMaterializeOutput {
       });
     }
 
+    // Each output chunk holds a range of the sorted rows, so that it is ordered by the sort column, too
     for (auto& segments : output_segments_by_chunk) {
       output->append_chunk(segments);
+      const auto chunk_id = static_cast<ChunkID>(output->chunk_count() - 1);
+      output->get_chunk(chunk_id)->set_ordered_by(std::make_pair(_column_id, _order_by_mode));
     }
 
     return output;
@@ -152,6 +159,8 @@ class Sort::SortImplMaterializeOutput {
 
  protected:
   const std::shared_ptr<const Table> _table_in;
+  const ColumnID _column_id;
+  const OrderByMode _order_by_mode;
   const size_t _output_chunk_size;
   const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
 };
@@ -198,8 +207,8 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
 
     // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
     // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
+    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(
+        _table_in, _row_id_value_vector, _column_id, _order_by_mode, _output_chunk_size);
     return materialization->execute();
   }
 
@@ -1,5 +1,7 @@
 #include "table_scan.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -16,12 +18,12 @@
 #include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/is_null_expression.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/parameter_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "operators/operator_scan_predicate.hpp"
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "scheduler/job_task.hpp"
+#include "scheduler/job_batch.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/proxy_chunk.hpp"
@@ -37,6 +39,53 @@
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_value_or_parameter(const AbstractExpression& expression) {
+  return dynamic_cast<const ValueExpression*>(&expression) || dynamic_cast<const ParameterExpression*>(&expression);
+}
+
+std::optional<ColumnID> resolve_column_id(const AbstractExpression& expression) {
+  const auto* column_expression = dynamic_cast<const PQPColumnExpression*>(&expression);
+  if (!column_expression) return std::nullopt;
+  return column_expression->column_id;
+}
+
+// The column that @param expression restricts to a value or a range of values (=, <, <=, >, >=, BETWEEN), if any
+std::optional<ColumnID> resolve_restricted_column_id(const AbstractExpression& expression) {
+  if (const auto* between_expression = dynamic_cast<const BetweenExpression*>(&expression)) {
+    if (!is_value_or_parameter(*between_expression->lower_bound()) ||
+        !is_value_or_parameter(*between_expression->upper_bound())) {
+      return std::nullopt;
+    }
+    return resolve_column_id(*between_expression->value());
+  }
+
+  if (const auto* binary_predicate_expression = dynamic_cast<const BinaryPredicateExpression*>(&expression)) {
+    switch (binary_predicate_expression->predicate_condition) {
+      case PredicateCondition::Equals:
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals:
+        break;
+      default:
+        return std::nullopt;
+    }
+
+    const auto& left_operand = *binary_predicate_expression->left_operand();
+    const auto& right_operand = *binary_predicate_expression->right_operand();
+    if (is_value_or_parameter(right_operand)) return resolve_column_id(left_operand);
+    if (is_value_or_parameter(left_operand)) return resolve_column_id(right_operand);
+  }
+
+  return std::nullopt;
+}
+
+}  // namespace
+
 namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in,
@@ -77,99 +126,165 @@ std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
   return std::make_shared<TableScan>(copied_input_left, _predicate->deep_copy());
 }
 
+bool TableScan::is_pipeline_breaker() const {
+  return !_excluded_chunk_ids.empty() || expression_contains_pqp_select(_predicate);
+}
+
+std::shared_ptr<Table> TableScan::_create_output_table(const std::shared_ptr<const Table>& input_table) const {
+  return std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+}
+
+void TableScan::_prepare_chunk_execution(const std::shared_ptr<const Table>& input_table) {
+  // The impl only depends on the columns of the input table, so one impl scans the chunks of all tables pushed through
+  // an OperatorPipeline
+  _impl = create_impl(input_table);
+  _impl_description = _impl->description();
+  _count_column_scans(*input_table);
+}
+
+std::shared_ptr<Chunk> TableScan::_on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                                                    const std::shared_ptr<TransactionContext>& transaction_context) {
+  DebugAssert(_impl, "_prepare_chunk_execution() was not called");
+  return _scan_chunk(*_impl, input_table, chunk_id);
+}
+
 std::shared_ptr<const Table> TableScan::_on_execute() {
   const auto in_table = input_table_left();
 
-  const auto output_table = std::make_shared<Table>(in_table->column_definitions(), TableType::References);
+  const auto output_table = _create_output_table(in_table);
 
   _impl = create_impl();
   _impl_description = _impl->description();
+  _count_column_scans(*in_table);
 
   std::mutex output_mutex;
 
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
+  auto chunk_ids = std::vector<ChunkID>{};
+  chunk_ids.reserve(in_table->chunk_count() - excluded_chunk_set.size());
 
   for (ChunkID chunk_id{0u}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    if (excluded_chunk_set.count(chunk_id)) continue;
+    if (!excluded_chunk_set.count(chunk_id)) chunk_ids.emplace_back(chunk_id);
+  }
+
+  // Once the output contains the rows needed by our consumer (see set_row_budget()), the remaining chunks are skipped.
+  // The chunks still being scanned at that point are completed, so the output might contain more rows than needed.
+  auto output_row_count = std::atomic<size_t>{0};
+
+  // Scanning a chunk is often cheap, so a JobBatch is used instead of one JobTask per chunk
+  const auto scan_chunk = [&](const size_t job_index) {
+    if (_row_budget && output_row_count >= *_row_budget) return;
+
+    const auto chunk_out = _scan_chunk(*_impl, in_table, chunk_ids[job_index]);
+    if (!chunk_out) return;
+
+    output_row_count += chunk_out->size();
 
-    auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
-      const auto chunk_guard = in_table->get_chunk_with_access_counting(chunk_id);
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) return;
+    std::lock_guard<std::mutex> lock(output_mutex);
+    output_table->append_chunk(chunk_out);
+  };
 
-      // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
-      // towards the original chunk.
-      Segments out_segments;
+  JobBatch{chunk_ids.size(), scan_chunk}.schedule_and_wait();
 
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference segments of the output. If it is a reference segment,
-       * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between segments as much as possible. Position lists can be shared between two segments iff
-       * (a) they point to the same table and
-       * (b) the reference segments of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (in_table->type() == TableType::References) {
-        const auto chunk_in = in_table->get_chunk(chunk_id);
+  return output_table;
+}
+
+std::shared_ptr<Chunk> TableScan::_scan_chunk(AbstractTableScanImpl& impl, const std::shared_ptr<const Table>& in_table,
+                                              ChunkID chunk_id) const {
+  const auto chunk_guard = in_table->get_chunk_with_access_counting(chunk_id);
+  // The actual scan happens in the sub classes of BaseTableScanImpl
+  const auto matches_out = impl.scan_chunk(in_table, chunk_id);
+  if (matches_out->empty()) return nullptr;
 
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+  // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
+  // towards the original chunk.
+  Segments out_segments;
 
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto segment_in = chunk_in->get_segment(column_id);
+  /**
+   * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
+   * directly use the matches to construct the reference segments of the output. If it is a reference segment,
+   * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
+   * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
+   * between segments as much as possible. Position lists can be shared between two segments iff
+   * (a) they point to the same table and
+   * (b) the reference segments of the input table point to the same positions in the same order
+   *     (i.e. they share their position list).
+   */
+  if (in_table->type() == TableType::References) {
+    const auto chunk_in = in_table->get_chunk(chunk_id);
 
-          auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
-          DebugAssert(ref_segment_in != nullptr, "All segments should be of type ReferenceSegment.");
+    auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
 
-          const auto pos_list_in = ref_segment_in->pos_list();
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto segment_in = chunk_in->get_segment(column_id);
 
-          const auto table_out = ref_segment_in->referenced_table();
-          const auto column_id_out = ref_segment_in->referenced_column_id();
+      auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
+      DebugAssert(ref_segment_in != nullptr, "All segments should be of type ReferenceSegment.");
 
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+      const auto pos_list_in = ref_segment_in->pos_list();
 
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>();
-            filtered_pos_list->reserve(matches_out->size());
+      const auto table_out = ref_segment_in->referenced_table();
+      const auto column_id_out = ref_segment_in->referenced_column_id();
 
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              filtered_pos_list->push_back(row_id);
-            }
-          }
+      auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
 
-          if (pos_list_in->references_single_chunk()) filtered_pos_list->guarantee_single_chunk();
+      if (!filtered_pos_list) {
+        filtered_pos_list = std::make_shared<PosList>();
+        filtered_pos_list->reserve(matches_out->size());
 
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
-          out_segments.push_back(ref_segment_out);
-        }
-      } else {
-        matches_out->guarantee_single_chunk();
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
-          out_segments.push_back(ref_segment_out);
+        for (const auto& match : *matches_out) {
+          const auto row_id = (*pos_list_in)[match.chunk_offset];
+          filtered_pos_list->push_back(row_id);
         }
       }
 
-      std::lock_guard<std::mutex> lock(output_mutex);
-      output_table->append_chunk(out_segments, chunk_guard->get_allocator(), chunk_guard->access_counter());
-    });
+      if (pos_list_in->references_single_chunk()) filtered_pos_list->guarantee_single_chunk();
 
-    jobs.push_back(job_task);
-    job_task->schedule();
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
+      out_segments.push_back(ref_segment_out);
+    }
+  } else {
+    matches_out->guarantee_single_chunk();
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
+      out_segments.push_back(ref_segment_out);
+    }
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  auto chunk_out =
+      std::make_shared<Chunk>(out_segments, nullptr, chunk_guard->get_allocator(), chunk_guard->access_counter());
 
-  return output_table;
+  // If the matches are in the order of the input rows, the output chunk keeps the order of the input chunk
+  const auto ordered_by = chunk_guard->ordered_by();
+  if (ordered_by && std::is_sorted(matches_out->cbegin(), matches_out->cend())) {
+    chunk_out->set_ordered_by(ordered_by);
+  }
+
+  return chunk_out;
+}
+
+void TableScan::_count_column_scans(const Table& in_table) const {
+  for (const auto& expression : flatten_logical_expressions(_predicate, LogicalOperator::And)) {
+    const auto column_id = resolve_restricted_column_id(*expression);
+    if (!column_id) continue;
+
+    if (in_table.type() == TableType::Data) {
+      in_table.increment_column_scan_count(*column_id);
+      continue;
+    }
+
+    // The references of a column point to a single table, so the first segment tells which one
+    if (in_table.chunk_count() == 0) continue;
+    const auto reference_segment =
+        std::static_pointer_cast<const ReferenceSegment>(in_table.get_chunk(ChunkID{0})->get_segment(*column_id));
+    reference_segment->referenced_table()->increment_column_scan_count(reference_segment->referenced_column_id());
+  }
 }
 
-std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
+std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const { return create_impl(input_table_left()); }
+
+std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl(const std::shared_ptr<const Table>& in_table) const {
   /**
    * Select the scanning implementation (`_impl`) to use based on the kind of the expression. For this we have to
    * closely examine the predicate expression.
@@ -210,23 +325,23 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column> LIKE <non-null value>
     if (left_column_expression && left_column_expression->data_type() == DataType::String && is_like_predicate &&
         right_value) {
-      return std::make_unique<LikeTableScanImpl>(input_table_left(), left_column_expression->column_id,
-                                                 predicate_condition, type_cast<std::string>(*right_value));
+      return std::make_unique<LikeTableScanImpl>(in_table, left_column_expression->column_id, predicate_condition,
+                                                 type_cast<std::string>(*right_value));
     }
 
     // Predicate pattern: <column> <binary predicate_condition> <non-null value>
     if (left_column_expression && right_value) {
-      return std::make_unique<SingleColumnTableScanImpl>(input_table_left(), left_column_expression->column_id,
+      return std::make_unique<SingleColumnTableScanImpl>(in_table, left_column_expression->column_id,
                                                          predicate_condition, *right_value);
     }
     if (right_column_expression && left_value) {
-      return std::make_unique<SingleColumnTableScanImpl>(input_table_left(), right_column_expression->column_id,
+      return std::make_unique<SingleColumnTableScanImpl>(in_table, right_column_expression->column_id,
                                                          flip_predicate_condition(predicate_condition), *left_value);
     }
 
     // Predicate pattern: <column> <binary predicate_condition> <column>
     if (left_column_expression && right_column_expression) {
-      return std::make_unique<ColumnComparisonTableScanImpl>(input_table_left(), left_column_expression->column_id,
+      return std::make_unique<ColumnComparisonTableScanImpl>(in_table, left_column_expression->column_id,
                                                              predicate_condition, right_column_expression->column_id);
     }
   }
@@ -235,7 +350,7 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column> IS NULL
     if (const auto left_column_expression =
             std::dynamic_pointer_cast<PQPColumnExpression>(is_null_expression->operand())) {
-      return std::make_unique<IsNullTableScanImpl>(input_table_left(), left_column_expression->column_id,
+      return std::make_unique<IsNullTableScanImpl>(in_table, left_column_expression->column_id,
                                                    is_null_expression->predicate_condition);
     }
   }
@@ -249,13 +364,13 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column> BETWEEN <value-of-type-x> AND <value-of-type-x>
     if (left_column && lower_bound_value && upper_bound_value &&
         lower_bound_value->type() == upper_bound_value->type()) {
-      return std::make_unique<BetweenTableScanImpl>(input_table_left(), left_column->column_id, *lower_bound_value,
+      return std::make_unique<BetweenTableScanImpl>(in_table, left_column->column_id, *lower_bound_value,
                                                     *upper_bound_value);
     }
   }
 
   // Predicate pattern: Everything else. Fall back to ExpressionEvaluator
-  return std::make_unique<ExpressionEvaluatorTableScanImpl>(input_table_left(), _predicate);
+  return std::make_unique<ExpressionEvaluatorTableScanImpl>(in_table, _predicate);
 }
 
 void TableScan::_on_cleanup() { _impl.reset(); }
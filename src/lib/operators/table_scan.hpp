@@ -45,14 +45,26 @@ class TableScan : public AbstractReadOnlyOperator {
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
 
+  /**
+   * Sub-SELECTs in the predicate are evaluated once per impl, and excluded chunks refer to the chunks of the complete
+   * input. In both cases, the scan cannot be executed chunk by chunk.
+   */
+  bool is_pipeline_breaker() const override;
+
   /**
    * Create the TableScanImpl based on the predicate type. Public for testing purposes.
    */
   std::unique_ptr<AbstractTableScanImpl> create_impl() const;
+  std::unique_ptr<AbstractTableScanImpl> create_impl(const std::shared_ptr<const Table>& in_table) const;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  std::shared_ptr<Table> _create_output_table(const std::shared_ptr<const Table>& input_table) const override;
+  void _prepare_chunk_execution(const std::shared_ptr<const Table>& input_table) override;
+  std::shared_ptr<Chunk> _on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                                           const std::shared_ptr<TransactionContext>& transaction_context) override;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -63,6 +75,13 @@ class TableScan : public AbstractReadOnlyOperator {
   void _on_cleanup() override;
 
  private:
+  // Scans a single chunk of @param in_table and builds the output chunk from the matches, nullptr if there are none
+  std::shared_ptr<Chunk> _scan_chunk(AbstractTableScanImpl& impl, const std::shared_ptr<const Table>& in_table,
+                                     ChunkID chunk_id) const;
+
+  // Counts the columns of the scanned table that the predicate restricts (see Table::increment_column_scan_count())
+  void _count_column_scans(const Table& in_table) const;
+
   const std::shared_ptr<AbstractExpression> _predicate;
 
   std::unique_ptr<AbstractTableScanImpl> _impl;
@@ -5,6 +5,8 @@
 
 namespace opossum {
 
+class Table;
+
 /**
  * @brief the base class of all table scan impls
  */
@@ -14,7 +16,11 @@ class AbstractTableScanImpl {
 
   virtual std::string description() const = 0;
 
-  virtual std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) = 0;
+  /**
+   * Scans the chunk @param chunk_id of @param in_table, which needs to have the same columns as the table the impl was
+   * created for. This way, one impl can scan the chunks of all tables that an OperatorPipeline pushes through a scan.
+   */
+  virtual std::shared_ptr<PosList> scan_chunk(const std::shared_ptr<const Table>& in_table, ChunkID chunk_id) = 0;
 };
 
 }  // namespace opossum
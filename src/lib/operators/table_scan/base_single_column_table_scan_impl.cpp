@@ -19,11 +19,19 @@ BaseSingleColumnTableScanImpl::BaseSingleColumnTableScanImpl(const std::shared_p
                                                              const PredicateCondition predicate_condition)
     : BaseTableScanImpl{in_table, column_id, predicate_condition} {}
 
-std::shared_ptr<PosList> BaseSingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
-  const auto chunk = _in_table->get_chunk(chunk_id);
+std::shared_ptr<PosList> BaseSingleColumnTableScanImpl::scan_chunk(const std::shared_ptr<const Table>& in_table,
+                                                                   ChunkID chunk_id) {
+  const auto chunk = in_table->get_chunk(chunk_id);
   const auto segment = chunk->get_segment(_left_column_id);
 
   auto matches_out = std::make_shared<PosList>();
+
+  const auto ordered_by = chunk->ordered_by();
+  if (ordered_by && ordered_by->first == _left_column_id &&
+      _scan_sorted_segment(segment, chunk_id, ordered_by->second, *matches_out)) {
+    return matches_out;
+  }
+
   auto context = std::make_shared<Context>(chunk_id, *matches_out);
 
   resolve_data_and_segment_type(*segment, [&](const auto data_type_t, const auto& resolved_segment) {
@@ -33,6 +41,12 @@ std::shared_ptr<PosList> BaseSingleColumnTableScanImpl::scan_chunk(ChunkID chunk
   return matches_out;
 }
 
+bool BaseSingleColumnTableScanImpl::_scan_sorted_segment(const std::shared_ptr<const BaseSegment>& segment,
+                                                         const ChunkID chunk_id, const OrderByMode order_by_mode,
+                                                         PosList& matches_out) const {
+  return false;
+}
+
 void BaseSingleColumnTableScanImpl::handle_segment(const ReferenceSegment& segment,
                                                    std::shared_ptr<SegmentVisitorContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
@@ -1,12 +1,22 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 
 #include "base_table_scan_impl.hpp"
 
 #include "storage/abstract_segment_visitor.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/pfor_delta_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
 #include "types.hpp"
 
@@ -21,13 +31,16 @@ class AttributeVectorIterable;
  *
  * Resolves reference segments. The position list of reference segments
  * is split by the referenced segments and then each is visited separately.
+ *
+ * If a chunk is ordered by the scanned column, impls can find the matching rows by binary search instead (see
+ * _scan_sorted_segment()).
  */
 class BaseSingleColumnTableScanImpl : public BaseTableScanImpl, public AbstractSegmentVisitor {
  public:
   BaseSingleColumnTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
                                 const PredicateCondition predicate_condition);
 
-  std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) override;
+  std::shared_ptr<PosList> scan_chunk(const std::shared_ptr<const Table>& in_table, ChunkID chunk_id) override;
 
   void handle_segment(const ReferenceSegment& segment, std::shared_ptr<SegmentVisitorContext> base_context) override;
 
@@ -46,6 +59,251 @@ class BaseSingleColumnTableScanImpl : public BaseTableScanImpl, public AbstractS
 
     const std::shared_ptr<const PosList> _position_filter;
   };
+
+  /**
+   * Called by scan_chunk() if the chunk is ordered by the scanned column (see Chunk::ordered_by()), which is ordered
+   * according to @param order_by_mode. Impls that support this add the matches of @param segment to @param matches_out
+   * and return true. Otherwise, false is returned and the segment is scanned as usual.
+   */
+  virtual bool _scan_sorted_segment(const std::shared_ptr<const BaseSegment>& segment, const ChunkID chunk_id,
+                                    const OrderByMode order_by_mode, PosList& matches_out) const;
+
+  /**
+   * Adds the rows of @param segment whose values lie between @param lower_value and @param upper_value to the matches.
+   * A missing bound does not restrict the values. As the values are ordered according to @param order_by_mode, the
+   * matching rows form one range of chunk offsets, which is found by binary search instead of comparing every value.
+   * If @param invert is set, the rows outside of this range (except for NULLs) are added instead.
+   */
+  template <typename T>
+  void _scan_sorted_segment_range(const std::shared_ptr<const BaseSegment>& segment, const ChunkID chunk_id,
+                                  PosList& matches_out, const OrderByMode order_by_mode,
+                                  const std::optional<T>& lower_value, const bool lower_inclusive,
+                                  const std::optional<T>& upper_value, const bool upper_inclusive,
+                                  const bool invert = false) const {
+    const auto accessor = create_segment_accessor<T>(segment);
+    const auto segment_size = static_cast<ChunkOffset>(segment->size());
+
+    // The first offset in [begin, end) for which predicate is false, given that it is true for a prefix of the range
+    const auto partition_point = [&](ChunkOffset begin, ChunkOffset end, const auto& predicate) {
+      while (begin < end) {
+        const auto middle = static_cast<ChunkOffset>(begin + (end - begin) / 2);
+        if (predicate(accessor->access(middle))) {
+          begin = static_cast<ChunkOffset>(middle + 1);
+        } else {
+          end = middle;
+        }
+      }
+      return begin;
+    };
+
+    // The NULLs are at the beginning or at the end of the segment. The remaining values are [values_begin, values_end).
+    auto values_begin = ChunkOffset{0};
+    auto values_end = segment_size;
+    if (order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending) {
+      values_begin = partition_point(values_begin, values_end, [](const auto& value) { return !value; });
+    } else {
+      values_end = partition_point(values_begin, values_end, [](const auto& value) { return value.has_value(); });
+    }
+
+    const auto is_below_lower_value = [&](const std::optional<T>& value) {
+      return lower_value && (lower_inclusive ? *value < *lower_value : *value <= *lower_value);
+    };
+    const auto is_above_upper_value = [&](const std::optional<T>& value) {
+      return upper_value && (upper_inclusive ? *upper_value < *value : *upper_value <= *value);
+    };
+
+    auto range_begin = values_begin;
+    auto range_end = values_end;
+    if (order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::AscendingNullsLast) {
+      range_begin = partition_point(values_begin, values_end, is_below_lower_value);
+      range_end = partition_point(range_begin, values_end,
+                                  [&](const auto& value) { return !is_above_upper_value(value); });
+    } else {
+      range_begin = partition_point(values_begin, values_end, is_above_upper_value);
+      range_end = partition_point(range_begin, values_end,
+                                  [&](const auto& value) { return !is_below_lower_value(value); });
+    }
+
+    const auto add_matches = [&](const ChunkOffset begin, const ChunkOffset end) {
+      for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+        matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+      }
+    };
+
+    if (invert) {
+      add_matches(values_begin, range_begin);
+      add_matches(range_end, values_end);
+    } else {
+      add_matches(range_begin, range_end);
+    }
+  }
+
+  // Result of comparing a block's minimum and maximum with the predicate
+  enum class BlockMatch { None, Some, All };
+
+  /**
+   * Scans all values of a PFORDeltaSegment. @param block_match classifies each block by its minimum and maximum, so
+   * that only blocks in which some values might match are decoded and compared using @param predicate.
+   */
+  template <typename T, typename BlockMatchFunctor, typename Predicate>
+  void _scan_pfor_delta_segment(const PFORDeltaSegment<T>& segment, const ChunkID chunk_id, PosList& matches_out,
+                                const BlockMatchFunctor& block_match, const Predicate& predicate) const {
+    static constexpr auto block_size = PFORDeltaSegment<T>::block_size;
+
+    const auto& null_values = segment.null_values();
+    const auto& blocks = segment.blocks();
+    auto values = typename PFORDeltaSegment<T>::DecodedBlock{};
+
+    for (auto block_index = size_t{0}; block_index < blocks.size(); ++block_index) {
+      const auto& block = blocks[block_index];
+
+      // Skip blocks that only contain NULLs
+      if (block.minimum > block.maximum) continue;
+
+      const auto match = block_match(block.minimum, block.maximum);
+      if (match == BlockMatch::None) continue;
+
+      const auto block_begin = static_cast<ChunkOffset>(block_index * block_size);
+      const auto block_end = static_cast<ChunkOffset>(std::min(size_t{block_begin} + block_size, segment.size()));
+
+      if (match == BlockMatch::All) {
+        for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+          if (!null_values[chunk_offset]) matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+        continue;
+      }
+
+      segment.decode_block(block_index, values);
+      for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+        if (!null_values[chunk_offset] && predicate(values[chunk_offset - block_begin])) {
+          matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+    }
+  }
+
+  /**
+   * Scans all values of a FrameOfReferenceSegment for values between @param lower_value and @param upper_value (both
+   * inclusive) or, if @param invert is set, for values outside of this range. Instead of decoding the values, the
+   * range is translated into the offset domain of each block. Blocks that cannot contain a matching value (or only
+   * matching values) are decided without looking at their offsets. The offsets of the remaining blocks are compared
+   * in a branch-free loop that the compiler can vectorize. Fixed-size byte-aligned offsets are compared in place.
+   */
+  template <typename T>
+  void _scan_frame_of_reference_segment(const FrameOfReferenceSegment<T>& segment, const ChunkID chunk_id,
+                                        PosList& matches_out, const T lower_value, const T upper_value,
+                                        const bool invert) const {
+    using UnsignedT = std::make_unsigned_t<T>;
+    static constexpr auto block_size = FrameOfReferenceSegment<T>::block_size;
+
+    DebugAssert(lower_value <= upper_value, "Expected a non-empty range");
+
+    const auto& block_minima = segment.block_minima();
+    const auto& null_values = segment.null_values();
+
+    resolve_compressed_vector_type(segment.offset_values(), [&](const auto& offset_values) {
+      using OffsetValues = std::decay_t<decltype(offset_values)>;
+      static constexpr auto is_byte_aligned = std::is_same_v<OffsetValues, FixedSizeByteAlignedVector<uint8_t>> ||
+                                              std::is_same_v<OffsetValues, FixedSizeByteAlignedVector<uint16_t>> ||
+                                              std::is_same_v<OffsetValues, FixedSizeByteAlignedVector<uint32_t>>;
+
+      // The largest offset a block can contain, so that a block's values lie between minimum and minimum + max_offset
+      auto max_offset = std::numeric_limits<uint32_t>::max();
+      if constexpr (is_byte_aligned) {
+        using OffsetType = typename std::decay_t<decltype(offset_values.data())>::value_type;
+        max_offset = std::numeric_limits<OffsetType>::max();
+      } else if constexpr (std::is_same_v<OffsetValues, BitPackedVector>) {
+        if (offset_values.bit_width() < 32u) max_offset = (uint32_t{1} << offset_values.bit_width()) - 1u;
+      }
+
+      auto offset_it = offset_values.cbegin();
+      alignas(16) auto decoded_offsets = std::array<uint32_t, block_size>{};
+      auto offset_matches = std::array<uint8_t, block_size>{};
+
+      for (auto block_index = size_t{0}; block_index < block_minima.size(); ++block_index) {
+        const auto minimum = block_minima[block_index];
+        const auto block_begin = static_cast<ChunkOffset>(block_index * block_size);
+        const auto block_end = static_cast<ChunkOffset>(std::min(size_t{block_begin} + block_size, segment.size()));
+        const auto value_count = size_t{block_end - block_begin};
+
+        // Translate the range into the block's offsets. Both distances are non-negative and thus fit into UnsignedT.
+        auto match = BlockMatch::None;
+        auto lower_offset = uint32_t{0};
+        auto upper_offset = max_offset;
+        if (upper_value >= minimum) {
+          const auto lower_distance =
+              lower_value > minimum ? static_cast<UnsignedT>(static_cast<UnsignedT>(lower_value) - minimum) : 0u;
+          const auto upper_distance = static_cast<UnsignedT>(static_cast<UnsignedT>(upper_value) - minimum);
+
+          if (lower_distance <= max_offset) {
+            lower_offset = static_cast<uint32_t>(lower_distance);
+            upper_offset = static_cast<uint32_t>(std::min(upper_distance, static_cast<UnsignedT>(max_offset)));
+            match = lower_offset == 0u && upper_offset == max_offset ? BlockMatch::All : BlockMatch::Some;
+          }
+        }
+        if (invert && match != BlockMatch::Some) match = match == BlockMatch::All ? BlockMatch::None : BlockMatch::All;
+
+        if (match != BlockMatch::Some) {
+          if constexpr (!is_byte_aligned) std::advance(offset_it, value_count);
+
+          if (match == BlockMatch::All) {
+            for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+              if (!null_values[chunk_offset]) matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+            }
+          }
+          continue;
+        }
+
+        const auto compare_offsets = [&](const auto* offsets) {
+          const auto range_width = upper_offset - lower_offset;
+          for (auto offset_idx = size_t{0}; offset_idx < value_count; ++offset_idx) {
+            const auto in_range = static_cast<uint32_t>(offsets[offset_idx]) - lower_offset <= range_width;
+            offset_matches[offset_idx] = in_range != invert;
+          }
+        };
+
+        if constexpr (is_byte_aligned) {
+          compare_offsets(offset_values.data().data() + block_begin);
+        } else {
+          for (auto offset_idx = size_t{0}; offset_idx < value_count; ++offset_idx, ++offset_it) {
+            decoded_offsets[offset_idx] = *offset_it;
+          }
+          compare_offsets(decoded_offsets.data());
+        }
+
+        for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+          if (offset_matches[chunk_offset - block_begin] && !null_values[chunk_offset]) {
+            matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+          }
+        }
+      }
+    });
+  }
+
+  /**
+   * Scans all values of a RunLengthSegment. @param predicate is evaluated once per run and all rows of a matching run
+   * are added to the matches.
+   */
+  template <typename T, typename Predicate>
+  void _scan_run_length_segment(const RunLengthSegment<T>& segment, const ChunkID chunk_id, PosList& matches_out,
+                                const Predicate& predicate) const {
+    const auto& values = *segment.values();
+    const auto& null_values = *segment.null_values();
+    const auto& end_positions = *segment.end_positions();
+
+    auto run_begin = ChunkOffset{0};
+    for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+      const auto run_end = static_cast<ChunkOffset>(end_positions[run_index] + 1);
+
+      if (!null_values[run_index] && predicate(values[run_index])) {
+        for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+          matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+
+      run_begin = run_end;
+    }
+  }
 };
 
 }  // namespace opossum
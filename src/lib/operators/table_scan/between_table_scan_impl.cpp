@@ -1,11 +1,13 @@
 #include "between_table_scan_impl.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/table.hpp"
 
@@ -59,6 +61,59 @@ void BetweenTableScanImpl::handle_segment(const BaseEncodedSegment& base_segment
 
   const auto left_column_type = _in_table->column_data_type(_left_column_id);
 
+  if (base_segment.encoding_type() == EncodingType::PFORDelta && !position_filter) {
+    resolve_data_type(left_column_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+
+      if constexpr (std::is_same_v<Type, int32_t> || std::is_same_v<Type, int64_t>) {
+        const auto& left_segment = static_cast<const PFORDeltaSegment<Type>&>(base_segment);
+        const auto left_value = type_cast<Type>(_left_value);
+        const auto right_value = type_cast<Type>(_right_value);
+
+        const auto block_match = [&](const Type minimum, const Type maximum) {
+          if (maximum < left_value || minimum > right_value) return BlockMatch::None;
+          if (minimum >= left_value && maximum <= right_value) return BlockMatch::All;
+          return BlockMatch::Some;
+        };
+
+        _scan_pfor_delta_segment(left_segment, chunk_id, matches_out, block_match,
+                                 [&](const Type value) { return value >= left_value && value <= right_value; });
+      }
+    });
+    return;
+  }
+
+  if (base_segment.encoding_type() == EncodingType::FrameOfReference && !position_filter) {
+    resolve_data_type(left_column_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+
+      if constexpr (std::is_same_v<Type, int32_t> || std::is_same_v<Type, int64_t>) {
+        const auto& left_segment = static_cast<const FrameOfReferenceSegment<Type>&>(base_segment);
+        const auto left_value = type_cast<Type>(_left_value);
+        const auto right_value = type_cast<Type>(_right_value);
+
+        if (left_value <= right_value) {
+          _scan_frame_of_reference_segment(left_segment, chunk_id, matches_out, left_value, right_value, false);
+        }
+      }
+    });
+    return;
+  }
+
+  if (base_segment.encoding_type() == EncodingType::RunLength && !position_filter) {
+    resolve_data_type(left_column_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+
+      const auto& left_segment = static_cast<const RunLengthSegment<Type>&>(base_segment);
+      const auto left_value = type_cast<Type>(_left_value);
+      const auto right_value = type_cast<Type>(_right_value);
+
+      _scan_run_length_segment(left_segment, chunk_id, matches_out,
+                               [&](const Type& value) { return value >= left_value && value <= right_value; });
+    });
+    return;
+  }
+
   resolve_data_type(left_column_type, [&](auto type) {
     using Type = typename decltype(type)::type;
 
@@ -73,6 +128,22 @@ void BetweenTableScanImpl::handle_segment(const BaseEncodedSegment& base_segment
   });
 }
 
+bool BetweenTableScanImpl::_scan_sorted_segment(const std::shared_ptr<const BaseSegment>& segment,
+                                                const ChunkID chunk_id, const OrderByMode order_by_mode,
+                                                PosList& matches_out) const {
+  if (variant_is_null(_left_value) || variant_is_null(_right_value)) return false;
+
+  resolve_data_type(_in_table->column_data_type(_left_column_id), [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    _scan_sorted_segment_range(segment, chunk_id, matches_out, order_by_mode,
+                               std::optional<Type>{type_cast<Type>(_left_value)}, true,
+                               std::optional<Type>{type_cast<Type>(_right_value)}, true);
+  });
+
+  return true;
+}
+
 void BetweenTableScanImpl::handle_segment(const BaseDictionarySegment& base_segment,
                                           std::shared_ptr<SegmentVisitorContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
@@ -20,6 +20,8 @@ class Table;
  *
  * Both of these limitations are to keep the code complexity and the number of template instantiations low,
  * more complicated cases are handled by two scans, see operator_scan_predicate.cpp
+ *
+ * For chunks that are ordered by the column, the matching rows are found by binary search.
  */
 class BetweenTableScanImpl : public BaseSingleColumnTableScanImpl {
  public:
@@ -39,6 +41,10 @@ class BetweenTableScanImpl : public BaseSingleColumnTableScanImpl {
 
   using BaseSingleColumnTableScanImpl::handle_segment;
 
+ protected:
+  bool _scan_sorted_segment(const std::shared_ptr<const BaseSegment>& segment, const ChunkID chunk_id,
+                            const OrderByMode order_by_mode, PosList& matches_out) const override;
+
  private:
   const AllTypeVariant _left_value;
   const AllTypeVariant _right_value;
@@ -23,8 +23,9 @@ ColumnComparisonTableScanImpl::ColumnComparisonTableScanImpl(const std::shared_p
 
 std::string ColumnComparisonTableScanImpl::description() const { return "ColumnComparison"; }
 
-std::shared_ptr<PosList> ColumnComparisonTableScanImpl::scan_chunk(ChunkID chunk_id) {
-  const auto chunk = _in_table->get_chunk(chunk_id);
+std::shared_ptr<PosList> ColumnComparisonTableScanImpl::scan_chunk(const std::shared_ptr<const Table>& in_table,
+                                                                   ChunkID chunk_id) {
+  const auto chunk = in_table->get_chunk(chunk_id);
 
   const auto left_segment = chunk->get_segment(_left_column_id);
   const auto right_segment = chunk->get_segment(_right_column_id);
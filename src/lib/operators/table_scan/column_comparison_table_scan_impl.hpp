@@ -29,7 +29,7 @@ class ColumnComparisonTableScanImpl : public BaseTableScanImpl {
 
   std::string description() const override;
 
-  std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) override;
+  std::shared_ptr<PosList> scan_chunk(const std::shared_ptr<const Table>& in_table, ChunkID chunk_id) override;
 
  private:
   const ColumnID _right_column_id;
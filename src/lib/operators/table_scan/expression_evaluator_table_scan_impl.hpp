@@ -19,10 +19,9 @@ class ExpressionEvaluatorTableScanImpl : public AbstractTableScanImpl {
                                    const std::shared_ptr<AbstractExpression>& expression);
 
   std::string description() const override;
-  std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) override;
+  std::shared_ptr<PosList> scan_chunk(const std::shared_ptr<const Table>& in_table, ChunkID chunk_id) override;
 
  private:
-  std::shared_ptr<const Table> _in_table;
   std::shared_ptr<AbstractExpression> _expression;
   std::shared_ptr<ExpressionEvaluator::UncorrelatedSelectResults> _uncorrelated_select_results;
 };
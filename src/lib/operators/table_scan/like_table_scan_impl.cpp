@@ -7,10 +7,12 @@
 #include <regex>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/value_segment.hpp"
@@ -21,6 +23,7 @@ namespace opossum {
 LikeTableScanImpl::LikeTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID left_column_id,
                                      const PredicateCondition predicate_condition, const std::string& pattern)
     : BaseSingleColumnTableScanImpl{in_table, left_column_id, predicate_condition},
+      _pattern{pattern},
       _matcher{pattern},
       _invert_results(predicate_condition == PredicateCondition::NotLike) {}
 
@@ -45,6 +48,37 @@ void LikeTableScanImpl::handle_segment(const BaseEncodedSegment& base_segment,
   const auto& position_filter = context->_position_filter;
   const auto chunk_id = context->_chunk_id;
 
+  if (base_segment.encoding_type() == EncodingType::FSST) {
+    const auto& left_segment = static_cast<const FSSTSegment<std::string>&>(base_segment);
+
+    if (!LikeMatcher::contains_wildcard(_pattern)) {
+      // Without wildcards, LIKE is an equality check, which we evaluate on the compressed values
+      const auto compressed_pattern = left_segment.symbol_table().compress(_pattern);
+      const auto compressed_iterable = FSSTSegmentIterable<std::string, std::string_view>{left_segment};
+      const auto matcher = [&](const std::string_view compressed_value) {
+        return (compressed_value == compressed_pattern) != _invert_results;
+      };
+
+      compressed_iterable.with_iterators(position_filter, [&](auto left_it, auto left_end) {
+        this->_unary_scan(matcher, left_it, left_end, chunk_id, matches_out);
+      });
+      return;
+    }
+
+    // Otherwise, the iterable decompresses the values into a buffer that is reused for all values
+    _scan_iterable(FSSTSegmentIterable<std::string>{left_segment}, chunk_id, matches_out, position_filter);
+    return;
+  }
+
+  if (base_segment.encoding_type() == EncodingType::RunLength && !position_filter) {
+    // Match the pattern only once per run
+    const auto& left_segment = static_cast<const RunLengthSegment<std::string>&>(base_segment);
+    _matcher.resolve(_invert_results, [&](const auto& matcher) {
+      _scan_run_length_segment(left_segment, chunk_id, matches_out, matcher);
+    });
+    return;
+  }
+
   resolve_encoded_segment_type<std::string>(base_segment, [&](const auto& typed_segment) {
     auto left_iterable = create_iterable_from_segment(typed_segment);
     _scan_iterable(left_iterable, chunk_id, matches_out, position_filter);
@@ -63,9 +97,12 @@ void LikeTableScanImpl::handle_segment(const BaseDictionarySegment& base_segment
   if (base_segment.encoding_type() == EncodingType::Dictionary) {
     const auto& left_segment = static_cast<const DictionarySegment<std::string>&>(base_segment);
     result = _find_matches_in_dictionary(*left_segment.dictionary());
-  } else {
+  } else if (base_segment.encoding_type() == EncodingType::FixedStringDictionary) {
     const auto& left_segment = static_cast<const FixedStringDictionarySegment<std::string>&>(base_segment);
     result = _find_matches_in_dictionary(*left_segment.dictionary());
+  } else {
+    const auto& left_segment = static_cast<const FrontCodedDictionarySegment<std::string>&>(base_segment);
+    result = _find_matches_in_dictionary(*left_segment.dictionary());
   }
 
   const auto& match_count = result.first;
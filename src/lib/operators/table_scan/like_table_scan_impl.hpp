@@ -25,6 +25,8 @@ class Table;
  * - For dictionary segments, we check the values in the dictionary and store the results in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For FSST segments, patterns without wildcards are compared with the compressed values
+ * - For RunLength segments, the pattern is matched once per run
  *
  * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
  *                    e.g., StartsWithPattern. 
@@ -62,6 +64,7 @@ class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
    */
   std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const pmr_vector<std::string>& dictionary);
 
+  const std::string _pattern;
   const LikeMatcher _matcher;
 
   // For NOT LIKE support
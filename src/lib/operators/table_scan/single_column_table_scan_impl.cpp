@@ -1,11 +1,17 @@
 #include "single_column_table_scan_impl.hpp"
 
+#include <limits>
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 
@@ -22,7 +28,8 @@ SingleColumnTableScanImpl::SingleColumnTableScanImpl(const std::shared_ptr<const
 
 std::string SingleColumnTableScanImpl::description() const { return "SingleColumnScan"; }
 
-std::shared_ptr<PosList> SingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
+std::shared_ptr<PosList> SingleColumnTableScanImpl::scan_chunk(const std::shared_ptr<const Table>& in_table,
+                                                               ChunkID chunk_id) {
   // early outs for specific NULL semantics
   if (variant_is_null(_right_value)) {
     /**
@@ -34,7 +41,7 @@ std::shared_ptr<PosList> SingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id)
     return std::make_shared<PosList>();
   }
 
-  return BaseSingleColumnTableScanImpl::scan_chunk(chunk_id);
+  return BaseSingleColumnTableScanImpl::scan_chunk(in_table, chunk_id);
 }
 
 void SingleColumnTableScanImpl::handle_segment(const BaseValueSegment& base_segment,
@@ -69,8 +76,122 @@ void SingleColumnTableScanImpl::handle_segment(const BaseEncodedSegment& base_se
   const auto& position_filter = context->_position_filter;
   const auto chunk_id = context->_chunk_id;
 
+  if (base_segment.encoding_type() == EncodingType::FSST &&
+      (_predicate_condition == PredicateCondition::Equals || _predicate_condition == PredicateCondition::NotEquals)) {
+    const auto& left_segment = static_cast<const FSSTSegment<std::string>&>(base_segment);
+
+    // Compare the compressed values with the compressed search value, so that no value needs to be decompressed
+    const auto compressed_right_value = left_segment.symbol_table().compress(type_cast<std::string>(_right_value));
+    const auto left_segment_iterable = FSSTSegmentIterable<std::string, std::string_view>{left_segment};
+
+    left_segment_iterable.with_iterators(position_filter, [&](auto left_it, auto left_end) {
+      with_comparator(_predicate_condition, [&](auto comparator) {
+        _unary_scan_with_value(comparator, left_it, left_end, std::string_view{compressed_right_value}, chunk_id,
+                               matches_out);
+      });
+    });
+    return;
+  }
+
   const auto left_column_type = _in_table->column_data_type(_left_column_id);
 
+  if (base_segment.encoding_type() == EncodingType::PFORDelta && !position_filter) {
+    resolve_data_type(left_column_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+
+      if constexpr (std::is_same_v<Type, int32_t> || std::is_same_v<Type, int64_t>) {
+        const auto& left_segment = static_cast<const PFORDeltaSegment<Type>&>(base_segment);
+        const auto right_value = type_cast<Type>(_right_value);
+
+        with_comparator(_predicate_condition, [&](auto comparator) {
+          const auto block_match = [&](const Type minimum, const Type maximum) {
+            if (_predicate_condition == PredicateCondition::Equals) {
+              if (right_value < minimum || right_value > maximum) return BlockMatch::None;
+              return minimum == maximum ? BlockMatch::All : BlockMatch::Some;
+            }
+
+            if (_predicate_condition == PredicateCondition::NotEquals) {
+              if (right_value < minimum || right_value > maximum) return BlockMatch::All;
+              return minimum == maximum ? BlockMatch::None : BlockMatch::Some;
+            }
+
+            // The remaining comparators are monotonic, so the extremes decide whether all or no values match
+            const auto minimum_matches = comparator(minimum, right_value);
+            const auto maximum_matches = comparator(maximum, right_value);
+            if (minimum_matches && maximum_matches) return BlockMatch::All;
+            if (!minimum_matches && !maximum_matches) return BlockMatch::None;
+            return BlockMatch::Some;
+          };
+
+          _scan_pfor_delta_segment(left_segment, chunk_id, matches_out, block_match,
+                                   [&](const Type value) { return comparator(value, right_value); });
+        });
+      }
+    });
+    return;
+  }
+
+  if (base_segment.encoding_type() == EncodingType::FrameOfReference && !position_filter) {
+    resolve_data_type(left_column_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+
+      if constexpr (std::is_same_v<Type, int32_t> || std::is_same_v<Type, int64_t>) {
+        const auto& left_segment = static_cast<const FrameOfReferenceSegment<Type>&>(base_segment);
+        const auto right_value = type_cast<Type>(_right_value);
+        constexpr auto min_value = std::numeric_limits<Type>::min();
+        constexpr auto max_value = std::numeric_limits<Type>::max();
+
+        // Each comparison is expressed as a range of matching values
+        switch (_predicate_condition) {
+          case PredicateCondition::Equals:
+            _scan_frame_of_reference_segment(left_segment, chunk_id, matches_out, right_value, right_value, false);
+            break;
+
+          case PredicateCondition::NotEquals:
+            _scan_frame_of_reference_segment(left_segment, chunk_id, matches_out, right_value, right_value, true);
+            break;
+
+          case PredicateCondition::LessThan:
+            if (right_value == min_value) break;
+            _scan_frame_of_reference_segment(left_segment, chunk_id, matches_out, min_value, right_value - 1, false);
+            break;
+
+          case PredicateCondition::LessThanEquals:
+            _scan_frame_of_reference_segment(left_segment, chunk_id, matches_out, min_value, right_value, false);
+            break;
+
+          case PredicateCondition::GreaterThan:
+            if (right_value == max_value) break;
+            _scan_frame_of_reference_segment(left_segment, chunk_id, matches_out, right_value + 1, max_value, false);
+            break;
+
+          case PredicateCondition::GreaterThanEquals:
+            _scan_frame_of_reference_segment(left_segment, chunk_id, matches_out, right_value, max_value, false);
+            break;
+
+          default:
+            Fail("Unsupported comparison type encountered");
+        }
+      }
+    });
+    return;
+  }
+
+  if (base_segment.encoding_type() == EncodingType::RunLength && !position_filter) {
+    resolve_data_type(left_column_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+
+      const auto& left_segment = static_cast<const RunLengthSegment<Type>&>(base_segment);
+      const auto right_value = type_cast<Type>(_right_value);
+
+      with_comparator(_predicate_condition, [&](auto comparator) {
+        _scan_run_length_segment(left_segment, chunk_id, matches_out,
+                                 [&](const Type& value) { return comparator(value, right_value); });
+      });
+    });
+    return;
+  }
+
   resolve_data_type(left_column_type, [&](auto type) {
     using Type = typename decltype(type)::type;
 
@@ -86,6 +207,51 @@ void SingleColumnTableScanImpl::handle_segment(const BaseEncodedSegment& base_se
   });
 }
 
+bool SingleColumnTableScanImpl::_scan_sorted_segment(const std::shared_ptr<const BaseSegment>& segment,
+                                                     const ChunkID chunk_id, const OrderByMode order_by_mode,
+                                                     PosList& matches_out) const {
+  auto is_supported = true;
+
+  resolve_data_type(_in_table->column_data_type(_left_column_id), [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    const auto value = std::optional<Type>{type_cast<Type>(_right_value)};
+    const auto unbounded = std::optional<Type>{};
+
+    // Each comparison is expressed as a range of matching values
+    switch (_predicate_condition) {
+      case PredicateCondition::Equals:
+        _scan_sorted_segment_range(segment, chunk_id, matches_out, order_by_mode, value, true, value, true);
+        break;
+
+      case PredicateCondition::NotEquals:
+        _scan_sorted_segment_range(segment, chunk_id, matches_out, order_by_mode, value, true, value, true, true);
+        break;
+
+      case PredicateCondition::LessThan:
+        _scan_sorted_segment_range(segment, chunk_id, matches_out, order_by_mode, unbounded, false, value, false);
+        break;
+
+      case PredicateCondition::LessThanEquals:
+        _scan_sorted_segment_range(segment, chunk_id, matches_out, order_by_mode, unbounded, false, value, true);
+        break;
+
+      case PredicateCondition::GreaterThan:
+        _scan_sorted_segment_range(segment, chunk_id, matches_out, order_by_mode, value, false, unbounded, false);
+        break;
+
+      case PredicateCondition::GreaterThanEquals:
+        _scan_sorted_segment_range(segment, chunk_id, matches_out, order_by_mode, value, true, unbounded, false);
+        break;
+
+      default:
+        is_supported = false;
+    }
+  });
+
+  return is_supported;
+}
+
 void SingleColumnTableScanImpl::handle_segment(const BaseDictionarySegment& base_segment,
                                                std::shared_ptr<SegmentVisitorContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
@@ -20,6 +20,12 @@ namespace opossum {
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For (not) equals on FSST segments, we compress the constant value and compare it with the compressed values
+ * - For PFORDelta segments, blocks whose minimum and maximum show that all or no values match are not decoded
+ * - For FrameOfReference segments, the constant value is translated into each block's offsets, which are then
+ *   compared without decoding them
+ * - For RunLength segments, the predicate is evaluated once per run
+ * - For chunks that are ordered by the column, the matching rows are found by binary search
  */
 class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
  public:
@@ -28,7 +34,7 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
 
   std::string description() const override;
 
-  std::shared_ptr<PosList> scan_chunk(ChunkID) override;
+  std::shared_ptr<PosList> scan_chunk(const std::shared_ptr<const Table>& in_table, ChunkID chunk_id) override;
 
   void handle_segment(const BaseValueSegment& base_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
@@ -41,6 +47,10 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
 
   using BaseSingleColumnTableScanImpl::handle_segment;
 
+ protected:
+  bool _scan_sorted_segment(const std::shared_ptr<const BaseSegment>& segment, const ChunkID chunk_id,
+                            const OrderByMode order_by_mode, PosList& matches_out) const override;
+
  private:
   /**
    * @defgroup Methods used for handling dictionary segments
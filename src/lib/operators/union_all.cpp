@@ -16,6 +16,8 @@ UnionAll::UnionAll(const std::shared_ptr<const AbstractOperator>& left_in,
 
 const std::string UnionAll::name() const { return "UnionAll"; }
 
+std::optional<size_t> UnionAll::input_row_budget() const { return _row_budget; }
+
 std::shared_ptr<const Table> UnionAll::_on_execute() {
   DebugAssert(input_table_left()->column_definitions() == input_table_right()->column_definitions(),
               "Input tables must have same number of columns");
@@ -23,10 +25,14 @@ std::shared_ptr<const Table> UnionAll::_on_execute() {
 
   auto output = std::make_shared<Table>(input_table_left()->column_definitions(), input_table_left()->type());
 
+  // Once the output contains the rows needed by our consumer (see set_row_budget()), the remaining chunks are skipped
+  auto output_row_count = size_t{0};
+
   // add positions to output by iterating over both input tables
   for (const auto& input : {input_table_left(), input_table_right()}) {
     // iterating over all chunks of table input
     for (ChunkID in_chunk_id{0}; in_chunk_id < input->chunk_count(); in_chunk_id++) {
+      if (_row_budget && output_row_count >= *_row_budget) break;
       // creating empty chunk to add segments with positions
       Segments output_segments;
 
@@ -37,6 +43,7 @@ std::shared_ptr<const Table> UnionAll::_on_execute() {
 
       // adding newly filled chunk to the output table
       output->append_chunk(output_segments);
+      output_row_count += input->get_chunk(in_chunk_id)->size();
     }
   }
 
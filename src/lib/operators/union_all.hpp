@@ -16,6 +16,9 @@ class UnionAll : public AbstractReadOnlyOperator {
            const std::shared_ptr<const AbstractOperator>& right_in);
   const std::string name() const override;
 
+  // Both inputs together need to provide at most as many rows as the UnionAll's consumer needs
+  std::optional<size_t> input_row_budget() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -47,77 +47,103 @@ std::shared_ptr<const Table> Validate::_on_execute() {
   Fail("Validate can't be called without a transaction context.");
 }
 
+bool Validate::is_pipeline_breaker() const { return false; }
+
 std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionContext> transaction_context) {
   DebugAssert(transaction_context != nullptr, "Validate requires a valid TransactionContext.");
 
   const auto in_table = input_table_left();
-  auto output = std::make_shared<Table>(in_table->column_definitions(), TableType::References);
+  auto output = _create_output_table(in_table);
+
+  // Once the output contains the rows needed by our consumer (see set_row_budget()), the remaining chunks are skipped
+  auto output_row_count = size_t{0};
+  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+    if (_row_budget && output_row_count >= *_row_budget) break;
+
+    const auto chunk_out = _on_execute_chunk(in_table, chunk_id, transaction_context);
+    if (!chunk_out) continue;
+
+    output_row_count += chunk_out->size();
+    output->append_chunk(chunk_out);
+  }
+
+  return output;
+}
+
+std::shared_ptr<Table> Validate::_create_output_table(const std::shared_ptr<const Table>& input_table) const {
+  return std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+}
+
+std::shared_ptr<Chunk> Validate::_on_execute_chunk(const std::shared_ptr<const Table>& in_table, ChunkID chunk_id,
+                                                   const std::shared_ptr<TransactionContext>& transaction_context) {
+  DebugAssert(transaction_context != nullptr, "Validate requires a valid TransactionContext.");
 
   const auto our_tid = transaction_context->transaction_id();
   const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
 
-  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    const auto chunk_in = in_table->get_chunk(chunk_id);
+  const auto chunk_in = in_table->get_chunk(chunk_id);
 
-    Segments output_segments;
-    auto pos_list_out = std::make_shared<PosList>();
-    auto referenced_table = std::shared_ptr<const Table>();
-    const auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(ColumnID{0}));
+  Segments output_segments;
+  auto pos_list_out = std::make_shared<PosList>();
+  auto referenced_table = std::shared_ptr<const Table>();
+  const auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(ColumnID{0}));
 
-    // If the segments in this chunk reference a segment, build a poslist for a reference segment.
-    if (ref_segment_in) {
-      DebugAssert(chunk_in->references_exactly_one_table(),
-                  "Input to Validate contains a Chunk referencing more than one table.");
+  // If the segments in this chunk reference a segment, build a poslist for a reference segment.
+  if (ref_segment_in) {
+    DebugAssert(chunk_in->references_exactly_one_table(),
+                "Input to Validate contains a Chunk referencing more than one table.");
 
-      // Check all rows in the old poslist and put them in pos_list_out if they are visible.
-      referenced_table = ref_segment_in->referenced_table();
-      DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC data");
+    // Check all rows in the old poslist and put them in pos_list_out if they are visible.
+    referenced_table = ref_segment_in->referenced_table();
+    DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC data");
 
-      for (auto row_id : *ref_segment_in->pos_list()) {
-        const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+    for (auto row_id : *ref_segment_in->pos_list()) {
+      const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
 
-        auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+      auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
 
-        if (is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-          pos_list_out->emplace_back(row_id);
-        }
+      if (is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
+        pos_list_out->emplace_back(row_id);
       }
+    }
 
-      // Construct the actual ReferenceSegment objects and add them to the chunk.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        const auto reference_segment =
-            std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
-        const auto referenced_column_id = reference_segment->referenced_column_id();
-        auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list_out);
-        output_segments.push_back(ref_segment_out);
-      }
+    // Construct the actual ReferenceSegment objects and add them to the chunk.
+    for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+      const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
+      const auto referenced_column_id = reference_segment->referenced_column_id();
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list_out);
+      output_segments.push_back(ref_segment_out);
+    }
 
-      // Otherwise we have a Value- or DictionarySegment and simply iterate over all rows to build a poslist.
-    } else {
-      referenced_table = in_table;
-      DebugAssert(chunk_in->has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data");
-      const auto mvcc_data = chunk_in->get_scoped_mvcc_data_lock();
-
-      // Generate pos_list_out.
-      auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-      for (auto i = 0u; i < chunk_size; i++) {
-        if (is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
-          pos_list_out->emplace_back(RowID{chunk_id, i});
-        }
-      }
+    // Otherwise we have a Value- or DictionarySegment and simply iterate over all rows to build a poslist.
+  } else {
+    referenced_table = in_table;
+    DebugAssert(chunk_in->has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data");
 
-      // Create actual ReferenceSegment objects.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list_out);
-        output_segments.push_back(ref_segment_out);
+    // None of the rows of the chunk are visible anymore, e.g., because they were moved by a TableClusteringTask
+    const auto cleanup_commit_id = chunk_in->cleanup_commit_id();
+    if (cleanup_commit_id && *cleanup_commit_id <= snapshot_commit_id) return nullptr;
+
+    const auto mvcc_data = chunk_in->get_scoped_mvcc_data_lock();
+
+    // Generate pos_list_out.
+    auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
+    for (auto i = 0u; i < chunk_size; i++) {
+      if (is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
+        pos_list_out->emplace_back(RowID{chunk_id, i});
       }
     }
 
-    if (!pos_list_out->empty() > 0) {
-      output->append_chunk(output_segments);
+    // Create actual ReferenceSegment objects.
+    for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list_out);
+      output_segments.push_back(ref_segment_out);
     }
   }
-  return output;
+
+  if (pos_list_out->empty()) return nullptr;
+
+  return std::make_shared<Chunk>(output_segments);
 }
 
 }  // namespace opossum
@@ -22,8 +22,14 @@ class Validate : public AbstractReadOnlyOperator {
 
   const std::string name() const override;
 
+  bool is_pipeline_breaker() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
+
+  std::shared_ptr<Table> _create_output_table(const std::shared_ptr<const Table>& input_table) const override;
+  std::shared_ptr<Chunk> _on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                                           const std::shared_ptr<TransactionContext>& transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
@@ -18,6 +18,7 @@
 #include "strategy/join_ordering_rule.hpp"
 #include "strategy/logical_reduction_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
+#include "strategy/redundant_aggregate_rule.hpp"
 #include "utils/performance_warning.hpp"
 
 /**
@@ -92,6 +93,9 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   final_batch.add_rule(std::make_shared<LogicalReductionRule>());
 
+  // Uses the unique constraints of the stored tables, see lqp_is_unique_on()
+  final_batch.add_rule(std::make_shared<RedundantAggregateRule>());
+
   final_batch.add_rule(std::make_shared<ColumnPruningRule>());
 
   final_batch.add_rule(std::make_shared<ExistsReformulationRule>());
@@ -4,6 +4,7 @@
 #include <iostream>
 
 #include "all_parameter_variant.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "constant_mappings.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
@@ -19,6 +20,15 @@ namespace opossum {
 std::string ChunkPruningRule::name() const { return "Chunk Pruning Rule"; }
 
 bool ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  // Chunks without visible rows are excluded even if the table is not filtered
+  if (node->type == LQPNodeType::StoredTable) {
+    auto& stored_table = static_cast<StoredTableNode&>(*node);
+    const auto table = StorageManager::get().get_table(stored_table.table_name);
+    const auto cleaned_up_chunk_ids = _compute_cleaned_up_chunk_ids(*table);
+    if (!cleaned_up_chunk_ids.empty()) _exclude_chunks(stored_table, cleaned_up_chunk_ids);
+    return false;
+  }
+
   // we only want to follow chains of predicates
   if (node->type != LQPNodeType::Predicate) {
     return _apply_to_inputs(node);
@@ -57,22 +67,12 @@ bool ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) co
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
     statistics.push_back(table->get_chunk(chunk_id)->statistics());
   }
-  std::set<ChunkID> excluded_chunk_ids;
+  auto excluded_chunk_ids = _compute_cleaned_up_chunk_ids(*table);
   for (auto& predicate : predicate_nodes) {
     auto new_exclusions = _compute_exclude_list(statistics, predicate);
     excluded_chunk_ids.insert(new_exclusions.begin(), new_exclusions.end());
   }
-
-  // wanted side effect of usings sets: excluded_chunk_ids vector is sorted
-  auto& already_excluded_chunk_ids = stored_table->excluded_chunk_ids();
-  if (!already_excluded_chunk_ids.empty()) {
-    std::vector<ChunkID> intersection;
-    std::set_intersection(already_excluded_chunk_ids.begin(), already_excluded_chunk_ids.end(),
-                          excluded_chunk_ids.begin(), excluded_chunk_ids.end(), std::back_inserter(intersection));
-    stored_table->set_excluded_chunk_ids(intersection);
-  } else {
-    stored_table->set_excluded_chunk_ids(std::vector<ChunkID>(excluded_chunk_ids.begin(), excluded_chunk_ids.end()));
-  }
+  _exclude_chunks(*stored_table, excluded_chunk_ids);
 
   // always returns false as we never modify the LQP
   return false;
@@ -105,4 +105,32 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
   return result;
 }
 
+std::set<ChunkID> ChunkPruningRule::_compute_cleaned_up_chunk_ids(const Table& table) const {
+  // The plan is only executed by transactions that are active or not yet started. Both have a snapshot commit id at
+  // least as large as this one. Cleanup commit ids are never reset, so cached plans stay correct.
+  const auto snapshot_commit_id = TransactionManager::get().lowest_active_snapshot_commit_id();
+
+  std::set<ChunkID> result;
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto cleanup_commit_id = table.get_chunk(chunk_id)->cleanup_commit_id();
+    if (cleanup_commit_id && *cleanup_commit_id <= snapshot_commit_id) result.insert(chunk_id);
+  }
+  return result;
+}
+
+void ChunkPruningRule::_exclude_chunks(StoredTableNode& stored_table_node,
+                                       const std::set<ChunkID>& excluded_chunk_ids) const {
+  // wanted side effect of usings sets: excluded_chunk_ids vector is sorted
+  auto& already_excluded_chunk_ids = stored_table_node.excluded_chunk_ids();
+  if (!already_excluded_chunk_ids.empty()) {
+    std::vector<ChunkID> intersection;
+    std::set_intersection(already_excluded_chunk_ids.begin(), already_excluded_chunk_ids.end(),
+                          excluded_chunk_ids.begin(), excluded_chunk_ids.end(), std::back_inserter(intersection));
+    stored_table_node.set_excluded_chunk_ids(intersection);
+  } else {
+    stored_table_node.set_excluded_chunk_ids(
+        std::vector<ChunkID>(excluded_chunk_ids.begin(), excluded_chunk_ids.end()));
+  }
+}
+
 }  // namespace opossum
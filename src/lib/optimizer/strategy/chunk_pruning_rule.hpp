@@ -14,11 +14,17 @@ namespace opossum {
 class AbstractLQPNode;
 class ChunkStatistics;
 class PredicateNode;
+class StoredTableNode;
+class Table;
 
 /**
  * This rule determines which chunks can be excluded from table scans based on
  * the predicates present in the LQP and stores that information in the stored
  * table nodes.
+ *
+ * Chunks none of whose rows are visible to the transactions that may execute the plan are always excluded, i.e., the
+ * chunks that were cleaned up (see Chunk::cleanup_commit_id()) before the lowest snapshot commit id of the active
+ * transactions. This includes the chunks that a TableClusteringTask moved the rows out of.
  */
 class ChunkPruningRule : public AbstractRule {
  public:
@@ -28,6 +34,12 @@ class ChunkPruningRule : public AbstractRule {
  protected:
   std::set<ChunkID> _compute_exclude_list(const std::vector<std::shared_ptr<ChunkStatistics>>& statistics,
                                           const std::shared_ptr<PredicateNode>& predicate_node) const;
+
+  std::set<ChunkID> _compute_cleaned_up_chunk_ids(const Table& table) const;
+
+  // Excludes @param excluded_chunk_ids from the chunks read by @param stored_table_node. If other paths leading to the
+  // node excluded chunks before, only the chunks excluded by all paths are.
+  void _exclude_chunks(StoredTableNode& stored_table_node, const std::set<ChunkID>& excluded_chunk_ids) const;
 };
 
 }  // namespace opossum
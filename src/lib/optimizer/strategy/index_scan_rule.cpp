@@ -8,78 +8,187 @@
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
+#include "expression/list_expression.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/value_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
-#include "operators/operator_scan_predicate.hpp"
+#include "operators/operator_index_scan_predicate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
-namespace opossum {
-
-// Only if we expect num_output_rows <= num_input_rows * selectivity_threshold, the ScanType can be set to IndexScan.
-// This value is kind of arbitrarily chosen, but the following paper suggests something similar:
-// Access Path Selection in Main-Memory Optimized Data Systems: Should I Scan or Should I Probe?
-constexpr float INDEX_SCAN_SELECTIVITY_THRESHOLD = 0.01f;
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// A PredicateNode that restricts a single column in a way that an index can answer
+struct IndexPredicateCandidate {
+  std::shared_ptr<PredicateNode> predicate_node;
+  ColumnID column_id;
+
+  // Equality and IN predicates restrict the column to single values and can be followed by predicates on the next
+  // columns of a composite index
+  bool is_point_predicate;
+};
+
+/**
+ * @return The candidates that an index on @param index_column_ids can answer, in the order of the index columns:
+ *         Point predicates on the leading columns, optionally followed by one other predicate on the next column
+ */
+std::vector<std::shared_ptr<PredicateNode>> select_index_predicates(
+    const std::vector<ColumnID>& index_column_ids, const std::vector<IndexPredicateCandidate>& candidates) {
+  auto selected_predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+
+  for (const auto column_id : index_column_ids) {
+    const auto restricts_column = [&](const auto& candidate) { return candidate.column_id == column_id; };
+
+    const auto point_candidate_iter = std::find_if(candidates.cbegin(), candidates.cend(), [&](const auto& candidate) {
+      return restricts_column(candidate) && candidate.is_point_predicate;
+    });
+    if (point_candidate_iter != candidates.cend()) {
+      selected_predicate_nodes.emplace_back(point_candidate_iter->predicate_node);
+      continue;
+    }
 
-// Only if the number of input rows exceeds num_input_rows, the ScanType can be set to IndexScan.
-// The number is taken from: Fast Lookups for In-Memory Column Stores: Group-Key Indices, Lookup and Maintenance.
-constexpr float INDEX_SCAN_ROW_COUNT_THRESHOLD = 1000.0f;
+    const auto candidate_iter = std::find_if(candidates.cbegin(), candidates.cend(), restricts_column);
+    if (candidate_iter != candidates.cend()) selected_predicate_nodes.emplace_back(candidate_iter->predicate_node);
+    break;
+  }
 
-std::string IndexScanRule::name() const { return "Index Scan Rule"; }
+  return selected_predicate_nodes;
+}
 
-bool IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
-  if (node->type == LQPNodeType::Predicate) {
-    const auto& child = node->left_input();
-
-    if (child->type == LQPNodeType::StoredTable) {
-      const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
-      const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(child);
-      const auto table = StorageManager::get().get_table(stored_table_node->table_name);
-
-      const auto index_infos = table->get_indexes();
-      for (const auto& index_info : index_infos) {
-        if (_is_index_scan_applicable(index_info, predicate_node)) {
-          predicate_node->scan_type = ScanType::IndexScan;
-        }
-      }
+float estimate_selectivity(const std::shared_ptr<AbstractExpression>& predicate,
+                           const std::shared_ptr<StoredTableNode>& stored_table_node) {
+  const auto table_statistics = stored_table_node->get_statistics();
+  const auto row_count_table = table_statistics->row_count();
+
+  // The statistics cannot estimate IN predicates, so the estimations for the single values are added up. The
+  // predicate was already checked by OperatorIndexScanPredicate to consist of a column and a list of values.
+  if (const auto in_expression = std::dynamic_pointer_cast<InExpression>(predicate)) {
+    const auto column_id = stored_table_node->get_column_id(*in_expression->value());
+    const auto& list_expression = static_cast<const ListExpression&>(*in_expression->set());
+
+    auto row_count_predicate = 0.0f;
+    for (const auto& element : list_expression.elements()) {
+      const auto& value = static_cast<const ValueExpression&>(*element).value;
+      if (variant_is_null(value)) continue;
+      row_count_predicate +=
+          table_statistics->estimate_predicate(column_id, PredicateCondition::Equals, value).row_count();
     }
+    return std::min(row_count_predicate / row_count_table, 1.0f);
   }
 
-  return _apply_to_inputs(node);
+  const auto row_count_predicate =
+      PredicateNode::make(predicate)->derive_statistics_from(stored_table_node, nullptr)->row_count();
+  return row_count_predicate / row_count_table;
 }
 
-bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
-                                              const std::shared_ptr<PredicateNode>& predicate_node) const {
-  if (!_is_single_segment_index(index_info)) return false;
+}  // namespace
 
-  if (index_info.type != SegmentIndexType::GroupKey) return false;
+namespace opossum {
 
-  const auto operator_predicates = OperatorScanPredicate::from_expression(*predicate_node->predicate, *predicate_node);
-  if (!operator_predicates) return false;
-  if (operator_predicates->size() != 1) return false;
+std::string IndexScanRule::name() const { return "Index Scan Rule"; }
 
-  const auto& operator_predicate = (*operator_predicates)[0];
+bool IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type != LQPNodeType::Predicate) return _apply_to_inputs(node);
+
+  // Collect the chain of PredicateNodes that starts at node and ends in a StoredTableNode. The PredicateNodes below
+  // node are only moved if nothing else uses them.
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{std::static_pointer_cast<PredicateNode>(node)};
+  auto input = node->left_input();
+  while (input->type == LQPNodeType::Predicate && input->output_count() == 1) {
+    predicate_nodes.emplace_back(std::static_pointer_cast<PredicateNode>(input));
+    input = input->left_input();
+  }
+  if (input->type != LQPNodeType::StoredTable) return _apply_to_inputs(node);
+
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(input);
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+
+  const auto row_count_table = stored_table_node->derive_statistics_from(nullptr, nullptr)->row_count();
+  if (row_count_table < ROW_COUNT_THRESHOLD) return false;
+
+  auto candidates = std::vector<IndexPredicateCandidate>{};
+  for (const auto& predicate_node : predicate_nodes) {
+    const auto index_scan_predicate =
+        OperatorIndexScanPredicate::from_expression(*predicate_node->predicate, *stored_table_node);
+    if (!index_scan_predicate || index_scan_predicate->column_ids.size() != 1) continue;
+
+    const auto& key_ranges = index_scan_predicate->key_ranges;
+    const auto is_point_predicate = std::all_of(key_ranges.cbegin(), key_ranges.cend(), [](const auto& key_range) {
+      return key_range == IndexKeyRange::equal_to(key_range.lower_values);
+    });
+    candidates.emplace_back(
+        IndexPredicateCandidate{predicate_node, index_scan_predicate->column_ids.front(), is_point_predicate});
+  }
 
-  // Currently, we do not support two-column predicates
-  if (is_column_id(operator_predicate.value)) return false;
+  auto indexes_column_ids = std::vector<std::vector<ColumnID>>{};
+  for (const auto& index_info : table->get_indexes()) {
+    if (_is_supported_index(index_info)) indexes_column_ids.emplace_back(index_info.column_ids);
+  }
+  for (const auto& table_index : table->table_indexes()) {
+    indexes_column_ids.emplace_back(table_index->column_ids());
+  }
+
+  // Choose the index with the lowest estimated selectivity. The predicates on different columns are assumed to be
+  // independent.
+  auto index_predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+  auto index_selectivity = SELECTIVITY_THRESHOLD;
+  for (const auto& index_column_ids : indexes_column_ids) {
+    const auto selected_predicate_nodes = select_index_predicates(index_column_ids, candidates);
+    if (selected_predicate_nodes.empty()) continue;
+
+    auto selectivity = 1.0f;
+    for (const auto& predicate_node : selected_predicate_nodes) {
+      selectivity *= estimate_selectivity(predicate_node->predicate, stored_table_node);
+    }
 
-  if (index_info.column_ids[0] != operator_predicate.column_id) return false;
+    if (selectivity > index_selectivity) continue;
+    if (!index_predicate_nodes.empty() && selectivity == index_selectivity) continue;
 
-  const auto row_count_table = predicate_node->left_input()->derive_statistics_from(nullptr, nullptr)->row_count();
-  if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
+    index_predicate_nodes = selected_predicate_nodes;
+    index_selectivity = selectivity;
+  }
 
-  const auto row_count_predicate =
-      predicate_node->derive_statistics_from(predicate_node->left_input(), nullptr)->row_count();
-  const float selectivity = row_count_predicate / row_count_table;
+  if (index_predicate_nodes.empty()) return false;
+
+  // The IndexScan has to be executed directly on the table. A single predicate is moved there, multiple predicates
+  // are combined into one PredicateNode in the order of the index columns (see OperatorIndexScanPredicate).
+  auto index_scan_node = std::shared_ptr<PredicateNode>{};
+  if (index_predicate_nodes.size() == 1) {
+    index_scan_node = index_predicate_nodes.front();
+    if (index_scan_node != predicate_nodes.back()) {
+      lqp_remove_node(index_scan_node);
+      lqp_insert_node(predicate_nodes.back(), LQPInputSide::Left, index_scan_node);
+    }
+  } else {
+    auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+    for (const auto& predicate_node : index_predicate_nodes) {
+      predicates.emplace_back(predicate_node->predicate);
+    }
+    index_scan_node = PredicateNode::make(inflate_logical_expressions(predicates, LogicalOperator::And));
+
+    lqp_insert_node(predicate_nodes.back(), LQPInputSide::Left, index_scan_node);
+    for (const auto& predicate_node : index_predicate_nodes) {
+      lqp_remove_node(predicate_node);
+    }
+  }
 
-  return selectivity <= INDEX_SCAN_SELECTIVITY_THRESHOLD;
+  index_scan_node->scan_type = ScanType::IndexScan;
+  return true;
 }
 
-inline bool IndexScanRule::_is_single_segment_index(const IndexInfo& index_info) const {
-  return index_info.column_ids.size() == 1;
+inline bool IndexScanRule::_is_supported_index(const IndexInfo& index_info) const {
+  if (index_info.type == SegmentIndexType::GroupKey) return index_info.column_ids.size() == 1;
+  return index_info.type == SegmentIndexType::CompositeGroupKey;
 }
 
 }  // namespace opossum
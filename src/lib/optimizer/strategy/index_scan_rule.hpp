@@ -11,29 +11,39 @@
 namespace opossum {
 
 class AbstractLQPNode;
-class PredicateNode;
 
 /**
- * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
- * for being executed by IndexScans. If the expected selectivity of the predicate falls below a certain threshold, the
- * ScanType of the PredicateNode is set to IndexScan.
+ * This optimizer rule finds chains of PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are
+ * candidates for being executed by IndexScans. For every index on the table, the rule selects the predicates that the
+ * index can answer: Equality and IN predicates on the leading columns of the index, optionally followed by a range
+ * predicate (e.g., BETWEEN) on the next column (see OperatorIndexScanPredicate). If the expected selectivity of the
+ * selected predicates falls below a certain threshold, they are combined into a single PredicateNode directly on top
+ * of the StoredTableNode, whose ScanType is set to IndexScan. If multiple indexes qualify, the most selective one is
+ * used.
  *
  * Note:
- * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
- * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
- * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * Two-column predicates (i.e. WHERE a < b) are not supported. We also assume that if chunks have an index, all of them
+ * are of the same type, we do not mix GroupKey and ART indexes. In addition, chains of IndexScans are not possible
+ * since an IndexScan's input must be a GetTable. Currently, only GroupKeyIndexes, CompositeGroupKeyIndexes, and
+ * TableIndexes are supported.
  */
 
 class IndexScanRule : public AbstractRule {
  public:
+  // Only if we expect num_output_rows <= num_input_rows * selectivity_threshold, the ScanType can be set to IndexScan.
+  // This value is kind of arbitrarily chosen, but the following paper suggests something similar:
+  // Access Path Selection in Main-Memory Optimized Data Systems: Should I Scan or Should I Probe?
+  static constexpr float SELECTIVITY_THRESHOLD = 0.01f;
+
+  // Only if the number of input rows exceeds num_input_rows, the ScanType can be set to IndexScan.
+  // The number is taken from: Fast Lookups for In-Memory Column Stores: Group-Key Indices, Lookup and Maintenance.
+  static constexpr float ROW_COUNT_THRESHOLD = 1000.0f;
+
   std::string name() const override;
   bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
 
  protected:
-  bool _is_index_scan_applicable(const IndexInfo& index_info,
-                                 const std::shared_ptr<PredicateNode>& predicate_node) const;
-  inline bool _is_single_segment_index(const IndexInfo& index_info) const;
+  inline bool _is_supported_index(const IndexInfo& index_info) const;
 };
 
 }  // namespace opossum
@@ -0,0 +1,30 @@
+#include "redundant_aggregate_rule.hpp"
+
+#include <memory>
+#include <string>
+
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/projection_node.hpp"
+
+namespace opossum {
+
+std::string RedundantAggregateRule::name() const { return "Redundant Aggregate Rule"; }
+
+bool RedundantAggregateRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type != LQPNodeType::Aggregate) return _apply_to_inputs(node);
+
+  const auto aggregate_node = std::static_pointer_cast<AggregateNode>(node);
+  const auto& group_by_expressions = aggregate_node->group_by_expressions;
+  if (!aggregate_node->aggregate_expressions.empty() || group_by_expressions.empty()) return _apply_to_inputs(node);
+
+  if (!lqp_is_unique_on(aggregate_node->left_input(), group_by_expressions)) return _apply_to_inputs(node);
+
+  const auto projection_node = ProjectionNode::make(group_by_expressions);
+  lqp_replace_node(aggregate_node, projection_node);
+
+  _apply_to_inputs(projection_node);
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Removes AggregateNodes that only group (i.e., that have no aggregate expressions, as created for DISTINCT and for
+ * GROUP BY without aggregate functions) if their input is already unique on the group by expressions. This is the case
+ * if, e.g., they contain the primary key of a table. See lqp_is_unique_on().
+ *
+ * The AggregateNode is replaced by a ProjectionNode of the group by expressions, which are the output of the
+ * AggregateNode. AggregateNodes with aggregate functions are not removed, as the type of their results (e.g., SUM(a)
+ * of an int column is a long) would change.
+ */
+class RedundantAggregateRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
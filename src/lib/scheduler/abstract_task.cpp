@@ -8,6 +8,8 @@
 #include "abstract_scheduler.hpp"
 #include "current_scheduler.hpp"
 #include "task_queue.hpp"
+#include "utils/tracing/execution_trace.hpp"
+#include "utils/tracing/hardware_counters.hpp"
 #include "utils/tracing/probes.hpp"
 #include "worker.hpp"
 
@@ -15,7 +17,10 @@
 
 namespace opossum {
 
-AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority(priority), _stealable(stealable) {}
+AbstractTask::AbstractTask(SchedulePriority priority, bool stealable)
+    : _priority(priority), _stealable(stealable),
+      _execution_trace(ExecutionTrace::current()),
+      _hardware_counters(HardwareCounters::current()) {}
 
 TaskID AbstractTask::id() const { return _id; }
 
@@ -49,7 +54,12 @@ const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() con
 
 void AbstractTask::set_node_id(NodeID node_id) { _node_id = node_id; }
 
-bool AbstractTask::try_mark_as_enqueued() { return !_is_enqueued.exchange(true); }
+bool AbstractTask::try_mark_as_enqueued() {
+  if (_is_enqueued.exchange(true)) return false;
+
+  if (_execution_trace) _enqueue_time = ExecutionTrace::Clock::now();
+  return true;
+}
 
 void AbstractTask::set_done_callback(const std::function<void()>& done_callback) {
   DebugAssert((!_is_scheduled), "Possible race: Don't set callback after the Task was scheduled");
@@ -80,7 +90,27 @@ void AbstractTask::execute() {
   DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
-  _on_execute();
+  // Make everything that is executed and created by this task part of the same trace
+  const auto trace_activation = ExecutionTrace::ScopedActivation{_execution_trace};
+  const auto begin = _execution_trace ? ExecutionTrace::Clock::now() : ExecutionTrace::Clock::time_point{};
+
+  {
+    // Count the task into the operator that created it (if any), see HardwareCounters
+    const auto counter_attribution = HardwareCounters::ScopedAttribution{_hardware_counters};
+    _on_execute();
+  }
+
+  // Record the task before anyone waiting for it is notified, so that the trace is complete once the query is done
+  if (_execution_trace) {
+    auto arguments =
+        nlohmann::json{{"task_id", _id.load()}, {"node_id", static_cast<NodeID::base_type>(_node_id.load())}};
+    // Tasks executed without a Scheduler are never enqueued
+    if (_is_enqueued) {
+      arguments["queue_wait_us"] =
+          std::chrono::duration_cast<std::chrono::microseconds>(begin - _enqueue_time).count();
+    }
+    _execution_trace->add_complete_event(description(), "Task", begin, ExecutionTrace::Clock::now(), arguments);
+  }
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
@@ -96,6 +126,8 @@ void AbstractTask::execute() {
   DTRACE_PROBE2(HYRISE, JOB_END, _id, reinterpret_cast<uintptr_t>(this));
 }
 
+const std::shared_ptr<ExecutionTrace>& AbstractTask::execution_trace() const { return _execution_trace; }
+
 void AbstractTask::_mark_as_scheduled() {
   [[gnu::unused]] auto already_scheduled = _is_scheduled.exchange(true);
 
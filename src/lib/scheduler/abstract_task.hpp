@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -12,6 +13,8 @@
 
 namespace opossum {
 
+class ExecutionTrace;
+class HardwareCounters;
 class Worker;
 
 /**
@@ -107,6 +110,12 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void execute();
 
+  /**
+   * @return The ExecutionTrace that was active when the task was created and that the task is recorded in, nullptr if
+   *         the task is not traced
+   */
+  const std::shared_ptr<ExecutionTrace>& execution_trace() const;
+
  protected:
   virtual void _on_execute() = 0;
 
@@ -154,6 +163,13 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   // To make sure a task is never executed twice
   std::atomic_bool _started{false};
+
+  // For tracing, see ExecutionTrace
+  const std::shared_ptr<ExecutionTrace> _execution_trace;
+  std::chrono::steady_clock::time_point _enqueue_time;
+
+  // The HardwareCounters that the task is counted into, see HardwareCounters::ScopedAttribution
+  const std::shared_ptr<HardwareCounters> _hardware_counters;
 };
 
 }  // namespace opossum
@@ -0,0 +1,129 @@
+#include "job_batch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "current_scheduler.hpp"
+#include "job_task.hpp"
+#include "topology.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+struct JobBatch::SharedState {
+  SharedState(const size_t init_job_count, const std::function<void(size_t)>& init_job)
+      : job_count(init_job_count), job(init_job) {}
+
+  const size_t job_count;
+  const std::function<void(size_t)> job;
+
+  std::atomic<size_t> next_job_index{0};
+  std::atomic<size_t> finished_job_count{0};
+
+  // Only used for blocking in wait() while the last jobs are executed by other threads
+  std::mutex done_mutex;
+  std::condition_variable done_condition_variable;
+
+  // The first exception thrown by a job, guarded by done_mutex
+  std::exception_ptr exception;
+};
+
+JobBatch::JobBatch(const size_t job_count, const std::function<void(size_t)>& job, SchedulePriority priority)
+    : _state(std::make_shared<SharedState>(job_count, job)), _priority(priority) {}
+
+JobBatch::JobBatch(JobBatch&& other) noexcept
+    : _state(std::move(other._state)),
+      _priority(other._priority),
+      _is_scheduled(std::exchange(other._is_scheduled, false)) {}
+
+JobBatch& JobBatch::operator=(JobBatch&& other) {
+  if (this == &other) return *this;
+  if (_is_scheduled) wait();
+
+  _state = std::move(other._state);
+  _priority = other._priority;
+  _is_scheduled = std::exchange(other._is_scheduled, false);
+  return *this;
+}
+
+JobBatch::~JobBatch() {
+  if (!_is_scheduled) return;
+
+  // Destructors must not throw. The exception could only be observed through wait() anyway.
+  try {
+    wait();
+  } catch (...) {
+  }
+}
+
+size_t JobBatch::job_count() const {
+  DebugAssert(_state, "JobBatch was moved from");
+  return _state->job_count;
+}
+
+bool JobBatch::is_done() const {
+  DebugAssert(_state, "JobBatch was moved from");
+  return _state->finished_job_count == _state->job_count;
+}
+
+void JobBatch::schedule() {
+  DebugAssert(_state, "JobBatch was moved from");
+  DebugAssert(!_is_scheduled, "JobBatch was already scheduled");
+  _is_scheduled = true;
+
+  if (!CurrentScheduler::is_set()) return;
+
+  // The thread calling wait() executes jobs as well, so at most job_count - 1 helpers are useful
+  const auto helper_count = std::min(_state->job_count, Topology::get().num_cpus()) - (_state->job_count > 0 ? 1 : 0);
+
+  for (auto helper_idx = size_t{0}; helper_idx < helper_count; ++helper_idx) {
+    // The helper keeps the SharedState alive. If it only gets to run after all jobs were claimed, it returns without
+    // touching the job function.
+    const auto helper = std::make_shared<JobTask>([state = _state]() { _execute_jobs(*state); }, _priority);
+    helper->schedule();
+  }
+}
+
+void JobBatch::wait() {
+  DebugAssert(_state, "JobBatch was moved from");
+  _execute_jobs(*_state);
+
+  // All jobs are claimed, the remaining ones are being executed by helpers on other threads
+  std::unique_lock<std::mutex> lock(_state->done_mutex);
+  _state->done_condition_variable.wait(lock, [&]() { return is_done(); });
+
+  if (_state->exception) std::rethrow_exception(std::exchange(_state->exception, nullptr));
+}
+
+void JobBatch::schedule_and_wait() {
+  schedule();
+  wait();
+}
+
+void JobBatch::_execute_jobs(SharedState& state) {
+  while (true) {
+    const auto job_index = state.next_job_index++;
+    if (job_index >= state.job_count) return;
+
+    try {
+      state.job(job_index);
+    } catch (...) {
+      // The job still counts as finished, so that wait() does not block forever
+      std::lock_guard<std::mutex> lock(state.done_mutex);
+      if (!state.exception) state.exception = std::current_exception();
+    }
+
+    if (++state.finished_job_count == state.job_count) {
+      // Lock to avoid the notification getting lost between the waiter's predicate check and it going to sleep
+      std::lock_guard<std::mutex> lock(state.done_mutex);
+      state.done_condition_variable.notify_all();
+    }
+  }
+}
+
+}  // namespace opossum
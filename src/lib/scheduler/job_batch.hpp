@@ -0,0 +1,76 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Executes N homogeneous jobs (e.g., one per chunk) with a per-job overhead that is much lower than that of a JobTask.
+ *
+ * Instead of allocating and scheduling one JobTask per job, a JobBatch keeps a single shared state with an atomic job
+ * index. schedule() enqueues at most one helper task per CPU (and none at all if there is only one job). Each helper,
+ * as well as the thread calling wait(), repeatedly claims the next unprocessed index and executes the job for it.
+ * Joining is done through a counter of finished jobs instead of waiting on each task individually.
+ *
+ * Usage example:
+ *
+ * auto batch = JobBatch{chunk_count, [&](const size_t job_index) { process_chunk(ChunkID{job_index}); }};
+ * batch.schedule();
+ * batch.wait();
+ *
+ * Since wait() participates in executing the jobs, a JobBatch can be waited for from within a Worker without blocking
+ * progress. Without an active Scheduler, all jobs are executed by wait().
+ * The job function may capture references to the caller's stack: It is never invoked after wait() returned.
+ * If a job throws, the remaining jobs are still executed and the first exception is rethrown by wait().
+ */
+class JobBatch : private Noncopyable {
+ public:
+  JobBatch(size_t job_count, const std::function<void(size_t)>& job,
+           SchedulePriority priority = SchedulePriority::Default);
+
+  // A moved-from batch is empty and does not wait for the jobs, which are owned by the batch it was moved to. It must
+  // not be used anymore, except for being destroyed or assigned to.
+  JobBatch(JobBatch&& other) noexcept;
+  JobBatch& operator=(JobBatch&& other);
+
+  /**
+   * Waits for the jobs if the batch was scheduled, so that they never outlive the data they reference. Exceptions of
+   * jobs that were not rethrown by wait() are dropped.
+   */
+  ~JobBatch();
+
+  size_t job_count() const;
+
+  /**
+   * @return All jobs finished executing
+   */
+  bool is_done() const;
+
+  /**
+   * Enqueues the helper tasks if a Scheduler is available, otherwise does nothing
+   */
+  void schedule();
+
+  /**
+   * Executes unclaimed jobs on the current thread and blocks until all jobs are finished. Can be called repeatedly.
+   * Rethrows the first exception thrown by a job, once.
+   */
+  void wait();
+
+  void schedule_and_wait();
+
+ private:
+  struct SharedState;
+
+  // Claims and executes jobs until none are left
+  static void _execute_jobs(SharedState& state);
+
+  std::shared_ptr<SharedState> _state;
+  SchedulePriority _priority;
+  bool _is_scheduled{false};
+};
+
+}  // namespace opossum
@@ -25,6 +25,7 @@ namespace opossum {
  *
  * // c == 2 now
  *
+ * For a large number of homogeneous jobs (e.g., one per chunk), prefer JobBatch, which has less per-job overhead.
  */
 class JobTask : public AbstractTask {
  public:
@@ -1,6 +1,8 @@
 #include "operator_task.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -8,6 +10,7 @@
 
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "operators/operator_pipeline.hpp"
 
 #include "scheduler/job_task.hpp"
 #include "scheduler/worker.hpp"
@@ -23,31 +26,85 @@ std::string OperatorTask::description() const {
 }
 
 const std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_operator(
-    const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries) {
+    const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries,
+    UsePipelining use_pipelining) {
   std::vector<std::shared_ptr<OperatorTask>> tasks;
   std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>> task_by_op;
-  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, cleanup_temporaries);
+
+  // Only operators with a single consumer may receive a row budget or become part of a pipeline, because other
+  // consumers might need their full output
+  auto consumer_counts = std::unordered_map<const AbstractOperator*, size_t>{};
+  auto visited_ops = std::unordered_set<const AbstractOperator*>{};
+  auto ops_to_visit = std::vector<std::shared_ptr<const AbstractOperator>>{op};
+  while (!ops_to_visit.empty()) {
+    const auto current_op = ops_to_visit.back();
+    ops_to_visit.pop_back();
+    if (!visited_ops.emplace(current_op.get()).second) continue;
+
+    for (const auto& input : {current_op->input_left(), current_op->input_right()}) {
+      if (!input) continue;
+      ++consumer_counts[input.get()];
+      ops_to_visit.emplace_back(input);
+    }
+  }
+
+  visited_ops.clear();
+  _propagate_row_budgets(op, consumer_counts, visited_ops);
+
+  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, cleanup_temporaries,
+                                         use_pipelining == UsePipelining::Yes ? &consumer_counts : nullptr);
   return tasks;
 }
 
+void OperatorTask::_propagate_row_budgets(const std::shared_ptr<AbstractOperator>& op,
+                                          const std::unordered_map<const AbstractOperator*, size_t>& consumer_counts,
+                                          std::unordered_set<const AbstractOperator*>& visited_ops) {
+  if (!visited_ops.emplace(op.get()).second) return;
+
+  const auto input_row_budget = op->input_row_budget();
+
+  for (const auto& input : {op->mutable_input_left(), op->mutable_input_right()}) {
+    if (!input) continue;
+
+    // Also resets row budgets that previous executions of the PQP set. Operators with multiple consumers never receive
+    // a row budget.
+    input->set_row_budget(consumer_counts.at(input.get()) == 1 ? input_row_budget : std::nullopt);
+
+    _propagate_row_budgets(input, consumer_counts, visited_ops);
+  }
+}
+
 std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
     std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
     std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
-    CleanupTemporaries cleanup_temporaries) {
+    CleanupTemporaries cleanup_temporaries,
+    const std::unordered_map<const AbstractOperator*, size_t>* consumer_counts) {
   const auto task_by_op_it = task_by_op.find(op);
   if (task_by_op_it != task_by_op.end()) return task_by_op_it->second;
 
   const auto task = std::make_shared<OperatorTask>(op, cleanup_temporaries);
   task_by_op.emplace(op, task);
 
-  if (auto left = op->mutable_input_left()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, cleanup_temporaries);
-    subtree_root->set_as_predecessor_of(task);
+  // If the operator is the top of a pipeline, the task depends on the input of the pipeline's bottom operator and on
+  // the inputs that the operators of the pipeline do not consume chunk by chunk, e.g., the build side of a JoinHash
+  auto pipelined_ops = std::vector<std::shared_ptr<AbstractOperator>>{op};
+  if (consumer_counts) {
+    auto collected_ops = _collect_pipeline(op, *consumer_counts);
+    if (collected_ops.size() > 1) {
+      task->_pipeline = std::make_shared<OperatorPipeline>(collected_ops);
+      pipelined_ops = std::move(collected_ops);
+    }
   }
 
-  if (auto right = op->mutable_input_right()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, cleanup_temporaries);
-    subtree_root->set_as_predecessor_of(task);
+  for (auto op_idx = size_t{0}; op_idx < pipelined_ops.size(); ++op_idx) {
+    const auto& pipelined_op = pipelined_ops[op_idx];
+    for (const auto& input : {pipelined_op->mutable_input_left(), pipelined_op->mutable_input_right()}) {
+      if (!input || (op_idx > 0 && input == pipelined_ops[op_idx - 1])) continue;
+
+      auto subtree_root =
+          OperatorTask::_add_tasks_from_operator(input, tasks, task_by_op, cleanup_temporaries, consumer_counts);
+      subtree_root->set_as_predecessor_of(task);
+    }
   }
 
   // Add AFTER the inputs to establish a task order where predecessor get executed before successors
@@ -56,8 +113,31 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
   return task;
 }
 
+std::vector<std::shared_ptr<AbstractOperator>> OperatorTask::_collect_pipeline(
+    const std::shared_ptr<AbstractOperator>& op,
+    const std::unordered_map<const AbstractOperator*, size_t>& consumer_counts) {
+  auto pipelined_ops = std::vector<std::shared_ptr<AbstractOperator>>{};
+
+  auto current_op = op;
+  while (const auto input_side = current_op->pipelined_input_side()) {
+    pipelined_ops.emplace_back(current_op);
+
+    const auto input = *input_side == OperatorInputSide::Left ? current_op->mutable_input_left()
+                                                              : current_op->mutable_input_right();
+    const auto consumer_count_iter = consumer_counts.find(input.get());
+    if (consumer_count_iter == consumer_counts.end() || consumer_count_iter->second != 1) break;
+
+    current_op = input;
+  }
+
+  std::reverse(pipelined_ops.begin(), pipelined_ops.end());
+  return pipelined_ops;
+}
+
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
+const std::shared_ptr<OperatorPipeline>& OperatorTask::get_pipeline() const { return _pipeline; }
+
 void OperatorTask::_on_execute() {
   auto context = _op->transaction_context();
   if (context) {
@@ -83,7 +163,11 @@ void OperatorTask::_on_execute() {
   }
 
   DTRACE_PROBE2(HYRISE, OPERATOR_TASKS, reinterpret_cast<uintptr_t>(_op.get()), reinterpret_cast<uintptr_t>(this));
-  _op->execute();
+  if (_pipeline) {
+    _pipeline->execute();
+  } else {
+    _op->execute();
+  }
 
   /**
    * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
@@ -9,6 +10,7 @@
 namespace opossum {
 
 class AbstractOperator;
+class OperatorPipeline;
 
 /**
  * Makes an AbstractOperator scheduleable
@@ -21,12 +23,22 @@ class OperatorTask : public AbstractTask {
 
   /**
    * Create tasks recursively from result operator and set task dependencies automatically.
+   * With UsePipelining::Yes, chains of operators that consume their input chunk by chunk (including the probe side of
+   * a JoinHash) are combined into a single task that executes them as an OperatorPipeline.
+   * Row budgets (e.g., of a Limit) are passed down to the operators that can stop early, see
+   * AbstractOperator::set_row_budget().
    */
   static const std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
-      const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries);
+      const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries,
+      UsePipelining use_pipelining = UsePipelining::No);
 
   const std::shared_ptr<AbstractOperator>& get_operator() const;
 
+  /**
+   * @return The OperatorPipeline ending in get_operator() that this task executes, nullptr for a single operator
+   */
+  const std::shared_ptr<OperatorPipeline>& get_pipeline() const;
+
   std::string description() const override;
 
  protected:
@@ -39,10 +51,28 @@ class OperatorTask : public AbstractTask {
   static std::shared_ptr<OperatorTask> _add_tasks_from_operator(
       std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
       std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
-      CleanupTemporaries cleanup_temporaries);
+      CleanupTemporaries cleanup_temporaries,
+      const std::unordered_map<const AbstractOperator*, size_t>* consumer_counts);
+
+  /**
+   * Passes the input_row_budget() of @param op on to its inputs and recursively further down, see
+   * AbstractOperator::set_row_budget()
+   */
+  static void _propagate_row_budgets(const std::shared_ptr<AbstractOperator>& op,
+                                     const std::unordered_map<const AbstractOperator*, size_t>& consumer_counts,
+                                     std::unordered_set<const AbstractOperator*>& visited_ops);
+
+  /**
+   * Collects the longest chain of operators ending in @param op that can be executed as an OperatorPipeline. The
+   * operators below @param op must not be consumed by anyone else. Ordered from bottom to top.
+   */
+  static std::vector<std::shared_ptr<AbstractOperator>> _collect_pipeline(
+      const std::shared_ptr<AbstractOperator>& op,
+      const std::unordered_map<const AbstractOperator*, size_t>& consumer_counts);
 
  private:
   std::shared_ptr<AbstractOperator> _op;
   CleanupTemporaries _cleanup_temporaries;
+  std::shared_ptr<OperatorPipeline> _pipeline;
 };
 }  // namespace opossum
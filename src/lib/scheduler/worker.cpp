@@ -14,6 +14,7 @@
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
 #include "task_queue.hpp"
+#include "utils/tracing/execution_trace.hpp"
 
 namespace {
 
@@ -62,6 +63,13 @@ void Worker::_work() {
 
       task = queue->steal();
       if (task) {
+        if (const auto& execution_trace = task->execution_trace()) {
+          execution_trace->add_instant_event(
+              "Steal", "Scheduler",
+              {{"task_id", task->id()},
+               {"from_node_id", static_cast<NodeID::base_type>(queue->node_id())},
+               {"to_node_id", static_cast<NodeID::base_type>(_queue->node_id())}});
+        }
         task->set_node_id(_queue->node_id());
         work_stealing_successful = true;
         break;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <utility>
+#include <vector>
 
 namespace opossum {
 
@@ -30,6 +31,9 @@ class AbstractCache {
   // Returns the number of elements currently held in the cache.
   virtual size_t size() const = 0;
 
+  // Returns copies of all cached items, without refreshing them.
+  virtual std::vector<KeyValuePair> snapshot() const = 0;
+
   // Remove all elements from the cache.
   virtual void clear() = 0;
 
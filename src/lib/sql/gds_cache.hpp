@@ -3,6 +3,7 @@
 #include <list>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "abstract_cache.hpp"
 #include "boost/heap/fibonacci_heap.hpp"
@@ -74,6 +75,15 @@ class GDSCache : public AbstractCache<Key, Value> {
 
   size_t size() const { return _map.size(); }
 
+  std::vector<typename AbstractCache<Key, Value>::KeyValuePair> snapshot() const {
+    auto entries = std::vector<typename AbstractCache<Key, Value>::KeyValuePair>{};
+    entries.reserve(_queue.size());
+    for (const auto& entry : _queue) {
+      entries.emplace_back(entry.key, entry.value);
+    }
+    return entries;
+  }
+
   void clear() {
     _map.clear();
     _queue.clear();
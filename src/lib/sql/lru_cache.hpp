@@ -3,6 +3,7 @@
 #include <list>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "abstract_cache.hpp"
 
@@ -50,6 +51,8 @@ class LRUCache : public AbstractCache<Key, Value> {
 
   size_t size() const { return _map.size(); }
 
+  std::vector<KeyValuePair> snapshot() const { return {_list.cbegin(), _list.cend()}; }
+
   void clear() {
     _list.clear();
     _map.clear();
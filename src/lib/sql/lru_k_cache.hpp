@@ -101,6 +101,15 @@ class LRUKCache : public AbstractCache<Key, Value> {
 
   size_t size() const { return _map.size(); }
 
+  std::vector<typename AbstractCache<Key, Value>::KeyValuePair> snapshot() const {
+    auto entries = std::vector<typename AbstractCache<Key, Value>::KeyValuePair>{};
+    entries.reserve(_queue.size());
+    for (const auto& entry : _queue) {
+      entries.emplace_back(entry.key, entry.value);
+    }
+    return entries;
+  }
+
   void clear() {
     _map.clear();
     _queue.clear();
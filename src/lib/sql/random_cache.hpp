@@ -55,6 +55,8 @@ class RandomCache : public AbstractCache<Key, Value> {
 
   size_t size() const { return _map.size(); }
 
+  std::vector<KeyValuePair> snapshot() const { return {_list.cbegin(), _list.cend()}; }
+
   void clear() {
     _list.clear();
     _map.clear();
@@ -3,6 +3,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include <algorithm>
+#include <optional>
 #include <utility>
 
 #include "SQLParser.h"
@@ -17,7 +18,8 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
                          const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
                          const std::shared_ptr<Optimizer>& optimizer,
                          const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                         const CleanupTemporaries cleanup_temporaries)
+                         const CleanupTemporaries cleanup_temporaries, const UsePipelining use_pipelining,
+                         const std::shared_ptr<ExecutionTrace>& execution_trace)
     : _transaction_context(transaction_context), _optimizer(optimizer) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
@@ -77,7 +79,7 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
 
     auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
         statement_string, std::move(parsed_statement), use_mvcc, transaction_context, lqp_translator, optimizer,
-        prepared_statements, cleanup_temporaries);
+        prepared_statements, cleanup_temporaries, use_pipelining, execution_trace);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -200,7 +202,10 @@ const std::vector<std::shared_ptr<const Table>>& SQLPipeline::get_result_tables(
 
   for (auto& pipeline_statement : _sql_pipeline_statements) {
     pipeline_statement->get_result_table();
-    if (_transaction_context && _transaction_context->aborted()) {
+
+    // With auto-commit, each statement has its own transaction, which is rolled back if it violates a constraint
+    const auto& transaction_context = pipeline_statement->transaction_context();
+    if (transaction_context && transaction_context->aborted()) {
       _failed_pipeline_statement = pipeline_statement;
       _result_tables.clear();
       return _result_tables;
@@ -241,6 +246,7 @@ std::string SQLPipelineMetrics::to_string() const {
   auto total_lqp_translate_nanos = std::chrono::nanoseconds::zero();
   auto total_execute_nanos = std::chrono::nanoseconds::zero();
   std::vector<bool> query_plan_cache_hits;
+  auto total_hardware_counters = std::optional<HardwareCounterValues>{};
 
   for (const auto& statement_metric : statement_metrics) {
     total_sql_translate_nanos += statement_metric->sql_translate_time_nanos;
@@ -249,6 +255,11 @@ std::string SQLPipelineMetrics::to_string() const {
     total_execute_nanos += statement_metric->execution_time_nanos;
 
     query_plan_cache_hits.push_back(statement_metric->query_plan_cache_hit);
+
+    for (const auto& operator_hardware_counters : statement_metric->operator_hardware_counters) {
+      if (!total_hardware_counters) total_hardware_counters.emplace();
+      *total_hardware_counters += operator_hardware_counters.second;
+    }
   }
 
   const auto num_cache_hits = std::count(query_plan_cache_hits.begin(), query_plan_cache_hits.end(), true);
@@ -261,6 +272,7 @@ std::string SQLPipelineMetrics::to_string() const {
   info_string << "LQP TRANSLATE: " << format_duration(total_lqp_translate_nanos) << ", ";
   info_string << "EXECUTE: " << format_duration(total_execute_nanos) << " (wall time) | ";
   info_string << "QUERY PLAN CACHE HITS: " << num_cache_hits << "/" << query_plan_cache_hits.size() << " statement(s)";
+  if (total_hardware_counters) info_string << " | HARDWARE COUNTERS: " << total_hardware_counters->to_string();
   info_string << "]\n";
 
   return info_string.str();
@@ -46,7 +46,8 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
               const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-              const CleanupTemporaries cleanup_temporaries);
+              const CleanupTemporaries cleanup_temporaries, const UsePipelining use_pipelining,
+              const std::shared_ptr<ExecutionTrace>& execution_trace);
 
   // Returns the SQL string for each statement.
   const std::vector<std::string>& get_sql_strings();
@@ -41,12 +41,22 @@ SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_pipelining(const UsePipelining use_pipelining) {
+  _use_pipelining = use_pipelining;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_execution_trace(const std::shared_ptr<ExecutionTrace>& execution_trace) {
+  _execution_trace = execution_trace;
+  return *this;
+}
+
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
   auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _prepared_statements,
-                              _cleanup_temporaries);
+                              _cleanup_temporaries, _use_pipelining, _execution_trace);
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_strings().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
@@ -57,8 +67,8 @@ SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql,      std::move(parsed_sql), _use_mvcc,           _transaction_context, lqp_translator,
-          optimizer, _prepared_statements,  _cleanup_temporaries};
+  return {_sql,      std::move(parsed_sql), _use_mvcc,            _transaction_context, lqp_translator,
+          optimizer, _prepared_statements,  _cleanup_temporaries, _use_pipelining,      _execution_trace};
 }
 
 }  // namespace opossum
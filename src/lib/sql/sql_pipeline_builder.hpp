@@ -28,6 +28,8 @@ class Optimizer;
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer() is used.
  *  - No JIT operators
+ *  - No pipelining
+ *  - No tracing
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -53,6 +55,17 @@ class SQLPipelineBuilder final {
    */
   SQLPipelineBuilder& dont_cleanup_temporaries();
 
+  /*
+   * Execute chains of operators that are no pipeline breakers (e.g., TableScan->Validate->Projection) chunk by chunk,
+   * without materializing their intermediate results. See OperatorPipeline.
+   */
+  SQLPipelineBuilder& with_pipelining(const UsePipelining use_pipelining);
+
+  /*
+   * Record the execution of all statements in @param execution_trace, e.g., to export it as a Chrome trace
+   */
+  SQLPipelineBuilder& with_execution_trace(const std::shared_ptr<ExecutionTrace>& execution_trace);
+
   SQLPipeline create_pipeline() const;
 
   /**
@@ -70,6 +83,8 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<PreparedStatementCache> _prepared_statements;
   CleanupTemporaries _cleanup_temporaries{true};
+  UsePipelining _use_pipelining{UsePipelining::No};
+  std::shared_ptr<ExecutionTrace> _execution_trace;
 };
 
 }  // namespace opossum
@@ -15,6 +15,7 @@
 #include "sql/sql_query_plan.hpp"
 #include "sql/sql_translator.hpp"
 #include "utils/assert.hpp"
+#include "utils/tracing/execution_trace.hpp"
 #include "utils/tracing/probes.hpp"
 
 namespace opossum {
@@ -25,7 +26,9 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                                           const CleanupTemporaries cleanup_temporaries)
+                                           const CleanupTemporaries cleanup_temporaries,
+                                           const UsePipelining use_pipelining,
+                                           const std::shared_ptr<ExecutionTrace>& execution_trace)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
@@ -35,7 +38,9 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
       _prepared_statements(prepared_statements),
-      _cleanup_temporaries(cleanup_temporaries) {
+      _cleanup_temporaries(cleanup_temporaries),
+      _use_pipelining(use_pipelining),
+      _execution_trace(execution_trace) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
   DebugAssert(!_sql_string.empty(), "An SQLPipelineStatement should always contain a SQL statement string for caching");
@@ -242,7 +247,10 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
               "Physical query plan creation returned no or more than one plan for a single statement.");
 
   const auto& root = query_plan->tree_roots().front();
-  _tasks = OperatorTask::make_tasks_from_operator(root, _cleanup_temporaries);
+
+  // The tasks remember the active trace and record themselves into it
+  const auto trace_activation = ExecutionTrace::ScopedActivation{_execution_trace};
+  _tasks = OperatorTask::make_tasks_from_operator(root, _cleanup_temporaries, _use_pipelining);
   return _tasks;
 }
 
@@ -266,7 +274,11 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
 
   DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
                 reinterpret_cast<uintptr_t>(this));
-  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  {
+    // Without a Scheduler, the tasks are executed on this thread
+    const auto trace_activation = ExecutionTrace::ScopedActivation{_execution_trace};
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  }
 
   if (_auto_commit) {
     _transaction_context->commit();
@@ -275,6 +287,12 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics->execution_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
 
+  for (const auto& task : tasks) {
+    const auto& op = task->get_operator();
+    const auto& hardware_counters = op->performance_data().hardware_counters;
+    if (hardware_counters) _metrics->operator_hardware_counters.emplace_back(op->description(), *hardware_counters);
+  }
+
   // Get output from the last task
   _result_table = tasks.back()->get_operator()->get_output();
   if (_result_table == nullptr) _query_has_output = false;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "SQLParserResult.h"
 #include "concurrency/transaction_context.hpp"
@@ -9,9 +11,12 @@
 #include "sql/sql_query_cache.hpp"
 #include "sql/sql_query_plan.hpp"
 #include "storage/table.hpp"
+#include "utils/tracing/hardware_counters.hpp"
 
 namespace opossum {
 
+class ExecutionTrace;
+
 using PreparedStatementCache = SQLQueryCache<SQLQueryPlan>;
 
 // Holds relevant information about the execution of an SQLPipelineStatement.
@@ -22,6 +27,10 @@ struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds execution_time_nanos{};
 
   bool query_plan_cache_hit = false;
+
+  // Description and counters of each executed operator (or OperatorPipeline, reported by its top operator). Only
+  // filled if HardwareCounters::is_enabled().
+  std::vector<std::pair<std::string, HardwareCounterValues>> operator_hardware_counters;
 };
 
 /**
@@ -47,7 +56,8 @@ class SQLPipelineStatement : public Noncopyable {
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
                        const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                       const CleanupTemporaries cleanup_temporaries);
+                       const CleanupTemporaries cleanup_temporaries, const UsePipelining use_pipelining,
+                       const std::shared_ptr<ExecutionTrace>& execution_trace);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -108,6 +118,12 @@ class SQLPipelineStatement : public Noncopyable {
 
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
+
+  // Execute chains of operators that are no pipeline breakers chunk by chunk
+  const UsePipelining _use_pipelining;
+
+  // Records the execution of the tasks if set
+  const std::shared_ptr<ExecutionTrace> _execution_trace;
 };
 
 }  // namespace opossum
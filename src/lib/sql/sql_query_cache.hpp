@@ -56,8 +56,17 @@ class SQLQueryCache : public Singleton<SQLQueryCache<Value, Key>> {
     return _cache->get(query);
   }
 
+  // Returns all cache entries without refreshing them.
+  std::vector<std::pair<Key, Value>> snapshot() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _cache->snapshot();
+  }
+
   // Purges all entries from the cache.
-  void clear() { _cache->clear(); }
+  void clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cache->clear();
+  }
 
   void resize(size_t capacity) { _cache->resize(capacity); }
 
@@ -0,0 +1,125 @@
+#include "alp_segment.hpp"
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T, typename U>
+ALPSegment<T, U>::ALPSegment(pmr_vector<BlockInfo> blocks, pmr_vector<uint128_t> packed_offsets,
+                             pmr_vector<uint8_t> exception_positions, pmr_vector<T> exception_values,
+                             pmr_vector<bool> null_values)
+    : BaseEncodedSegment{data_type_from_type<T>()},
+      _blocks{std::move(blocks)},
+      _packed_offsets{std::move(packed_offsets)},
+      _exception_positions{std::move(exception_positions)},
+      _exception_values{std::move(exception_values)},
+      _null_values{std::move(null_values)} {
+  DebugAssert(_exception_positions.size() == _exception_values.size(), "Expected a position for each exception");
+  DebugAssert(_blocks.size() == (_null_values.size() + block_size - 1) / block_size, "Unexpected number of blocks");
+}
+
+template <typename T, typename U>
+const pmr_vector<typename ALPSegment<T, U>::BlockInfo>& ALPSegment<T, U>::blocks() const {
+  return _blocks;
+}
+
+template <typename T, typename U>
+const pmr_vector<uint128_t>& ALPSegment<T, U>::packed_offsets() const {
+  return _packed_offsets;
+}
+
+template <typename T, typename U>
+const pmr_vector<uint8_t>& ALPSegment<T, U>::exception_positions() const {
+  return _exception_positions;
+}
+
+template <typename T, typename U>
+const pmr_vector<T>& ALPSegment<T, U>::exception_values() const {
+  return _exception_values;
+}
+
+template <typename T, typename U>
+const pmr_vector<bool>& ALPSegment<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+void ALPSegment<T, U>::decode_block(const size_t block_index, DecodedBlock& values) const {
+  DebugAssert(block_index < _blocks.size(), "Block index out of range");
+  const auto& block = _blocks[block_index];
+
+  alignas(16) auto offsets = std::array<uint32_t, block_size>{};
+  Packing::unpack_block(_packed_offsets.data() + block.packed_offsets_begin, offsets.data(), block.bit_width);
+
+  for (auto value_idx = size_t{0}; value_idx < block_size; ++value_idx) {
+    values[value_idx] = decode_value(block.base + static_cast<int64_t>(offsets[value_idx]), block.exponent);
+  }
+
+  const auto exceptions_end =
+      block_index + 1 < _blocks.size() ? _blocks[block_index + 1].exceptions_begin : _exception_positions.size();
+  for (auto exception_idx = block.exceptions_begin; exception_idx < exceptions_end; ++exception_idx) {
+    values[_exception_positions[exception_idx]] = _exception_values[exception_idx];
+  }
+}
+
+template <typename T, typename U>
+const AllTypeVariant ALPSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value.has_value()) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T, typename U>
+const std::optional<T> ALPSegment<T, U>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (_null_values[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  auto values = DecodedBlock{};
+  decode_block(chunk_offset / block_size, values);
+  return values[chunk_offset % block_size];
+}
+
+template <typename T, typename U>
+size_t ALPSegment<T, U>::size() const {
+  return _null_values.size();
+}
+
+template <typename T, typename U>
+std::shared_ptr<BaseSegment> ALPSegment<T, U>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_blocks = pmr_vector<BlockInfo>{_blocks, alloc};
+  auto new_packed_offsets = pmr_vector<uint128_t>{_packed_offsets, alloc};
+  auto new_exception_positions = pmr_vector<uint8_t>{_exception_positions, alloc};
+  auto new_exception_values = pmr_vector<T>{_exception_values, alloc};
+  auto new_null_values = pmr_vector<bool>{_null_values, alloc};
+
+  return std::allocate_shared<ALPSegment>(alloc, std::move(new_blocks), std::move(new_packed_offsets),
+                                          std::move(new_exception_positions), std::move(new_exception_values),
+                                          std::move(new_null_values));
+}
+
+template <typename T, typename U>
+size_t ALPSegment<T, U>::estimate_memory_usage() const {
+  static const auto bits_per_byte = 8u;
+
+  return sizeof(*this) + _blocks.size() * sizeof(BlockInfo) + _packed_offsets.size() * sizeof(uint128_t) +
+         _exception_positions.size() * sizeof(uint8_t) + _exception_values.size() * sizeof(T) +
+         _null_values.size() / bits_per_byte;
+}
+
+template <typename T, typename U>
+EncodingType ALPSegment<T, U>::encoding_type() const {
+  return EncodingType::ALP;
+}
+
+template class ALPSegment<float>;
+template class ALPSegment<double>;
+
+}  // namespace opossum
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+#include <array>
+#include <memory>
+
+#include "base_encoded_segment.hpp"
+#include "storage/vector_compression/simd_bp128/oversized_types.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Segment implementing decimal-scaled integer encoding for floating-point values (similar to ALP)
+ *
+ * Floating-point columns such as measurements or prices usually hold values with few decimal places, e.g., 23.45,
+ * which are nearly all distinct, so that dictionary encoding does not help. Multiplied with a power of ten, such
+ * values become small integers, e.g., 2345, from which the original value can be restored exactly.
+ *
+ * The values are divided into blocks of 128 values. For each block, the encoder chooses the exponent with which the
+ * block needs the least memory. The resulting integers are stored as offsets from the block's smallest integer and
+ * bit-packed with SimdBp128Packing. Values that cannot be restored (e.g., 1/3, NaN, or values with too many digits)
+ * and offsets that would need too many bits are stored as exceptions and patched into the block after decoding.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(enum_c<EncodingType, EncodingType::ALP>,
+                                                                              hana::type_c<T>)>>
+class ALPSegment : public BaseEncodedSegment {
+ public:
+  using Packing = SimdBp128Packing;
+
+  static constexpr auto block_size = Packing::block_size;
+
+  // Largest exponent for which the scaled integers of typical values still fit into int64_t
+  static constexpr auto max_exponent = uint8_t{std::is_same_v<T, float> ? 10 : 18};
+
+  using DecodedBlock = std::array<T, block_size>;
+
+  struct BlockInfo {
+    // Frame of reference of the block's integers
+    int64_t base;
+
+    // Position of the block's offsets in packed_offsets and of its first exception
+    uint32_t packed_offsets_begin;
+    uint32_t exceptions_begin;
+
+    // The values of the block are restored by dividing their integers by 10^exponent
+    uint8_t exponent;
+
+    // Number of bits per packed offset, which equals the number of 128-bit words the block occupies
+    uint8_t bit_width;
+  };
+
+  /**
+   * Restores a value from its integer. The encoder only keeps integers for which this returns the original value,
+   * so the encoder and the segment need to use the same function.
+   */
+  static T decode_value(const int64_t encoded_value, const uint8_t exponent) {
+    return static_cast<T>(encoded_value) / powers_of_ten[exponent];
+  }
+
+  static constexpr auto powers_of_ten = [] {
+    auto powers = std::array<T, max_exponent + 1>{};
+    auto power = T{1};
+    for (auto& element : powers) {
+      element = power;
+      power *= 10;
+    }
+    return powers;
+  }();
+
+  /**
+   * @param exception_positions are the positions of the exceptions within their blocks
+   * @param exception_values are the original values of the exceptions
+   */
+  explicit ALPSegment(pmr_vector<BlockInfo> blocks, pmr_vector<uint128_t> packed_offsets,
+                      pmr_vector<uint8_t> exception_positions, pmr_vector<T> exception_values,
+                      pmr_vector<bool> null_values);
+
+  const pmr_vector<BlockInfo>& blocks() const;
+  const pmr_vector<uint128_t>& packed_offsets() const;
+  const pmr_vector<uint8_t>& exception_positions() const;
+  const pmr_vector<T>& exception_values() const;
+  const pmr_vector<bool>& null_values() const;
+
+  /**
+   * Decodes all values of a block into @param values. The values at NULL positions and behind the end of the
+   * segment are unspecified.
+   */
+  void decode_block(const size_t block_index, DecodedBlock& values) const;
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+
+  /**@}*/
+
+ private:
+  const pmr_vector<BlockInfo> _blocks;
+  const pmr_vector<uint128_t> _packed_offsets;
+  const pmr_vector<uint8_t> _exception_positions;
+  const pmr_vector<T> _exception_values;
+  const pmr_vector<bool> _null_values;
+};
+
+}  // namespace opossum
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
+
+#include "storage/base_segment_encoder.hpp"
+
+#include "storage/alp_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class ALPEncoder : public SegmentEncoder<ALPEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::ALP>;
+  static constexpr auto _uses_vector_compression = false;  // see base_segment_encoder.hpp for details
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
+    using Segment = ALPSegment<T>;
+
+    const auto alloc = value_segment->values().get_allocator();
+    const auto size = value_segment->size();
+
+    auto output = BlockOutput<T>{pmr_vector<typename Segment::BlockInfo>{alloc}, pmr_vector<uint128_t>{alloc},
+                                 pmr_vector<uint8_t>{alloc}, pmr_vector<T>{alloc}};
+    output.blocks.reserve((size + Segment::block_size - 1) / Segment::block_size);
+
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    auto iterable = ValueSegmentIterable<T>{*value_segment};
+    iterable.with_iterators([&](auto segment_it, auto segment_end) {
+      auto values = std::array<T, Segment::block_size>{};
+      auto block_null_values = std::array<bool, Segment::block_size>{};
+
+      while (segment_it != segment_end) {
+        auto value_count = size_t{0};
+        for (; value_count < Segment::block_size && segment_it != segment_end; ++value_count, ++segment_it) {
+          const auto segment_value = *segment_it;
+          values[value_count] = segment_value.is_null() ? T{0} : segment_value.value();
+          block_null_values[value_count] = segment_value.is_null();
+          null_values.push_back(segment_value.is_null());
+        }
+
+        _encode_block(values, block_null_values, value_count, output);
+      }
+    });
+
+    return std::allocate_shared<Segment>(alloc, std::move(output.blocks), std::move(output.packed_offsets),
+                                         std::move(output.exception_positions), std::move(output.exception_values),
+                                         std::move(null_values));
+  }
+
+ private:
+  template <typename T>
+  struct BlockOutput {
+    pmr_vector<typename ALPSegment<T>::BlockInfo> blocks;
+    pmr_vector<uint128_t> packed_offsets;
+    pmr_vector<uint8_t> exception_positions;
+    pmr_vector<T> exception_values;
+  };
+
+  // Returns the integer from which @param value can be restored using @param exponent, if there is one
+  template <typename T>
+  static std::optional<int64_t> _encode_value(const T value, const uint8_t exponent) {
+    // Also rejects NaN and infinity
+    static constexpr auto max_scaled_value = static_cast<T>(int64_t{1} << 62);
+    const auto scaled_value = value * ALPSegment<T>::powers_of_ten[exponent];
+    if (!(std::abs(scaled_value) < max_scaled_value)) return std::nullopt;
+
+    const auto encoded_value = static_cast<int64_t>(std::llround(scaled_value));
+    const auto decoded_value = ALPSegment<T>::decode_value(encoded_value, exponent);
+
+    // Compare the sign separately, as -0.0 == 0.0
+    if (decoded_value != value || std::signbit(decoded_value) != std::signbit(value)) return std::nullopt;
+    return encoded_value;
+  }
+
+  template <typename T>
+  struct BlockCandidate {
+    typename ALPSegment<T>::BlockInfo block{};
+    std::array<std::optional<int64_t>, ALPSegment<T>::block_size> encoded_values{};
+    size_t size_in_bits{0};
+  };
+
+  // Encodes a block with @param exponent and chooses the bit width that minimizes the size of the packed offsets and
+  // the exceptions (position and value)
+  template <typename T>
+  static BlockCandidate<T> _encode_block_with_exponent(const std::array<T, ALPSegment<T>::block_size>& values,
+                                                       const std::array<bool, ALPSegment<T>::block_size>& null_values,
+                                                       const size_t value_count, const uint8_t exponent) {
+    static constexpr auto block_size = ALPSegment<T>::block_size;
+    static constexpr auto max_bit_width = uint8_t{32};
+    static constexpr auto offset_bit_width = std::numeric_limits<uint64_t>::digits;
+    static constexpr auto exception_bit_width = 8u + sizeof(T) * 8u;
+
+    auto candidate = BlockCandidate<T>{};
+    candidate.block.exponent = exponent;
+
+    // NULLs are encoded as the base
+    auto encoded_count = size_t{0};
+    auto exception_count = size_t{0};
+    candidate.block.base = std::numeric_limits<int64_t>::max();
+    for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+      if (null_values[value_idx]) continue;
+
+      candidate.encoded_values[value_idx] = _encode_value(values[value_idx], exponent);
+      if (candidate.encoded_values[value_idx]) {
+        candidate.block.base = std::min(candidate.block.base, *candidate.encoded_values[value_idx]);
+        ++encoded_count;
+      } else {
+        ++exception_count;
+      }
+    }
+    if (encoded_count == 0) candidate.block.base = 0;
+
+    auto bit_width_counts = std::array<size_t, offset_bit_width + 1>{};
+    for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+      if (!candidate.encoded_values[value_idx]) continue;
+
+      const auto offset = _offset(*candidate.encoded_values[value_idx], candidate.block.base);
+      auto bit_width = size_t{0};
+      while (bit_width < offset_bit_width && (offset >> bit_width) != 0) ++bit_width;
+      ++bit_width_counts[bit_width];
+    }
+
+    exception_count += encoded_count;
+    candidate.size_in_bits = std::numeric_limits<size_t>::max();
+    for (auto bit_width = uint8_t{0}; bit_width <= max_bit_width; ++bit_width) {
+      exception_count -= bit_width_counts[bit_width];
+      const auto size_in_bits = size_t{bit_width} * block_size + exception_count * exception_bit_width;
+      if (size_in_bits < candidate.size_in_bits) {
+        candidate.size_in_bits = size_in_bits;
+        candidate.block.bit_width = bit_width;
+      }
+    }
+
+    return candidate;
+  }
+
+  static uint64_t _offset(const int64_t encoded_value, const int64_t base) {
+    return static_cast<uint64_t>(encoded_value) - static_cast<uint64_t>(base);
+  }
+
+  template <typename T>
+  static void _encode_block(const std::array<T, ALPSegment<T>::block_size>& values,
+                            const std::array<bool, ALPSegment<T>::block_size>& null_values,
+                            const size_t value_count, BlockOutput<T>& output) {
+    using Segment = ALPSegment<T>;
+    static constexpr auto block_size = Segment::block_size;
+
+    // Keep the smallest exponent with which the block needs the least memory
+    auto candidate = _encode_block_with_exponent(values, null_values, value_count, uint8_t{0});
+    for (auto exponent = uint8_t{1}; exponent <= Segment::max_exponent && candidate.size_in_bits > 0; ++exponent) {
+      auto next_candidate = _encode_block_with_exponent(values, null_values, value_count, exponent);
+      if (next_candidate.size_in_bits < candidate.size_in_bits) candidate = next_candidate;
+    }
+
+    auto& block = candidate.block;
+    alignas(16) auto packed_offsets = std::array<uint32_t, block_size>{};
+    block.exceptions_begin = static_cast<uint32_t>(output.exception_positions.size());
+    for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+      if (null_values[value_idx]) continue;
+
+      const auto& encoded_value = candidate.encoded_values[value_idx];
+      const auto offset = encoded_value ? _offset(*encoded_value, block.base) : uint64_t{0};
+      if (!encoded_value || (offset >> block.bit_width) != 0) {
+        output.exception_positions.push_back(static_cast<uint8_t>(value_idx));
+        output.exception_values.push_back(values[value_idx]);
+      } else {
+        packed_offsets[value_idx] = static_cast<uint32_t>(offset);
+      }
+    }
+
+    Assert(output.packed_offsets.size() + block.bit_width <= std::numeric_limits<uint32_t>::max(),
+           "Packed offsets must fit into uint32_t.");
+    block.packed_offsets_begin = static_cast<uint32_t>(output.packed_offsets.size());
+    output.packed_offsets.resize(output.packed_offsets.size() + block.bit_width);
+    Segment::Packing::pack_block(packed_offsets.data(), output.packed_offsets.data() + block.packed_offsets_begin,
+                                 block.bit_width);
+
+    output.blocks.push_back(block);
+  }
+};
+
+}  // namespace opossum
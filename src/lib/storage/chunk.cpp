@@ -9,7 +9,12 @@
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "index/b_tree/b_tree_index.hpp"
 #include "index/base_index.hpp"
+#include "index/delta_index.hpp"
+#include "index/group_key/composite_group_key_index.hpp"
+#include "index/group_key/group_key_index.hpp"
 #include "reference_segment.hpp"
 #include "resolve_type.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
@@ -20,7 +25,10 @@ namespace opossum {
 Chunk::Chunk(const Segments& segments, const std::shared_ptr<MvccData>& mvcc_data,
              const std::optional<PolymorphicAllocator<Chunk>>& alloc,
              const std::shared_ptr<ChunkAccessCounter>& access_counter)
-    : _segments(segments), _mvcc_data(mvcc_data), _access_counter(access_counter) {
+    : _segments(segments),
+      _mvcc_data(mvcc_data),
+      _access_counter(access_counter),
+      _indices(std::make_shared<std::vector<std::shared_ptr<BaseIndex>>>()) {
 #if IS_DEBUG
   const auto chunk_size = segments.empty() ? 0u : segments[0]->size();
   Assert(!_mvcc_data || _mvcc_data->size() == chunk_size, "Invalid MvccData size");
@@ -37,7 +45,25 @@ bool Chunk::is_mutable() const { return _is_mutable; }
 void Chunk::mark_immutable() { _is_mutable = false; }
 
 void Chunk::replace_segment(size_t column_id, const std::shared_ptr<BaseSegment>& segment) {
+  const auto previous_segment = std::atomic_load(&_segments.at(column_id));
+
+  auto previous_indices = std::vector<std::shared_ptr<BaseIndex>>{};
+  const auto indices = std::atomic_load(&_indices);
+  for (const auto& index : *indices) {
+    auto indexed_segments = index->get_indexed_segments();
+    const auto segment_it = std::find(indexed_segments.begin(), indexed_segments.end(), previous_segment);
+    if (segment_it == indexed_segments.end()) continue;
+
+    *segment_it = segment;
+    _add_index(_make_index(index->type(), indexed_segments));
+    previous_indices.emplace_back(index);
+  }
+
   std::atomic_store(&_segments.at(column_id), segment);
+
+  for (const auto& index : previous_indices) {
+    remove_index(index);
+  }
 }
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
@@ -58,6 +84,13 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
     DebugAssert(base_value_segment, "Can't append to segment that is not a ValueSegment");
     base_value_segment->append(*value_it);
   }
+
+  _ordered_by = 0;
+
+  const auto chunk_offset = static_cast<ChunkOffset>(size() - 1);
+  for (const auto& delta_index : delta_indexes()) {
+    delta_index->insert(*this, chunk_offset, chunk_offset + 1);
+  }
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
@@ -95,8 +128,9 @@ void Chunk::set_mvcc_data(const std::shared_ptr<MvccData>& mvcc_data) { _mvcc_da
 
 std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(
     const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
+  const auto indices = std::atomic_load(&_indices);
   auto result = std::vector<std::shared_ptr<BaseIndex>>();
-  std::copy_if(_indices.cbegin(), _indices.cend(), std::back_inserter(result),
+  std::copy_if(indices->cbegin(), indices->cend(), std::back_inserter(result),
                [&](const auto& index) { return index->is_index_for(segments); });
   return result;
 }
@@ -108,11 +142,12 @@ std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(const std::vector<Col
 
 std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
                                             const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
-  auto index_it = std::find_if(_indices.cbegin(), _indices.cend(), [&](const auto& index) {
+  const auto indices = std::atomic_load(&_indices);
+  auto index_it = std::find_if(indices->cbegin(), indices->cend(), [&](const auto& index) {
     return index->is_index_for(segments) && index->type() == index_type;
   });
 
-  return (index_it == _indices.cend()) ? nullptr : *index_it;
+  return (index_it == indices->cend()) ? nullptr : *index_it;
 }
 
 std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
@@ -121,10 +156,58 @@ std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
   return get_index(index_type, segments);
 }
 
+std::shared_ptr<BaseIndex> Chunk::create_index(const SegmentIndexType index_type,
+                                               const std::vector<ColumnID>& column_ids) {
+  auto index = _make_index(index_type, _get_segments_for_ids(column_ids));
+  _add_index(index);
+  return index;
+}
+
 void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
-  auto it = std::find(_indices.cbegin(), _indices.cend(), index);
-  DebugAssert(it != _indices.cend(), "Trying to remove a non-existing index");
-  _indices.erase(it);
+  std::lock_guard<std::mutex> lock(_indices_mutex);
+
+  auto indices = std::make_shared<std::vector<std::shared_ptr<BaseIndex>>>(*std::atomic_load(&_indices));
+  auto it = std::find(indices->cbegin(), indices->cend(), index);
+  DebugAssert(it != indices->cend(), "Trying to remove a non-existing index");
+  indices->erase(it);
+  std::atomic_store(&_indices, std::shared_ptr<const std::vector<std::shared_ptr<BaseIndex>>>(indices));
+}
+
+std::shared_ptr<DeltaIndex> Chunk::create_delta_index(const std::vector<ColumnID>& column_ids,
+                                                      const SegmentIndexType merge_type) {
+  DebugAssert(is_mutable(), "Immutable chunks have regular indexes");
+
+  auto data_types = std::vector<DataType>{};
+  for (const auto column_id : column_ids) {
+    data_types.emplace_back(get_segment(column_id)->data_type());
+  }
+
+  auto delta_index = std::make_shared<DeltaIndex>(column_ids, data_types, merge_type);
+  delta_index->insert(*this, ChunkOffset{0}, size());
+
+  std::unique_lock<std::shared_mutex> lock(_delta_indexes_mutex);
+  _delta_indexes.emplace_back(delta_index);
+  return delta_index;
+}
+
+std::vector<std::shared_ptr<DeltaIndex>> Chunk::delta_indexes() const {
+  std::shared_lock<std::shared_mutex> lock(_delta_indexes_mutex);
+  return _delta_indexes;
+}
+
+std::shared_ptr<DeltaIndex> Chunk::get_delta_index(const std::vector<ColumnID>& column_ids) const {
+  std::shared_lock<std::shared_mutex> lock(_delta_indexes_mutex);
+  const auto delta_index_it =
+      std::find_if(_delta_indexes.cbegin(), _delta_indexes.cend(),
+                   [&](const auto& delta_index) { return delta_index->is_index_for(column_ids); });
+  return (delta_index_it == _delta_indexes.cend()) ? nullptr : *delta_index_it;
+}
+
+void Chunk::remove_delta_index(const std::shared_ptr<DeltaIndex>& delta_index) {
+  std::unique_lock<std::shared_mutex> lock(_delta_indexes_mutex);
+  auto it = std::find(_delta_indexes.cbegin(), _delta_indexes.cend(), delta_index);
+  DebugAssert(it != _delta_indexes.cend(), "Trying to remove a non-existing delta index");
+  _delta_indexes.erase(it);
 }
 
 bool Chunk::references_exactly_one_table() const {
@@ -149,7 +232,7 @@ bool Chunk::references_exactly_one_table() const {
 
 void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
   // Migrating chunks with indices is not implemented yet.
-  if (!_indices.empty()) {
+  if (!std::atomic_load(&_indices)->empty()) {
     Fail("Cannot migrate Chunk with Indices.");
   }
 
@@ -199,6 +282,31 @@ std::vector<std::shared_ptr<const BaseSegment>> Chunk::_get_segments_for_ids(
   return segments;
 }
 
+std::shared_ptr<BaseIndex> Chunk::_make_index(const SegmentIndexType index_type,
+                                              const std::vector<std::shared_ptr<const BaseSegment>>& segments) {
+  switch (index_type) {
+    case SegmentIndexType::GroupKey:
+      return std::make_shared<GroupKeyIndex>(segments);
+    case SegmentIndexType::CompositeGroupKey:
+      return std::make_shared<CompositeGroupKeyIndex>(segments);
+    case SegmentIndexType::AdaptiveRadixTree:
+      return std::make_shared<AdaptiveRadixTreeIndex>(segments);
+    case SegmentIndexType::BTree:
+      return std::make_shared<BTreeIndex>(segments);
+    case SegmentIndexType::Invalid:
+      break;
+  }
+  Fail("Invalid index type");
+}
+
+void Chunk::_add_index(const std::shared_ptr<BaseIndex>& index) {
+  std::lock_guard<std::mutex> lock(_indices_mutex);
+
+  auto indices = std::make_shared<std::vector<std::shared_ptr<BaseIndex>>>(*std::atomic_load(&_indices));
+  indices->emplace_back(index);
+  std::atomic_store(&_indices, std::shared_ptr<const std::vector<std::shared_ptr<BaseIndex>>>(indices));
+}
+
 std::shared_ptr<ChunkStatistics> Chunk::statistics() const { return _statistics; }
 
 void Chunk::set_statistics(const std::shared_ptr<ChunkStatistics>& chunk_statistics) {
@@ -208,4 +316,56 @@ void Chunk::set_statistics(const std::shared_ptr<ChunkStatistics>& chunk_statist
   _statistics = chunk_statistics;
 }
 
+std::optional<std::pair<ColumnID, OrderByMode>> Chunk::ordered_by() const {
+  const auto packed_ordered_by = _ordered_by.load();
+  if (!packed_ordered_by) return std::nullopt;
+
+  // Bits 8 to 23 hold the column id, the lowest eight bits the OrderByMode (see set_ordered_by())
+  return std::make_pair(ColumnID{static_cast<ColumnID::base_type>(packed_ordered_by >> 8)},
+                        static_cast<OrderByMode>(packed_ordered_by & 0xFF));
+}
+
+void Chunk::set_ordered_by(const std::optional<std::pair<ColumnID, OrderByMode>>& ordered_by) {
+  DebugAssert(!ordered_by || ordered_by->first < column_count(), "Column with given ID does not exist.");
+  if (!ordered_by) {
+    _ordered_by = 0;
+    return;
+  }
+
+  // Bit 32 marks the metadata as set
+  const auto column_id = static_cast<uint64_t>(ordered_by->first);
+  _ordered_by = (uint64_t{1} << 32) | (column_id << 8) | static_cast<uint64_t>(ordered_by->second);
+}
+
+std::optional<CommitID> Chunk::cleanup_commit_id() const {
+  const auto cleanup_commit_id = _cleanup_commit_id.load();
+  if (cleanup_commit_id == MvccData::MAX_COMMIT_ID) return std::nullopt;
+  return cleanup_commit_id;
+}
+
+void Chunk::set_cleanup_commit_id(const CommitID cleanup_commit_id) {
+  DebugAssert(cleanup_commit_id != MvccData::MAX_COMMIT_ID, "Invalid cleanup commit id");
+  _cleanup_commit_id = cleanup_commit_id;
+}
+
+void Chunk::reclaim(const Segments& empty_segments) {
+  Assert(cleanup_commit_id(), "Only chunks without visible rows can be reclaimed");
+  Assert(empty_segments.size() == column_count(), "Need an empty segment per column");
+
+  {
+    std::lock_guard<std::mutex> lock(_indices_mutex);
+    std::atomic_store(&_indices, std::make_shared<const std::vector<std::shared_ptr<BaseIndex>>>());
+  }
+  {
+    std::unique_lock<std::shared_mutex> lock(_delta_indexes_mutex);
+    _delta_indexes.clear();
+  }
+  _statistics = nullptr;
+
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    DebugAssert(empty_segments[column_id]->size() == 0, "Segments must be empty");
+    std::atomic_store(&_segments[column_id], empty_segments[column_id]);
+  }
+}
+
 }  // namespace opossum
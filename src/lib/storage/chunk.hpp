@@ -9,8 +9,10 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "index/segment_index_type.hpp"
@@ -27,6 +29,7 @@ namespace opossum {
 
 class BaseIndex;
 class BaseSegment;
+class DeltaIndex;
 class ChunkStatistics;
 
 using Segments = pmr_vector<std::shared_ptr<BaseSegment>>;
@@ -52,7 +55,13 @@ class Chunk : private Noncopyable {
 
   void mark_immutable();
 
-  // Atomically replaces the current segment at column_id with the passed segment
+  /**
+   * Atomically replaces the current segment at column_id with the passed segment
+   *
+   * Indexes refer to the segments they were built on, so the indexes on the current segment are rebuilt on the passed
+   * one. The new indexes are added before the segments are exchanged and the previous ones are removed afterwards, so
+   * that concurrent lookups always find an index.
+   */
   void replace_segment(size_t column_id, const std::shared_ptr<BaseSegment>& segment);
 
   // returns the number of columns, which is equal to the number of segments (cannot exceed ColumnID (uint16_t))
@@ -118,7 +127,7 @@ class Chunk : private Noncopyable {
                 "All segments must be part of the chunk.");
 
     auto index = std::make_shared<Index>(segments_to_index);
-    _indices.emplace_back(index);
+    _add_index(index);
     return index;
   }
 
@@ -128,8 +137,31 @@ class Chunk : private Noncopyable {
     return create_index<Index>(segments);
   }
 
+  // Creates an index whose type is only known at runtime (e.g., the merge type of a DeltaIndex)
+  std::shared_ptr<BaseIndex> create_index(const SegmentIndexType index_type, const std::vector<ColumnID>& column_ids);
+
+  /**
+   * Indexes may be added and removed while operators look them up: The lookups see the indexes of the chunk either
+   * before or after the modification.
+   */
   void remove_index(const std::shared_ptr<BaseIndex>& index);
 
+  /**
+   * Regular indexes cannot be built on the ValueSegments of a mutable chunk. Instead, a DeltaIndex on @param column_ids
+   * is created, which is maintained as rows are inserted and replaced by an index of @param merge_type when the chunk
+   * is compressed. Rows that are already in the chunk are indexed right away.
+   */
+  std::shared_ptr<DeltaIndex> create_delta_index(const std::vector<ColumnID>& column_ids,
+                                                 const SegmentIndexType merge_type);
+
+  // The delta indexes are accessed and modified by concurrent inserts and scans, so a copy is returned
+  std::vector<std::shared_ptr<DeltaIndex>> delta_indexes() const;
+
+  // @return A DeltaIndex that can be used for lookups on @param column_ids, nullptr if there is none
+  std::shared_ptr<DeltaIndex> get_delta_index(const std::vector<ColumnID>& column_ids) const;
+
+  void remove_delta_index(const std::shared_ptr<DeltaIndex>& delta_index);
+
   void migrate(boost::container::pmr::memory_resource* memory_source);
 
   std::shared_ptr<ChunkAccessCounter> access_counter() const { return _access_counter; }
@@ -142,6 +174,35 @@ class Chunk : private Noncopyable {
 
   void set_statistics(const std::shared_ptr<ChunkStatistics>& chunk_statistics);
 
+  /**
+   * If set, the rows of the chunk are ordered by the values of the column ordered_by()->first, as the Sort operator
+   * orders them using ordered_by()->second. NULLs come first, except for the NullsLast modes. Operators use this to
+   * find ranges of values by binary search and to avoid sorting or hashing the chunk again.
+   * The metadata is set by the producer of the chunk (e.g., Sort or the ChunkEncoder) and is not maintained when rows
+   * are appended. Appending rows via append() resets it. It can be set while operators read it, so it is returned by
+   * value.
+   */
+  std::optional<std::pair<ColumnID, OrderByMode>> ordered_by() const;
+  void set_ordered_by(const std::optional<std::pair<ColumnID, OrderByMode>>& ordered_by);
+
+  /**
+   * If set, all rows of the chunk were deleted by transactions that committed up to this commit id, so that no
+   * transaction whose snapshot commit id is at least as large sees any of its rows. Validate skips such chunks without
+   * checking their rows and the ChunkPruningRule excludes them. It is set by the transaction that deleted the last
+   * rows of the chunk after its commit (see TableClusteringTask).
+   */
+  std::optional<CommitID> cleanup_commit_id() const;
+  void set_cleanup_commit_id(const CommitID cleanup_commit_id);
+
+  /**
+   * Frees the segments, indexes, and statistics of a chunk whose rows are not visible to any transaction anymore (see
+   * cleanup_commit_id() and TransactionManager::lowest_active_snapshot_commit_id()) by replacing the segments with
+   * @param empty_segments. The chunk stays in its table, so that the RowIDs of the following chunks do not change. The
+   * MVCC data is kept for operators that still reference rows of the chunk. Operators that hold a previous segment keep
+   * it alive until they release it.
+   */
+  void reclaim(const Segments& empty_segments);
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this chunk and its segments
    */
@@ -150,13 +211,30 @@ class Chunk : private Noncopyable {
  private:
   std::vector<std::shared_ptr<const BaseSegment>> _get_segments_for_ids(const std::vector<ColumnID>& column_ids) const;
 
+  // Builds an index of @param index_type on @param segments without adding it to the chunk
+  static std::shared_ptr<BaseIndex> _make_index(const SegmentIndexType index_type,
+                                                const std::vector<std::shared_ptr<const BaseSegment>>& segments);
+
+  void _add_index(const std::shared_ptr<BaseIndex>& index);
+
  private:
   PolymorphicAllocator<Chunk> _alloc;
   Segments _segments;
   std::shared_ptr<MvccData> _mvcc_data;
   std::shared_ptr<ChunkAccessCounter> _access_counter;
-  pmr_vector<std::shared_ptr<BaseIndex>> _indices;
+
+  // Replaced as a whole when an index is added or removed, so that lookups need no lock. Use std::atomic_load/store,
+  // modifications are serialized by _indices_mutex.
+  std::shared_ptr<const std::vector<std::shared_ptr<BaseIndex>>> _indices;
+  std::mutex _indices_mutex;
+
+  std::vector<std::shared_ptr<DeltaIndex>> _delta_indexes;
+  mutable std::shared_mutex _delta_indexes_mutex;
   std::shared_ptr<ChunkStatistics> _statistics;
+
+  // The ordered_by() metadata packed into one word, so that it is read and written atomically. 0 if it is not set.
+  std::atomic<uint64_t> _ordered_by{0};
+  std::atomic<CommitID> _cleanup_commit_id{MvccData::MAX_COMMIT_ID};
   bool _is_mutable = true;
 };
 
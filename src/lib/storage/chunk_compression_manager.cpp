@@ -0,0 +1,83 @@
+#include "chunk_compression_manager.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/base_value_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+
+namespace opossum {
+
+ChunkCompressionManager::ChunkCompressionManager() : ChunkCompressionManager(Options{}) {}
+
+ChunkCompressionManager::ChunkCompressionManager(const Options& options)
+    : _options(options),
+      _encoding_advisor(options.segment_encoding_spec
+                            ? nullptr
+                            : std::make_shared<const EncodingAdvisor>(options.encoding_advisor_options)) {
+  _loop_thread = std::make_unique<PausableLoopThread>(_options.interval, [this](size_t) { run(); });
+}
+
+std::map<std::string, std::vector<ChunkID>> ChunkCompressionManager::run() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto compressed_chunk_ids = std::map<std::string, std::vector<ChunkID>>{};
+  // The tables are held by the snapshot, so tables that are dropped concurrently can still be compressed safely.
+  // They are not looked up by name again, as a table with the same name might have been added in the meantime.
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    // A TableClusteringTask might compress the chunks of the table at the same time
+    const auto compression_lock = table->acquire_compression_mutex();
+
+    const auto chunk_ids = _find_completed_chunks(*table);
+    if (chunk_ids.empty()) continue;
+
+    if (_encoding_advisor) {
+      ChunkEncoder::encode_chunks(table, chunk_ids, *_encoding_advisor);
+    } else {
+      ChunkEncoder::encode_chunks(table, chunk_ids, *_options.segment_encoding_spec);
+    }
+
+    _compressed_chunk_count += chunk_ids.size();
+    compressed_chunk_ids.emplace(table_name, chunk_ids);
+  }
+
+  return compressed_chunk_ids;
+}
+
+void ChunkCompressionManager::resume() { _loop_thread->resume(); }
+
+void ChunkCompressionManager::pause() { _loop_thread->pause(); }
+
+size_t ChunkCompressionManager::compressed_chunk_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _compressed_chunk_count;
+}
+
+std::vector<ChunkID> ChunkCompressionManager::_find_completed_chunks(Table& table) const {
+  auto chunk_ids = std::vector<ChunkID>{};
+  if (table.type() != TableType::Data) return chunk_ids;
+
+  // Inserts append chunks while holding the append mutex, so the chunks can be listed safely. The chunks are
+  // compressed afterwards, without blocking inserts into the following chunks.
+  const auto append_lock = table.acquire_append_mutex();
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk->is_mutable() || chunk->column_count() == 0) continue;
+    if (!ChunkCompressionTask::chunk_is_completed(chunk, table.max_chunk_size())) continue;
+
+    // Chunks that were assembled from encoded segments are not compressed again
+    if (!std::dynamic_pointer_cast<const BaseValueSegment>(chunk->get_segment(ColumnID{0}))) continue;
+
+    chunk_ids.emplace_back(chunk_id);
+  }
+
+  return chunk_ids;
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+/**
+ * The ChunkCompressionManager compresses the chunks that the Insert operator filled, so that tables that only grow
+ * through inserts do not consist of ValueSegments forever. Every run, it looks for chunks of the stored tables that
+ * are still mutable but completed, i.e., they are full and all inserts into them were committed or rolled back (see
+ * ChunkCompressionTask). Usually, this is the chunk before the tail chunk of the table, as the Insert operator appends
+ * a new mutable chunk once the last one is full.
+ *
+ * The chunks are compressed by the ChunkEncoder, like a ChunkCompressionTask does, with the configured encoding or, if
+ * none is configured, with the encodings chosen by an EncodingAdvisor. The encoder generates the ChunkStatistics,
+ * exchanges the segments atomically so that concurrent readers are not blocked, and replaces the DeltaIndexes of the
+ * chunk with regular indexes. The TableIndexes of the table stay valid because the RowIDs do not change. The tables
+ * are taken from a snapshot of the StorageManager, so that tables can be added and dropped during a run. Each table is
+ * compressed while holding its compression mutex, so that it is not clustered at the same time (see
+ * TableClusteringTask).
+ *
+ * The manager is created in a paused state, see resume().
+ */
+class ChunkCompressionManager : private Noncopyable {
+ public:
+  struct Options {
+    // Time between two runs in the background, see resume()
+    std::chrono::milliseconds interval = std::chrono::seconds(1);
+
+    // Encoding of all segments. If not set, the EncodingAdvisor chooses the encoding of each segment.
+    std::optional<SegmentEncodingSpec> segment_encoding_spec;
+
+    EncodingAdvisor::Options encoding_advisor_options;
+  };
+
+  ChunkCompressionManager();
+  explicit ChunkCompressionManager(const Options& options);
+
+  /**
+   * Compresses all completed mutable chunks of the stored tables
+   * @return The IDs of the compressed chunks per table name
+   */
+  std::map<std::string, std::vector<ChunkID>> run();
+
+  // Starts (or continues) running the manager periodically in a background thread
+  void resume();
+  void pause();
+
+  // Number of chunks compressed so far
+  size_t compressed_chunk_count() const;
+
+ protected:
+  // The completed mutable chunks of @param table
+  std::vector<ChunkID> _find_completed_chunks(Table& table) const;
+
+  const Options _options;
+  const std::shared_ptr<const EncodingAdvisor> _encoding_advisor;
+
+  size_t _compressed_chunk_count{0};
+  mutable std::mutex _mutex;
+
+  // Declared last, so that the thread is stopped before the other members are destroyed
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
@@ -1,29 +1,101 @@
 #include "chunk_encoder.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <map>
 #include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "base_value_segment.hpp"
 #include "chunk.hpp"
+#include "resolve_type.hpp"
 #include "table.hpp"
 #include "types.hpp"
+#include "value_segment.hpp"
 
+#include "scheduler/job_batch.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "statistics/chunk_statistics/segment_statistics.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/global_dictionary_encoder.hpp"
+#include "storage/index/delta_index.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// @return the order of the values of @param base_value_segment if they are sorted with NULLs first. Segments with a
+// single distinct value are not considered to be sorted, as knowing their order does not help.
+std::optional<OrderByMode> find_order_by_mode(const DataType data_type, const BaseValueSegment& base_value_segment) {
+  auto order_by_mode = std::optional<OrderByMode>{};
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto& value_segment = static_cast<const ValueSegment<ColumnDataType>&>(base_value_segment);
+    const auto& values = value_segment.values();
+
+    auto first_value_offset = size_t{0};
+    if (value_segment.is_nullable()) {
+      const auto& null_values = value_segment.null_values();
+      while (first_value_offset < null_values.size() && null_values[first_value_offset]) ++first_value_offset;
+      if (std::find(null_values.cbegin() + first_value_offset, null_values.cend(), true) != null_values.cend()) return;
+    }
+
+    auto is_ascending = true;
+    auto is_descending = true;
+    for (auto chunk_offset = first_value_offset; chunk_offset < values.size(); ++chunk_offset) {
+      if constexpr (std::is_floating_point_v<ColumnDataType>) {
+        // NaNs cannot be ordered
+        if (std::isnan(values[chunk_offset])) return;
+      }
+
+      if (chunk_offset == first_value_offset) continue;
+      is_ascending &= !(values[chunk_offset] < values[chunk_offset - 1]);
+      is_descending &= !(values[chunk_offset - 1] < values[chunk_offset]);
+      if (!is_ascending && !is_descending) return;
+    }
+
+    if (is_ascending && is_descending) return;
+    order_by_mode = is_ascending ? OrderByMode::Ascending : OrderByMode::Descending;
+  });
+
+  return order_by_mode;
+}
+
+}  // namespace
+
 namespace opossum {
 
 void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& data_types,
                                 const ChunkEncodingSpec& chunk_encoding_spec) {
+  _encode_chunk(chunk, data_types, chunk_encoding_spec);
+  _merge_delta_indexes(*chunk);
+}
+
+void ChunkEncoder::_encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& data_types,
+                                 const ChunkEncodingSpec& chunk_encoding_spec) {
   Assert((data_types.size() == chunk->column_count()), "Number of column types must match the chunk’s column count.");
   Assert((chunk_encoding_spec.size() == chunk->column_count()),
          "Number of column encoding specs must match the chunk’s column count.");
+  Assert(std::none_of(chunk_encoding_spec.cbegin(), chunk_encoding_spec.cend(),
+                      [](const auto& spec) { return spec.global_dictionary; }),
+         "Global dictionaries span the chunks of a table, use encode_chunks()");
+
+  // The segments are encoded in parallel, each job writes the statistics of its segment. Unless the order of the
+  // chunk is known, the jobs also find out whether the values of their segment are sorted.
+  std::vector<std::shared_ptr<SegmentStatistics>> column_statistics(chunk->column_count());
+  auto order_by_modes = std::vector<std::optional<OrderByMode>>(chunk->column_count());
+  const auto find_order = !chunk->ordered_by();
 
-  std::vector<std::shared_ptr<SegmentStatistics>> column_statistics;
-  for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+  const auto encode_segment_by_idx = [&](const size_t column_idx) {
+    const auto column_id = static_cast<ColumnID>(column_idx);
     const auto spec = chunk_encoding_spec[column_id];
 
     const auto data_type = data_types[column_id];
@@ -32,14 +104,26 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
 
     Assert(value_segment != nullptr, "All segments of the chunk need to be of type ValueSegment<T>");
 
+    if (find_order) order_by_modes[column_id] = find_order_by_mode(data_type, *value_segment);
+
     if (spec.encoding_type == EncodingType::Unencoded) {
       // No need to encode, but we still want to have statistics for the now immutable value segment
-      column_statistics.push_back(SegmentStatistics::build_statistics(data_type, value_segment));
+      column_statistics[column_id] = SegmentStatistics::build_statistics(data_type, value_segment);
     } else {
-      auto encoded_segment = encode_segment(spec.encoding_type, data_type, value_segment, spec.vector_compression_type);
+      auto encoded_segment =
+          encode_segment(spec.encoding_type, data_type, value_segment, spec.vector_compression_type);
       chunk->replace_segment(column_id, encoded_segment);
-      column_statistics.push_back(SegmentStatistics::build_statistics(data_type, encoded_segment));
+      column_statistics[column_id] = SegmentStatistics::build_statistics(data_type, encoded_segment);
     }
+  };
+  JobBatch{chunk->column_count(), encode_segment_by_idx}.schedule_and_wait();
+
+  // The chunk is considered to be ordered by the first sorted column
+  const auto order_by_mode_it =
+      std::find_if(order_by_modes.cbegin(), order_by_modes.cend(), [](const auto& mode) { return mode.has_value(); });
+  if (order_by_mode_it != order_by_modes.cend()) {
+    const auto column_id = static_cast<ColumnID>(std::distance(order_by_modes.cbegin(), order_by_mode_it));
+    chunk->set_ordered_by(std::make_pair(column_id, **order_by_mode_it));
   }
 
   chunk->mark_immutable();
@@ -60,62 +144,124 @@ void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std:
                                  const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs) {
   const auto data_types = table->column_data_types();
 
-  for (auto chunk_id : chunk_ids) {
-    Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
-
-    auto chunk = table->get_chunk(chunk_id);
+  // Segments that use a global dictionary are left unencoded while the chunks are encoded. Afterwards, the
+  // GlobalDictionaryEncoder encodes them for all chunks of their column at once.
+  auto global_dictionary_specs = std::map<ColumnID, SegmentEncodingSpec>{};
+  auto global_dictionary_chunk_ids = std::map<ColumnID, std::vector<ChunkID>>{};
+  for (const auto chunk_id : chunk_ids) {
     const auto& chunk_encoding_spec = chunk_encoding_specs.at(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < chunk_encoding_spec.size(); ++column_id) {
+      const auto& segment_encoding_spec = chunk_encoding_spec[column_id];
+      if (!segment_encoding_spec.global_dictionary) continue;
+
+      Assert(segment_encoding_spec.encoding_type == EncodingType::Dictionary,
+             "Global dictionaries are only supported by dictionary encoding");
+      global_dictionary_specs.emplace(column_id, segment_encoding_spec);
+      global_dictionary_chunk_ids[column_id].emplace_back(chunk_id);
+    }
+  }
 
-    encode_chunk(chunk, data_types, chunk_encoding_spec);
+  for (const auto chunk_id : chunk_ids) {
+    Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
   }
+
+  const auto encode_chunk_by_idx = [&](const size_t chunk_idx) {
+    const auto chunk_id = chunk_ids[chunk_idx];
+    auto chunk_encoding_spec = chunk_encoding_specs.at(chunk_id);
+    for (auto& segment_encoding_spec : chunk_encoding_spec) {
+      if (segment_encoding_spec.global_dictionary) segment_encoding_spec = SegmentEncodingSpec{EncodingType::Unencoded};
+    }
+
+    _encode_chunk(table->get_chunk(chunk_id), data_types, chunk_encoding_spec);
+  };
+  JobBatch{chunk_ids.size(), encode_chunk_by_idx}.schedule_and_wait();
+
+  // The global dictionary of a column does not depend on the other columns
+  const auto global_dictionary_columns =
+      std::vector<std::pair<ColumnID, std::vector<ChunkID>>>{global_dictionary_chunk_ids.cbegin(),
+                                                             global_dictionary_chunk_ids.cend()};
+  const auto encode_global_dictionary_column_by_idx = [&](const size_t column_idx) {
+    const auto& [column_id, column_chunk_ids] = global_dictionary_columns[column_idx];
+    const auto vector_compression_type = global_dictionary_specs.at(column_id).vector_compression_type;
+    GlobalDictionaryEncoder::encode_chunks(table, column_id, column_chunk_ids, vector_compression_type);
+  };
+  JobBatch{global_dictionary_columns.size(), encode_global_dictionary_column_by_idx}.schedule_and_wait();
+
+  // Indexes can only be built on the final segments, so the DeltaIndexes are merged once the global dictionaries are
+  // in place
+  const auto merge_delta_indexes_by_idx = [&](const size_t chunk_idx) {
+    _merge_delta_indexes(*table->get_chunk(chunk_ids[chunk_idx]));
+  };
+  JobBatch{chunk_ids.size(), merge_delta_indexes_by_idx}.schedule_and_wait();
 }
 
 void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
                                  const SegmentEncodingSpec& segment_encoding_spec) {
-  const auto data_types = table->column_data_types();
-
-  for (auto chunk_id : chunk_ids) {
-    Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
-    auto chunk = table->get_chunk(chunk_id);
+  const auto chunk_encoding_spec = ChunkEncodingSpec{table->column_count(), segment_encoding_spec};
+  encode_chunks(table, chunk_ids, _chunk_encoding_specs(chunk_ids, chunk_encoding_spec));
+}
 
-    encode_chunk(chunk, data_types, segment_encoding_spec);
-  }
+void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
+                                 const EncodingAdvisor& encoding_advisor) {
+  encode_chunks(table, chunk_ids, encoding_advisor.advise_chunks(*table, chunk_ids));
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
                                      const std::vector<ChunkEncodingSpec>& chunk_encoding_specs) {
-  const auto column_types = table->column_data_types();
   const auto chunk_count = static_cast<size_t>(table->chunk_count());
   Assert(chunk_encoding_specs.size() == chunk_count, "Number of encoding specs must match table’s chunk count.");
 
-  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    auto chunk = table->get_chunk(chunk_id);
-    const auto chunk_encoding_spec = chunk_encoding_specs[chunk_id];
-
-    encode_chunk(chunk, column_types, chunk_encoding_spec);
+  auto chunk_encoding_specs_by_chunk_id = std::map<ChunkID, ChunkEncodingSpec>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunk_encoding_specs_by_chunk_id.emplace(chunk_id, chunk_encoding_specs[chunk_id]);
   }
+
+  encode_chunks(table, _all_chunk_ids(*table), chunk_encoding_specs_by_chunk_id);
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
                                      const ChunkEncodingSpec& chunk_encoding_spec) {
   Assert(chunk_encoding_spec.size() == table->column_count(),
          "Number of encoding specs must match table’s column count.");
-  const auto column_types = table->column_data_types();
 
-  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    auto chunk = table->get_chunk(chunk_id);
-    encode_chunk(chunk, column_types, chunk_encoding_spec);
-  }
+  const auto chunk_ids = _all_chunk_ids(*table);
+  encode_chunks(table, chunk_ids, _chunk_encoding_specs(chunk_ids, chunk_encoding_spec));
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
                                      const SegmentEncodingSpec& segment_encoding_spec) {
-  const auto column_types = table->column_data_types();
+  encode_chunks(table, _all_chunk_ids(*table), segment_encoding_spec);
+}
+
+void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table, const EncodingAdvisor& encoding_advisor) {
+  encode_chunks(table, _all_chunk_ids(*table), encoding_advisor);
+}
+
+std::vector<ChunkID> ChunkEncoder::_all_chunk_ids(const Table& table) {
+  auto chunk_ids = std::vector<ChunkID>{};
+  chunk_ids.reserve(table.chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    chunk_ids.emplace_back(chunk_id);
+  }
+  return chunk_ids;
+}
+
+std::map<ChunkID, ChunkEncodingSpec> ChunkEncoder::_chunk_encoding_specs(const std::vector<ChunkID>& chunk_ids,
+                                                                         const ChunkEncodingSpec& chunk_encoding_spec) {
+  auto chunk_encoding_specs = std::map<ChunkID, ChunkEncodingSpec>{};
+  for (const auto chunk_id : chunk_ids) {
+    chunk_encoding_specs.emplace(chunk_id, chunk_encoding_spec);
+  }
+  return chunk_encoding_specs;
+}
 
-  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    auto chunk = table->get_chunk(chunk_id);
+void ChunkEncoder::_merge_delta_indexes(Chunk& chunk) {
+  for (const auto& delta_index : chunk.delta_indexes()) {
+    const auto& column_ids = delta_index->column_ids();
 
-    encode_chunk(chunk, column_types, segment_encoding_spec);
+    // The regular index is created before the DeltaIndex is removed, so that concurrent scans always find an index
+    chunk.create_index(delta_index->merge_type(), column_ids);
+    chunk.remove_delta_index(delta_index);
   }
 }
 
@@ -15,6 +15,7 @@
 namespace opossum {
 
 class Chunk;
+class EncodingAdvisor;
 class Table;
 
 struct SegmentEncodingSpec {
@@ -25,6 +26,10 @@ struct SegmentEncodingSpec {
 
   EncodingType encoding_type;
   std::optional<VectorCompressionType> vector_compression_type;
+
+  // Only for EncodingType::Dictionary: The segments of all immutable chunks of the column share one dictionary. This
+  // requires the chunks of a table to be encoded together, see GlobalDictionaryEncoder.
+  bool global_dictionary = false;
 };
 
 using ChunkEncodingSpec = std::vector<SegmentEncodingSpec>;
@@ -34,6 +39,8 @@ using ChunkEncodingSpec = std::vector<SegmentEncodingSpec>;
  *
  * The methods provided are not thread-safe and might lead to race conditions
  * if there are other operations manipulating the chunks at the same time.
+ *
+ * The chunks, and the segments of each chunk, are encoded in parallel by jobs of the CurrentScheduler.
  */
 class ChunkEncoder {
  public:
@@ -48,6 +55,14 @@ class ChunkEncoder {
    * Note: In some cases, it might be benificial to
    *       leave certain segments of a chunk unencoded.
    *       Use EncodingType::Unencoded in this case.
+   *
+   * If the chunk's order is not known yet, the chunk is marked as ordered by its first column whose values are sorted
+   * (see Chunk::ordered_by()).
+   *
+   * The DeltaIndexes of the chunk (see Chunk::create_delta_index()) are replaced by indexes of their merge type on the
+   * encoded segments.
+   *
+   * Global dictionaries are not supported, as they span the chunks of a table. Use encode_chunks() instead.
    */
   static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& data_types,
                            const ChunkEncodingSpec& chunk_encoding_spec);
@@ -61,7 +76,9 @@ class ChunkEncoder {
   /**
    * @brief Encodes the specified chunks of the passed table
    *
-   * The encoding is specified per segment for each chunk.
+   * The encoding is specified per segment for each chunk. Segments that use a global dictionary are encoded by the
+   * GlobalDictionaryEncoder once all chunks were encoded. The DeltaIndexes of the chunks are merged afterwards, so
+   * that the indexes are built on the final segments.
    */
   static void encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
                             const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs);
@@ -72,6 +89,12 @@ class ChunkEncoder {
   static void encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
                             const SegmentEncodingSpec& segment_encoding_spec = {});
 
+  /**
+   * @brief Encodes the specified chunks of the passed table using the encodings chosen by the advisor
+   */
+  static void encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
+                            const EncodingAdvisor& encoding_advisor);
+
   /**
    * @brief Encodes an entire table
    *
@@ -92,6 +115,25 @@ class ChunkEncoder {
    */
   static void encode_all_chunks(const std::shared_ptr<Table>& table,
                                 const SegmentEncodingSpec& segment_encoding_spec = {});
+
+  /**
+   * @brief Encodes an entire table using the encodings chosen by the advisor
+   */
+  static void encode_all_chunks(const std::shared_ptr<Table>& table, const EncodingAdvisor& encoding_advisor);
+
+ private:
+  static std::vector<ChunkID> _all_chunk_ids(const Table& table);
+
+  // Like encode_chunk(), but leaves the DeltaIndexes of @param chunk in place
+  static void _encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& data_types,
+                            const ChunkEncodingSpec& chunk_encoding_spec);
+
+  // Replaces each DeltaIndex of the (encoded) @param chunk with an index of its merge type
+  static void _merge_delta_indexes(Chunk& chunk);
+
+  // The same @param chunk_encoding_spec for each of @param chunk_ids
+  static std::map<ChunkID, ChunkEncodingSpec> _chunk_encoding_specs(const std::vector<ChunkID>& chunk_ids,
+                                                                    const ChunkEncodingSpec& chunk_encoding_spec);
 };
 
 }  // namespace opossum
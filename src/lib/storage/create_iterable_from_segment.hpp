@@ -4,7 +4,10 @@
 #include "storage/encoding_type.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 
+#include "storage/alp_segment/alp_segment_iterable.hpp"
 #include "storage/frame_of_reference/frame_of_reference_iterable.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
+#include "storage/pfor_delta_segment/pfor_delta_iterable.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment/run_length_segment_iterable.hpp"
 #include "storage/value_segment/value_segment_iterable.hpp"
@@ -49,11 +52,31 @@ auto create_iterable_from_segment(const FixedStringDictionarySegment<T>& segment
   return erase_type_from_iterable_if_debug(DictionarySegmentIterable<T, FixedStringVector>{segment});
 }
 
+template <typename T>
+auto create_iterable_from_segment(const FrontCodedDictionarySegment<T>& segment) {
+  return erase_type_from_iterable_if_debug(DictionarySegmentIterable<T, FrontCodedStringVector>{segment});
+}
+
 template <typename T>
 auto create_iterable_from_segment(const FrameOfReferenceSegment<T>& segment) {
   return erase_type_from_iterable_if_debug(FrameOfReferenceIterable<T>{segment});
 }
 
+template <typename T>
+auto create_iterable_from_segment(const FSSTSegment<T>& segment) {
+  return erase_type_from_iterable_if_debug(FSSTSegmentIterable<T>{segment});
+}
+
+template <typename T>
+auto create_iterable_from_segment(const PFORDeltaSegment<T>& segment) {
+  return erase_type_from_iterable_if_debug(PFORDeltaIterable<T>{segment});
+}
+
+template <typename T>
+auto create_iterable_from_segment(const ALPSegment<T>& segment) {
+  return erase_type_from_iterable_if_debug(ALPSegmentIterable<T>{segment});
+}
+
 /**
  * This function must be forward-declared because ReferenceSegmentIterable
  * includes this file leading to a circular dependency
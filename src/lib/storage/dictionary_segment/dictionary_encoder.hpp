@@ -1,13 +1,18 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
+#include "bytell_hash_map.hpp"
 #include "storage/base_segment_encoder.hpp"
 
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/front_coded_dictionary_segment.hpp"
 #include "storage/value_segment.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 
@@ -22,6 +27,11 @@ namespace opossum {
  *
  * The algorithm first creates an attribute vector of standard size (uint32_t) and then compresses it
  * using fixed-size byte-aligned encoding.
+ *
+ * Segments with many duplicates are deduplicated with a hash map first, so that only the distinct values are sorted
+ * and each value id is found with a hash lookup instead of a binary search in the dictionary. Once the hash map holds
+ * more than a share of the segment's values (see MIN_VALUES_PER_HASHED_DISTINCT_VALUE), the encoder falls back to
+ * sorting all values.
  */
 template <auto Encoding>
 class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
@@ -29,6 +39,9 @@ class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
   static constexpr auto _encoding_type = enum_c<EncodingType, Encoding>;
   static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
 
+  // Minimum average number of occurrences of each distinct value for the dictionary to be built with a hash map
+  static constexpr auto MIN_VALUES_PER_HASHED_DISTINCT_VALUE = size_t{8};
+
   template <typename T>
   std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
     // See: https://goo.gl/MCM5rr
@@ -41,7 +54,10 @@ class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
           FixedStringVector{values.cbegin(), values.cend(), _calculate_fixed_string_length(values), values.size()},
           value_segment);
     } else {
-      // Encode a segment with a pmr_vector<T> as dictionary
+      // Encode a segment with a pmr_vector<T> as dictionary. For FrontCodedDictionary, the sorted dictionary is
+      // front coded after the value ids were assigned.
+      if (auto encoded_segment = _encode_with_hash_map(value_segment)) return encoded_segment;
+
       return _encode_dictionary_segment(pmr_vector<T>{values.cbegin(), values.cend(), values.get_allocator()},
                                         value_segment);
     }
@@ -112,18 +128,97 @@ class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
       }
     }
 
+    return _create_segment<T>(std::move(dictionary), attribute_vector, null_value_id, alloc);
+  }
+
+  /**
+   * Builds the dictionary from the distinct values in a hash map
+   * @return nullptr if the segment has too many distinct values, see MIN_VALUES_PER_HASHED_DISTINCT_VALUE
+   */
+  template <typename T>
+  std::shared_ptr<BaseEncodedSegment> _encode_with_hash_map(
+      const std::shared_ptr<const ValueSegment<T>>& value_segment) {
+    const auto& values = value_segment->values();
+    const auto alloc = values.get_allocator();
+    const auto max_distinct_count = values.size() / MIN_VALUES_PER_HASHED_DISTINCT_VALUE;
+
+    const auto* null_values = value_segment->is_nullable() ? &value_segment->null_values() : nullptr;
+
+    // Calls @param functor for each value with a flag whether it is null
+    const auto for_each_value = [&](const auto& functor) {
+      auto value_it = values.cbegin();
+      if (null_values) {
+        auto null_value_it = null_values->cbegin();
+        for (; value_it != values.cend(); ++value_it, ++null_value_it) {
+          if (!functor(*value_it, *null_value_it)) return false;
+        }
+      } else {
+        for (; value_it != values.cend(); ++value_it) {
+          if (!functor(*value_it, false)) return false;
+        }
+      }
+      return true;
+    };
+
+    // The value ids are assigned once all distinct values are known and sorted
+    auto value_ids = ska::bytell_hash_map<T, ValueID>{};
+    const auto all_values_hashed = for_each_value([&](const T& value, const bool is_null) {
+      if (is_null) return true;
+
+      // NaN is not equal to itself, so it could not be found in the hash map again
+      if constexpr (std::is_floating_point_v<T>) {
+        if (std::isnan(value)) return false;
+      }
+
+      value_ids.emplace(value, ValueID{0});
+      return value_ids.size() <= max_distinct_count;
+    });
+    if (!all_values_hashed) return nullptr;
+
+    auto dictionary = pmr_vector<T>{alloc};
+    dictionary.reserve(value_ids.size());
+    for (const auto& value_id_entry : value_ids) {
+      dictionary.push_back(value_id_entry.first);
+    }
+    std::sort(dictionary.begin(), dictionary.end());
+
+    for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+      value_ids[dictionary[value_id]] = static_cast<ValueID>(value_id);
+    }
+
+    const auto null_value_id = static_cast<uint32_t>(dictionary.size());
+
+    auto attribute_vector = pmr_vector<uint32_t>{alloc};
+    attribute_vector.reserve(values.size());
+    for_each_value([&](const T& value, const bool is_null) {
+      attribute_vector.push_back(is_null ? null_value_id : static_cast<uint32_t>(value_ids.find(value)->second));
+      return true;
+    });
+
+    return _create_segment<T>(std::move(dictionary), attribute_vector, null_value_id, alloc);
+  }
+
+  template <typename T, typename U, typename Allocator>
+  std::shared_ptr<BaseEncodedSegment> _create_segment(U dictionary, const pmr_vector<uint32_t>& attribute_vector,
+                                                      const uint32_t null_value_id, const Allocator& alloc) {
     // We need to increment the dictionary size here because of possible null values.
     const auto max_value = dictionary.size() + 1u;
 
     auto encoded_attribute_vector = compress_vector(
         attribute_vector, SegmentEncoder<DictionaryEncoder<Encoding>>::vector_compression_type(), alloc, {max_value});
-    auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
     auto attribute_vector_sptr = std::shared_ptr<const BaseCompressedVector>(std::move(encoded_attribute_vector));
 
-    if constexpr (Encoding == EncodingType::FixedStringDictionary) {
+    if constexpr (Encoding == EncodingType::FrontCodedDictionary) {
+      auto dictionary_sptr =
+          std::allocate_shared<FrontCodedStringVector>(alloc, dictionary.cbegin(), dictionary.cend(), alloc);
+      return std::allocate_shared<FrontCodedDictionarySegment<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
+                                                                  ValueID{null_value_id});
+    } else if constexpr (Encoding == EncodingType::FixedStringDictionary) {
+      auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
       return std::allocate_shared<FixedStringDictionarySegment<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
                                                                    ValueID{null_value_id});
     } else {
+      auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
       return std::allocate_shared<DictionarySegment<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
                                                         ValueID{null_value_id});
     }
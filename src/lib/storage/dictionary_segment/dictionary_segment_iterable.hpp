@@ -6,6 +6,7 @@
 
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/front_coded_dictionary_segment.hpp"
 
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
@@ -20,6 +21,9 @@ class DictionarySegmentIterable : public PointAccessibleSegmentIterable<Dictiona
   explicit DictionarySegmentIterable(const FixedStringDictionarySegment<std::string>& segment)
       : _segment{segment}, _dictionary(segment.fixed_string_dictionary()) {}
 
+  explicit DictionarySegmentIterable(const FrontCodedDictionarySegment<std::string>& segment)
+      : _segment{segment}, _dictionary(segment.front_coded_dictionary()) {}
+
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
     resolve_compressed_vector_type(*_segment.attribute_vector(), [&](const auto& vector) {
@@ -79,10 +83,10 @@ class DictionarySegmentIterable : public PointAccessibleSegmentIterable<Dictiona
 
       if (is_null) return SegmentIteratorValue<T>{T{}, true, _chunk_offset};
 
-      if constexpr (std::is_same_v<Dictionary, FixedStringVector>) {
-        return SegmentIteratorValue<T>{_dictionary.get_string_at(value_id), false, _chunk_offset};
-      } else {
+      if constexpr (std::is_same_v<Dictionary, pmr_vector<T>>) {
         return SegmentIteratorValue<T>{_dictionary[value_id], false, _chunk_offset};
+      } else {
+        return SegmentIteratorValue<T>{_dictionary.get_string_at(value_id), false, _chunk_offset};
       }
     }
 
@@ -118,10 +122,10 @@ class DictionarySegmentIterable : public PointAccessibleSegmentIterable<Dictiona
 
       if (is_null) return SegmentIteratorValue<T>{T{}, true, chunk_offsets.offset_in_poslist};
 
-      if constexpr (std::is_same_v<Dictionary, FixedStringVector>) {
-        return SegmentIteratorValue<T>{_dictionary.get_string_at(value_id), false, chunk_offsets.offset_in_poslist};
-      } else {
+      if constexpr (std::is_same_v<Dictionary, pmr_vector<T>>) {
         return SegmentIteratorValue<T>{_dictionary[value_id], false, chunk_offsets.offset_in_poslist};
+      } else {
+        return SegmentIteratorValue<T>{_dictionary.get_string_at(value_id), false, chunk_offsets.offset_in_poslist};
       }
     }
 
@@ -0,0 +1,278 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/base_segment_encoder.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_access_counter.hpp"
+#include "storage/index/delta_index.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Rough per-value costs of decoding a segment sequentially, relative to reading a ValueSegment. RunLength segments
+ * decode a run at a time, so their cost depends on the share of values that start a new run.
+ */
+float estimate_decode_cost(const EncodingType encoding_type,
+                           const std::optional<VectorCompressionType> vector_compression_type, const float run_share) {
+  auto decode_cost = 1.0f;
+  switch (encoding_type) {
+    case EncodingType::Unencoded:
+      decode_cost = 1.0f;
+      break;
+    case EncodingType::Dictionary:
+      decode_cost = 1.3f;
+      break;
+    case EncodingType::RunLength:
+      decode_cost = 0.3f + 1.2f * run_share;
+      break;
+    case EncodingType::FixedStringDictionary:
+      decode_cost = 1.5f;
+      break;
+    case EncodingType::FrameOfReference:
+      decode_cost = 1.2f;
+      break;
+    case EncodingType::FrontCodedDictionary:
+      decode_cost = 2.5f;
+      break;
+    case EncodingType::FSST:
+      decode_cost = 3.0f;
+      break;
+    case EncodingType::PFORDelta:
+      decode_cost = 1.5f;
+      break;
+    case EncodingType::ALP:
+      decode_cost = 1.6f;
+      break;
+  }
+
+  if (!vector_compression_type) return decode_cost;
+
+  // SIMD-BP128 only supports sequential access efficiently, bit-packed values need to be shifted and masked
+  switch (*vector_compression_type) {
+    case VectorCompressionType::SimdBp128:
+      return decode_cost * 1.4f;
+    case VectorCompressionType::BitPacked:
+      return decode_cost * 1.2f;
+    default:
+      return decode_cost;
+  }
+}
+
+// Whether an index of @param index_type can be built on a segment encoded with @param spec
+bool supports_index(const SegmentEncodingSpec& spec, const SegmentIndexType index_type) {
+  const auto is_dictionary_encoded = spec.encoding_type == EncodingType::Dictionary ||
+                                     spec.encoding_type == EncodingType::FixedStringDictionary ||
+                                     spec.encoding_type == EncodingType::FrontCodedDictionary;
+  switch (index_type) {
+    case SegmentIndexType::GroupKey:
+    case SegmentIndexType::AdaptiveRadixTree:
+      return is_dictionary_encoded;
+    case SegmentIndexType::CompositeGroupKey: {
+      // FixedSizeByteAligned is the default vector compression of the encoders
+      const auto vector_compression_type =
+          spec.vector_compression_type.value_or(VectorCompressionType::FixedSizeByteAligned);
+      return is_dictionary_encoded && vector_compression_type == VectorCompressionType::FixedSizeByteAligned;
+    }
+    case SegmentIndexType::BTree:
+      return true;
+    case SegmentIndexType::Invalid:
+      break;
+  }
+  Fail("Invalid index type");
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::ostream& operator<<(std::ostream& stream, const EncodingCandidate& candidate) {
+  stream << encoding_type_to_string.left.at(candidate.spec.encoding_type);
+  if (candidate.spec.vector_compression_type) {
+    stream << " (" << vector_compression_type_to_string.left.at(*candidate.spec.vector_compression_type) << ")";
+  }
+  stream << ": size " << format_bytes(candidate.memory_usage) << ", decode cost " << candidate.decode_cost
+         << ", cost " << candidate.cost;
+  return stream;
+}
+
+EncodingAdvisor::EncodingAdvisor() : EncodingAdvisor(Options{}) {}
+
+EncodingAdvisor::EncodingAdvisor(const Options& options) : _options(options) {
+  Assert(_options.sample_size > 0 && _options.sample_stretch_count > 0, "Sample must not be empty");
+}
+
+std::vector<EncodingCandidate> EncodingAdvisor::estimate_candidates(
+    const std::shared_ptr<const BaseValueSegment>& segment, const DataType data_type, const float access_share,
+    const std::vector<SegmentIndexType>& index_types) const {
+  DebugAssert(segment->size() > 0, "Cannot estimate the encodings of an empty segment");
+
+  const auto sample = _sample(segment, data_type);
+  const auto scale = static_cast<float>(segment->size()) / static_cast<float>(sample->size());
+  const auto unencoded_memory_usage = sample->estimate_memory_usage();
+  const auto decode_weight = _options.base_decode_weight + access_share * _options.access_decode_weight;
+
+  auto candidates = std::vector<EncodingCandidate>{};
+  const auto add_candidate = [&](const SegmentEncodingSpec& spec, const size_t memory_usage, const float run_share) {
+    const auto decode_cost = estimate_decode_cost(spec.encoding_type, spec.vector_compression_type, run_share);
+    const auto compression_ratio = static_cast<float>(memory_usage) / static_cast<float>(unencoded_memory_usage);
+    candidates.push_back({spec, static_cast<size_t>(static_cast<float>(memory_usage) * scale), decode_cost,
+                          compression_ratio + decode_weight * decode_cost});
+  };
+
+  for (const auto& entry : encoding_type_to_string.left) {
+    const auto encoding_type = entry.first;
+    if (!encoding_supports_data_type(encoding_type, data_type)) continue;
+
+    if (encoding_type == EncodingType::Unencoded) {
+      if (!index_types.empty()) continue;
+      add_candidate(SegmentEncodingSpec{encoding_type}, unencoded_memory_usage, 1.0f);
+      continue;
+    }
+
+    auto vector_compression_types = std::vector<std::optional<VectorCompressionType>>{std::nullopt};
+    if (create_encoder(encoding_type)->uses_vector_compression()) {
+      vector_compression_types.clear();
+      for (const auto& vector_compression_entry : vector_compression_type_to_string.left) {
+        vector_compression_types.emplace_back(vector_compression_entry.first);
+      }
+    }
+
+    for (const auto& vector_compression_type : vector_compression_types) {
+      auto spec = SegmentEncodingSpec{encoding_type};
+      spec.vector_compression_type = vector_compression_type;
+      const auto supports_indexes = std::all_of(index_types.cbegin(), index_types.cend(), [&](const auto index_type) {
+        return supports_index(spec, index_type);
+      });
+      if (!supports_indexes) continue;
+
+      const auto encoded_segment = encode_segment(encoding_type, data_type, sample, vector_compression_type);
+
+      auto run_share = 1.0f;
+      if (encoding_type == EncodingType::RunLength) {
+        resolve_data_type(data_type, [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          const auto& run_length_segment = static_cast<const RunLengthSegment<ColumnDataType>&>(*encoded_segment);
+          run_share = static_cast<float>(run_length_segment.values()->size()) / static_cast<float>(sample->size());
+        });
+      }
+
+      add_candidate(spec, encoded_segment->estimate_memory_usage(), run_share);
+    }
+  }
+
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.cost < rhs.cost; });
+  return candidates;
+}
+
+SegmentEncodingSpec EncodingAdvisor::advise_segment(const std::shared_ptr<const BaseValueSegment>& segment,
+                                                    const DataType data_type, const float access_share,
+                                                    const std::vector<SegmentIndexType>& index_types) const {
+  if (segment->size() == 0) return SegmentEncodingSpec{};
+
+  const auto candidates = estimate_candidates(segment, data_type, access_share, index_types);
+  Assert(!candidates.empty(), "No encoding supports the indexes of the segment");
+  return candidates.front().spec;
+}
+
+std::map<ChunkID, ChunkEncodingSpec> EncodingAdvisor::advise_chunks(const Table& table,
+                                                                    const std::vector<ChunkID>& chunk_ids) const {
+  const auto data_types = table.column_data_types();
+  const auto access_shares = _access_shares(table);
+
+  auto chunk_encoding_specs = std::map<ChunkID, ChunkEncodingSpec>{};
+  for (const auto chunk_id : chunk_ids) {
+    Assert(chunk_id < table.chunk_count(), "Chunk with given ID does not exist.");
+    const auto chunk = table.get_chunk(chunk_id);
+
+    // The DeltaIndexes of the chunk are merged into regular indexes on the encoded segments
+    auto index_types_by_column = std::vector<std::vector<SegmentIndexType>>(chunk->column_count());
+    for (const auto& delta_index : chunk->delta_indexes()) {
+      for (const auto column_id : delta_index->column_ids()) {
+        index_types_by_column[column_id].emplace_back(delta_index->merge_type());
+      }
+    }
+
+    auto& chunk_encoding_spec = chunk_encoding_specs[chunk_id];
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      const auto value_segment = std::dynamic_pointer_cast<const BaseValueSegment>(chunk->get_segment(column_id));
+      Assert(value_segment, "All segments of the chunk need to be of type ValueSegment<T>");
+
+      chunk_encoding_spec.emplace_back(advise_segment(value_segment, data_types[column_id], access_shares[chunk_id],
+                                                      index_types_by_column[column_id]));
+    }
+  }
+
+  return chunk_encoding_specs;
+}
+
+std::vector<float> EncodingAdvisor::_access_shares(const Table& table) const {
+  auto access_counts = std::vector<uint64_t>(table.chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto access_counter = table.get_chunk(chunk_id)->access_counter();
+    if (access_counter) access_counts[chunk_id] = access_counter->history_sample(_options.access_history_samples);
+  }
+
+  const auto max_access_count = access_counts.empty() ? uint64_t{0} : *std::max_element(access_counts.cbegin(),
+                                                                                         access_counts.cend());
+
+  auto access_shares = std::vector<float>(access_counts.size(), 0.0f);
+  if (max_access_count == 0) return access_shares;
+
+  for (auto chunk_id = size_t{0}; chunk_id < access_counts.size(); ++chunk_id) {
+    access_shares[chunk_id] = static_cast<float>(access_counts[chunk_id]) / static_cast<float>(max_access_count);
+  }
+  return access_shares;
+}
+
+std::shared_ptr<const BaseValueSegment> EncodingAdvisor::_sample(const std::shared_ptr<const BaseValueSegment>& segment,
+                                                                 const DataType data_type) const {
+  const auto size = segment->size();
+  if (size <= _options.sample_size) return segment;
+
+  auto sample = std::shared_ptr<const BaseValueSegment>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto& value_segment = static_cast<const ValueSegment<ColumnDataType>&>(*segment);
+    const auto& values = value_segment.values();
+
+    auto typed_sample = std::make_shared<ValueSegment<ColumnDataType>>(value_segment.is_nullable());
+    typed_sample->reserve(_options.sample_size);
+
+    // Evenly spaced stretches of consecutive values, the first one starting at the beginning of the segment
+    const auto stretch_count = std::min(_options.sample_stretch_count, _options.sample_size);
+    const auto stretch_size = _options.sample_size / stretch_count;
+    for (auto stretch_idx = size_t{0}; stretch_idx < stretch_count; ++stretch_idx) {
+      const auto stretch_begin = stretch_idx * (size - stretch_size) / std::max(stretch_count - 1, size_t{1});
+      for (auto chunk_offset = stretch_begin; chunk_offset < stretch_begin + stretch_size; ++chunk_offset) {
+        typed_sample->values().push_back(values[chunk_offset]);
+        if (value_segment.is_nullable()) {
+          typed_sample->null_values().push_back(value_segment.null_values()[chunk_offset]);
+        }
+      }
+    }
+
+    sample = typed_sample;
+  });
+
+  return sample;
+}
+
+}  // namespace opossum
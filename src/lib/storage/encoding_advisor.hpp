@@ -0,0 +1,105 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/segment_index_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseValueSegment;
+class Table;
+
+// An encoding considered by the EncodingAdvisor, see EncodingAdvisor::estimate_candidates()
+struct EncodingCandidate {
+  SegmentEncodingSpec spec;
+
+  // Estimated size of the encoded segment in bytes, extrapolated from the sample
+  size_t memory_usage;
+
+  // Estimated time to decode a value sequentially, relative to reading it from a ValueSegment
+  float decode_cost;
+
+  // Weighted sum of the compression ratio and the decode cost, the candidate with the lowest cost is chosen
+  float cost;
+};
+
+std::ostream& operator<<(std::ostream& stream, const EncodingCandidate& candidate);
+
+/**
+ * The EncodingAdvisor chooses a SegmentEncodingSpec for each segment instead of encoding all segments the same way.
+ * For every segment, it
+ *
+ *  1. takes a sample of the segment's values. The sample consists of a few evenly spaced stretches of consecutive
+ *     values, so that runs and the order of the values are preserved.
+ *  2. encodes the sample with every EncodingType that supports the segment's data type and, for encodings that use
+ *     vector compression, with every VectorCompressionType. The memory usage of the encoded sample is extrapolated
+ *     to the size of the segment.
+ *  3. rates each candidate by its compression ratio (compared to a ValueSegment) plus its decode cost, which is a
+ *     rough per-value estimate for the encoding and vector compression. The decode cost is weighted by how often the
+ *     chunk is accessed compared to the most frequently accessed chunk of its table (see ChunkAccessCounter), so that
+ *     rarely read chunks are compressed as much as possible while hot chunks favor encodings that decode quickly.
+ *
+ * Segments that are indexed by a DeltaIndex only get encodings that the regular index it is merged into supports
+ * (see DeltaIndex::merge_type()), e.g., a Dictionary encoding with FixedSizeByteAligned vectors for a
+ * CompositeGroupKeyIndex.
+ *
+ * ChunkEncoder::encode_chunks() and ChunkEncoder::encode_all_chunks() accept an advisor in place of encoding specs.
+ */
+class EncodingAdvisor {
+ public:
+  struct Options {
+    // Maximum number of values sampled from a segment
+    size_t sample_size = 4'096;
+
+    // Number of stretches of consecutive values that make up the sample
+    size_t sample_stretch_count = 8;
+
+    // Weight of the decode cost for chunks that are never accessed
+    float base_decode_weight = 0.1f;
+
+    // Weight of the decode cost added for the most frequently accessed chunk of a table
+    float access_decode_weight = 1.0f;
+
+    // Number of ChunkAccessCounter history samples that are considered
+    size_t access_history_samples = 100;
+  };
+
+  EncodingAdvisor();
+  explicit EncodingAdvisor(const Options& options);
+
+  /**
+   * Estimates all applicable encodings of @param segment, ordered by cost.
+   * @param access_share is the access count of the segment's chunk relative to the most accessed chunk (0 to 1)
+   * @param index_types are the indexes that have to be built on the encoded segment
+   */
+  std::vector<EncodingCandidate> estimate_candidates(const std::shared_ptr<const BaseValueSegment>& segment,
+                                                     const DataType data_type, const float access_share,
+                                                     const std::vector<SegmentIndexType>& index_types = {}) const;
+
+  SegmentEncodingSpec advise_segment(const std::shared_ptr<const BaseValueSegment>& segment, const DataType data_type,
+                                     const float access_share,
+                                     const std::vector<SegmentIndexType>& index_types = {}) const;
+
+  /**
+   * Chooses the encodings of the segments of the given chunks. All segments of these chunks need to be of type
+   * ValueSegment<T>.
+   */
+  std::map<ChunkID, ChunkEncodingSpec> advise_chunks(const Table& table, const std::vector<ChunkID>& chunk_ids) const;
+
+ protected:
+  // Access count of each chunk of @param table relative to the most accessed chunk
+  std::vector<float> _access_shares(const Table& table) const;
+
+  std::shared_ptr<const BaseValueSegment> _sample(const std::shared_ptr<const BaseValueSegment>& segment,
+                                                  const DataType data_type) const;
+
+  const Options _options;
+};
+
+}  // namespace opossum
@@ -17,7 +17,17 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
-enum class EncodingType : uint8_t { Unencoded, Dictionary, RunLength, FixedStringDictionary, FrameOfReference };
+enum class EncodingType : uint8_t {
+  Unencoded,
+  Dictionary,
+  RunLength,
+  FixedStringDictionary,
+  FrameOfReference,
+  FrontCodedDictionary,
+  FSST,
+  PFORDelta,
+  ALP
+};
 
 /**
  * @brief Maps each encoding type to its supported data types
@@ -32,7 +42,11 @@ constexpr auto supported_data_types_for_encoding_type = hana::make_map(
     hana::make_pair(enum_c<EncodingType, EncodingType::Dictionary>, data_types),
     hana::make_pair(enum_c<EncodingType, EncodingType::RunLength>, data_types),
     hana::make_pair(enum_c<EncodingType, EncodingType::FixedStringDictionary>, hana::tuple_t<std::string>),
-    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::tuple_t<int32_t, int64_t>));
+    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::tuple_t<int32_t, int64_t>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::FrontCodedDictionary>, hana::tuple_t<std::string>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::FSST>, hana::tuple_t<std::string>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::PFORDelta>, hana::tuple_t<int32_t, int64_t>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::ALP>, hana::tuple_t<float, double>));
 
 /**
  * @return an integral constant implicitly convertible to bool
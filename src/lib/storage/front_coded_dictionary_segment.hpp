@@ -0,0 +1,84 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "base_dictionary_segment.hpp"
+#include "front_coded_dictionary_segment/front_coded_string_vector.hpp"
+#include "types.hpp"
+#include "vector_compression/base_compressed_vector.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing dictionary encoding for strings with a front-coded dictionary
+ *
+ * The sorted dictionary shares common prefixes of neighbouring strings, see FrontCodedStringVector. This is
+ * considerably smaller than a pmr_vector<std::string> (one allocation per string) or a FixedStringVector (padded to
+ * the longest string) for columns like URLs or product names. Strings are decoded on access. Value ids preserve the
+ * order of the strings, so range predicates can still be evaluated on the attribute vector.
+ * Uses vector compression schemes for its attribute vector.
+ */
+template <typename T>
+class FrontCodedDictionarySegment : public BaseDictionarySegment {
+ public:
+  explicit FrontCodedDictionarySegment(const std::shared_ptr<const FrontCodedStringVector>& dictionary,
+                                       const std::shared_ptr<const BaseCompressedVector>& attribute_vector,
+                                       const ValueID null_value_id);
+
+  // returns the decoded dictionary as pmr_vector
+  std::shared_ptr<const pmr_vector<std::string>> dictionary() const;
+
+  // returns an underlying dictionary
+  std::shared_ptr<const FrontCodedStringVector> front_coded_dictionary() const;
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+  CompressedVectorType compressed_vector_type() const final;
+  /**@}*/
+
+  /**
+   * @defgroup BaseDictionarySegment interface
+   * @{
+   */
+  EncodingType encoding_type() const final;
+
+  ValueID lower_bound(const AllTypeVariant& value) const final;
+  ValueID upper_bound(const AllTypeVariant& value) const final;
+
+  size_t unique_values_count() const final;
+
+  std::shared_ptr<const BaseCompressedVector> attribute_vector() const final;
+
+  const ValueID null_value_id() const final;
+
+  /**@}*/
+
+ protected:
+  const std::shared_ptr<const FrontCodedStringVector> _dictionary;
+  const std::shared_ptr<const BaseCompressedVector> _attribute_vector;
+  const ValueID _null_value_id;
+  const std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+}  // namespace opossum
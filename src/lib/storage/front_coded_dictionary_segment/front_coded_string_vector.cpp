@@ -0,0 +1,155 @@
+#include "front_coded_string_vector.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+void append_length(opossum::pmr_vector<char>& chars, size_t length) {
+  while (length >= 0x80) {
+    chars.push_back(static_cast<char>((length & 0x7F) | 0x80));
+    length >>= 7;
+  }
+  chars.push_back(static_cast<char>(length));
+}
+
+size_t read_length(const char*& iter) {
+  auto length = size_t{0};
+  auto shift = size_t{0};
+  while (true) {
+    const auto byte = static_cast<uint8_t>(*iter++);
+    length |= static_cast<size_t>(byte & 0x7F) << shift;
+    if (byte < 0x80) return length;
+    shift += 7;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+FrontCodedStringVector::FrontCodedStringVector(const FrontCodedStringVector& other,
+                                               const PolymorphicAllocator<char>& alloc)
+    : _size(other._size), _chars(other._chars, alloc), _block_offsets(other._block_offsets, alloc) {}
+
+void FrontCodedStringVector::_push_back(const std::string& string, const std::string& previous_string) {
+  DebugAssert(_size == 0 || previous_string < string, "Strings must be sorted and unique");
+
+  if (_size % BLOCK_SIZE == 0) {
+    Assert(_chars.size() <= std::numeric_limits<uint32_t>::max(), "FrontCodedStringVector is too large");
+    _block_offsets.push_back(static_cast<uint32_t>(_chars.size()));
+
+    append_length(_chars, string.size());
+    _chars.insert(_chars.end(), string.cbegin(), string.cend());
+  } else {
+    const auto mismatch =
+        std::mismatch(string.cbegin(), string.cend(), previous_string.cbegin(), previous_string.cend());
+    const auto prefix_length = static_cast<size_t>(std::distance(string.cbegin(), mismatch.first));
+
+    append_length(_chars, prefix_length);
+    append_length(_chars, string.size() - prefix_length);
+    _chars.insert(_chars.end(), mismatch.first, string.cend());
+  }
+
+  ++_size;
+}
+
+std::string_view FrontCodedStringVector::_block_header(const size_t block_id) const {
+  const auto* iter = _chars.data() + _block_offsets[block_id];
+  const auto length = read_length(iter);
+  return std::string_view{iter, length};
+}
+
+template <typename IsPast>
+size_t FrontCodedStringVector::_find_first(const IsPast& is_past) const {
+  // Binary search for the first block whose header is past. The searched string is this header or one of the strings
+  // in the block before.
+  auto block_count = _block_offsets.size();
+  auto first_block_id = size_t{0};
+  while (block_count > 0) {
+    const auto step = block_count / 2;
+    if (!is_past(_block_header(first_block_id + step))) {
+      first_block_id += step + 1;
+      block_count -= step + 1;
+    } else {
+      block_count = step;
+    }
+  }
+  if (first_block_id == 0) return 0;
+
+  const auto block_id = first_block_id - 1;
+  const auto block_end = std::min(_size, (block_id + 1) * BLOCK_SIZE);
+
+  auto string = std::string{_block_header(block_id)};
+  const auto* iter = _chars.data() + _block_offsets[block_id];
+  iter += read_length(iter);
+
+  for (auto pos = block_id * BLOCK_SIZE + 1; pos < block_end; ++pos) {
+    const auto prefix_length = read_length(iter);
+    const auto suffix_length = read_length(iter);
+    string.resize(prefix_length);
+    string.append(iter, suffix_length);
+    iter += suffix_length;
+
+    if (is_past(std::string_view{string})) return pos;
+  }
+  return block_end;
+}
+
+std::string FrontCodedStringVector::get_string_at(const size_t pos) const {
+  DebugAssert(pos < _size, "Position out of range");
+
+  const auto block_id = pos / BLOCK_SIZE;
+  const auto* iter = _chars.data() + _block_offsets[block_id];
+
+  const auto header_length = read_length(iter);
+  auto string = std::string{iter, header_length};
+  iter += header_length;
+
+  for (auto string_idx = size_t{1}; string_idx <= pos % BLOCK_SIZE; ++string_idx) {
+    const auto prefix_length = read_length(iter);
+    const auto suffix_length = read_length(iter);
+    string.resize(prefix_length);
+    string.append(iter, suffix_length);
+    iter += suffix_length;
+  }
+  return string;
+}
+
+size_t FrontCodedStringVector::lower_bound(const std::string& value) const {
+  return _find_first([&](const std::string_view string) { return string >= std::string_view{value}; });
+}
+
+size_t FrontCodedStringVector::upper_bound(const std::string& value) const {
+  return _find_first([&](const std::string_view string) { return string > std::string_view{value}; });
+}
+
+size_t FrontCodedStringVector::size() const { return _size; }
+
+size_t FrontCodedStringVector::data_size() const {
+  return sizeof(*this) + _chars.capacity() + _block_offsets.capacity() * sizeof(uint32_t);
+}
+
+std::shared_ptr<const pmr_vector<std::string>> FrontCodedStringVector::dictionary() const {
+  auto strings = pmr_vector<std::string>{};
+  strings.reserve(_size);
+
+  auto string = std::string{};
+  const auto* iter = _chars.data();
+  for (auto pos = size_t{0}; pos < _size; ++pos) {
+    const auto prefix_length = pos % BLOCK_SIZE == 0 ? size_t{0} : read_length(iter);
+    const auto suffix_length = read_length(iter);
+    string.resize(prefix_length);
+    string.append(iter, suffix_length);
+    iter += suffix_length;
+    strings.emplace_back(string);
+  }
+  return std::make_shared<pmr_vector<std::string>>(std::move(strings));
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * FrontCodedStringVector stores a sorted sequence of strings with front coding (also known as incremental encoding):
+ * The strings are grouped into blocks of BLOCK_SIZE strings. The first string of each block is stored completely,
+ * every following string only as the length of the prefix it shares with its predecessor and the remaining suffix.
+ * All lengths are stored as variable-length integers (7 bits per byte), so that short strings need one byte each.
+ *
+ * Layout of a block in _chars:
+ *   [length][chars of string 0] [prefix length][suffix length][suffix chars of string 1] ...
+ *
+ * Strings are decoded on demand. Since the first strings of the blocks are stored uncompressed, lower_bound() and
+ * upper_bound() binary search the blocks without decoding and then decode at most one block.
+ */
+class FrontCodedStringVector {
+ public:
+  static constexpr size_t BLOCK_SIZE = 16;
+
+  // Create a FrontCodedStringVector from the sorted and unique strings in [first, last)
+  template <class Iter>
+  FrontCodedStringVector(Iter first, Iter last, const PolymorphicAllocator<char>& alloc = {})
+      : _chars(alloc), _block_offsets(alloc) {
+    auto previous_string = std::string{};
+    for (; first != last; ++first) {
+      _push_back(*first, previous_string);
+      previous_string = *first;
+    }
+    _chars.shrink_to_fit();
+    _block_offsets.shrink_to_fit();
+  }
+
+  FrontCodedStringVector(const FrontCodedStringVector& other, const PolymorphicAllocator<char>& alloc);
+
+  // Decode the string at position pos
+  std::string get_string_at(const size_t pos) const;
+
+  // Return the position of the first string >= value (> value for upper_bound), size() if there is none
+  size_t lower_bound(const std::string& value) const;
+  size_t upper_bound(const std::string& value) const;
+
+  // Return the number of strings in the vector
+  size_t size() const;
+
+  // Return the calculated size of FrontCodedStringVector in main memory
+  size_t data_size() const;
+
+  // Return the decoded strings as a vector of strings
+  std::shared_ptr<const pmr_vector<std::string>> dictionary() const;
+
+ protected:
+  void _push_back(const std::string& string, const std::string& previous_string);
+
+  // Return the first string of the block, which is stored uncompressed
+  std::string_view _block_header(const size_t block_id) const;
+
+  /**
+   * Return the position of the first string for which is_past(string) is true. is_past must be monotonic in the
+   * order of the strings.
+   */
+  template <typename IsPast>
+  size_t _find_first(const IsPast& is_past) const;
+
+  size_t _size = 0;
+  pmr_vector<char> _chars;
+  pmr_vector<uint32_t> _block_offsets;
+};
+
+}  // namespace opossum
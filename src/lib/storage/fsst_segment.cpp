@@ -0,0 +1,112 @@
+#include "fsst_segment.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T, typename U>
+FSSTSegment<T, U>::FSSTSegment(std::shared_ptr<const FSSTSymbolTable> symbol_table,
+                               pmr_vector<char> compressed_values, pmr_vector<bool> null_values,
+                               std::unique_ptr<const BaseCompressedVector> offsets)
+    : BaseEncodedSegment{data_type_from_type<T>()},
+      _symbol_table{std::move(symbol_table)},
+      _compressed_values{std::move(compressed_values)},
+      _null_values{std::move(null_values)},
+      _offsets{std::move(offsets)},
+      _decompressor{_offsets->create_base_decompressor()} {
+  DebugAssert(_offsets->size() == _null_values.size() + 1, "Expected one offset per value and the end offset");
+}
+
+template <typename T, typename U>
+const FSSTSymbolTable& FSSTSegment<T, U>::symbol_table() const {
+  return *_symbol_table;
+}
+
+template <typename T, typename U>
+const pmr_vector<char>& FSSTSegment<T, U>::compressed_values() const {
+  return _compressed_values;
+}
+
+template <typename T, typename U>
+const pmr_vector<bool>& FSSTSegment<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+const BaseCompressedVector& FSSTSegment<T, U>::offsets() const {
+  return *_offsets;
+}
+
+template <typename T, typename U>
+std::string_view FSSTSegment<T, U>::compressed_value(const ChunkOffset chunk_offset) const {
+  const auto begin = _decompressor->get(chunk_offset);
+  const auto end = _decompressor->get(chunk_offset + 1);
+  return std::string_view{_compressed_values.data() + begin, end - begin};
+}
+
+template <typename T, typename U>
+const AllTypeVariant FSSTSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value.has_value()) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T, typename U>
+const std::optional<T> FSSTSegment<T, U>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (_null_values[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  auto value = std::string{};
+  _symbol_table->decompress(compressed_value(chunk_offset), value);
+  return value;
+}
+
+template <typename T, typename U>
+size_t FSSTSegment<T, U>::size() const {
+  return _null_values.size();
+}
+
+template <typename T, typename U>
+std::shared_ptr<BaseSegment> FSSTSegment<T, U>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_compressed_values = pmr_vector<char>{_compressed_values, alloc};
+  auto new_null_values = pmr_vector<bool>{_null_values, alloc};
+  auto new_offsets = _offsets->copy_using_allocator(alloc);
+
+  return std::allocate_shared<FSSTSegment>(alloc, _symbol_table, std::move(new_compressed_values),
+                                           std::move(new_null_values), std::move(new_offsets));
+}
+
+template <typename T, typename U>
+size_t FSSTSegment<T, U>::estimate_memory_usage() const {
+  static const auto bits_per_byte = 8u;
+
+  return sizeof(*this) + _symbol_table->data_size() + _compressed_values.size() + _offsets->data_size() +
+         _null_values.size() / bits_per_byte;
+}
+
+template <typename T, typename U>
+EncodingType FSSTSegment<T, U>::encoding_type() const {
+  return EncodingType::FSST;
+}
+
+template <typename T, typename U>
+CompressedVectorType FSSTSegment<T, U>::compressed_vector_type() const {
+  return _offsets->type();
+}
+
+template class FSSTSegment<std::string>;
+
+}  // namespace opossum
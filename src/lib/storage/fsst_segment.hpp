@@ -0,0 +1,87 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "base_encoded_segment.hpp"
+#include "fsst_segment/fsst_symbol_table.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing FSST-style string compression
+ *
+ * Meant for high-cardinality string columns (comments, addresses, ...) that dictionary encoding does not compress.
+ * Every value is compressed on its own with a static symbol table of the segment (see FSSTSymbolTable) and the
+ * compressed values are stored one after another. The offsets of the values are compressed using vector compression
+ * (null suppression), so each value can be decompressed individually.
+ *
+ * Since the compression is deterministic, equality predicates can be evaluated by compressing the search value and
+ * comparing the compressed values, see compressed_value().
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(enum_c<EncodingType, EncodingType::FSST>,
+                                                                              hana::type_c<T>)>>
+class FSSTSegment : public BaseEncodedSegment {
+ public:
+  /**
+   * @param compressed_values are the concatenated compressed values
+   * @param offsets are the start positions of the values in compressed_values, followed by its size
+   */
+  explicit FSSTSegment(std::shared_ptr<const FSSTSymbolTable> symbol_table, pmr_vector<char> compressed_values,
+                       pmr_vector<bool> null_values, std::unique_ptr<const BaseCompressedVector> offsets);
+
+  const FSSTSymbolTable& symbol_table() const;
+  const pmr_vector<char>& compressed_values() const;
+  const pmr_vector<bool>& null_values() const;
+  const BaseCompressedVector& offsets() const;
+
+  // Returns the compressed bytes of the value at @param chunk_offset (empty for NULL)
+  std::string_view compressed_value(const ChunkOffset chunk_offset) const;
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  CompressedVectorType compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  const std::shared_ptr<const FSSTSymbolTable> _symbol_table;
+  const pmr_vector<char> _compressed_values;
+  const pmr_vector<bool> _null_values;
+  const std::unique_ptr<const BaseCompressedVector> _offsets;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+}  // namespace opossum
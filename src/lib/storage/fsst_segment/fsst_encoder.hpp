@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "storage/base_segment_encoder.hpp"
+
+#include "storage/fsst_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class FSSTEncoder : public SegmentEncoder<FSSTEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::FSST>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  // Approximate number of bytes of the values from which the symbol table is built
+  static constexpr auto sample_size = size_t{16'384};
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
+    const auto alloc = value_segment->values().get_allocator();
+    const auto size = value_segment->size();
+
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    // Views of the values, as tbb::concurrent_vector does not guarantee fast random access
+    auto values = std::vector<std::string_view>{};
+    values.reserve(size);
+    auto total_length = size_t{0};
+
+    const auto& segment_values = value_segment->values();
+    auto value_it = segment_values.cbegin();
+    if (value_segment->is_nullable()) {
+      auto null_value_it = value_segment->null_values().cbegin();
+      for (; value_it != segment_values.cend(); ++value_it, ++null_value_it) {
+        null_values.push_back(*null_value_it);
+        values.emplace_back(*null_value_it ? std::string_view{} : std::string_view{*value_it});
+        total_length += values.back().size();
+      }
+    } else {
+      for (; value_it != segment_values.cend(); ++value_it) {
+        null_values.push_back(false);
+        values.emplace_back(*value_it);
+        total_length += values.back().size();
+      }
+    }
+
+    // Build the symbol table from every n-th value, so that the sample covers the whole segment
+    const auto sample_step = std::max(total_length / sample_size, size_t{1});
+    auto sample = std::vector<std::string_view>{};
+    for (auto value_idx = size_t{0}; value_idx < values.size(); value_idx += sample_step) {
+      if (!null_values[value_idx]) sample.emplace_back(values[value_idx]);
+    }
+    const auto symbol_table = FSSTSymbolTable::build(sample);
+
+    auto compressed_values = pmr_vector<char>{alloc};
+    compressed_values.reserve(total_length);
+
+    auto offsets = pmr_vector<uint32_t>{alloc};
+    offsets.reserve(size + 1);
+
+    for (const auto& value : values) {
+      offsets.push_back(static_cast<uint32_t>(compressed_values.size()));
+      symbol_table->compress(value, compressed_values);
+      Assert(compressed_values.size() <= std::numeric_limits<uint32_t>::max(), "Compressed values must fit into 4GB.");
+    }
+    offsets.push_back(static_cast<uint32_t>(compressed_values.size()));
+    compressed_values.shrink_to_fit();
+
+    const auto max_offset = offsets.back();
+    auto compressed_offsets = compress_vector(offsets, vector_compression_type(), alloc, {max_offset});
+
+    return std::allocate_shared<FSSTSegment<T>>(alloc, symbol_table, std::move(compressed_values),
+                                                std::move(null_values), std::move(compressed_offsets));
+  }
+};
+
+}  // namespace opossum
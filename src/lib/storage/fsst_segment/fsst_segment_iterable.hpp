@@ -0,0 +1,147 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "storage/segment_iterables.hpp"
+
+#include "storage/fsst_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+/**
+ * Iterates over the values of an FSSTSegment. The iterators decompress each value into a buffer that they reuse for
+ * all values, so that decompressing does not allocate memory once the buffer is large enough.
+ *
+ * With ValueType = std::string_view, the iterators return the compressed values instead, which scans compare with a
+ * compressed search value (see FSSTSegment).
+ */
+template <typename T, typename ValueType = T>
+class FSSTSegmentIterable : public PointAccessibleSegmentIterable<FSSTSegmentIterable<T, ValueType>> {
+ public:
+  explicit FSSTSegmentIterable(const FSSTSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.offsets(), [&](const auto& offsets) {
+      using OffsetIteratorT = decltype(offsets.cbegin());
+
+      // The iterators point to the end offsets of the values
+      auto begin = Iterator<OffsetIteratorT>{&_segment, std::next(offsets.cbegin()), *offsets.cbegin(),
+                                             _segment.null_values().cbegin()};
+      auto end = Iterator<OffsetIteratorT>{offsets.cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const PosList& position_filter, const Functor& functor) const {
+    auto begin = PointAccessIterator{&_segment, position_filter.cbegin(), position_filter.cbegin()};
+    auto end = PointAccessIterator{position_filter.cbegin(), position_filter.cend()};
+    functor(begin, end);
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const FSSTSegment<T>& _segment;
+
+ private:
+  static ValueType _make_value(const FSSTSegment<T>& segment, const std::string_view compressed_value,
+                               std::string& buffer) {
+    if constexpr (std::is_same_v<ValueType, std::string_view>) {
+      return compressed_value;
+    } else {
+      segment.symbol_table().decompress(compressed_value, buffer);
+      return buffer;
+    }
+  }
+
+  template <typename OffsetIteratorT>
+  class Iterator : public BaseSegmentIterator<Iterator<OffsetIteratorT>, SegmentIteratorValue<ValueType>> {
+   public:
+    using NullValueIterator = typename pmr_vector<bool>::const_iterator;
+
+   public:
+    // Begin Iterator
+    explicit Iterator(const FSSTSegment<T>* segment, OffsetIteratorT end_offset_it, const uint32_t begin_offset,
+                      NullValueIterator null_value_it)
+        : _segment{segment},
+          _end_offset_it{end_offset_it},
+          _begin_offset{begin_offset},
+          _null_value_it{null_value_it},
+          _chunk_offset{0u} {}
+
+    // End iterator
+    explicit Iterator(OffsetIteratorT end_offset_it) : Iterator{nullptr, end_offset_it, 0u, {}} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      _begin_offset = *_end_offset_it;
+      ++_end_offset_it;
+      ++_null_value_it;
+      ++_chunk_offset;
+    }
+
+    bool equal(const Iterator& other) const { return _end_offset_it == other._end_offset_it; }
+
+    SegmentIteratorValue<ValueType> dereference() const {
+      if (*_null_value_it) return SegmentIteratorValue<ValueType>{ValueType{}, true, _chunk_offset};
+
+      const auto end_offset = static_cast<uint32_t>(*_end_offset_it);
+      const auto compressed_value =
+          std::string_view{_segment->compressed_values().data() + _begin_offset, end_offset - _begin_offset};
+      return SegmentIteratorValue<ValueType>{_make_value(*_segment, compressed_value, _buffer), false, _chunk_offset};
+    }
+
+   private:
+    const FSSTSegment<T>* _segment;
+    OffsetIteratorT _end_offset_it;
+    uint32_t _begin_offset;
+    NullValueIterator _null_value_it;
+    ChunkOffset _chunk_offset;
+    mutable std::string _buffer;
+  };
+
+  class PointAccessIterator
+      : public BasePointAccessSegmentIterator<PointAccessIterator, SegmentIteratorValue<ValueType>> {
+   public:
+    // Begin Iterator
+    PointAccessIterator(const FSSTSegment<T>* segment, const PosList::const_iterator position_filter_begin,
+                        PosList::const_iterator position_filter_it)
+        : BasePointAccessSegmentIterator<PointAccessIterator, SegmentIteratorValue<ValueType>>{
+              std::move(position_filter_begin), std::move(position_filter_it)},
+          _segment{segment} {}
+
+    // End Iterator
+    explicit PointAccessIterator(const PosList::const_iterator position_filter_begin,
+                                 PosList::const_iterator position_filter_it)
+        : PointAccessIterator{nullptr, std::move(position_filter_begin), std::move(position_filter_it)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentIteratorValue<ValueType> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+
+      if (_segment->null_values()[chunk_offsets.offset_in_referenced_chunk]) {
+        return SegmentIteratorValue<ValueType>{ValueType{}, true, chunk_offsets.offset_in_poslist};
+      }
+
+      const auto compressed_value = _segment->compressed_value(chunk_offsets.offset_in_referenced_chunk);
+      return SegmentIteratorValue<ValueType>{_make_value(*_segment, compressed_value, _buffer), false,
+                                             chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const FSSTSegment<T>* _segment;
+    mutable std::string _buffer;
+  };
+};
+
+}  // namespace opossum
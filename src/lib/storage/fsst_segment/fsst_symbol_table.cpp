@@ -0,0 +1,159 @@
+#include "fsst_symbol_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+// Number of times the sample is compressed to refine the symbols
+constexpr auto GENERATION_COUNT = 5;
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<const FSSTSymbolTable> FSSTSymbolTable::build(const std::vector<std::string_view>& sample) {
+  auto symbol_table = std::make_shared<FSSTSymbolTable>(std::vector<std::string>{});
+
+  for (auto generation = 0; generation < GENERATION_COUNT; ++generation) {
+    // Count the symbols (or escaped bytes) the current table produces and their concatenations
+    auto counts = std::unordered_map<std::string, size_t>{};
+    for (const auto& value : sample) {
+      const auto* const end = value.data() + value.size();
+      auto previous_symbol = std::string_view{};
+
+      for (const auto* iter = value.data(); iter < end;) {
+        const auto code = symbol_table->_find_longest_symbol(iter, end);
+        const auto symbol = code ? symbol_table->symbol(*code) : std::string_view{iter, 1};
+
+        ++counts[std::string{symbol}];
+        if (!previous_symbol.empty() && previous_symbol.size() + symbol.size() <= MAX_SYMBOL_LENGTH) {
+          ++counts[std::string{previous_symbol}.append(symbol)];
+        }
+
+        previous_symbol = symbol;
+        iter += symbol.size();
+      }
+    }
+
+    // A symbol saves (length - 1) bytes per occurrence compared to its codes in the current table, which is
+    // approximated by its length. Ties are broken by the symbol to keep the table deterministic.
+    auto candidates = std::vector<std::pair<size_t, std::string>>{};
+    candidates.reserve(counts.size());
+    for (const auto& [symbol, count] : counts) {
+      candidates.emplace_back(count * symbol.size(), symbol);
+    }
+
+    const auto symbol_count = std::min(candidates.size(), MAX_SYMBOL_COUNT);
+    std::partial_sort(candidates.begin(), candidates.begin() + symbol_count, candidates.end(),
+                      [](const auto& lhs, const auto& rhs) {
+                        if (lhs.first != rhs.first) return lhs.first > rhs.first;
+                        return lhs.second < rhs.second;
+                      });
+
+    auto symbols = std::vector<std::string>{};
+    symbols.reserve(symbol_count);
+    for (auto candidate_idx = size_t{0}; candidate_idx < symbol_count; ++candidate_idx) {
+      symbols.emplace_back(std::move(candidates[candidate_idx].second));
+    }
+    symbol_table = std::make_shared<FSSTSymbolTable>(symbols);
+  }
+
+  return symbol_table;
+}
+
+FSSTSymbolTable::FSSTSymbolTable(const std::vector<std::string>& symbols) : _symbol_count(symbols.size()) {
+  Assert(symbols.size() <= MAX_SYMBOL_COUNT, "Too many symbols");
+
+  for (auto code = size_t{0}; code < symbols.size(); ++code) {
+    const auto& symbol = symbols[code];
+    Assert(!symbol.empty() && symbol.size() <= MAX_SYMBOL_LENGTH, "Invalid symbol length");
+
+    std::memcpy(&_symbols[code], symbol.data(), symbol.size());
+    _symbol_lengths[code] = static_cast<uint8_t>(symbol.size());
+    _codes_by_first_byte[static_cast<uint8_t>(symbol.front())].emplace_back(static_cast<uint8_t>(code));
+  }
+
+  for (auto& codes : _codes_by_first_byte) {
+    std::stable_sort(codes.begin(), codes.end(),
+                     [&](const auto lhs, const auto rhs) { return _symbol_lengths[lhs] > _symbol_lengths[rhs]; });
+  }
+}
+
+std::optional<uint8_t> FSSTSymbolTable::_find_longest_symbol(const char* begin, const char* end) const {
+  const auto remaining_length = static_cast<size_t>(end - begin);
+  for (const auto code : _codes_by_first_byte[static_cast<uint8_t>(*begin)]) {
+    const auto symbol_length = _symbol_lengths[code];
+    if (symbol_length <= remaining_length && std::memcmp(begin, &_symbols[code], symbol_length) == 0) return code;
+  }
+  return std::nullopt;
+}
+
+template <typename Output>
+void FSSTSymbolTable::_compress(const std::string_view value, Output& output) const {
+  const auto* const end = value.data() + value.size();
+  for (const auto* iter = value.data(); iter < end;) {
+    const auto code = _find_longest_symbol(iter, end);
+    if (code) {
+      output.push_back(static_cast<char>(*code));
+      iter += _symbol_lengths[*code];
+    } else {
+      output.push_back(static_cast<char>(ESCAPE_CODE));
+      output.push_back(*iter);
+      ++iter;
+    }
+  }
+}
+
+void FSSTSymbolTable::compress(const std::string_view value, pmr_vector<char>& output) const {
+  _compress(value, output);
+}
+
+std::string FSSTSymbolTable::compress(const std::string_view value) const {
+  auto output = std::string{};
+  output.reserve(value.size());
+  _compress(value, output);
+  return output;
+}
+
+void FSSTSymbolTable::decompress(const std::string_view compressed_value, std::string& output) const {
+  output.clear();
+
+  const auto* const end = compressed_value.data() + compressed_value.size();
+  for (const auto* iter = compressed_value.data(); iter < end; ++iter) {
+    const auto code = static_cast<uint8_t>(*iter);
+    if (code == ESCAPE_CODE) {
+      ++iter;
+      DebugAssert(iter < end, "Escape code at the end of a compressed value");
+      output.push_back(*iter);
+    } else {
+      DebugAssert(code < _symbol_count, "Invalid code");
+      output.append(reinterpret_cast<const char*>(&_symbols[code]), _symbol_lengths[code]);
+    }
+  }
+}
+
+size_t FSSTSymbolTable::symbol_count() const { return _symbol_count; }
+
+std::string_view FSSTSymbolTable::symbol(const uint8_t code) const {
+  DebugAssert(code < _symbol_count, "Invalid code");
+  return std::string_view{reinterpret_cast<const char*>(&_symbols[code]), _symbol_lengths[code]};
+}
+
+size_t FSSTSymbolTable::data_size() const {
+  auto data_size = sizeof(*this);
+  for (const auto& codes : _codes_by_first_byte) {
+    data_size += codes.capacity();
+  }
+  return data_size;
+}
+
+}  // namespace opossum
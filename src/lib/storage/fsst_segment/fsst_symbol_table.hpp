@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Static symbol table for FSST-style string compression (see Boncz et al., "FSST: Fast Random Access String
+ * Compression", VLDB 2020).
+ *
+ * The table maps up to 255 one-byte codes to symbols of one to eight bytes. A string is compressed by greedily
+ * replacing its longest prefix that is a symbol with the symbol's code. Bytes that do not start any symbol are
+ * written as ESCAPE_CODE followed by the byte itself. As the compression is deterministic, two strings are equal
+ * iff their compressed representations are equal.
+ *
+ * The table is built from a sample of the strings in a few generations: Each generation compresses the sample with
+ * the current table, counts how often each symbol and each concatenation of two consecutive symbols (of at most eight
+ * bytes) occurs, and keeps the 255 candidates that save the most bytes.
+ */
+class FSSTSymbolTable {
+ public:
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+  static constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+  static constexpr auto MAX_SYMBOL_LENGTH = size_t{8};
+
+  // Build a symbol table that compresses the strings of @param sample well
+  static std::shared_ptr<const FSSTSymbolTable> build(const std::vector<std::string_view>& sample);
+
+  explicit FSSTSymbolTable(const std::vector<std::string>& symbols);
+
+  // Append the compressed @param value to @param output
+  void compress(const std::string_view value, pmr_vector<char>& output) const;
+  std::string compress(const std::string_view value) const;
+
+  // Decompress @param compressed_value into @param output, reusing its memory
+  void decompress(const std::string_view compressed_value, std::string& output) const;
+
+  size_t symbol_count() const;
+  std::string_view symbol(const uint8_t code) const;
+
+  size_t data_size() const;
+
+ protected:
+  // Return the code of the longest symbol that is a prefix of [begin, end)
+  std::optional<uint8_t> _find_longest_symbol(const char* begin, const char* end) const;
+
+  template <typename Output>
+  void _compress(const std::string_view value, Output& output) const;
+
+  size_t _symbol_count;
+
+  // The symbols, padded with zeros to eight bytes, so that decompression can always copy eight bytes
+  std::array<uint64_t, MAX_SYMBOL_COUNT> _symbols{};
+  std::array<uint8_t, MAX_SYMBOL_COUNT> _symbol_lengths{};
+
+  // The codes of the symbols that start with a byte, longest symbols first
+  std::array<std::vector<uint8_t>, 256> _codes_by_first_byte;
+};
+
+}  // namespace opossum
@@ -0,0 +1,175 @@
+#include "global_dictionary_encoder.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+std::shared_ptr<DictionarySegment<T>> create_dictionary_segment(
+    const std::shared_ptr<const pmr_vector<T>>& dictionary, const pmr_vector<uint32_t>& attribute_vector,
+    const VectorCompressionType vector_compression_type) {
+  // The null value id is the same for all segments that share the dictionary
+  const auto null_value_id = static_cast<uint32_t>(dictionary->size());
+  auto compressed_attribute_vector = compress_vector(attribute_vector, vector_compression_type,
+                                                     PolymorphicAllocator<size_t>{}, {dictionary->size() + 1u});
+
+  return std::make_shared<DictionarySegment<T>>(
+      dictionary, std::shared_ptr<const BaseCompressedVector>(std::move(compressed_attribute_vector)),
+      ValueID{null_value_id});
+}
+
+template <typename T>
+void encode_chunks_with_global_dictionary(Table& table, const ColumnID column_id,
+                                          const std::vector<ChunkID>& chunk_ids,
+                                          const VectorCompressionType vector_compression_type) {
+  auto is_encoded_chunk = std::vector<bool>(table.chunk_count(), false);
+  auto value_segments = std::vector<std::pair<std::shared_ptr<Chunk>, std::shared_ptr<const ValueSegment<T>>>>{};
+  for (const auto chunk_id : chunk_ids) {
+    Assert(chunk_id < table.chunk_count(), "Chunk with given ID does not exist.");
+    const auto chunk = table.get_chunk(chunk_id);
+    Assert(!chunk->is_mutable(), "Only immutable chunks can share a global dictionary");
+
+    const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(chunk->get_segment(column_id));
+    Assert(value_segment, "Segments to be encoded need to be of type ValueSegment<T>");
+
+    is_encoded_chunk[chunk_id] = true;
+    value_segments.emplace_back(chunk, value_segment);
+  }
+
+  // The DictionarySegments of the other immutable chunks of the column
+  auto dictionary_segments =
+      std::vector<std::pair<std::shared_ptr<Chunk>, std::shared_ptr<const DictionarySegment<T>>>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (is_encoded_chunk[chunk_id] || chunk->is_mutable()) continue;
+
+    const auto dictionary_segment =
+        std::dynamic_pointer_cast<const DictionarySegment<T>>(chunk->get_segment(column_id));
+    if (dictionary_segment) dictionary_segments.emplace_back(chunk, dictionary_segment);
+  }
+
+  // The current global dictionary, if all DictionarySegments share one
+  auto dictionary = std::shared_ptr<const pmr_vector<T>>{};
+  auto dictionary_is_shared = true;
+  for (const auto& dictionary_segment_entry : dictionary_segments) {
+    const auto segment_dictionary = dictionary_segment_entry.second->dictionary();
+    if (!dictionary) dictionary = segment_dictionary;
+    dictionary_is_shared &= segment_dictionary == dictionary;
+  }
+
+  auto new_values = std::vector<T>{};
+  for (const auto& value_segment_entry : value_segments) {
+    const auto& value_segment = *value_segment_entry.second;
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_segment.size(); ++chunk_offset) {
+      const auto value = value_segment.get_typed_value(chunk_offset);
+      if (value) new_values.emplace_back(*value);
+    }
+  }
+  std::sort(new_values.begin(), new_values.end());
+  new_values.erase(std::unique(new_values.begin(), new_values.end()), new_values.end());
+
+  const auto dictionary_holds_new_values =
+      dictionary && dictionary_is_shared &&
+      std::includes(dictionary->cbegin(), dictionary->cend(), new_values.cbegin(), new_values.cend());
+
+  if (!dictionary_holds_new_values) {
+    // Build a new dictionary from the dictionaries of all DictionarySegments and the new values
+    auto merged_dictionary = pmr_vector<T>{new_values.cbegin(), new_values.cend()};
+    auto previous_dictionaries = std::vector<std::shared_ptr<const pmr_vector<T>>>{};
+    for (const auto& dictionary_segment_entry : dictionary_segments) {
+      const auto segment_dictionary = dictionary_segment_entry.second->dictionary();
+      if (std::find(previous_dictionaries.cbegin(), previous_dictionaries.cend(), segment_dictionary) !=
+          previous_dictionaries.cend()) {
+        continue;
+      }
+
+      previous_dictionaries.emplace_back(segment_dictionary);
+      merged_dictionary.insert(merged_dictionary.end(), segment_dictionary->cbegin(), segment_dictionary->cend());
+    }
+    std::sort(merged_dictionary.begin(), merged_dictionary.end());
+    merged_dictionary.erase(std::unique(merged_dictionary.begin(), merged_dictionary.end()), merged_dictionary.end());
+    dictionary = std::make_shared<const pmr_vector<T>>(std::move(merged_dictionary));
+
+    // For each previous dictionary, the new value id of each of its value ids (and of its null value id)
+    auto value_id_mappings = std::map<std::shared_ptr<const pmr_vector<T>>, std::vector<uint32_t>>{};
+    for (const auto& previous_dictionary : previous_dictionaries) {
+      auto& value_id_mapping = value_id_mappings[previous_dictionary];
+      value_id_mapping.reserve(previous_dictionary->size() + 1);
+      for (const auto& value : *previous_dictionary) {
+        const auto value_it = std::lower_bound(dictionary->cbegin(), dictionary->cend(), value);
+        value_id_mapping.emplace_back(static_cast<uint32_t>(std::distance(dictionary->cbegin(), value_it)));
+      }
+      value_id_mapping.emplace_back(static_cast<uint32_t>(dictionary->size()));
+    }
+
+    for (const auto& dictionary_segment_entry : dictionary_segments) {
+      const auto& dictionary_segment = *dictionary_segment_entry.second;
+      const auto& value_id_mapping = value_id_mappings.at(dictionary_segment.dictionary());
+
+      auto attribute_vector = pmr_vector<uint32_t>{};
+      attribute_vector.reserve(dictionary_segment.size());
+      resolve_compressed_vector_type(*dictionary_segment.attribute_vector(), [&](const auto& vector) {
+        for (auto value_id_it = vector.cbegin(); value_id_it != vector.cend(); ++value_id_it) {
+          attribute_vector.emplace_back(value_id_mapping[*value_id_it]);
+        }
+      });
+
+      dictionary_segment_entry.first->replace_segment(
+          column_id, create_dictionary_segment<T>(dictionary, attribute_vector, vector_compression_type));
+    }
+  }
+
+  const auto null_value_id = static_cast<uint32_t>(dictionary->size());
+  for (const auto& value_segment_entry : value_segments) {
+    const auto& value_segment = *value_segment_entry.second;
+
+    auto attribute_vector = pmr_vector<uint32_t>{};
+    attribute_vector.reserve(value_segment.size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_segment.size(); ++chunk_offset) {
+      const auto value = value_segment.get_typed_value(chunk_offset);
+      if (!value) {
+        attribute_vector.emplace_back(null_value_id);
+        continue;
+      }
+
+      const auto value_it = std::lower_bound(dictionary->cbegin(), dictionary->cend(), *value);
+      attribute_vector.emplace_back(static_cast<uint32_t>(std::distance(dictionary->cbegin(), value_it)));
+    }
+
+    value_segment_entry.first->replace_segment(
+        column_id, create_dictionary_segment<T>(dictionary, attribute_vector, vector_compression_type));
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+void GlobalDictionaryEncoder::encode_chunks(const std::shared_ptr<Table>& table, const ColumnID column_id,
+                                            const std::vector<ChunkID>& chunk_ids,
+                                            const std::optional<VectorCompressionType>& vector_compression_type) {
+  Assert(column_id < table->column_count(), "Column with given ID does not exist.");
+
+  resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    encode_chunks_with_global_dictionary<ColumnDataType>(
+        *table, column_id, chunk_ids, vector_compression_type.value_or(VectorCompressionType::FixedSizeByteAligned));
+  });
+}
+
+}  // namespace opossum
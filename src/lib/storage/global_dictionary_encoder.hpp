@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * @brief Encodes a column with a dictionary that is shared by the segments of all immutable chunks
+ *
+ * A DictionarySegment usually has a dictionary of its own, so that the value ids of two segments cannot be compared.
+ * With a global dictionary, the DictionarySegments of all immutable chunks of a column point to the same sorted
+ * dictionary. Their value ids, including the null value id, are comparable across chunks, so that operators can group
+ * and compare rows by their value ids without decoding them (see Aggregate), and each distinct value is stored once.
+ * Whether two segments share a dictionary is found out by comparing their DictionarySegment::dictionary() pointers.
+ *
+ * When chunks are encoded, the global dictionary of the column is extended by their values:
+ *
+ *  - If the dictionary already holds all values, the new segments are encoded with the existing dictionary.
+ *  - Otherwise, a new dictionary is built from the values of all DictionarySegments of the column's immutable chunks
+ *    and the new values. The value ids of the existing DictionarySegments are translated to the new dictionary and
+ *    their segments are exchanged atomically (see Chunk::replace_segment()). DictionarySegments that were encoded with
+ *    a dictionary of their own are merged into the global dictionary in the same way.
+ *
+ * Segments of other encodings are not touched. Like the ChunkEncoder, the GlobalDictionaryEncoder is not thread-safe:
+ * Only one encoder may encode the chunks of a table at a time. Concurrent readers are not blocked, though. Chunk
+ * indexes on exchanged segments are rebuilt on the new segments by Chunk::replace_segment().
+ */
+class GlobalDictionaryEncoder {
+ public:
+  /**
+   * Encodes the column @param column_id of the chunks @param chunk_ids of @param table, which need to be
+   * ValueSegments of immutable chunks
+   */
+  static void encode_chunks(const std::shared_ptr<Table>& table, const ColumnID column_id,
+                            const std::vector<ChunkID>& chunk_ids,
+                            const std::optional<VectorCompressionType>& vector_compression_type = std::nullopt);
+};
+
+}  // namespace opossum
@@ -1,5 +1,9 @@
 #include "adaptive_radix_tree_nodes.hpp"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <algorithm>
 #include <iterator>
 #include <memory>
@@ -15,6 +19,21 @@ namespace opossum {
 
 constexpr uint8_t INVALID_INDEX = 255u;
 
+size_t partial_key_lower_bound_16(const std::array<uint8_t, 16>& partial_keys, const uint8_t partial_key) {
+#if defined(__SSE2__)
+  // There is no unsigned byte comparison in SSE2, but a partial key is not less than the searched one iff it is the
+  // maximum of both. All 16 partial keys are compared at once, the first match is the lowest set bit of the mask.
+  const auto keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(partial_keys.data()));
+  const auto searched_keys = _mm_set1_epi8(static_cast<char>(partial_key));
+  const auto not_less = _mm_cmpeq_epi8(_mm_max_epu8(keys, searched_keys), keys);
+  const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(not_less));
+  return mask == 0 ? 16 : static_cast<size_t>(__builtin_ctz(mask));
+#else
+  const auto lower_bound = std::lower_bound(partial_keys.cbegin(), partial_keys.cend(), partial_key);
+  return std::distance(partial_keys.cbegin(), lower_bound);
+#endif
+}
+
 /**
  *
  * ARTNode4 has two arrays of length 4:
@@ -144,19 +163,18 @@ BaseIndex::Iterator ARTNode16::_delegate_to_child(
     const std::function<Iterator(std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type,
                                  const AdaptiveRadixTreeIndex::BinaryComparable&, size_t)>& function) const {
   auto partial_key = key[depth];
-  auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), partial_key);
-  auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
+  auto partial_key_pos = partial_key_lower_bound_16(_partial_keys, partial_key);
 
-  if (*partial_key_iterator == partial_key) {
-    return function(partial_key_pos, key, ++depth);  // case0
-  }
   if (partial_key_pos >= 16) {
     return end();  // case 1a
   }
-  if (_children[partial_key_pos] != nullptr) {
-    return _children[partial_key_pos]->begin();  // case2
+  if (_children[partial_key_pos] == nullptr) {
+    return end();  // case1b, also if the searched partial_key is 255u, but only matches the default value
+  }
+  if (_partial_keys[partial_key_pos] == partial_key) {
+    return function(partial_key_pos, key, ++depth);  // case0
   }
-  return end();  // case1b
+  return _children[partial_key_pos]->begin();  // case2
 }
 
 BaseIndex::Iterator ARTNode16::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
@@ -185,9 +203,8 @@ BaseIndex::Iterator ARTNode16::begin() const { return _children[0]->begin(); }
  */
 
 BaseIndex::Iterator ARTNode16::end() const {
-  auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), INVALID_INDEX);
-  auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
-  if (_children[partial_key_pos] == nullptr) {
+  auto partial_key_pos = partial_key_lower_bound_16(_partial_keys, INVALID_INDEX);
+  if (partial_key_pos == 16 || _children[partial_key_pos] == nullptr) {
     // there does not exist a child with partial_key 255u, we take the partial_key in front of it
     return _children[partial_key_pos - 1]->end();
   } else {
@@ -15,6 +15,14 @@ namespace opossum {
 
 using Iterator = std::vector<ChunkOffset>::const_iterator;
 
+/**
+ * Searches the sorted 16 @param partial_keys of a node with 16 children (using SSE2 if available). Unused positions
+ * after the used ones do not matter, callers compare the result with the number of used positions.
+ *
+ * @return The position of the first partial key that is not less than @param partial_key, 16 if there is none
+ */
+size_t partial_key_lower_bound_16(const std::array<uint8_t, 16>& partial_keys, const uint8_t partial_key);
+
 /**
  * This file declares the ARTNode-types needed for the Adaptive-Radix-Tree (ART)
  * In order to store its partial keys, the ART uses 4 different node-types, which can hold up to 4, 16, 48 and 256
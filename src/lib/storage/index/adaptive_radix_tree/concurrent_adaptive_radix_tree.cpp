@@ -0,0 +1,888 @@
+#include "concurrent_adaptive_radix_tree.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "adaptive_radix_tree_nodes.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+enum class NodeType : uint8_t { Node4, Node16, Node48, Node256, Leaf };
+
+}  // namespace
+
+struct ConcurrentAdaptiveRadixTree::Node {
+  explicit Node(const NodeType init_type) : type(init_type) {}
+
+  const NodeType type;
+};
+
+namespace {
+
+using Node = ConcurrentAdaptiveRadixTree::Node;
+using Key = ConcurrentAdaptiveRadixTree::Key;
+using Value = ConcurrentAdaptiveRadixTree::Value;
+
+constexpr auto KEY_SIZE = sizeof(Key);
+
+/**
+ * Returns the byte of @param key at @param depth, starting with the most significant one. Positions after the key can
+ * only be reached when reading a node that is modified concurrently. As such reads are validated before their results
+ * are used, any value can be returned for them.
+ */
+uint8_t key_byte(const Key key, const size_t depth) {
+  if (depth >= KEY_SIZE) return 0;
+  return static_cast<uint8_t>(key >> (8 * (KEY_SIZE - 1 - depth)));
+}
+
+// Leaves are immutable, so they can be read without synchronization once they are reachable
+struct LeafNode final : public Node {
+  LeafNode(const Key init_key, const Value init_value) : Node(NodeType::Leaf), key(init_key), value(init_value) {}
+
+  const Key key;
+  const Value value;
+};
+
+/**
+ * The version of an inner node consists of a counter that is incremented by every modification, a locked bit, and an
+ * obsolete bit, which is set when the node is replaced or removed. Optimistic readers remember the version before
+ * reading the node and restart if it has changed afterwards. The children are atomics so that reading them while they
+ * are written is not undefined behavior. The other fields are read without synchronization, as in the paper, and
+ * every value read from them is validated before it is relied upon.
+ */
+struct InnerNode : public Node {
+  static constexpr auto OBSOLETE_BIT = uint64_t{0b01};
+  static constexpr auto LOCKED_BIT = uint64_t{0b10};
+
+  explicit InnerNode(const NodeType init_type) : Node(init_type) {}
+
+  uint64_t read_lock_or_restart(bool& restart) const {
+    const auto current_version = version.load(std::memory_order_acquire);
+    if (current_version & (LOCKED_BIT | OBSOLETE_BIT)) restart = true;
+    return current_version;
+  }
+
+  void check_or_restart(const uint64_t expected_version, bool& restart) const {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (version.load(std::memory_order_relaxed) != expected_version) restart = true;
+  }
+
+  void upgrade_to_write_lock_or_restart(uint64_t& expected_version, bool& restart) {
+    if (version.compare_exchange_strong(expected_version, expected_version + LOCKED_BIT, std::memory_order_acquire)) {
+      expected_version += LOCKED_BIT;
+    } else {
+      restart = true;
+    }
+  }
+
+  void write_lock_or_restart(bool& restart) {
+    auto current_version = read_lock_or_restart(restart);
+    if (restart) return;
+    upgrade_to_write_lock_or_restart(current_version, restart);
+  }
+
+  // Adding the locked bit to a locked version clears it and increments the counter
+  void write_unlock() { version.fetch_add(LOCKED_BIT, std::memory_order_release); }
+
+  void write_unlock_obsolete() { version.fetch_add(LOCKED_BIT | OBSOLETE_BIT, std::memory_order_release); }
+
+  std::atomic<uint64_t> version{0};
+  std::atomic<uint16_t> count{0};
+
+  // Keys have eight bytes, so the prefix can be stored completely
+  uint8_t prefix_length{0};
+  std::array<uint8_t, KEY_SIZE> prefix{};
+};
+
+struct Node4 final : public InnerNode {
+  Node4() : InnerNode(NodeType::Node4) {}
+
+  std::array<uint8_t, 4> keys{};
+  std::array<std::atomic<Node*>, 4> children{};
+};
+
+struct Node16 final : public InnerNode {
+  Node16() : InnerNode(NodeType::Node16) {}
+
+  std::array<uint8_t, 16> keys{};
+  std::array<std::atomic<Node*>, 16> children{};
+};
+
+struct Node48 final : public InnerNode {
+  static constexpr auto EMPTY = uint8_t{48};
+
+  Node48() : InnerNode(NodeType::Node48) {
+    for (auto& index : child_index) {
+      index.store(EMPTY, std::memory_order_relaxed);
+    }
+  }
+
+  std::array<std::atomic<uint8_t>, 256> child_index;
+  std::array<std::atomic<Node*>, 48> children{};
+};
+
+struct Node256 final : public InnerNode {
+  Node256() : InnerNode(NodeType::Node256) {}
+
+  std::array<std::atomic<Node*>, 256> children{};
+};
+
+void delete_node(Node* node) {
+  switch (node->type) {
+    case NodeType::Node4:
+      delete static_cast<Node4*>(node);
+      break;
+    case NodeType::Node16:
+      delete static_cast<Node16*>(node);
+      break;
+    case NodeType::Node48:
+      delete static_cast<Node48*>(node);
+      break;
+    case NodeType::Node256:
+      delete static_cast<Node256*>(node);
+      break;
+    case NodeType::Leaf:
+      delete static_cast<LeafNode*>(node);
+      break;
+  }
+}
+
+/**
+ * Epoch-based reclamation: Every thread that operates on a tree announces the global epoch in its ThreadRecord for the
+ * duration of the operation. Nodes that are unlinked from a tree are retired together with the epoch at that time.
+ * The global epoch can only be advanced if all active threads have announced the current one. Thus, once the epoch
+ * has advanced twice after a node was retired, no thread can still be reading it and it is freed.
+ */
+class EpochManager : private Noncopyable {
+  struct ThreadRecord;
+
+ public:
+  static EpochManager& get() {
+    static EpochManager epoch_manager;
+    return epoch_manager;
+  }
+
+  ~EpochManager() {
+    // Only called at exit, when the trees are not used anymore
+    auto record = _records.load();
+    while (record) {
+      for (const auto& [epoch, node] : record->retired_nodes) delete_node(node);
+      const auto next = record->next;
+      delete record;
+      record = next;
+    }
+    for (const auto& [epoch, node] : _orphaned_nodes) delete_node(node);
+  }
+
+  // Marks the calling thread as active during its lifetime
+  class Guard : private Noncopyable {
+   public:
+    Guard() : _record(EpochManager::get()._thread_record()) {
+      if (_record.guard_depth++ == 0) {
+        _record.epoch.store(EpochManager::get()._global_epoch.load());
+      }
+    }
+
+    ~Guard() {
+      if (--_record.guard_depth == 0) {
+        _record.epoch.store(INACTIVE);
+      }
+    }
+
+   private:
+    ThreadRecord& _record;
+  };
+
+  // Frees @param node once no operation that might still read it is running. Has to be called within a Guard.
+  void retire(Node* node) {
+    auto& record = _thread_record();
+    record.retired_nodes.emplace_back(_global_epoch.load(), node);
+
+    if (record.retired_nodes.size() >= RECLAMATION_THRESHOLD) {
+      _try_advance_epoch();
+      _reclaim(record.retired_nodes);
+
+      // Nodes that were retired by threads that ended are reclaimed by whoever gets the lock
+      const auto lock = std::unique_lock<std::mutex>{_orphaned_nodes_mutex, std::try_to_lock};
+      if (lock.owns_lock()) _reclaim(_orphaned_nodes);
+    }
+  }
+
+ private:
+  static constexpr auto INACTIVE = std::numeric_limits<uint64_t>::max();
+  static constexpr auto RECLAMATION_THRESHOLD = size_t{64};
+
+  using RetiredNodes = std::vector<std::pair<uint64_t, Node*>>;
+
+  // Records are never freed while the program runs, but reused when the owning thread ends
+  struct ThreadRecord {
+    std::atomic<uint64_t> epoch{INACTIVE};
+    std::atomic_bool is_used{true};
+    ThreadRecord* next{nullptr};
+
+    // Only accessed by the owning thread
+    size_t guard_depth{0};
+    RetiredNodes retired_nodes;
+  };
+
+  // Returns the record to the EpochManager when the thread ends
+  struct ThreadRecordHandle : private Noncopyable {
+    ThreadRecordHandle() : record(EpochManager::get()._acquire_record()) {}
+    ~ThreadRecordHandle() { EpochManager::get()._release_record(*record); }
+
+    ThreadRecord* const record;
+  };
+
+  EpochManager() = default;
+
+  ThreadRecord& _thread_record() {
+    thread_local const auto handle = ThreadRecordHandle{};
+    return *handle.record;
+  }
+
+  ThreadRecord* _acquire_record() {
+    for (auto record = _records.load(); record; record = record->next) {
+      auto is_used = false;
+      if (record->is_used.compare_exchange_strong(is_used, true)) return record;
+    }
+
+    auto record = new ThreadRecord{};
+    record->next = _records.load();
+    while (!_records.compare_exchange_weak(record->next, record)) {
+    }
+    return record;
+  }
+
+  void _release_record(ThreadRecord& record) {
+    {
+      const auto lock = std::lock_guard<std::mutex>{_orphaned_nodes_mutex};
+      _orphaned_nodes.insert(_orphaned_nodes.end(), record.retired_nodes.cbegin(), record.retired_nodes.cend());
+    }
+    record.retired_nodes.clear();
+    record.is_used = false;
+  }
+
+  void _try_advance_epoch() {
+    auto global_epoch = _global_epoch.load();
+    for (auto record = _records.load(); record; record = record->next) {
+      const auto epoch = record->epoch.load();
+      if (epoch != INACTIVE && epoch != global_epoch) return;
+    }
+    _global_epoch.compare_exchange_strong(global_epoch, global_epoch + 1);
+  }
+
+  void _reclaim(RetiredNodes& retired_nodes) {
+    const auto global_epoch = _global_epoch.load();
+    const auto reclaimable_end = std::partition(retired_nodes.begin(), retired_nodes.end(),
+                                                [&](const auto& retired_node) {
+                                                  return retired_node.first + 2 <= global_epoch;
+                                                });
+    std::for_each(retired_nodes.begin(), reclaimable_end, [](const auto& retired_node) {
+      delete_node(retired_node.second);
+    });
+    retired_nodes.erase(retired_nodes.begin(), reclaimable_end);
+  }
+
+  std::atomic<uint64_t> _global_epoch{0};
+  std::atomic<ThreadRecord*> _records{nullptr};
+
+  std::mutex _orphaned_nodes_mutex;
+  RetiredNodes _orphaned_nodes;
+};
+
+/**
+ * Calls @param functor with the partial key and the child for all children of @param node in the order of their
+ * partial keys. For optimistic readers, the results are only valid if the version of the node is unchanged afterwards.
+ */
+template <typename Functor>
+void for_each_child(const InnerNode& node, const Functor& functor) {
+  switch (node.type) {
+    case NodeType::Node4: {
+      const auto& node4 = static_cast<const Node4&>(node);
+      const auto count = std::min(node.count.load(std::memory_order_relaxed), uint16_t{4});
+      for (auto position = uint16_t{0}; position < count; ++position) {
+        functor(node4.keys[position], node4.children[position].load(std::memory_order_relaxed));
+      }
+    } break;
+    case NodeType::Node16: {
+      const auto& node16 = static_cast<const Node16&>(node);
+      const auto count = std::min(node.count.load(std::memory_order_relaxed), uint16_t{16});
+      for (auto position = uint16_t{0}; position < count; ++position) {
+        functor(node16.keys[position], node16.children[position].load(std::memory_order_relaxed));
+      }
+    } break;
+    case NodeType::Node48: {
+      const auto& node48 = static_cast<const Node48&>(node);
+      for (auto partial_key = uint16_t{0}; partial_key < 256; ++partial_key) {
+        const auto index = node48.child_index[partial_key].load(std::memory_order_relaxed);
+        if (index >= Node48::EMPTY) continue;
+        functor(static_cast<uint8_t>(partial_key), node48.children[index].load(std::memory_order_relaxed));
+      }
+    } break;
+    case NodeType::Node256: {
+      const auto& node256 = static_cast<const Node256&>(node);
+      for (auto partial_key = uint16_t{0}; partial_key < 256; ++partial_key) {
+        const auto child = node256.children[partial_key].load(std::memory_order_relaxed);
+        if (child) functor(static_cast<uint8_t>(partial_key), child);
+      }
+    } break;
+    case NodeType::Leaf:
+      Fail("Leaves have no children");
+  }
+}
+
+// Returns the position of @param partial_key in a Node4 or Node16, or the position it would be inserted at
+template <typename SmallNode>
+uint16_t partial_key_position(const SmallNode& node, const uint8_t partial_key) {
+  const auto count = std::min(node.count.load(std::memory_order_relaxed), static_cast<uint16_t>(node.keys.size()));
+  if constexpr (std::is_same_v<SmallNode, Node16>) {
+    return std::min(static_cast<uint16_t>(partial_key_lower_bound_16(node.keys, partial_key)), count);
+  } else {
+    auto position = uint16_t{0};
+    while (position < count && node.keys[position] < partial_key) ++position;
+    return position;
+  }
+}
+
+// Returns the child of @param node with @param partial_key, nullptr if there is none
+Node* find_child(const InnerNode& node, const uint8_t partial_key) {
+  const auto find_in_small_node = [&](const auto& small_node) -> Node* {
+    const auto position = partial_key_position(small_node, partial_key);
+    if (position == small_node.count.load(std::memory_order_relaxed) || small_node.keys[position] != partial_key) {
+      return nullptr;
+    }
+    return small_node.children[position].load(std::memory_order_relaxed);
+  };
+
+  switch (node.type) {
+    case NodeType::Node4:
+      return find_in_small_node(static_cast<const Node4&>(node));
+    case NodeType::Node16:
+      return find_in_small_node(static_cast<const Node16&>(node));
+    case NodeType::Node48: {
+      const auto& node48 = static_cast<const Node48&>(node);
+      const auto index = node48.child_index[partial_key].load(std::memory_order_relaxed);
+      return index < Node48::EMPTY ? node48.children[index].load(std::memory_order_relaxed) : nullptr;
+    }
+    case NodeType::Node256:
+      return static_cast<const Node256&>(node).children[partial_key].load(std::memory_order_relaxed);
+    case NodeType::Leaf:
+      Fail("Leaves have no children");
+  }
+  Fail("GCC thinks this is reachable");
+}
+
+bool is_full(const InnerNode& node) {
+  const auto count = node.count.load(std::memory_order_relaxed);
+  switch (node.type) {
+    case NodeType::Node4:
+      return count == 4;
+    case NodeType::Node16:
+      return count == 16;
+    case NodeType::Node48:
+      return count == 48;
+    case NodeType::Node256:
+      return false;
+    case NodeType::Leaf:
+      Fail("Leaves have no children");
+  }
+  Fail("GCC thinks this is reachable");
+}
+
+// The following functions modify a node and require it to be write-locked (or not yet reachable)
+
+void insert_child(InnerNode& node, const uint8_t partial_key, Node* child) {
+  const auto insert_into_small_node = [&](auto& small_node) {
+    const auto count = small_node.count.load(std::memory_order_relaxed);
+    const auto position = partial_key_position(small_node, partial_key);
+    for (auto moved_position = count; moved_position > position; --moved_position) {
+      small_node.keys[moved_position] = small_node.keys[moved_position - 1];
+      small_node.children[moved_position].store(small_node.children[moved_position - 1].load(std::memory_order_relaxed),
+                                                std::memory_order_relaxed);
+    }
+    small_node.keys[position] = partial_key;
+    small_node.children[position].store(child, std::memory_order_relaxed);
+  };
+
+  switch (node.type) {
+    case NodeType::Node4:
+      insert_into_small_node(static_cast<Node4&>(node));
+      break;
+    case NodeType::Node16:
+      insert_into_small_node(static_cast<Node16&>(node));
+      break;
+    case NodeType::Node48: {
+      // Slots of removed children are reused, so the first free slot is not necessarily at the end
+      auto& node48 = static_cast<Node48&>(node);
+      auto index = uint8_t{0};
+      while (node48.children[index].load(std::memory_order_relaxed)) ++index;
+      node48.children[index].store(child, std::memory_order_relaxed);
+      node48.child_index[partial_key].store(index, std::memory_order_relaxed);
+    } break;
+    case NodeType::Node256:
+      static_cast<Node256&>(node).children[partial_key].store(child, std::memory_order_relaxed);
+      break;
+    case NodeType::Leaf:
+      Fail("Leaves have no children");
+  }
+
+  node.count.store(node.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+void change_child(InnerNode& node, const uint8_t partial_key, Node* child) {
+  switch (node.type) {
+    case NodeType::Node4: {
+      auto& node4 = static_cast<Node4&>(node);
+      node4.children[partial_key_position(node4, partial_key)].store(child, std::memory_order_relaxed);
+    } break;
+    case NodeType::Node16: {
+      auto& node16 = static_cast<Node16&>(node);
+      node16.children[partial_key_position(node16, partial_key)].store(child, std::memory_order_relaxed);
+    } break;
+    case NodeType::Node48: {
+      auto& node48 = static_cast<Node48&>(node);
+      node48.children[node48.child_index[partial_key].load(std::memory_order_relaxed)].store(
+          child, std::memory_order_relaxed);
+    } break;
+    case NodeType::Node256:
+      static_cast<Node256&>(node).children[partial_key].store(child, std::memory_order_relaxed);
+      break;
+    case NodeType::Leaf:
+      Fail("Leaves have no children");
+  }
+}
+
+void remove_child(InnerNode& node, const uint8_t partial_key) {
+  const auto remove_from_small_node = [&](auto& small_node) {
+    const auto count = small_node.count.load(std::memory_order_relaxed);
+    for (auto position = partial_key_position(small_node, partial_key); position + 1 < count; ++position) {
+      small_node.keys[position] = small_node.keys[position + 1];
+      small_node.children[position].store(small_node.children[position + 1].load(std::memory_order_relaxed),
+                                          std::memory_order_relaxed);
+    }
+    small_node.children[count - 1].store(nullptr, std::memory_order_relaxed);
+  };
+
+  switch (node.type) {
+    case NodeType::Node4:
+      remove_from_small_node(static_cast<Node4&>(node));
+      break;
+    case NodeType::Node16:
+      remove_from_small_node(static_cast<Node16&>(node));
+      break;
+    case NodeType::Node48: {
+      auto& node48 = static_cast<Node48&>(node);
+      const auto index = node48.child_index[partial_key].load(std::memory_order_relaxed);
+      node48.child_index[partial_key].store(Node48::EMPTY, std::memory_order_relaxed);
+      node48.children[index].store(nullptr, std::memory_order_relaxed);
+    } break;
+    case NodeType::Node256:
+      static_cast<Node256&>(node).children[partial_key].store(nullptr, std::memory_order_relaxed);
+      break;
+    case NodeType::Leaf:
+      Fail("Leaves have no children");
+  }
+
+  node.count.store(node.count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+}
+
+// Returns a copy of the full @param node with room for more children
+InnerNode* grow(const InnerNode& node) {
+  auto bigger_node = static_cast<InnerNode*>(nullptr);
+  switch (node.type) {
+    case NodeType::Node4:
+      bigger_node = new Node16();
+      break;
+    case NodeType::Node16:
+      bigger_node = new Node48();
+      break;
+    case NodeType::Node48:
+      bigger_node = new Node256();
+      break;
+    case NodeType::Node256:
+    case NodeType::Leaf:
+      Fail("Node cannot grow");
+  }
+
+  bigger_node->prefix_length = node.prefix_length;
+  bigger_node->prefix = node.prefix;
+  for_each_child(node, [&](const uint8_t partial_key, Node* child) { insert_child(*bigger_node, partial_key, child); });
+  return bigger_node;
+}
+
+// Returns the number of leading bytes of the prefix of @param node that match @param key from @param depth on
+size_t matching_prefix_length(const InnerNode& node, const Key key, const size_t depth) {
+  const auto prefix_length = std::min(static_cast<size_t>(node.prefix_length), KEY_SIZE);
+  auto matching_length = size_t{0};
+  while (matching_length < prefix_length && node.prefix[matching_length] == key_byte(key, depth + matching_length)) {
+    ++matching_length;
+  }
+  return matching_length;
+}
+
+std::optional<Value> lookup_or_restart(const InnerNode& root, const Key key, bool& restart) {
+  auto node = &root;
+  auto version = node->read_lock_or_restart(restart);
+  if (restart) return std::nullopt;
+  auto depth = size_t{0};
+
+  while (true) {
+    const auto prefix_length = node->prefix_length;
+    if (matching_prefix_length(*node, key, depth) != prefix_length) {
+      node->check_or_restart(version, restart);
+      return std::nullopt;
+    }
+    depth += prefix_length;
+
+    const auto child = find_child(*node, key_byte(key, depth));
+    node->check_or_restart(version, restart);
+    if (restart || !child) return std::nullopt;
+
+    if (child->type == NodeType::Leaf) {
+      const auto& leaf = static_cast<const LeafNode&>(*child);
+      if (leaf.key != key) return std::nullopt;
+      return leaf.value;
+    }
+
+    node = static_cast<const InnerNode*>(child);
+    version = node->read_lock_or_restart(restart);
+    if (restart) return std::nullopt;
+    ++depth;
+  }
+}
+
+// Returns whether the leaf was inserted (i.e., its key was not contained) and takes ownership of it in that case
+bool insert_or_restart(InnerNode& root, LeafNode* new_leaf, bool& restart) {
+  const auto key = new_leaf->key;
+
+  auto parent = static_cast<InnerNode*>(nullptr);
+  auto parent_version = uint64_t{0};
+  auto parent_partial_key = uint8_t{0};
+
+  auto node = &root;
+  auto version = node->read_lock_or_restart(restart);
+  if (restart) return false;
+  auto depth = size_t{0};
+
+  while (true) {
+    const auto prefix_length = node->prefix_length;
+    const auto matching_length = matching_prefix_length(*node, key, depth);
+    if (matching_length != prefix_length) {
+      // The key differs from the prefix: Insert a Node4 above the node that holds the matching part of the prefix, the
+      // node (with the rest of the prefix after the differing byte), and the new leaf. The root has no prefix, so there
+      // always is a parent.
+      parent->upgrade_to_write_lock_or_restart(parent_version, restart);
+      if (restart) return false;
+      node->upgrade_to_write_lock_or_restart(version, restart);
+      if (restart) {
+        parent->write_unlock();
+        return false;
+      }
+
+      auto new_node = new Node4();
+      new_node->prefix_length = static_cast<uint8_t>(matching_length);
+      std::copy_n(node->prefix.cbegin(), matching_length, new_node->prefix.begin());
+      insert_child(*new_node, key_byte(key, depth + matching_length), new_leaf);
+      insert_child(*new_node, node->prefix[matching_length], node);
+
+      const auto remaining_length = prefix_length - matching_length - 1;
+      std::copy_n(node->prefix.cbegin() + matching_length + 1, remaining_length, node->prefix.begin());
+      node->prefix_length = static_cast<uint8_t>(remaining_length);
+
+      change_child(*parent, parent_partial_key, new_node);
+      node->write_unlock();
+      parent->write_unlock();
+      return true;
+    }
+    depth += prefix_length;
+
+    const auto partial_key = key_byte(key, depth);
+    const auto child = find_child(*node, partial_key);
+    node->check_or_restart(version, restart);
+    if (restart) return false;
+
+    if (!child) {
+      if (is_full(*node)) {
+        // Replace the node with a bigger copy. The root is a Node256, so there always is a parent.
+        parent->upgrade_to_write_lock_or_restart(parent_version, restart);
+        if (restart) return false;
+        node->upgrade_to_write_lock_or_restart(version, restart);
+        if (restart) {
+          parent->write_unlock();
+          return false;
+        }
+
+        const auto bigger_node = grow(*node);
+        insert_child(*bigger_node, partial_key, new_leaf);
+        change_child(*parent, parent_partial_key, bigger_node);
+
+        node->write_unlock_obsolete();
+        EpochManager::get().retire(node);
+        parent->write_unlock();
+        return true;
+      }
+
+      node->upgrade_to_write_lock_or_restart(version, restart);
+      if (restart) return false;
+      insert_child(*node, partial_key, new_leaf);
+      node->write_unlock();
+      return true;
+    }
+
+    if (child->type == NodeType::Leaf) {
+      node->upgrade_to_write_lock_or_restart(version, restart);
+      if (restart) return false;
+
+      const auto leaf = static_cast<LeafNode*>(child);
+      if (leaf->key == key) {
+        node->write_unlock();
+        return false;
+      }
+
+      // Replace the leaf with a Node4 that holds both leaves. Its prefix are the following bytes that both keys share.
+      auto new_node = new Node4();
+      auto new_prefix_length = size_t{0};
+      while (key_byte(key, depth + 1 + new_prefix_length) == key_byte(leaf->key, depth + 1 + new_prefix_length)) {
+        new_node->prefix[new_prefix_length] = key_byte(key, depth + 1 + new_prefix_length);
+        ++new_prefix_length;
+      }
+      new_node->prefix_length = static_cast<uint8_t>(new_prefix_length);
+      insert_child(*new_node, key_byte(key, depth + 1 + new_prefix_length), new_leaf);
+      insert_child(*new_node, key_byte(leaf->key, depth + 1 + new_prefix_length), leaf);
+
+      change_child(*node, partial_key, new_node);
+      node->write_unlock();
+      return true;
+    }
+
+    parent = node;
+    parent_version = version;
+    parent_partial_key = partial_key;
+
+    node = static_cast<InnerNode*>(child);
+    version = node->read_lock_or_restart(restart);
+    if (restart) return false;
+    ++depth;
+  }
+}
+
+// Returns whether the key was removed
+bool remove_or_restart(InnerNode& root, const Key key, bool& restart) {
+  auto parent = static_cast<InnerNode*>(nullptr);
+  auto parent_version = uint64_t{0};
+  auto parent_partial_key = uint8_t{0};
+
+  auto node = &root;
+  auto version = node->read_lock_or_restart(restart);
+  if (restart) return false;
+  auto depth = size_t{0};
+
+  while (true) {
+    const auto prefix_length = node->prefix_length;
+    if (matching_prefix_length(*node, key, depth) != prefix_length) {
+      node->check_or_restart(version, restart);
+      return false;
+    }
+    depth += prefix_length;
+
+    const auto partial_key = key_byte(key, depth);
+    const auto child = find_child(*node, partial_key);
+    const auto is_collapsible = node->type == NodeType::Node4 && node->count.load(std::memory_order_relaxed) == 2;
+    node->check_or_restart(version, restart);
+    if (restart || !child) return false;
+
+    if (child->type == NodeType::Leaf) {
+      const auto leaf = static_cast<LeafNode*>(child);
+      if (leaf->key != key) return false;
+
+      if (!is_collapsible || !parent) {
+        node->upgrade_to_write_lock_or_restart(version, restart);
+        if (restart) return false;
+        remove_child(*node, partial_key);
+        node->write_unlock();
+        EpochManager::get().retire(leaf);
+        return true;
+      }
+
+      // Only one child would remain in the Node4, so it replaces the node in the parent
+      parent->upgrade_to_write_lock_or_restart(parent_version, restart);
+      if (restart) return false;
+      node->upgrade_to_write_lock_or_restart(version, restart);
+      if (restart) {
+        parent->write_unlock();
+        return false;
+      }
+
+      auto remaining_partial_key = uint8_t{0};
+      auto remaining_child = static_cast<Node*>(nullptr);
+      for_each_child(*node, [&](const uint8_t child_partial_key, Node* node_child) {
+        if (node_child == leaf) return;
+        remaining_partial_key = child_partial_key;
+        remaining_child = node_child;
+      });
+
+      if (remaining_child->type != NodeType::Leaf) {
+        // The remaining child is reached from the parent directly, so it gets the prefix of the node and the partial
+        // key as additional prefix
+        auto& remaining_node = static_cast<InnerNode&>(*remaining_child);
+        remaining_node.write_lock_or_restart(restart);
+        if (restart) {
+          node->write_unlock();
+          parent->write_unlock();
+          return false;
+        }
+
+        auto combined_prefix = node->prefix;
+        combined_prefix[node->prefix_length] = remaining_partial_key;
+        std::copy_n(remaining_node.prefix.cbegin(), remaining_node.prefix_length,
+                    combined_prefix.begin() + node->prefix_length + 1);
+        remaining_node.prefix = combined_prefix;
+        remaining_node.prefix_length = static_cast<uint8_t>(node->prefix_length + 1 + remaining_node.prefix_length);
+        remaining_node.write_unlock();
+      }
+
+      change_child(*parent, parent_partial_key, remaining_child);
+      node->write_unlock_obsolete();
+      parent->write_unlock();
+      EpochManager::get().retire(node);
+      EpochManager::get().retire(leaf);
+      return true;
+    }
+
+    parent = node;
+    parent_version = version;
+    parent_partial_key = partial_key;
+
+    node = static_cast<InnerNode*>(child);
+    version = node->read_lock_or_restart(restart);
+    if (restart) return false;
+    ++depth;
+  }
+}
+
+// Appends all entries in [lower_key, upper_key] below @param node, whose key bytes before @param depth are @param path
+void range_or_restart(const InnerNode& node, const Key path, const size_t depth, const Key lower_key,
+                      const Key upper_key, std::vector<std::pair<Key, Value>>& entries, bool& restart) {
+  const auto version = node.read_lock_or_restart(restart);
+  if (restart) return;
+
+  const auto prefix_length = std::min(static_cast<size_t>(node.prefix_length), KEY_SIZE - depth);
+  const auto prefix = node.prefix;
+  auto children = std::vector<std::pair<uint8_t, Node*>>{};
+  for_each_child(node, [&](const uint8_t partial_key, Node* child) { children.emplace_back(partial_key, child); });
+
+  node.check_or_restart(version, restart);
+  if (restart) return;
+
+  auto node_path = path;
+  for (auto prefix_idx = size_t{0}; prefix_idx < prefix_length; ++prefix_idx) {
+    node_path |= Key{prefix[prefix_idx]} << (8 * (KEY_SIZE - 1 - depth - prefix_idx));
+  }
+  const auto child_depth = depth + prefix_length;
+  if (child_depth >= KEY_SIZE) return;
+
+  for (const auto& [partial_key, child] : children) {
+    // All keys below the child share the bytes up to and including the partial key
+    const auto child_path = node_path | (Key{partial_key} << (8 * (KEY_SIZE - 1 - child_depth)));
+    const auto remaining_bits = 8 * (KEY_SIZE - 1 - child_depth);
+    const auto child_max_key = remaining_bits == 0 ? child_path : child_path | ((Key{1} << remaining_bits) - 1);
+    if (child_max_key < lower_key) continue;
+    if (child_path > upper_key) break;
+
+    if (child->type == NodeType::Leaf) {
+      const auto& leaf = static_cast<const LeafNode&>(*child);
+      if (leaf.key >= lower_key && leaf.key <= upper_key) entries.emplace_back(leaf.key, leaf.value);
+      continue;
+    }
+
+    range_or_restart(static_cast<const InnerNode&>(*child), child_path, child_depth + 1, lower_key, upper_key, entries,
+                     restart);
+    if (restart) return;
+  }
+}
+
+void delete_subtree(Node* node) {
+  if (node->type != NodeType::Leaf) {
+    for_each_child(static_cast<InnerNode&>(*node), [](const uint8_t, Node* child) { delete_subtree(child); });
+  }
+  delete_node(node);
+}
+
+}  // namespace
+
+ConcurrentAdaptiveRadixTree::ConcurrentAdaptiveRadixTree() : _root(new Node256()) {}
+
+ConcurrentAdaptiveRadixTree::~ConcurrentAdaptiveRadixTree() { delete_subtree(_root); }
+
+bool ConcurrentAdaptiveRadixTree::insert(const Key key, const Value value) {
+  const auto guard = EpochManager::Guard{};
+  auto& root = static_cast<InnerNode&>(*_root);
+  auto new_leaf = new LeafNode(key, value);
+
+  while (true) {
+    auto restart = false;
+    const auto inserted = insert_or_restart(root, new_leaf, restart);
+    if (restart) continue;
+
+    if (inserted) {
+      ++_size;
+    } else {
+      delete new_leaf;
+    }
+    return inserted;
+  }
+}
+
+bool ConcurrentAdaptiveRadixTree::remove(const Key key) {
+  const auto guard = EpochManager::Guard{};
+  auto& root = static_cast<InnerNode&>(*_root);
+
+  while (true) {
+    auto restart = false;
+    const auto removed = remove_or_restart(root, key, restart);
+    if (restart) continue;
+
+    if (removed) --_size;
+    return removed;
+  }
+}
+
+std::optional<Value> ConcurrentAdaptiveRadixTree::lookup(const Key key) const {
+  const auto guard = EpochManager::Guard{};
+  const auto& root = static_cast<const InnerNode&>(*_root);
+
+  while (true) {
+    auto restart = false;
+    const auto value = lookup_or_restart(root, key, restart);
+    if (!restart) return value;
+  }
+}
+
+std::vector<std::pair<Key, Value>> ConcurrentAdaptiveRadixTree::range(const Key lower_key, const Key upper_key) const {
+  const auto guard = EpochManager::Guard{};
+  const auto& root = static_cast<const InnerNode&>(*_root);
+
+  auto entries = std::vector<std::pair<Key, Value>>{};
+  if (lower_key > upper_key) return entries;
+
+  // If a node is modified while the range is collected, it is collected again from the start
+  while (true) {
+    auto restart = false;
+    range_or_restart(root, Key{0}, 0, lower_key, upper_key, entries, restart);
+    if (!restart) return entries;
+    entries.clear();
+  }
+}
+
+size_t ConcurrentAdaptiveRadixTree::size() const { return _size.load(); }
+
+}  // namespace opossum
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * An Adaptive Radix Tree that supports concurrent lookups, inserts, and removals. In contrast to the
+ * AdaptiveRadixTreeIndex, which is bulk-loaded from a DictionarySegment and read-only afterwards, it can serve as the
+ * engine of updatable, table-wide indexes.
+ *
+ * Keys are unsigned 64 bit integers, which are binary comparable when split into their bytes from the most significant
+ * one (see AdaptiveRadixTreeIndex::BinaryComparable). Each key is mapped to one value, so non-unique columns have to
+ * make their keys unique, e.g., by combining the value with the position of the row.
+ *
+ * Synchronization uses optimistic lock coupling as described in "The ART of Practical Synchronization" (Leis et al.,
+ * DaMoN 2016): Every inner node has a version that writers lock and increment. Readers do not write to shared memory,
+ * but read the version before and validate it after reading a node and restart if it has changed in between. Thus,
+ * lookups on different keys do not contend for cache lines and scale with the number of cores. Writers only lock the
+ * nodes that they modify (and the parent if the node has to be replaced).
+ *
+ * Replaced and removed nodes might still be read by concurrent operations. They are freed using epoch-based
+ * reclamation once no operation that started before the node was removed is running anymore.
+ *
+ * Like in the paper, the tree uses lazy expansion (leaves are stored as high up in the tree as possible and hold the
+ * full key) and stores prefixes of inner nodes pessimistically (which never exceed the eight bytes of a key). Inner
+ * nodes grow when they are full, but are not shrunk, except that a Node4 with a single remaining child is merged into
+ * its parent.
+ */
+class ConcurrentAdaptiveRadixTree : private Noncopyable {
+ public:
+  using Key = uint64_t;
+  using Value = uint64_t;
+
+  ConcurrentAdaptiveRadixTree();
+  ~ConcurrentAdaptiveRadixTree();
+
+  /**
+   * @return false if the key was already contained, in which case its value is not changed
+   */
+  bool insert(const Key key, const Value value);
+
+  /**
+   * @return false if the key was not contained
+   */
+  bool remove(const Key key);
+
+  std::optional<Value> lookup(const Key key) const;
+
+  /**
+   * @return All entries with keys in [@param lower_key, @param upper_key], ordered by their keys. Entries that are
+   *         inserted or removed concurrently may or may not be part of the result.
+   */
+  std::vector<std::pair<Key, Value>> range(const Key lower_key, const Key upper_key) const;
+
+  // Number of entries. Might be outdated immediately when the tree is modified concurrently.
+  size_t size() const;
+
+  // Defined in the .cpp together with the functions that operate on the nodes
+  struct Node;
+
+ protected:
+  // The root is a Node256 with an empty prefix, so it never has to be replaced
+  Node* const _root;
+  std::atomic<size_t> _size{0};
+};
+
+}  // namespace opossum
@@ -1,8 +1,16 @@
 #include "b_tree_index_impl.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+
 #include "resolve_type.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -13,6 +21,20 @@ BTreeIndexImpl<DataType>::BTreeIndexImpl(const std::shared_ptr<const BaseSegment
   _bulk_insert(segments_to_index);
 }
 
+template <typename DataType>
+BTreeIndexImpl<DataType>::BTreeIndexImpl(const std::vector<DataType>& sorted_values,
+                                         std::vector<ChunkOffset> chunk_offsets) {
+  Assert(sorted_values.size() == chunk_offsets.size(), "Expected one chunk offset per value.");
+  DebugAssert(std::is_sorted(sorted_values.cbegin(), sorted_values.cend()), "Values must be sorted.");
+
+  _chunk_offsets = std::move(chunk_offsets);
+  for (auto position = size_t{0}; position < sorted_values.size(); ++position) {
+    if (position == 0 || sorted_values[position] != sorted_values[position - 1]) {
+      _append_to_btree(sorted_values[position], position);
+    }
+  }
+}
+
 template <typename DataType>
 BaseBTreeIndexImpl::Iterator BTreeIndexImpl<DataType>::lower_bound(const std::vector<AllTypeVariant>& values) const {
   return lower_bound(type_cast<DataType>(values[0]));
@@ -60,35 +82,74 @@ uint64_t BTreeIndexImpl<DataType>::memory_consumption() const {
 
 template <typename DataType>
 void BTreeIndexImpl<DataType>::_bulk_insert(const std::shared_ptr<const BaseSegment>& segment) {
-  std::vector<std::pair<ChunkOffset, DataType>> values;
+  // The attribute vector of a dictionary segment already orders the rows by value, so the chunk offsets are sorted
+  // with a counting sort over the value ids, as in the GroupKeyIndex
+  if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<DataType>>(segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    const auto null_value_id = dictionary_segment->null_value_id();
+
+    // value_positions[value_id] is the position of the first chunk offset of the value in _chunk_offsets
+    auto value_positions = std::vector<size_t>(dictionary.size() + 1u, 0u);
+    resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+      for (const auto& compressed_value_id : attribute_vector) {
+        const auto value_id = static_cast<ValueID>(compressed_value_id);
+        if (value_id != null_value_id) ++value_positions[value_id + 1u];
+      }
+    });
+    std::partial_sum(value_positions.begin(), value_positions.end(), value_positions.begin());
+
+    _chunk_offsets.resize(value_positions.back());
+    auto write_positions = std::vector<size_t>(value_positions.cbegin(), value_positions.cend() - 1);
+    resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+      auto chunk_offset = ChunkOffset{0};
+      for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend();
+           ++value_id_it, ++chunk_offset) {
+        const auto value_id = static_cast<ValueID>(*value_id_it);
+        if (value_id != null_value_id) _chunk_offsets[write_positions[value_id]++] = chunk_offset;
+      }
+    });
+
+    for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+      if (value_positions[value_id] != value_positions[value_id + 1]) {
+        _append_to_btree(dictionary[value_id], value_positions[value_id]);
+      }
+    }
+    return;
+  }
 
   // Materialize
+  std::vector<std::pair<DataType, ChunkOffset>> values;
   resolve_segment_type<DataType>(*segment, [&](const auto& typed_segment) {
     auto iterable_left = create_iterable_from_segment<DataType>(typed_segment);
     iterable_left.for_each([&](const auto& value) {
       if (value.is_null()) return;
-      values.push_back(std::make_pair(value.chunk_offset(), value.value()));
+      values.emplace_back(value.value(), value.chunk_offset());
     });
   });
 
-  // Sort
-  std::sort(values.begin(), values.end(), [](const auto& a, const auto& b) { return a.second < b.second; });
+  // Sort, rows with the same value stay ordered by their chunk offset
+  std::sort(values.begin(), values.end());
   _chunk_offsets.resize(values.size());
   for (size_t i = 0; i < values.size(); i++) {
-    _chunk_offsets[i] = values[i].first;
+    _chunk_offsets[i] = values[i].second;
   }
 
   // Build index
-  DataType current_value = values[0].second;
-  _btree[current_value] = 0;
   for (size_t i = 0; i < values.size(); i++) {
-    if (values[i].second != current_value) {
-      current_value = values[i].second;
-      _btree[current_value] = i;
+    if (i == 0 || values[i].first != values[i - 1].first) {
+      _append_to_btree(values[i].first, i);
     }
   }
 }
 
+template <typename DataType>
+void BTreeIndexImpl<DataType>::_append_to_btree(const DataType& value, const size_t position) {
+  DebugAssert(_btree.empty() || std::prev(_btree.end())->first < value, "Values must be appended in order.");
+
+  // Inserting with the end as hint does not search the tree
+  _btree.insert(_btree.end(), std::make_pair(value, position));
+}
+
 EXPLICITLY_INSTANTIATE_DATA_TYPES(BTreeIndexImpl);
 
 }  // namespace opossum
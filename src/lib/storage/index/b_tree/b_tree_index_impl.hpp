@@ -50,6 +50,13 @@ class BTreeIndexImpl : public BaseBTreeIndexImpl {
   ~BTreeIndexImpl() = default;
   explicit BTreeIndexImpl(const std::shared_ptr<const BaseSegment>& segments_to_index);
 
+  /**
+   * Bulk loads the index from @param sorted_values and the @param chunk_offsets of the rows that hold them, both
+   * ordered by value. The tree is filled from left to right, which is much cheaper than inserting the values one by
+   * one.
+   */
+  BTreeIndexImpl(const std::vector<DataType>& sorted_values, std::vector<ChunkOffset> chunk_offsets);
+
   BTreeIndexImpl(const BTreeIndexImpl&) = delete;
   BTreeIndexImpl& operator=(const BTreeIndexImpl&) = delete;
 
@@ -69,6 +76,10 @@ class BTreeIndexImpl : public BaseBTreeIndexImpl {
  protected:
   void _bulk_insert(const std::shared_ptr<const BaseSegment>&);
 
+  // Appends an entry for @param value, which is greater than all values in the tree and whose first chunk offset is
+  // at @param position in _chunk_offsets
+  void _append_to_btree(const DataType& value, const size_t position);
+
   btree::btree_map<DataType, size_t> _btree;
 };
 
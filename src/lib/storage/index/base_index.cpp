@@ -18,6 +18,10 @@ bool BaseIndex::is_index_for(const std::vector<std::shared_ptr<const BaseSegment
   return true;
 }
 
+std::vector<std::shared_ptr<const BaseSegment>> BaseIndex::get_indexed_segments() const {
+  return _get_indexed_segments();
+}
+
 BaseIndex::Iterator BaseIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
   DebugAssert((_get_indexed_segments().size() >= values.size()),
               "BaseIndex: The number of queried segments has to be less or equal to the number of indexed segments.");
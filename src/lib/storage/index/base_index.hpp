@@ -62,6 +62,11 @@ class BaseIndex : private Noncopyable {
    */
   bool is_index_for(const std::vector<std::shared_ptr<const BaseSegment>>& segments) const;
 
+  /**
+   * @return The indexed segments in the order of the index columns
+   */
+  std::vector<std::shared_ptr<const BaseSegment>> get_indexed_segments() const;
+
   /**
    * Searches for the first entry within the chunk that is equal or greater than the given values.
    * The number of given values has to be less or equal to number of indexed segments. Additionally
@@ -0,0 +1,55 @@
+#include "delta_index.hpp"
+
+#include <vector>
+
+#include "storage/chunk.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The chunk of the rows is always ChunkID{0}
+std::vector<ChunkOffset> to_chunk_offsets(const PosList& matches) {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  chunk_offsets.reserve(matches.size());
+  for (const auto& row_id : matches) {
+    chunk_offsets.emplace_back(row_id.chunk_offset);
+  }
+  return chunk_offsets;
+}
+
+}  // namespace
+
+DeltaIndex::DeltaIndex(const std::vector<ColumnID>& column_ids, const std::vector<DataType>& data_types,
+                       const SegmentIndexType merge_type)
+    : _merge_type(merge_type), _index(column_ids, data_types) {}
+
+const std::vector<ColumnID>& DeltaIndex::column_ids() const { return _index.column_ids(); }
+
+SegmentIndexType DeltaIndex::merge_type() const { return _merge_type; }
+
+bool DeltaIndex::is_index_for(const std::vector<ColumnID>& column_ids) const {
+  return _index.is_index_for(column_ids);
+}
+
+void DeltaIndex::insert(const Chunk& chunk, const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  _index.insert(chunk, ChunkID{0}, begin_offset, end_offset);
+}
+
+void DeltaIndex::remove(const Chunk& chunk, const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  _index.remove(chunk, ChunkID{0}, begin_offset, end_offset);
+}
+
+std::vector<ChunkOffset> DeltaIndex::lookup(const PredicateCondition predicate_condition,
+                                            const std::vector<AllTypeVariant>& values,
+                                            const std::vector<AllTypeVariant>& values2) const {
+  return to_chunk_offsets(_index.lookup(predicate_condition, values, values2));
+}
+
+std::vector<ChunkOffset> DeltaIndex::lookup(const IndexKeyRange& key_range) const {
+  return to_chunk_offsets(_index.lookup(key_range));
+}
+
+size_t DeltaIndex::size() const { return _index.size(); }
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "segment_index_type.hpp"
+#include "table_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * The regular chunk indexes (see BaseIndex) are built over the dictionaries and attribute vectors of encoded segments
+ * and cannot be extended. Without a DeltaIndex, lookups on the mutable chunk that rows are currently inserted into
+ * would always need a full scan.
+ *
+ * A DeltaIndex indexes the ValueSegments of a mutable chunk. It is filled by the Insert operator as rows are added and
+ * the rows of rolled back inserts are removed again. Once the chunk is compressed by the ChunkCompressionTask, the
+ * DeltaIndex is merged into a regular index of merge_type() on the encoded segments, which replaces it.
+ *
+ * Internally, it is a TableIndex over the single chunk, so inserting and looking up are thread-safe and rows that have
+ * a NULL in any of the indexed columns are not indexed.
+ */
+class DeltaIndex : private Noncopyable {
+ public:
+  DeltaIndex(const std::vector<ColumnID>& column_ids, const std::vector<DataType>& data_types,
+             const SegmentIndexType merge_type);
+
+  const std::vector<ColumnID>& column_ids() const;
+
+  // The type of the regular index that replaces the DeltaIndex when the chunk is compressed
+  SegmentIndexType merge_type() const;
+
+  /**
+   * @return Whether @param column_ids are the leading columns of the index, see BaseIndex::is_index_for()
+   */
+  bool is_index_for(const std::vector<ColumnID>& column_ids) const;
+
+  // Adds the rows [@param begin_offset, @param end_offset) of @param chunk
+  void insert(const Chunk& chunk, const ChunkOffset begin_offset, const ChunkOffset end_offset);
+
+  // Removes the rows [@param begin_offset, @param end_offset) of @param chunk, e.g., when an insert is rolled back
+  void remove(const Chunk& chunk, const ChunkOffset begin_offset, const ChunkOffset end_offset);
+
+  /**
+   * See TableIndex::lookup()
+   *
+   * @return The offsets of the matching rows, ordered by the indexed values
+   */
+  std::vector<ChunkOffset> lookup(const PredicateCondition predicate_condition,
+                                  const std::vector<AllTypeVariant>& values,
+                                  const std::vector<AllTypeVariant>& values2 = {}) const;
+
+  // See TableIndex::lookup(), @return The offsets of the matching rows, ordered by the indexed values
+  std::vector<ChunkOffset> lookup(const IndexKeyRange& key_range) const;
+
+  // Number of indexed rows
+  size_t size() const;
+
+ protected:
+  const SegmentIndexType _merge_type;
+  TableIndex _index;
+};
+
+}  // namespace opossum
@@ -120,12 +120,28 @@ VariableLengthKey CompositeGroupKeyIndex::_create_composite_key(const std::vecto
                                                                 bool is_upper_bound) const {
   auto result = VariableLengthKey(_keys.key_size());
 
+  const auto bits_of_segments_from = [&](const size_t first_segment_idx) {
+    return std::accumulate(
+        _indexed_segments.cbegin() + first_segment_idx, _indexed_segments.cend(), static_cast<uint8_t>(0u),
+        [](auto value, auto segment) {
+          return value + byte_width_for_fixed_size_byte_aligned_type(segment->compressed_vector_type()) * CHAR_BIT;
+        });
+  };
+
   // retrieve the partial keys for every value except for the last one and append them into one partial-key
   for (auto column_id = ColumnID{0}; column_id < values.size() - 1; ++column_id) {
-    auto partial_key = _indexed_segments[column_id]->lower_bound(values[column_id]);
+    const auto& segment = _indexed_segments[column_id];
+    auto partial_key = segment->lower_bound(values[column_id]);
     auto bits_of_partial_key =
-        byte_width_for_fixed_size_byte_aligned_type(_indexed_segments[column_id]->compressed_vector_type()) * CHAR_BIT;
+        byte_width_for_fixed_size_byte_aligned_type(segment->compressed_vector_type()) * CHAR_BIT;
     result.shift_and_set(partial_key, bits_of_partial_key);
+
+    // If the value is not part of the dictionary, no key starts with the given values. Both bounds are then the first
+    // key with the next greater value, regardless of the following values.
+    if (partial_key == segment->upper_bound(values[column_id])) {
+      result <<= bits_of_segments_from(column_id + 1);
+      return result;
+    }
   }
 
   // retrieve the partial key for the last value (depending on whether we have a lower- or upper-bound-query)
@@ -138,12 +154,7 @@ VariableLengthKey CompositeGroupKeyIndex::_create_composite_key(const std::vecto
   result.shift_and_set(partial_key, bits_of_partial_key);
 
   // fill empty space of key with zeros if less values than segments were provided
-  auto empty_bits = std::accumulate(
-      _indexed_segments.cbegin() + values.size(), _indexed_segments.cend(), static_cast<uint8_t>(0u),
-      [](auto value, auto segment) {
-        return value + byte_width_for_fixed_size_byte_aligned_type(segment->compressed_vector_type()) * CHAR_BIT;
-      });
-  result <<= empty_bits;
+  result <<= bits_of_segments_from(values.size());
 
   return result;
 }
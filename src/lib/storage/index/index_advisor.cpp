@@ -0,0 +1,527 @@
+#include "index_advisor.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "expression/between_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
+#include "expression/list_expression.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/parameter_expression.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "optimizer/strategy/index_scan_rule.hpp"
+#include "sql/sql_query_cache.hpp"
+#include "sql/sql_query_plan.hpp"
+#include "statistics/base_column_statistics.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Scans whose weight decayed below this value are forgotten
+constexpr float MIN_WORKLOAD_SCAN_WEIGHT = 0.01f;
+
+std::optional<ColumnID> resolve_column_id(const AbstractExpression& expression) {
+  const auto* column_expression = dynamic_cast<const PQPColumnExpression*>(&expression);
+  if (!column_expression) return std::nullopt;
+  return column_expression->column_id;
+}
+
+// Values of prepared statements are not known, their selectivity is estimated without the value
+std::optional<AllParameterVariant> resolve_value(const AbstractExpression& expression) {
+  if (const auto* value_expression = dynamic_cast<const ValueExpression*>(&expression)) {
+    if (variant_is_null(value_expression->value)) return std::nullopt;
+    return AllParameterVariant{value_expression->value};
+  }
+  if (const auto* parameter_expression = dynamic_cast<const ParameterExpression*>(&expression)) {
+    return AllParameterVariant{parameter_expression->parameter_id};
+  }
+  return std::nullopt;
+}
+
+std::optional<IndexAdvisor::ScanPredicate> resolve_scan_predicate(const AbstractExpression& expression) {
+  if (const auto* in_expression = dynamic_cast<const InExpression*>(&expression)) {
+    const auto column_id = resolve_column_id(*in_expression->value());
+    const auto* list_expression = dynamic_cast<const ListExpression*>(in_expression->set().get());
+    if (in_expression->is_negated() || !column_id || !list_expression) return std::nullopt;
+
+    auto values = std::vector<AllParameterVariant>{};
+    for (const auto& element : list_expression->elements()) {
+      const auto value = resolve_value(*element);
+      if (!value) return std::nullopt;
+      values.emplace_back(*value);
+    }
+    return IndexAdvisor::ScanPredicate{*column_id, PredicateCondition::Equals, std::move(values)};
+  }
+
+  if (const auto* between_expression = dynamic_cast<const BetweenExpression*>(&expression)) {
+    const auto column_id = resolve_column_id(*between_expression->value());
+    const auto lower_value = resolve_value(*between_expression->lower_bound());
+    const auto upper_value = resolve_value(*between_expression->upper_bound());
+    if (!column_id || !lower_value || !upper_value) return std::nullopt;
+
+    return IndexAdvisor::ScanPredicate{*column_id, PredicateCondition::Between, {*lower_value, *upper_value}};
+  }
+
+  if (const auto* binary_predicate_expression = dynamic_cast<const BinaryPredicateExpression*>(&expression)) {
+    auto predicate_condition = binary_predicate_expression->predicate_condition;
+    if (predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike) {
+      return std::nullopt;
+    }
+
+    auto column_id = resolve_column_id(*binary_predicate_expression->left_operand());
+    auto value = resolve_value(*binary_predicate_expression->right_operand());
+    if (!column_id) {
+      column_id = resolve_column_id(*binary_predicate_expression->right_operand());
+      value = resolve_value(*binary_predicate_expression->left_operand());
+      predicate_condition = flip_predicate_condition(predicate_condition);
+    }
+    if (!column_id || !value) return std::nullopt;
+
+    return IndexAdvisor::ScanPredicate{*column_id, predicate_condition, {*value}};
+  }
+
+  return std::nullopt;
+}
+
+// The name of the stored table that @param table_scan filters, if its input is a GetTable (or another filter of one)
+std::optional<std::string> resolve_scanned_table_name(const TableScan& table_scan) {
+  auto input = table_scan.input_left();
+  while (input && (input->type() == OperatorType::TableScan || input->type() == OperatorType::Validate)) {
+    input = input->input_left();
+  }
+  if (!input || input->type() != OperatorType::GetTable) return std::nullopt;
+  return static_cast<const GetTable&>(*input).table_name();
+}
+
+void collect_table_scans(const std::shared_ptr<const AbstractOperator>& op,
+                         std::unordered_set<std::shared_ptr<const AbstractOperator>>& visited_operators,
+                         std::vector<std::shared_ptr<const TableScan>>& table_scans) {
+  if (!op || !visited_operators.emplace(op).second) return;
+
+  if (op->type() == OperatorType::TableScan) table_scans.emplace_back(std::static_pointer_cast<const TableScan>(op));
+
+  collect_table_scans(op->input_left(), visited_operators, table_scans);
+  collect_table_scans(op->input_right(), visited_operators, table_scans);
+}
+
+bool is_point_predicate(const IndexAdvisor::ScanPredicate& predicate) {
+  return predicate.predicate_condition == PredicateCondition::Equals;
+}
+
+float estimate_selectivity(const TableStatistics& table_statistics, const IndexAdvisor::ScanPredicate& predicate) {
+  const auto& values = predicate.values;
+  if (predicate.predicate_condition == PredicateCondition::Between) {
+    const auto row_count =
+        table_statistics.estimate_predicate(predicate.column_id, PredicateCondition::Between, values[0], values[1])
+            .row_count();
+    return row_count / table_statistics.row_count();
+  }
+
+  // The values of IN lists are estimated one by one, as in the IndexScanRule
+  auto row_count = 0.0f;
+  for (const auto& value : values) {
+    row_count +=
+        table_statistics.estimate_predicate(predicate.column_id, predicate.predicate_condition, value).row_count();
+  }
+  return std::min(row_count / table_statistics.row_count(), 1.0f);
+}
+
+/**
+ * @return The selectivity of the predicates of @param scan that an index on @param column_ids answers (point
+ *         predicates on the leading columns, optionally followed by one other predicate), std::nullopt if the
+ *         IndexScanRule would not use the index for the scan
+ */
+std::optional<float> estimate_index_selectivity(const std::vector<ColumnID>& column_ids,
+                                                const IndexAdvisor::WorkloadScan& scan,
+                                                const TableStatistics& table_statistics) {
+  if (table_statistics.row_count() < IndexScanRule::ROW_COUNT_THRESHOLD) return std::nullopt;
+
+  auto selectivity = 1.0f;
+  auto answers_predicate = false;
+  for (const auto column_id : column_ids) {
+    const auto restricts_column = [&](const auto& predicate) { return predicate.column_id == column_id; };
+    const auto& predicates = scan.predicates;
+
+    const auto point_predicate_iter = std::find_if(predicates.cbegin(), predicates.cend(), [&](const auto& predicate) {
+      return restricts_column(predicate) && is_point_predicate(predicate);
+    });
+    if (point_predicate_iter != predicates.cend()) {
+      selectivity *= estimate_selectivity(table_statistics, *point_predicate_iter);
+      answers_predicate = true;
+      continue;
+    }
+
+    const auto predicate_iter = std::find_if(predicates.cbegin(), predicates.cend(), restricts_column);
+    if (predicate_iter != predicates.cend()) {
+      selectivity *= estimate_selectivity(table_statistics, *predicate_iter);
+      answers_predicate = true;
+    }
+    break;
+  }
+
+  if (!answers_predicate || selectivity > IndexScanRule::SELECTIVITY_THRESHOLD) return std::nullopt;
+  return selectivity;
+}
+
+/**
+ * GroupKeyIndex: A ChunkOffset per row and an offset per distinct value of every chunk.
+ * CompositeGroupKeyIndex: A key of the concatenated value ids, a key offset, and a position per row.
+ */
+size_t estimate_index_memory_usage(const Table& table, const TableStatistics& table_statistics,
+                                   const std::vector<ColumnID>& column_ids) {
+  const auto row_count = static_cast<size_t>(table_statistics.row_count());
+  const auto& column_statistics = table_statistics.column_statistics();
+
+  if (column_ids.size() == 1) {
+    const auto distinct_count = static_cast<size_t>(column_statistics[column_ids.front()]->distinct_count());
+    const auto distinct_count_per_chunk = std::min(distinct_count, static_cast<size_t>(table.max_chunk_size()));
+    return row_count * sizeof(ChunkOffset) + table.chunk_count() * (distinct_count_per_chunk + 1) * sizeof(size_t);
+  }
+
+  auto key_size = size_t{0};
+  for (const auto column_id : column_ids) {
+    const auto distinct_count = column_statistics[column_id]->distinct_count();
+    key_size += distinct_count <= 255.0f ? 1u : (distinct_count <= 65'535.0f ? 2u : 4u);
+  }
+  return row_count * (key_size + 2 * sizeof(ChunkOffset));
+}
+
+bool is_index_used_by_index_scans(const IndexInfo& index_info) {
+  if (index_info.type == SegmentIndexType::GroupKey) return index_info.column_ids.size() == 1;
+  return index_info.type == SegmentIndexType::CompositeGroupKey;
+}
+
+struct IndexCandidate {
+  std::string table_name;
+  std::vector<ColumnID> column_ids;
+  size_t memory_usage;
+  bool is_selected;
+};
+
+std::string create_index_name(const std::string& table_name, const std::vector<ColumnID>& column_ids) {
+  auto index_name = "index_advisor_" + table_name;
+  for (const auto column_id : column_ids) {
+    index_name += "_" + std::to_string(column_id);
+  }
+  return index_name;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::ostream& operator<<(std::ostream& stream, const IndexAdvisorDecision& decision) {
+  stream << (decision.action == IndexAdvisorDecision::Action::Create ? "Create" : "Drop") << " index on "
+         << decision.table_name << " (";
+  for (auto column_idx = size_t{0}; column_idx < decision.column_ids.size(); ++column_idx) {
+    if (column_idx > 0) stream << ", ";
+    stream << decision.column_ids[column_idx];
+  }
+  stream << "): benefit " << decision.benefit << " rows, size " << format_bytes(decision.memory_usage)
+         << " (table size " << format_bytes(decision.table_memory_usage) << ")";
+  return stream;
+}
+
+IndexAdvisor::IndexAdvisor(const Options& options) : _options(options) {
+  _loop_thread = std::make_unique<PausableLoopThread>(_options.interval, [this](size_t) { run(); });
+}
+
+std::vector<IndexAdvisorDecision> IndexAdvisor::run() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  _update_workload();
+
+  auto& storage_manager = StorageManager::get();
+
+  // Indexes whose table was dropped are forgotten
+  _created_indexes.erase(std::remove_if(_created_indexes.begin(), _created_indexes.end(),
+                                        [&](const auto& created_index) {
+                                          return !storage_manager.has_table(created_index.table_name);
+                                        }),
+                         _created_indexes.end());
+
+  // Group the scans by table. The statistics of the tables are generated if they are missing.
+  auto scans_by_table = std::map<std::string, std::vector<const WorkloadScan*>>{};
+  for (const auto& workload_entry : _workload) {
+    const auto& scan = workload_entry.second;
+    if (storage_manager.has_table(scan.table_name)) scans_by_table[scan.table_name].emplace_back(&scan);
+  }
+  for (const auto& created_index : _created_indexes) {
+    scans_by_table[created_index.table_name];
+  }
+
+  auto table_statistics_by_table = std::map<std::string, std::shared_ptr<const TableStatistics>>{};
+  for (const auto& scans_entry : scans_by_table) {
+    const auto table = storage_manager.get_table(scans_entry.first);
+    auto table_statistics = std::shared_ptr<const TableStatistics>{table->table_statistics()};
+    if (!table_statistics) table_statistics = std::make_shared<TableStatistics>(generate_table_statistics(*table));
+    table_statistics_by_table.emplace(scans_entry.first, table_statistics);
+  }
+
+  // The lowest selectivity that the selected indexes and the indexes not created by the advisor achieve per scan
+  auto best_selectivities = std::map<const WorkloadScan*, float>{};
+  for (const auto& scans_entry : scans_by_table) {
+    const auto table = storage_manager.get_table(scans_entry.first);
+    const auto& table_statistics = *table_statistics_by_table.at(scans_entry.first);
+
+    auto existing_indexes_column_ids = std::vector<std::vector<ColumnID>>{};
+    for (const auto& index_info : table->get_indexes()) {
+      const auto is_created_by_advisor =
+          std::any_of(_created_indexes.cbegin(), _created_indexes.cend(),
+                      [&](const auto& created_index) { return created_index.index_name == index_info.name; });
+      if (!is_created_by_advisor && is_index_used_by_index_scans(index_info)) {
+        existing_indexes_column_ids.emplace_back(index_info.column_ids);
+      }
+    }
+    for (const auto& table_index : table->table_indexes()) {
+      existing_indexes_column_ids.emplace_back(table_index->column_ids());
+    }
+
+    for (const auto* scan : scans_entry.second) {
+      auto best_selectivity = 1.0f;
+      for (const auto& column_ids : existing_indexes_column_ids) {
+        const auto selectivity = estimate_index_selectivity(column_ids, *scan, table_statistics);
+        if (selectivity) best_selectivity = std::min(best_selectivity, *selectivity);
+      }
+      best_selectivities.emplace(scan, best_selectivity);
+    }
+  }
+
+  // Candidates: Single columns and point-restricted columns followed by another restricted column
+  auto candidate_keys = std::set<std::pair<std::string, std::vector<ColumnID>>>{};
+  for (const auto& scans_entry : scans_by_table) {
+    for (const auto* scan : scans_entry.second) {
+      for (const auto& predicate : scan->predicates) {
+        candidate_keys.emplace(scan->table_name, std::vector<ColumnID>{predicate.column_id});
+        if (!is_point_predicate(predicate)) continue;
+
+        for (const auto& next_predicate : scan->predicates) {
+          if (next_predicate.column_id == predicate.column_id) continue;
+          const auto column_ids = std::vector<ColumnID>{predicate.column_id, next_predicate.column_id};
+          candidate_keys.emplace(scan->table_name, column_ids);
+        }
+      }
+    }
+  }
+  for (const auto& created_index : _created_indexes) {
+    candidate_keys.emplace(created_index.table_name, created_index.column_ids);
+  }
+
+  auto candidates = std::vector<IndexCandidate>{};
+  for (const auto& [table_name, column_ids] : candidate_keys) {
+    const auto table = storage_manager.get_table(table_name);
+    const auto memory_usage =
+        estimate_index_memory_usage(*table, *table_statistics_by_table.at(table_name), column_ids);
+    candidates.emplace_back(IndexCandidate{table_name, column_ids, memory_usage, false});
+  }
+
+  // Benefit of a candidate in addition to the selected indexes
+  const auto estimate_benefit = [&](const IndexCandidate& candidate) {
+    const auto& table_statistics = *table_statistics_by_table.at(candidate.table_name);
+
+    auto benefit = 0.0f;
+    for (const auto* scan : scans_by_table.at(candidate.table_name)) {
+      const auto selectivity = estimate_index_selectivity(candidate.column_ids, *scan, table_statistics);
+      if (!selectivity) continue;
+
+      const auto saved_share = std::max(best_selectivities.at(scan) - *selectivity, 0.0f);
+      benefit += scan->weight * table_statistics.row_count() * saved_share;
+    }
+    return benefit;
+  };
+
+  // Greedily select the candidate with the highest benefit per byte that fits into the remaining budget
+  auto remaining_memory_budget = _options.memory_budget;
+  auto benefits = std::map<const IndexCandidate*, float>{};
+  while (true) {
+    auto* best_candidate = static_cast<IndexCandidate*>(nullptr);
+    auto best_benefit_per_byte = 0.0f;
+
+    for (auto& candidate : candidates) {
+      if (candidate.is_selected || candidate.memory_usage > remaining_memory_budget) continue;
+
+      const auto benefit = estimate_benefit(candidate);
+      const auto benefit_per_byte = benefit / std::max(candidate.memory_usage, size_t{1});
+      if (benefit_per_byte > best_benefit_per_byte) {
+        best_candidate = &candidate;
+        best_benefit_per_byte = benefit_per_byte;
+        benefits[&candidate] = benefit;
+      }
+    }
+    if (!best_candidate) break;
+
+    best_candidate->is_selected = true;
+    remaining_memory_budget -= best_candidate->memory_usage;
+
+    const auto& table_statistics = *table_statistics_by_table.at(best_candidate->table_name);
+    for (const auto* scan : scans_by_table.at(best_candidate->table_name)) {
+      const auto selectivity = estimate_index_selectivity(best_candidate->column_ids, *scan, table_statistics);
+      if (selectivity) best_selectivities[scan] = std::min(best_selectivities[scan], *selectivity);
+    }
+  }
+
+  // Create the selected indexes that do not exist yet and drop the unselected indexes the advisor created earlier
+  auto decisions = std::vector<IndexAdvisorDecision>{};
+  for (const auto& candidate : candidates) {
+    const auto created_index_iter =
+        std::find_if(_created_indexes.begin(), _created_indexes.end(), [&](const auto& created_index) {
+          return created_index.table_name == candidate.table_name && created_index.column_ids == candidate.column_ids;
+        });
+    const auto is_created = created_index_iter != _created_indexes.end();
+    if (candidate.is_selected == is_created) continue;
+
+    const auto table = storage_manager.get_table(candidate.table_name);
+    const auto table_memory_usage = table->estimate_memory_usage();
+
+    // Compressing a chunk merges its DeltaIndexes, which must not change meanwhile
+    const auto compression_lock = table->acquire_compression_mutex();
+
+    if (candidate.is_selected) {
+      const auto index_name = create_index_name(candidate.table_name, candidate.column_ids);
+      if (candidate.column_ids.size() == 1) {
+        table->create_index<GroupKeyIndex>(candidate.column_ids, index_name);
+      } else {
+        table->create_index<CompositeGroupKeyIndex>(candidate.column_ids, index_name);
+      }
+      _created_indexes.emplace_back(CreatedIndex{candidate.table_name, candidate.column_ids, index_name});
+
+      decisions.emplace_back(IndexAdvisorDecision{IndexAdvisorDecision::Action::Create, candidate.table_name,
+                                                  candidate.column_ids, benefits.at(&candidate),
+                                                  candidate.memory_usage, table_memory_usage});
+    } else {
+      table->remove_index(created_index_iter->index_name);
+      _created_indexes.erase(created_index_iter);
+
+      decisions.emplace_back(IndexAdvisorDecision{IndexAdvisorDecision::Action::Drop, candidate.table_name,
+                                                  candidate.column_ids, estimate_benefit(candidate),
+                                                  candidate.memory_usage, table_memory_usage});
+    }
+  }
+
+  // Cached plans do not use the new indexes and must not use the dropped ones
+  if (!decisions.empty()) SQLQueryCache<SQLQueryPlan>::get().clear();
+
+  _decisions.insert(_decisions.end(), decisions.cbegin(), decisions.cend());
+  return decisions;
+}
+
+void IndexAdvisor::resume() { _loop_thread->resume(); }
+
+void IndexAdvisor::pause() { _loop_thread->pause(); }
+
+std::vector<IndexAdvisorDecision> IndexAdvisor::decisions() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _decisions;
+}
+
+void IndexAdvisor::_update_workload() {
+  for (auto workload_iter = _workload.begin(); workload_iter != _workload.end();) {
+    auto& scan = workload_iter->second;
+    scan.weight *= _options.workload_decay;
+    workload_iter = scan.weight < MIN_WORKLOAD_SCAN_WEIGHT ? _workload.erase(workload_iter) : std::next(workload_iter);
+  }
+
+  auto visited_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+  auto table_scans = std::vector<std::shared_ptr<const TableScan>>{};
+  for (const auto& cache_entry : SQLQueryCache<SQLQueryPlan>::get().snapshot()) {
+    for (const auto& root : cache_entry.second.tree_roots()) {
+      collect_table_scans(root, visited_operators, table_scans);
+    }
+  }
+
+  // The scans of the cached plans, by their description. Plans that are cached more than once count once.
+  auto& storage_manager = StorageManager::get();
+  auto cached_scans = std::map<std::string, WorkloadScan>{};
+  for (const auto& table_scan : table_scans) {
+    const auto table_name = resolve_scanned_table_name(*table_scan);
+    if (!table_name || !storage_manager.has_table(*table_name)) continue;
+
+    auto predicates = std::vector<ScanPredicate>{};
+    for (const auto& expression : flatten_logical_expressions(table_scan->predicate(), LogicalOperator::And)) {
+      const auto predicate = resolve_scan_predicate(*expression);
+      if (predicate) predicates.emplace_back(*predicate);
+    }
+    if (predicates.empty()) continue;
+
+    const auto description = *table_name + ": " + table_scan->predicate()->as_column_name();
+    cached_scans.emplace(description, WorkloadScan{*table_name, std::move(predicates), 0.0f});
+  }
+
+  // The cached plans are not executed themselves. How often a scan was executed since the last run is estimated from
+  // the executed scans of its columns (see Table::column_scan_count()), which are split between the cached scans that
+  // restrict the same column.
+  const auto scanned_columns = [](const WorkloadScan& scan) {
+    auto column_ids = std::set<ColumnID>{};
+    for (const auto& predicate : scan.predicates) {
+      column_ids.emplace(predicate.column_id);
+    }
+    return column_ids;
+  };
+
+  auto cached_scan_counts = std::map<std::pair<std::string, ColumnID>, size_t>{};
+  for (const auto& cached_scan_entry : cached_scans) {
+    const auto& scan = cached_scan_entry.second;
+    for (const auto column_id : scanned_columns(scan)) {
+      ++cached_scan_counts[{scan.table_name, column_id}];
+    }
+  }
+
+  auto executed_scan_counts = std::map<std::pair<std::string, ColumnID>, uint64_t>{};
+  for (const auto& cached_scan_count : cached_scan_counts) {
+    const auto& [table_name, column_id] = cached_scan_count.first;
+    const auto column_scan_count = storage_manager.get_table(table_name)->column_scan_count(column_id);
+
+    // The counts only grow, unless the table was replaced
+    auto& seen_column_scan_count = _seen_column_scan_counts[{table_name, column_id}];
+    const auto executed_scan_count =
+        column_scan_count >= seen_column_scan_count ? column_scan_count - seen_column_scan_count : column_scan_count;
+    seen_column_scan_count = column_scan_count;
+
+    executed_scan_counts.emplace(cached_scan_count.first, executed_scan_count);
+  }
+
+  for (auto& cached_scan_entry : cached_scans) {
+    auto& scan = cached_scan_entry.second;
+    const auto column_ids = scanned_columns(scan);
+
+    auto weight = 0.0f;
+    for (const auto column_id : column_ids) {
+      const auto key = std::make_pair(scan.table_name, column_id);
+      weight += static_cast<float>(executed_scan_counts.at(key)) / cached_scan_counts.at(key);
+    }
+    weight /= column_ids.size();
+    if (weight == 0.0f) continue;
+
+    auto workload_iter = _workload.find(cached_scan_entry.first);
+    if (workload_iter == _workload.end()) {
+      scan.weight = weight;
+      _workload.emplace(cached_scan_entry.first, std::move(scan));
+    } else {
+      workload_iter->second.weight += weight;
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "all_parameter_variant.hpp"
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+// A decision of the IndexAdvisor, see IndexAdvisor::decisions()
+struct IndexAdvisorDecision {
+  enum class Action { Create, Drop };
+
+  Action action;
+  std::string table_name;
+  std::vector<ColumnID> column_ids;
+
+  // Estimated number of rows that the scans of the workload do not have to read thanks to the index, weighted by how
+  // often and how recently the scans were executed. For dropped indexes, the benefit in addition to the selected
+  // indexes.
+  float benefit;
+
+  // Estimated size of the index and size of the indexed table (see Table::estimate_memory_usage()) in bytes
+  size_t memory_usage;
+  size_t table_memory_usage;
+};
+
+std::ostream& operator<<(std::ostream& stream, const IndexAdvisorDecision& decision);
+
+/**
+ * The IndexAdvisor chooses chunk indexes for the stored tables based on the workload. Every run
+ *
+ *  1. mines the predicates of the TableScans on stored tables from the plans in SQLQueryCache<SQLQueryPlan>. A scan
+ *     is weighted by how often it was executed, with a decay for the executions seen in earlier runs. As the cached
+ *     plans are only copied for execution, the executions are derived from Table::column_scan_count().
+ *  2. builds single-column candidates for the restricted columns and two-column candidates that start with a column
+ *     that is restricted to single values (equality or IN), as the IndexScanRule combines these predicates.
+ *  3. estimates the benefit of a candidate as the number of rows that the scans it can answer do not have to read,
+ *     based on the selectivities of the TableStatistics. Only scans for which the IndexScanRule would choose the
+ *     index count. The memory usage is estimated from the row and distinct counts.
+ *  4. selects candidates greedily by benefit per byte until the memory budget is used up. A candidate's benefit is
+ *     reduced by what the already selected indexes achieve for the same scans.
+ *  5. creates the selected indexes (GroupKeyIndex, CompositeGroupKeyIndex for two columns) and drops the indexes it
+ *     created in earlier runs that were not selected again. Indexes that were not created by the advisor are never
+ *     dropped, and the advisor does not create indexes for scans that they already serve.
+ *
+ * After indexes were created or dropped, the plan cache is cleared so that the queries are optimized again. Each
+ * decision is logged for auditing. Queries that were planned with a dropped index still use it, as their IndexScans
+ * pin the indexes of the chunks (see IndexScan::pin_indexes()). Its memory is released once no such plan exists.
+ */
+class IndexAdvisor : private Noncopyable {
+ public:
+  struct Options {
+    // Maximum total size of the indexes created by the advisor in bytes
+    size_t memory_budget = 1'000'000'000;
+
+    // Time between two runs in the background, see resume()
+    std::chrono::milliseconds interval = std::chrono::seconds(60);
+
+    // Factor by which the weights of the scans seen in earlier runs are reduced in every run
+    float workload_decay = 0.5f;
+  };
+
+  explicit IndexAdvisor(const Options& options);
+
+  /**
+   * Evaluates the current workload and creates and drops indexes accordingly
+   * @return The decisions of this run
+   */
+  std::vector<IndexAdvisorDecision> run();
+
+  // Starts (or continues) running the advisor periodically in a background thread
+  void resume();
+  void pause();
+
+  // All decisions made so far, in order
+  std::vector<IndexAdvisorDecision> decisions() const;
+
+  // A predicate of a TableScan that an index can answer. IN lists are Equals predicates with multiple values.
+  struct ScanPredicate {
+    ColumnID column_id;
+    PredicateCondition predicate_condition;
+    std::vector<AllParameterVariant> values;
+  };
+
+  struct WorkloadScan {
+    std::string table_name;
+    std::vector<ScanPredicate> predicates;
+    float weight;
+  };
+
+ protected:
+  struct CreatedIndex {
+    std::string table_name;
+    std::vector<ColumnID> column_ids;
+    std::string index_name;
+  };
+
+  void _update_workload();
+
+  const Options _options;
+
+  // The scans seen so far, by their description
+  std::map<std::string, WorkloadScan> _workload;
+
+  // Table::column_scan_count() of the scanned columns at the last run, by table name and column
+  std::map<std::pair<std::string, ColumnID>, uint64_t> _seen_column_scan_counts;
+  std::vector<CreatedIndex> _created_indexes;
+  std::vector<IndexAdvisorDecision> _decisions;
+  mutable std::mutex _mutex;
+
+  // Declared last, so that the thread is stopped before the other members are destroyed
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
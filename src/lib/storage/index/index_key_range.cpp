@@ -0,0 +1,51 @@
+#include "index_key_range.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+IndexKeyRange IndexKeyRange::equal_to(const std::vector<AllTypeVariant>& values) {
+  return IndexKeyRange{values, true, values, true};
+}
+
+std::vector<IndexKeyRange> IndexKeyRange::from_predicate(const PredicateCondition predicate_condition,
+                                                         const std::vector<AllTypeVariant>& values,
+                                                         const std::vector<AllTypeVariant>& values2) {
+  Assert(!values.empty(), "Index predicates need at least one value");
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      return {equal_to(values)};
+    case PredicateCondition::NotEquals:
+      return {IndexKeyRange{{}, true, values, false}, IndexKeyRange{values, false, {}, true}};
+    case PredicateCondition::LessThan:
+      return {IndexKeyRange{{}, true, values, false}};
+    case PredicateCondition::LessThanEquals:
+      return {IndexKeyRange{{}, true, values, true}};
+    case PredicateCondition::GreaterThan:
+      return {IndexKeyRange{values, false, {}, true}};
+    case PredicateCondition::GreaterThanEquals:
+      return {IndexKeyRange{values, true, {}, true}};
+    case PredicateCondition::Between:
+      Assert(values2.size() == values.size(), "Between requires an upper bound for every value");
+      return {IndexKeyRange{values, true, values2, true}};
+    default:
+      Fail("Predicate condition not supported by indexes");
+  }
+}
+
+bool IndexKeyRange::has_null_value() const {
+  const auto is_null_value = [](const auto& value) { return variant_is_null(value); };
+  return std::any_of(lower_values.cbegin(), lower_values.cend(), is_null_value) ||
+         std::any_of(upper_values.cbegin(), upper_values.cend(), is_null_value);
+}
+
+bool operator==(const IndexKeyRange& lhs, const IndexKeyRange& rhs) {
+  return lhs.lower_values == rhs.lower_values && lhs.lower_inclusive == rhs.lower_inclusive &&
+         lhs.upper_values == rhs.upper_values && lhs.upper_inclusive == rhs.upper_inclusive;
+}
+
+}  // namespace opossum
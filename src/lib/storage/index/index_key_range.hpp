@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A range of keys of a composite index (see BaseIndex and TableIndex). The bounds are values of the leading indexed
+ * columns: On an index on the columns AB, the range [(1), (1)] holds all keys with A = 1 and [(1, 5), (1, 9)) all keys
+ * with A = 1 and 5 <= B < 9. An empty bound leaves the range open on that side.
+ *
+ * Predicates that an index can answer are expressed as one or more ranges, e.g., IN lists as one range per value.
+ */
+struct IndexKeyRange {
+  // The range of all keys that are equal to @param values on the leading columns
+  static IndexKeyRange equal_to(const std::vector<AllTypeVariant>& values);
+
+  /**
+   * @return The ranges whose union holds all keys that compare to @param values as specified by
+   *         @param predicate_condition. @param values2 is the upper bound for PredicateCondition::Between.
+   *         NotEquals results in two ranges, all other conditions in one.
+   */
+  static std::vector<IndexKeyRange> from_predicate(const PredicateCondition predicate_condition,
+                                                   const std::vector<AllTypeVariant>& values,
+                                                   const std::vector<AllTypeVariant>& values2 = {});
+
+  // NULL never compares to anything, so a range with a NULL bound holds no keys
+  bool has_null_value() const;
+
+  std::vector<AllTypeVariant> lower_values;
+  bool lower_inclusive{true};
+  std::vector<AllTypeVariant> upper_values;
+  bool upper_inclusive{true};
+};
+
+bool operator==(const IndexKeyRange& lhs, const IndexKeyRange& rhs);
+
+}  // namespace opossum
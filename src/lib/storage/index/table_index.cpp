@@ -0,0 +1,172 @@
+#include "table_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/index/table_index_impl.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// A bound of an IndexKeyRange whose values have the data types of the indexed columns
+struct KeyBound {
+  std::vector<AllTypeVariant> values;
+  bool inclusive;
+};
+
+enum class CastResult { Exact, Rounded, BelowRange, AboveRange };
+
+/**
+ * Casts @param value to the ColumnDataType. Floating-point values are rounded towards the inside of the range when
+ * compared to integer columns (i.e., up for lower bounds), so that they are not truncated.
+ */
+template <typename ColumnDataType>
+std::pair<CastResult, ColumnDataType> cast_bound_value(const AllTypeVariant& value, const bool is_lower_bound) {
+  if constexpr (std::is_integral_v<ColumnDataType>) {
+    const auto value_data_type = data_type_from_all_type_variant(value);
+    if (value_data_type == DataType::Float || value_data_type == DataType::Double ||
+        (value_data_type == DataType::Long && std::is_same_v<ColumnDataType, int32_t>)) {
+      const auto double_value = type_cast<double>(value);
+      const auto rounded_value = is_lower_bound ? std::ceil(double_value) : std::floor(double_value);
+
+      // The range of ColumnDataType is [-2^digits, 2^digits), both limits are exactly representable as double
+      const auto range_limit = std::ldexp(1.0, std::numeric_limits<ColumnDataType>::digits);
+      if (rounded_value < -range_limit) return {CastResult::BelowRange, ColumnDataType{}};
+      if (rounded_value >= range_limit) return {CastResult::AboveRange, ColumnDataType{}};
+
+      if (value_data_type == DataType::Long) {
+        return {CastResult::Exact, static_cast<ColumnDataType>(get<int64_t>(value))};
+      }
+
+      const auto result = rounded_value == double_value ? CastResult::Exact : CastResult::Rounded;
+      return {result, static_cast<ColumnDataType>(rounded_value)};
+    }
+  }
+
+  return {CastResult::Exact, type_cast<ColumnDataType>(value)};
+}
+
+/**
+ * Casts the values of a bound to @param data_types. If a value is not exact in its column type, it decides the
+ * comparison with every key, so that the values after it are dropped. E.g., `(a, b) >= (1, 2.5)` on an int column b
+ * becomes `(a, b) >= (1, 3)` and `(a, b) >= (1, 1e20)` becomes `a > 1`.
+ *
+ * @return std::nullopt if no key satisfies the bound
+ */
+std::optional<KeyBound> cast_bound(const std::vector<AllTypeVariant>& values, const bool inclusive,
+                                   const bool is_lower_bound, const std::vector<DataType>& data_types) {
+  auto bound = KeyBound{{}, inclusive};
+
+  for (auto value_idx = size_t{0}; value_idx < values.size(); ++value_idx) {
+    auto result = CastResult::Exact;
+    resolve_data_type(data_types[value_idx], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto [cast_result, cast_value] = cast_bound_value<ColumnDataType>(values[value_idx], is_lower_bound);
+      result = cast_result;
+      if (result == CastResult::Exact || result == CastResult::Rounded) {
+        bound.values.emplace_back(std::move(cast_value));
+      }
+    });
+
+    if (result == CastResult::Exact) continue;
+    if (result == CastResult::Rounded) return KeyBound{std::move(bound.values), true};
+
+    // The value lies beyond all values of the column: Either all keys with the leading values pass the bound or none
+    const auto passes_all = (result == CastResult::BelowRange) == is_lower_bound;
+    if (!passes_all && value_idx == 0) return std::nullopt;
+    return KeyBound{std::move(bound.values), passes_all};
+  }
+
+  return bound;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TableIndex::TableIndex(const std::vector<ColumnID>& column_ids, const std::vector<DataType>& data_types)
+    : _column_ids(column_ids), _data_types(data_types) {
+  Assert(!_column_ids.empty(), "TableIndex requires at least one column");
+  Assert(_column_ids.size() == _data_types.size(), "Expected one data type per indexed column");
+
+  if (_column_ids.size() == 1) {
+    resolve_data_type(_data_types[0], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _impl = std::make_unique<TableIndexImpl<std::tuple<ColumnDataType>>>(_column_ids, _data_types);
+    });
+  } else if (_column_ids.size() == 2) {
+    resolve_data_type(_data_types[0], [&](auto first_type) {
+      resolve_data_type(_data_types[1], [&](auto second_type) {
+        using FirstDataType = typename decltype(first_type)::type;
+        using SecondDataType = typename decltype(second_type)::type;
+        _impl = std::make_unique<TableIndexImpl<std::tuple<FirstDataType, SecondDataType>>>(_column_ids, _data_types);
+      });
+    });
+  } else {
+    _impl = std::make_unique<TableIndexImpl<std::vector<AllTypeVariant>>>(_column_ids, _data_types);
+  }
+}
+
+TableIndex::~TableIndex() = default;
+
+const std::vector<ColumnID>& TableIndex::column_ids() const { return _column_ids; }
+
+bool TableIndex::is_index_for(const std::vector<ColumnID>& column_ids) const {
+  if (column_ids.empty() || column_ids.size() > _column_ids.size()) return false;
+  return std::equal(column_ids.cbegin(), column_ids.cend(), _column_ids.cbegin());
+}
+
+void TableIndex::insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                        const ChunkOffset end_offset) {
+  _impl->insert(chunk, chunk_id, begin_offset, end_offset);
+}
+
+void TableIndex::remove(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                        const ChunkOffset end_offset) {
+  _impl->remove(chunk, chunk_id, begin_offset, end_offset);
+}
+
+PosList TableIndex::lookup(const PredicateCondition predicate_condition, const std::vector<AllTypeVariant>& values,
+                           const std::vector<AllTypeVariant>& values2) const {
+  Assert(!values.empty() && values.size() <= _column_ids.size(), "Number of values does not match the index");
+
+  auto matches = PosList{};
+  for (const auto& key_range : IndexKeyRange::from_predicate(predicate_condition, values, values2)) {
+    const auto range_matches = lookup(key_range);
+    matches.insert(matches.end(), range_matches.cbegin(), range_matches.cend());
+  }
+  return matches;
+}
+
+PosList TableIndex::lookup(const IndexKeyRange& key_range) const {
+  Assert(key_range.lower_values.size() <= _column_ids.size() && key_range.upper_values.size() <= _column_ids.size(),
+         "Number of values does not match the index");
+
+  if (key_range.has_null_value()) return {};
+
+  const auto lower_bound = cast_bound(key_range.lower_values, key_range.lower_inclusive, true, _data_types);
+  const auto upper_bound = cast_bound(key_range.upper_values, key_range.upper_inclusive, false, _data_types);
+  if (!lower_bound || !upper_bound) return {};
+
+  auto matches = PosList{};
+  _impl->lookup(lower_bound->values, lower_bound->inclusive, upper_bound->values, upper_bound->inclusive, matches);
+  return matches;
+}
+
+size_t TableIndex::size() const { return _impl->size(); }
+
+size_t TableIndex::estimate_memory_usage() const { return sizeof(*this) + _impl->memory_consumption(); }
+
+}  // namespace opossum
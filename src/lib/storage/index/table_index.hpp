@@ -0,0 +1,90 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "index_key_range.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseTableIndexImpl;
+class Chunk;
+
+/**
+ * A TableIndex maps the values of one or more columns to the RowIDs of all rows in a Table that hold them. In contrast
+ * to the chunk indexes (see BaseIndex), a single lookup finds the matching rows in all chunks: A point lookup on a
+ * table with 10,000 chunks is one O(log n) search instead of 10,000 index probes.
+ *
+ * TableIndexes are created with Table::create_table_index() and maintained by the Table as chunks are appended and by
+ * the Insert operator as rows are added. Encoding a chunk does not change the RowIDs of its rows, so the index stays
+ * valid. Rows of rolled back inserts are removed from the index again. Like the chunk indexes, the index contains
+ * deleted rows, which are filtered out by the Validate operator.
+ *
+ * Like BaseIndex, the index is composite: The order of the columns matters and an index on the columns DAB can be used
+ * for lookups on D, DA, and DAB. Rows that have a NULL in any of the indexed columns are not indexed, as they never
+ * satisfy a predicate.
+ *
+ * The entries are held in a B-tree whose keys have the data types of the indexed columns, see TableIndexImpl.
+ * Inserting and looking up are thread-safe.
+ */
+class TableIndex : private Noncopyable {
+ public:
+  TableIndex(const std::vector<ColumnID>& column_ids, const std::vector<DataType>& data_types);
+  ~TableIndex();
+
+  const std::vector<ColumnID>& column_ids() const;
+
+  /**
+   * @return Whether @param column_ids are the leading columns of the index, see BaseIndex::is_index_for()
+   */
+  bool is_index_for(const std::vector<ColumnID>& column_ids) const;
+
+  /**
+   * Adds the rows [@param begin_offset, @param end_offset) of @param chunk, which is the chunk @param chunk_id of the
+   * indexed table
+   */
+  void insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset);
+
+  /**
+   * Removes the rows [@param begin_offset, @param end_offset) of the chunk @param chunk_id, which still has to hold the
+   * values that the rows were inserted with
+   */
+  void remove(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset);
+
+  /**
+   * Finds all rows whose indexed values compare to @param values as specified by @param predicate_condition. If fewer
+   * values than indexed columns are given, only the leading columns are compared. @param values2 is the upper bound
+   * for PredicateCondition::Between. Values that the indexed column type cannot represent are not truncated, i.e.,
+   * `int_column = 2.5` finds no rows and `int_column < 2.5` finds the rows with values up to 2.
+   *
+   * @return The RowIDs of the matching rows, ordered by the indexed values
+   */
+  PosList lookup(const PredicateCondition predicate_condition, const std::vector<AllTypeVariant>& values,
+                 const std::vector<AllTypeVariant>& values2 = {}) const;
+
+  /**
+   * Finds all rows whose indexed values lie in @param key_range. The scan stops at the first entry beyond the upper
+   * bound, so narrow ranges are found in O(log n + number of matches).
+   *
+   * @return The RowIDs of the matching rows, ordered by the indexed values
+   */
+  PosList lookup(const IndexKeyRange& key_range) const;
+
+  // Number of indexed rows
+  size_t size() const;
+
+  size_t estimate_memory_usage() const;
+
+ protected:
+  const std::vector<ColumnID> _column_ids;
+  const std::vector<DataType> _data_types;
+
+  std::unique_ptr<BaseTableIndexImpl> _impl;
+};
+
+}  // namespace opossum
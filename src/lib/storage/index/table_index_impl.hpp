@@ -0,0 +1,280 @@
+#pragma once
+
+#ifdef __clang__
+#pragma clang diagnostic ignored "-Wall"
+#include <btree_map.h>
+#pragma clang diagnostic pop
+#elif __GNUC__
+#pragma GCC system_header
+#include <btree_map.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/segment_accessor.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * The entries of a TableIndex. The base class hides the data types of the indexed columns from the TableIndex, see
+ * TableIndexImpl. Inserting and looking up are thread-safe.
+ */
+class BaseTableIndexImpl : private Noncopyable {
+ public:
+  virtual ~BaseTableIndexImpl() = default;
+
+  virtual void insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                      const ChunkOffset end_offset) = 0;
+
+  virtual void remove(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                      const ChunkOffset end_offset) = 0;
+
+  /**
+   * Appends the rows whose keys lie between the lower and the upper bound to @param matches. The values of the bounds
+   * have the data types of the indexed columns. A bound without values leaves the range open on that side.
+   */
+  virtual void lookup(const std::vector<AllTypeVariant>& lower_values, const bool lower_inclusive,
+                      const std::vector<AllTypeVariant>& upper_values, const bool upper_inclusive,
+                      PosList& matches) const = 0;
+
+  virtual size_t size() const = 0;
+
+  virtual size_t memory_consumption() const = 0;
+};
+
+/**
+ * Implementation: https://code.google.com/archive/p/cpp-btree/
+ *
+ * The keys of the B-tree hold the values of the indexed columns as @tparam Values: A std::tuple of the column data
+ * types for indexes on one or two columns. Indexes on more columns fall back to a std::vector<AllTypeVariant>, so that
+ * not every combination of three or more data types has to be instantiated.
+ */
+template <typename Values>
+class TableIndexImpl : public BaseTableIndexImpl {
+ public:
+  TableIndexImpl(const std::vector<ColumnID>& column_ids, const std::vector<DataType>& data_types)
+      : _column_ids(column_ids), _data_types(data_types) {
+    if constexpr (IS_TUPLE) {
+      Assert(_column_ids.size() == std::tuple_size_v<Values>, "Expected one tuple element per indexed column");
+    }
+  }
+
+  void insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset) override {
+    if (begin_offset >= end_offset) return;
+
+    // Build the keys before locking, so that lookups are not blocked while the values are retrieved
+    auto keys = _build_keys(chunk, begin_offset, end_offset);
+
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    for (auto row_idx = size_t{0}; row_idx < keys.size(); ++row_idx) {
+      if (!keys[row_idx]) continue;
+      _entries.insert(
+          std::make_pair(std::move(*keys[row_idx]), RowID{chunk_id, static_cast<ChunkOffset>(begin_offset + row_idx)}));
+    }
+  }
+
+  void remove(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset) override {
+    if (begin_offset >= end_offset) return;
+
+    const auto keys = _build_keys(chunk, begin_offset, end_offset);
+
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    for (auto row_idx = size_t{0}; row_idx < keys.size(); ++row_idx) {
+      if (!keys[row_idx]) continue;
+
+      const auto row_id = RowID{chunk_id, static_cast<ChunkOffset>(begin_offset + row_idx)};
+      auto [range_begin, range_end] = _entries.equal_range(*keys[row_idx]);
+      for (; range_begin != range_end; ++range_begin) {
+        if (range_begin->second == row_id) {
+          _entries.erase(range_begin);
+          break;
+        }
+      }
+    }
+  }
+
+  void lookup(const std::vector<AllTypeVariant>& lower_values, const bool lower_inclusive,
+              const std::vector<AllTypeVariant>& upper_values, const bool upper_inclusive,
+              PosList& matches) const override {
+    // A lower bound compares before all keys that start with its values if it is inclusive and after them otherwise,
+    // an upper bound vice versa. For an empty range (e.g., BETWEEN 5 AND 3), the scan stops at the first entry.
+    const auto lower_bound = static_cast<int8_t>(lower_inclusive ? -1 : 1);
+    const auto upper_bound = static_cast<int8_t>(upper_inclusive ? 1 : -1);
+    const auto lower_key = Key{_to_values(lower_values), lower_values.size(), lower_bound};
+    const auto upper_key = Key{_to_values(upper_values), upper_values.size(), upper_bound};
+    const auto key_less = KeyLess{};
+
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+
+    auto entry_iter = lower_values.empty() ? _entries.begin() : _entries.lower_bound(lower_key);
+    for (; entry_iter != _entries.end(); ++entry_iter) {
+      if (!upper_values.empty() && !key_less(entry_iter->first, upper_key)) break;
+      matches.emplace_back(entry_iter->second);
+    }
+  }
+
+  size_t size() const override {
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    return _entries.size();
+  }
+
+  size_t memory_consumption() const override {
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+
+    auto bytes = sizeof(*this) + _entries.bytes_used();
+    if constexpr (!IS_TUPLE) bytes += _entries.size() * _column_ids.size() * sizeof(AllTypeVariant);
+    return bytes;
+  }
+
+ protected:
+  static constexpr auto IS_TUPLE = !std::is_same_v<Values, std::vector<AllTypeVariant>>;
+
+  struct Key {
+    Values values;
+
+    // Number of leading values that the key is compared by. Keys of rows hold the values of all indexed columns.
+    size_t prefix_length;
+
+    // Bounds of lookups order before (-1) or after (+1) the keys of rows that start with their values, see lookup()
+    int8_t bound;
+  };
+
+  struct KeyLess {
+    bool operator()(const Key& lhs, const Key& rhs) const {
+      const auto column_count = std::min(lhs.prefix_length, rhs.prefix_length);
+      const auto comparison = _compare_values(lhs.values, rhs.values, column_count);
+      if (comparison != 0) return comparison < 0;
+
+      // Only a bound of a lookup can be shorter than the key it is compared to, the keys of rows have no bound
+      const auto lhs_bound = lhs.prefix_length == column_count ? lhs.bound : int8_t{0};
+      const auto rhs_bound = rhs.prefix_length == column_count ? rhs.bound : int8_t{0};
+      return lhs_bound < rhs_bound;
+    }
+  };
+
+  using Entries = btree::btree_multimap<Key, RowID, KeyLess>;
+
+  // @return A negative value, zero, or a positive value if the first @param column_count values of @param lhs are
+  //         less than, equal to, or greater than those of @param rhs
+  static int _compare_values(const Values& lhs, const Values& rhs, const size_t column_count) {
+    if constexpr (IS_TUPLE) {
+      return _compare_tuple_values<0>(lhs, rhs, column_count);
+    } else {
+      for (auto column_idx = size_t{0}; column_idx < column_count; ++column_idx) {
+        if (lhs[column_idx] < rhs[column_idx]) return -1;
+        if (rhs[column_idx] < lhs[column_idx]) return 1;
+      }
+      return 0;
+    }
+  }
+
+  template <size_t ColumnIdx>
+  static int _compare_tuple_values(const Values& lhs, const Values& rhs, const size_t column_count) {
+    if constexpr (ColumnIdx == std::tuple_size_v<Values>) {
+      return 0;
+    } else {
+      if (ColumnIdx == column_count) return 0;
+      if (std::get<ColumnIdx>(lhs) < std::get<ColumnIdx>(rhs)) return -1;
+      if (std::get<ColumnIdx>(rhs) < std::get<ColumnIdx>(lhs)) return 1;
+      return _compare_tuple_values<ColumnIdx + 1>(lhs, rhs, column_count);
+    }
+  }
+
+  // Calls @param functor with the index and the data type of every indexed column
+  template <typename Functor>
+  void _for_each_column(const Functor& functor) const {
+    if constexpr (IS_TUPLE) {
+      _for_each_tuple_column(functor, std::make_index_sequence<std::tuple_size_v<Values>>{});
+    } else {
+      for (auto column_idx = size_t{0}; column_idx < _column_ids.size(); ++column_idx) {
+        resolve_data_type(_data_types[column_idx], [&](auto type) { functor(column_idx, type); });
+      }
+    }
+  }
+
+  template <typename Functor, size_t... ColumnIndices>
+  void _for_each_tuple_column(const Functor& functor, std::index_sequence<ColumnIndices...>) const {
+    (functor(std::integral_constant<size_t, ColumnIndices>{},
+             hana::type_c<std::tuple_element_t<ColumnIndices, Values>>),
+     ...);
+  }
+
+  template <typename ColumnIdx, typename Value>
+  static void _set_value(Values& values, const ColumnIdx column_idx, Value&& value) {
+    if constexpr (IS_TUPLE) {
+      std::get<ColumnIdx::value>(values) = std::forward<Value>(value);
+    } else {
+      values[column_idx] = std::forward<Value>(value);
+    }
+  }
+
+  Values _empty_values() const {
+    if constexpr (IS_TUPLE) {
+      return Values{};
+    } else {
+      return Values(_column_ids.size());
+    }
+  }
+
+  // The leading values of a key from @param values, which have the data types of the columns
+  Values _to_values(const std::vector<AllTypeVariant>& values) const {
+    auto key_values = _empty_values();
+    _for_each_column([&](const auto column_idx, auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      if (column_idx < values.size()) _set_value(key_values, column_idx, type_cast<ColumnDataType>(values[column_idx]));
+    });
+    return key_values;
+  }
+
+  // Keys of the given rows, std::nullopt for rows with a NULL in any of the indexed columns
+  std::vector<std::optional<Key>> _build_keys(const Chunk& chunk, const ChunkOffset begin_offset,
+                                              const ChunkOffset end_offset) const {
+    DebugAssert(end_offset <= chunk.size(), "Rows to index are out of range");
+
+    const auto row_count = end_offset - begin_offset;
+    auto keys = std::vector<std::optional<Key>>(row_count, Key{_empty_values(), _column_ids.size(), int8_t{0}});
+
+    _for_each_column([&](const auto column_idx, auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto accessor = create_segment_accessor<ColumnDataType>(chunk.get_segment(_column_ids[column_idx]));
+      for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+        if (!keys[row_idx]) continue;
+
+        auto value = accessor->access(static_cast<ChunkOffset>(begin_offset + row_idx));
+        if (value) {
+          _set_value(keys[row_idx]->values, column_idx, std::move(*value));
+        } else {
+          keys[row_idx].reset();
+        }
+      }
+    });
+
+    return keys;
+  }
+
+  const std::vector<ColumnID> _column_ids;
+  const std::vector<DataType> _data_types;
+
+  mutable std::shared_mutex _mutex;
+  Entries _entries;
+};
+
+}  // namespace opossum
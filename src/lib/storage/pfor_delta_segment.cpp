@@ -0,0 +1,136 @@
+#include "pfor_delta_segment.hpp"
+
+#include <algorithm>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T, typename U>
+PFORDeltaSegment<T, U>::PFORDeltaSegment(pmr_vector<BlockInfo> blocks, pmr_vector<uint128_t> packed_offsets,
+                                         pmr_vector<uint8_t> exception_positions,
+                                         pmr_vector<UnsignedT> exception_values, pmr_vector<bool> null_values)
+    : BaseEncodedSegment{data_type_from_type<T>()},
+      _blocks{std::move(blocks)},
+      _packed_offsets{std::move(packed_offsets)},
+      _exception_positions{std::move(exception_positions)},
+      _exception_values{std::move(exception_values)},
+      _null_values{std::move(null_values)} {
+  DebugAssert(_exception_positions.size() == _exception_values.size(), "Expected a position for each exception");
+  DebugAssert(_blocks.size() == (_null_values.size() + block_size - 1) / block_size, "Unexpected number of blocks");
+}
+
+template <typename T, typename U>
+const pmr_vector<typename PFORDeltaSegment<T, U>::BlockInfo>& PFORDeltaSegment<T, U>::blocks() const {
+  return _blocks;
+}
+
+template <typename T, typename U>
+const pmr_vector<uint128_t>& PFORDeltaSegment<T, U>::packed_offsets() const {
+  return _packed_offsets;
+}
+
+template <typename T, typename U>
+const pmr_vector<uint8_t>& PFORDeltaSegment<T, U>::exception_positions() const {
+  return _exception_positions;
+}
+
+template <typename T, typename U>
+const pmr_vector<typename PFORDeltaSegment<T, U>::UnsignedT>& PFORDeltaSegment<T, U>::exception_values() const {
+  return _exception_values;
+}
+
+template <typename T, typename U>
+const pmr_vector<bool>& PFORDeltaSegment<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+void PFORDeltaSegment<T, U>::decode_block(const size_t block_index, DecodedBlock& values) const {
+  DebugAssert(block_index < _blocks.size(), "Block index out of range");
+  const auto& block = _blocks[block_index];
+
+  alignas(16) auto packed_offsets = std::array<uint32_t, block_size>{};
+  Packing::unpack_block(_packed_offsets.data() + block.packed_offsets_begin, packed_offsets.data(), block.bit_width);
+
+  auto offsets = std::array<UnsignedT, block_size>{};
+  std::copy(packed_offsets.cbegin(), packed_offsets.cend(), offsets.begin());
+
+  const auto exceptions_end =
+      block_index + 1 < _blocks.size() ? _blocks[block_index + 1].exceptions_begin : _exception_positions.size();
+  for (auto exception_idx = block.exceptions_begin; exception_idx < exceptions_end; ++exception_idx) {
+    offsets[_exception_positions[exception_idx]] = _exception_values[exception_idx];
+  }
+
+  // Unsigned arithmetic, as the deltas of int64_t values might overflow, which is intended
+  const auto min_delta = static_cast<UnsignedT>(block.min_delta);
+  auto value = static_cast<UnsignedT>(block.first_value);
+  values[0] = block.first_value;
+  for (auto value_idx = size_t{1}; value_idx < block_size; ++value_idx) {
+    value += min_delta + offsets[value_idx];
+    values[value_idx] = static_cast<T>(value);
+  }
+}
+
+template <typename T, typename U>
+const AllTypeVariant PFORDeltaSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value.has_value()) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T, typename U>
+const std::optional<T> PFORDeltaSegment<T, U>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (_null_values[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  auto values = DecodedBlock{};
+  decode_block(chunk_offset / block_size, values);
+  return values[chunk_offset % block_size];
+}
+
+template <typename T, typename U>
+size_t PFORDeltaSegment<T, U>::size() const {
+  return _null_values.size();
+}
+
+template <typename T, typename U>
+std::shared_ptr<BaseSegment> PFORDeltaSegment<T, U>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_blocks = pmr_vector<BlockInfo>{_blocks, alloc};
+  auto new_packed_offsets = pmr_vector<uint128_t>{_packed_offsets, alloc};
+  auto new_exception_positions = pmr_vector<uint8_t>{_exception_positions, alloc};
+  auto new_exception_values = pmr_vector<UnsignedT>{_exception_values, alloc};
+  auto new_null_values = pmr_vector<bool>{_null_values, alloc};
+
+  return std::allocate_shared<PFORDeltaSegment>(alloc, std::move(new_blocks), std::move(new_packed_offsets),
+                                                std::move(new_exception_positions), std::move(new_exception_values),
+                                                std::move(new_null_values));
+}
+
+template <typename T, typename U>
+size_t PFORDeltaSegment<T, U>::estimate_memory_usage() const {
+  static const auto bits_per_byte = 8u;
+
+  return sizeof(*this) + _blocks.size() * sizeof(BlockInfo) + _packed_offsets.size() * sizeof(uint128_t) +
+         _exception_positions.size() * sizeof(uint8_t) + _exception_values.size() * sizeof(UnsignedT) +
+         _null_values.size() / bits_per_byte;
+}
+
+template <typename T, typename U>
+EncodingType PFORDeltaSegment<T, U>::encoding_type() const {
+  return EncodingType::PFORDelta;
+}
+
+template class PFORDeltaSegment<int32_t>;
+template class PFORDeltaSegment<int64_t>;
+
+}  // namespace opossum
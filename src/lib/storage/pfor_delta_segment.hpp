@@ -0,0 +1,118 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+#include <array>
+#include <memory>
+
+#include "base_encoded_segment.hpp"
+#include "storage/vector_compression/simd_bp128/oversized_types.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Segment implementing delta encoding with patched frame-of-reference (PFOR-Delta)
+ *
+ * Meant for sorted or slowly growing integer columns such as keys and timestamps, whose values are spread too widely
+ * for FrameOfReferenceSegment, but whose differences are small.
+ *
+ * The values are divided into blocks of 128 values. Each block stores its first value as a checkpoint and the
+ * differences (deltas) between consecutive values as offsets from the block's smallest delta. The offsets are
+ * bit-packed with SimdBp128Packing, using the bit width that minimizes the block's size. Offsets that do not fit
+ * into that bit width (e.g., a single jump in an otherwise monotonic column) are stored separately as exceptions
+ * and patched into the block after unpacking.
+ *
+ * Values are accessed by decoding the whole block, which only depends on the block's checkpoint. The blocks' minima
+ * and maxima let scans skip blocks without decoding them.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(
+                          enum_c<EncodingType, EncodingType::PFORDelta>, hana::type_c<T>)>>
+class PFORDeltaSegment : public BaseEncodedSegment {
+ public:
+  using Packing = SimdBp128Packing;
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  static constexpr auto block_size = Packing::block_size;
+
+  using DecodedBlock = std::array<T, block_size>;
+
+  struct BlockInfo {
+    // The first value of the block, from which the following values are decoded
+    T first_value;
+
+    // Smallest and largest non-NULL value of the block (minimum > maximum if the block only contains NULLs)
+    T minimum;
+    T maximum;
+
+    // The offset of each delta is stored relative to the smallest delta of the block
+    T min_delta;
+
+    // Position of the block's offsets in packed_offsets and of its first exception
+    uint32_t packed_offsets_begin;
+    uint32_t exceptions_begin;
+
+    // Number of bits per packed offset, which equals the number of 128-bit words the block occupies
+    uint8_t bit_width;
+  };
+
+  /**
+   * @param exception_positions are the positions of the exceptions within their blocks
+   * @param exception_values are the offsets of the exceptions (the packed offsets at these positions are zero)
+   */
+  explicit PFORDeltaSegment(pmr_vector<BlockInfo> blocks, pmr_vector<uint128_t> packed_offsets,
+                            pmr_vector<uint8_t> exception_positions, pmr_vector<UnsignedT> exception_values,
+                            pmr_vector<bool> null_values);
+
+  const pmr_vector<BlockInfo>& blocks() const;
+  const pmr_vector<uint128_t>& packed_offsets() const;
+  const pmr_vector<uint8_t>& exception_positions() const;
+  const pmr_vector<UnsignedT>& exception_values() const;
+  const pmr_vector<bool>& null_values() const;
+
+  /**
+   * Decodes all values of a block into @param values. The values at NULL positions and behind the end of the
+   * segment are unspecified.
+   */
+  void decode_block(const size_t block_index, DecodedBlock& values) const;
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+
+  /**@}*/
+
+ private:
+  const pmr_vector<BlockInfo> _blocks;
+  const pmr_vector<uint128_t> _packed_offsets;
+  const pmr_vector<uint8_t> _exception_positions;
+  const pmr_vector<UnsignedT> _exception_values;
+  const pmr_vector<bool> _null_values;
+};
+
+}  // namespace opossum
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+
+#include "storage/base_segment_encoder.hpp"
+
+#include "storage/pfor_delta_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class PFORDeltaEncoder : public SegmentEncoder<PFORDeltaEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::PFORDelta>;
+  static constexpr auto _uses_vector_compression = false;  // see base_segment_encoder.hpp for details
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
+    using Segment = PFORDeltaSegment<T>;
+
+    const auto alloc = value_segment->values().get_allocator();
+    const auto size = value_segment->size();
+
+    auto output = BlockOutput<T>{pmr_vector<typename Segment::BlockInfo>{alloc}, pmr_vector<uint128_t>{alloc},
+                                 pmr_vector<uint8_t>{alloc}, pmr_vector<typename Segment::UnsignedT>{alloc}};
+    output.blocks.reserve((size + Segment::block_size - 1) / Segment::block_size);
+
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    auto iterable = ValueSegmentIterable<T>{*value_segment};
+    iterable.with_iterators([&](auto segment_it, auto segment_end) {
+      auto values = std::array<T, Segment::block_size>{};
+      auto block_null_values = std::array<bool, Segment::block_size>{};
+
+      while (segment_it != segment_end) {
+        auto value_count = size_t{0};
+        for (; value_count < Segment::block_size && segment_it != segment_end; ++value_count, ++segment_it) {
+          const auto segment_value = *segment_it;
+          values[value_count] = segment_value.is_null() ? T{0} : segment_value.value();
+          block_null_values[value_count] = segment_value.is_null();
+          null_values.push_back(segment_value.is_null());
+        }
+
+        _encode_block(values, block_null_values, value_count, output);
+      }
+    });
+
+    return std::allocate_shared<Segment>(alloc, std::move(output.blocks), std::move(output.packed_offsets),
+                                         std::move(output.exception_positions), std::move(output.exception_values),
+                                         std::move(null_values));
+  }
+
+ private:
+  template <typename T>
+  struct BlockOutput {
+    pmr_vector<typename PFORDeltaSegment<T>::BlockInfo> blocks;
+    pmr_vector<uint128_t> packed_offsets;
+    pmr_vector<uint8_t> exception_positions;
+    pmr_vector<typename PFORDeltaSegment<T>::UnsignedT> exception_values;
+  };
+
+  template <typename T>
+  static void _encode_block(std::array<T, PFORDeltaSegment<T>::block_size>& values,
+                            const std::array<bool, PFORDeltaSegment<T>::block_size>& null_values,
+                            const size_t value_count, BlockOutput<T>& output) {
+    using Segment = PFORDeltaSegment<T>;
+    using UnsignedT = typename Segment::UnsignedT;
+    static constexpr auto block_size = Segment::block_size;
+    static constexpr auto max_bit_width = uint8_t{32};
+    static constexpr auto value_bit_width = std::numeric_limits<UnsignedT>::digits;
+
+    auto block = typename Segment::BlockInfo{};
+    block.minimum = std::numeric_limits<T>::max();
+    block.maximum = std::numeric_limits<T>::lowest();
+
+    // NULLs take the previous value (or the first non-NULL value) so that they do not add deltas
+    const auto first_non_null_it = std::find(null_values.cbegin(), null_values.cbegin() + value_count, false);
+    auto previous_value = first_non_null_it != null_values.cbegin() + value_count
+                              ? values[std::distance(null_values.cbegin(), first_non_null_it)]
+                              : T{0};
+    for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+      if (null_values[value_idx]) {
+        values[value_idx] = previous_value;
+        continue;
+      }
+
+      previous_value = values[value_idx];
+      block.minimum = std::min(block.minimum, previous_value);
+      block.maximum = std::max(block.maximum, previous_value);
+    }
+    block.first_value = values[0];
+
+    // Deltas are calculated using unsigned arithmetic, as they might overflow for int64_t values
+    const auto delta = [&](const size_t value_idx) {
+      return static_cast<T>(static_cast<UnsignedT>(values[value_idx]) - static_cast<UnsignedT>(values[value_idx - 1]));
+    };
+
+    block.min_delta = T{0};
+    if (value_count > 1) {
+      block.min_delta = delta(1);
+      for (auto value_idx = size_t{2}; value_idx < value_count; ++value_idx) {
+        block.min_delta = std::min(block.min_delta, delta(value_idx));
+      }
+    }
+
+    // The first offset and the offsets behind the last value are zero
+    auto offsets = std::array<UnsignedT, block_size>{};
+    auto bit_width_counts = std::array<size_t, value_bit_width + 1>{};
+    for (auto value_idx = size_t{1}; value_idx < value_count; ++value_idx) {
+      offsets[value_idx] = static_cast<UnsignedT>(delta(value_idx)) - static_cast<UnsignedT>(block.min_delta);
+
+      auto bit_width = size_t{0};
+      while (bit_width < value_bit_width && (offsets[value_idx] >> bit_width) != 0) ++bit_width;
+      ++bit_width_counts[bit_width];
+    }
+
+    // Choose the bit width that minimizes the size of the packed offsets and the exceptions (position and value)
+    static constexpr auto exception_bit_width = 8u + value_bit_width;
+    auto exception_count = value_count - 1;
+    auto best_size = std::numeric_limits<size_t>::max();
+    for (auto bit_width = uint8_t{0}; bit_width <= max_bit_width; ++bit_width) {
+      exception_count -= bit_width_counts[bit_width];
+      const auto size = size_t{bit_width} * block_size + exception_count * exception_bit_width;
+      if (size < best_size) {
+        best_size = size;
+        block.bit_width = bit_width;
+      }
+    }
+
+    alignas(16) auto packed_offsets = std::array<uint32_t, block_size>{};
+    block.exceptions_begin = static_cast<uint32_t>(output.exception_positions.size());
+    for (auto value_idx = size_t{1}; value_idx < value_count; ++value_idx) {
+      const auto offset = offsets[value_idx];
+      if (block.bit_width < value_bit_width && (offset >> block.bit_width) != 0) {
+        output.exception_positions.push_back(static_cast<uint8_t>(value_idx));
+        output.exception_values.push_back(offset);
+      } else {
+        packed_offsets[value_idx] = static_cast<uint32_t>(offset);
+      }
+    }
+
+    Assert(output.packed_offsets.size() + block.bit_width <= std::numeric_limits<uint32_t>::max(),
+           "Packed offsets must fit into uint32_t.");
+    block.packed_offsets_begin = static_cast<uint32_t>(output.packed_offsets.size());
+    output.packed_offsets.resize(output.packed_offsets.size() + block.bit_width);
+    Segment::Packing::pack_block(packed_offsets.data(), output.packed_offsets.data() + block.packed_offsets_begin,
+                                 block.bit_width);
+
+    output.blocks.push_back(block);
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+
+#include "storage/segment_iterables.hpp"
+
+#include "storage/pfor_delta_segment.hpp"
+
+namespace opossum {
+
+/**
+ * Iterates over the values of a PFORDeltaSegment. Both iterators decode one block at a time. The point access
+ * iterator only decodes a block again if the next position lies in a different block.
+ */
+template <typename T>
+class PFORDeltaIterable : public PointAccessibleSegmentIterable<PFORDeltaIterable<T>> {
+ public:
+  using DecodedBlock = typename PFORDeltaSegment<T>::DecodedBlock;
+
+  static constexpr auto block_size = PFORDeltaSegment<T>::block_size;
+
+  explicit PFORDeltaIterable(const PFORDeltaSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    auto begin = Iterator{&_segment, ChunkOffset{0}};
+    auto end = Iterator{&_segment, static_cast<ChunkOffset>(_segment.size())};
+    functor(begin, end);
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const PosList& position_filter, const Functor& functor) const {
+    auto begin = PointAccessIterator{&_segment, position_filter.cbegin(), position_filter.cbegin()};
+    auto end = PointAccessIterator{position_filter.cbegin(), position_filter.cend()};
+    functor(begin, end);
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const PFORDeltaSegment<T>& _segment;
+
+ private:
+  class Iterator : public BaseSegmentIterator<Iterator, SegmentIteratorValue<T>> {
+   public:
+    explicit Iterator(const PFORDeltaSegment<T>* segment, const ChunkOffset chunk_offset)
+        : _segment{segment}, _chunk_offset{chunk_offset}, _decoded_block{std::make_unique<DecodedBlock>()} {
+      if (_chunk_offset < _segment->size()) _segment->decode_block(_chunk_offset / block_size, *_decoded_block);
+    }
+
+    Iterator(const Iterator& other)
+        : _segment{other._segment},
+          _chunk_offset{other._chunk_offset},
+          _decoded_block{std::make_unique<DecodedBlock>(*other._decoded_block)} {}
+
+    Iterator(Iterator&& other) = default;
+    ~Iterator() = default;
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_chunk_offset;
+
+      if (_chunk_offset % block_size == 0 && _chunk_offset < _segment->size()) {
+        _segment->decode_block(_chunk_offset / block_size, *_decoded_block);
+      }
+    }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    SegmentIteratorValue<T> dereference() const {
+      const auto is_null = _segment->null_values()[_chunk_offset];
+      return SegmentIteratorValue<T>{(*_decoded_block)[_chunk_offset % block_size], is_null, _chunk_offset};
+    }
+
+   private:
+    const PFORDeltaSegment<T>* _segment;
+    ChunkOffset _chunk_offset;
+    std::unique_ptr<DecodedBlock> _decoded_block;
+  };
+
+  class PointAccessIterator : public BasePointAccessSegmentIterator<PointAccessIterator, SegmentIteratorValue<T>> {
+   public:
+    // Begin Iterator
+    PointAccessIterator(const PFORDeltaSegment<T>* segment, const PosList::const_iterator position_filter_begin,
+                        PosList::const_iterator position_filter_it)
+        : BasePointAccessSegmentIterator<PointAccessIterator, SegmentIteratorValue<T>>{std::move(position_filter_begin),
+                                                                                       std::move(position_filter_it)},
+          _segment{segment},
+          _decoded_block{std::make_unique<DecodedBlock>()} {}
+
+    // End Iterator
+    explicit PointAccessIterator(const PosList::const_iterator position_filter_begin,
+                                 PosList::const_iterator position_filter_it)
+        : PointAccessIterator{nullptr, std::move(position_filter_begin), std::move(position_filter_it)} {}
+
+    PointAccessIterator(const PointAccessIterator& other)
+        : BasePointAccessSegmentIterator<PointAccessIterator, SegmentIteratorValue<T>>{other},
+          _segment{other._segment},
+          _decoded_block_index{other._decoded_block_index},
+          _decoded_block{std::make_unique<DecodedBlock>(*other._decoded_block)} {}
+
+    PointAccessIterator(PointAccessIterator&& other) = default;
+    ~PointAccessIterator() = default;
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentIteratorValue<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+
+      if (_segment->null_values()[chunk_offsets.offset_in_referenced_chunk]) {
+        return SegmentIteratorValue<T>{T{}, true, chunk_offsets.offset_in_poslist};
+      }
+
+      const auto block_index = chunk_offsets.offset_in_referenced_chunk / block_size;
+      if (block_index != _decoded_block_index) {
+        _segment->decode_block(block_index, *_decoded_block);
+        _decoded_block_index = block_index;
+      }
+
+      const auto value = (*_decoded_block)[chunk_offsets.offset_in_referenced_chunk % block_size];
+      return SegmentIteratorValue<T>{value, false, chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const PFORDeltaSegment<T>* _segment;
+    mutable size_t _decoded_block_index{INVALID_BLOCK_INDEX};
+    std::unique_ptr<DecodedBlock> _decoded_block;
+
+    static constexpr auto INVALID_BLOCK_INDEX = std::numeric_limits<size_t>::max();
+  };
+};
+
+}  // namespace opossum
@@ -8,9 +8,13 @@
 #include <memory>
 
 // Include your encoded segment file here!
+#include "storage/alp_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/front_coded_dictionary_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/pfor_delta_segment.hpp"
 #include "storage/run_length_segment.hpp"
 
 #include "storage/encoding_type.hpp"
@@ -32,7 +36,11 @@ constexpr auto encoded_segment_for_type = hana::make_map(
     hana::make_pair(enum_c<EncodingType, EncodingType::RunLength>, template_c<RunLengthSegment>),
     hana::make_pair(enum_c<EncodingType, EncodingType::FixedStringDictionary>,
                     template_c<FixedStringDictionarySegment>),
-    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, template_c<FrameOfReferenceSegment>));
+    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, template_c<FrameOfReferenceSegment>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::FrontCodedDictionary>, template_c<FrontCodedDictionarySegment>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::FSST>, template_c<FSSTSegment>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::PFORDelta>, template_c<PFORDeltaSegment>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::ALP>, template_c<ALPSegment>));
 
 /**
  * @brief Resolves the type of an encoded segment.
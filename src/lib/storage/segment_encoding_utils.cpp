@@ -3,8 +3,11 @@
 #include <map>
 #include <memory>
 
+#include "storage/alp_segment/alp_encoder.hpp"
 #include "storage/dictionary_segment/dictionary_encoder.hpp"
 #include "storage/frame_of_reference/frame_of_reference_encoder.hpp"
+#include "storage/fsst_segment/fsst_encoder.hpp"
+#include "storage/pfor_delta_segment/pfor_delta_encoder.hpp"
 #include "storage/run_length_segment/run_length_encoder.hpp"
 
 #include "storage/base_value_segment.hpp"
@@ -24,7 +27,11 @@ const auto encoder_for_type = std::map<EncodingType, std::shared_ptr<BaseSegment
     {EncodingType::Dictionary, std::make_shared<DictionaryEncoder<EncodingType::Dictionary>>()},
     {EncodingType::RunLength, std::make_shared<RunLengthEncoder>()},
     {EncodingType::FixedStringDictionary, std::make_shared<DictionaryEncoder<EncodingType::FixedStringDictionary>>()},
-    {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()}};
+    {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()},
+    {EncodingType::FrontCodedDictionary, std::make_shared<DictionaryEncoder<EncodingType::FrontCodedDictionary>>()},
+    {EncodingType::FSST, std::make_shared<FSSTEncoder>()},
+    {EncodingType::PFORDelta, std::make_shared<PFORDeltaEncoder>()},
+    {EncodingType::ALP, std::make_shared<ALPEncoder>()}};
 
 }  // namespace
 
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -16,7 +17,8 @@ class Table;
 class AbstractLQPNode;
 
 // The StorageManager is a singleton that maintains all tables
-// by mapping table names to table instances.
+// by mapping table names to table instances. Tables and views can be added and dropped
+// while other threads (e.g., background managers) access them.
 class StorageManager : public Singleton<StorageManager> {
  public:
   // adds a table to the storage manager
@@ -34,8 +36,8 @@ class StorageManager : public Singleton<StorageManager> {
   // returns a list of all table names
   std::vector<std::string> table_names() const;
 
-  // returns a map from table name to table
-  const std::map<std::string, std::shared_ptr<Table>>& tables() const;
+  // returns a map from table name to table, the tables that are dropped concurrently remain valid in it
+  std::map<std::string, std::shared_ptr<Table>> tables() const;
 
   // adds a view to the storage manager
   void add_lqp_view(const std::string& name, const std::shared_ptr<LQPView>& view);
@@ -72,9 +74,9 @@ class StorageManager : public Singleton<StorageManager> {
   friend class Singleton;
 
   const StorageManager& operator=(const StorageManager&) = delete;
-  StorageManager& operator=(StorageManager&&) = default;
 
   std::map<std::string, std::shared_ptr<Table>> _tables;
   std::map<std::string, std::shared_ptr<LQPView>> _views;
+  mutable std::shared_mutex _mutex;
 };
 }  // namespace opossum
@@ -9,6 +9,10 @@
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/delta_index.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/unique_constraint_checker.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
@@ -25,7 +29,11 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
       _type(type),
       _use_mvcc(use_mvcc),
       _max_chunk_size(max_chunk_size),
-      _append_mutex(std::make_unique<std::mutex>()) {
+      _append_mutex(std::make_unique<std::mutex>()),
+      _insert_mutex(std::make_unique<std::shared_mutex>()),
+      _compression_mutex(std::make_unique<std::mutex>()),
+      _column_scan_counts(column_definitions.size(), 0u),
+      _table_indexes(std::make_shared<std::vector<std::shared_ptr<TableIndex>>>()) {
   Assert(max_chunk_size > 0, "Table must have a chunk size greater than 0.");
 }
 
@@ -91,6 +99,12 @@ void Table::append(const std::vector<AllTypeVariant>& values) {
   }
 
   _chunks.back()->append(values);
+
+  const auto chunk_id = static_cast<ChunkID>(_chunks.size() - 1);
+  const auto chunk_offset = static_cast<ChunkOffset>(_chunks.back()->size() - 1);
+  for (const auto& table_index : table_indexes()) {
+    table_index->insert(*_chunks.back(), chunk_id, chunk_offset, chunk_offset + 1);
+  }
 }
 
 void Table::append_mutable_chunk() {
@@ -102,6 +116,10 @@ void Table::append_mutable_chunk() {
     });
   }
   append_chunk(segments);
+
+  for (const auto& index_info : _indexes) {
+    _chunks.back()->create_delta_index(index_info.column_ids, index_info.type);
+  }
 }
 
 uint64_t Table::row_count() const {
@@ -165,7 +183,7 @@ void Table::append_chunk(const Segments& segments, const std::optional<Polymorph
     mvcc_data = std::make_shared<MvccData>(chunk_size);
   }
 
-  _chunks.emplace_back(std::make_shared<Chunk>(segments, mvcc_data, alloc, access_counter));
+  append_chunk(std::make_shared<Chunk>(segments, mvcc_data, alloc, access_counter));
 }
 
 void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
@@ -187,11 +205,138 @@ void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
               "Chunk does not have the same MVCC setting as the table.");
 
   _chunks.emplace_back(chunk);
+
+  const auto chunk_id = static_cast<ChunkID>(_chunks.size() - 1);
+  for (const auto& table_index : table_indexes()) {
+    table_index->insert(*chunk, chunk_id, ChunkOffset{0}, chunk->size());
+  }
 }
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
-std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
+std::shared_lock<std::shared_mutex> Table::acquire_insert_mutex() {
+  return std::shared_lock<std::shared_mutex>(*_insert_mutex);
+}
+
+std::unique_lock<std::mutex> Table::acquire_compression_mutex() {
+  return std::unique_lock<std::mutex>(*_compression_mutex);
+}
+
+void Table::increment_column_scan_count(const ColumnID column_id) const { ++_column_scan_counts.at(column_id); }
+
+uint64_t Table::column_scan_count(const ColumnID column_id) const { return _column_scan_counts.at(column_id); }
+
+std::vector<IndexInfo> Table::get_indexes() const {
+  std::lock_guard<std::mutex> lock(*_append_mutex);
+  return _indexes;
+}
+
+void Table::remove_index(const std::string& name) {
+  Assert(!name.empty(), "Only named indexes can be removed");
+
+  // Once the index is unregistered, appended chunks no longer get a DeltaIndex for it
+  auto index_info = IndexInfo{};
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  {
+    const auto append_lock = acquire_append_mutex();
+    const auto index_info_it = std::find_if(_indexes.cbegin(), _indexes.cend(),
+                                            [&](const auto& index_info) { return index_info.name == name; });
+    Assert(index_info_it != _indexes.cend(), "No index with this name");
+    index_info = *index_info_it;
+    _indexes.erase(index_info_it);
+    chunks = _chunks;
+  }
+  const auto& column_ids = index_info.column_ids;
+
+  for (const auto& chunk : chunks) {
+    // Indexes on more columns that start with column_ids are found as well, but not removed
+    for (const auto& index : chunk->get_indices(column_ids)) {
+      if (index->type() == index_info.type && index->get_indexed_segments().size() == column_ids.size()) {
+        chunk->remove_index(index);
+        break;
+      }
+    }
+
+    for (const auto& delta_index : chunk->delta_indexes()) {
+      if (delta_index->merge_type() == index_info.type && delta_index->column_ids() == column_ids) {
+        chunk->remove_delta_index(delta_index);
+        break;
+      }
+    }
+  }
+}
+
+std::shared_ptr<TableIndex> Table::create_table_index(const std::vector<ColumnID>& column_ids) {
+  Assert(_type == TableType::Data, "TableIndexes can only be created on data tables");
+
+  auto data_types = std::vector<DataType>{};
+  for (const auto column_id : column_ids) {
+    Assert(column_id < column_count(), "Invalid ColumnID for TableIndex");
+    data_types.emplace_back(column_data_type(column_id));
+  }
+
+  const auto table_index = std::make_shared<TableIndex>(column_ids, data_types);
+
+  // Concurrent lookups keep reading the previous list, see table_indexes(). Rows of running inserts are not indexed
+  // before they are written, see create_index().
+  const auto insert_lock = std::unique_lock<std::shared_mutex>{*_insert_mutex};
+  const auto append_lock = acquire_append_mutex();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    const auto& chunk = _chunks[chunk_id];
+    table_index->insert(*chunk, chunk_id, ChunkOffset{0}, chunk->size());
+  }
+
+  auto table_indexes = std::make_shared<std::vector<std::shared_ptr<TableIndex>>>(*std::atomic_load(&_table_indexes));
+  table_indexes->emplace_back(table_index);
+  std::atomic_store(&_table_indexes, std::shared_ptr<const std::vector<std::shared_ptr<TableIndex>>>(table_indexes));
+  return table_index;
+}
+
+std::vector<std::shared_ptr<TableIndex>> Table::table_indexes() const { return *std::atomic_load(&_table_indexes); }
+
+std::shared_ptr<TableIndex> Table::get_table_index(const std::vector<ColumnID>& column_ids) const {
+  for (const auto& table_index : *std::atomic_load(&_table_indexes)) {
+    if (table_index->is_index_for(column_ids)) return table_index;
+  }
+  return nullptr;
+}
+
+void Table::add_unique_constraint(const std::vector<ColumnID>& column_ids, const IsPrimaryKey is_primary_key) {
+  Assert(_type == TableType::Data, "Constraints can only be added to data tables");
+  Assert(!column_ids.empty(), "Constraint needs at least one column");
+
+  for (const auto column_id : column_ids) {
+    Assert(column_id < column_count(), "Invalid ColumnID for constraint");
+    Assert(std::count(column_ids.cbegin(), column_ids.cend(), column_id) == 1, "Column used twice in constraint");
+    Assert(is_primary_key == IsPrimaryKey::No || !column_is_nullable(column_id),
+           "Columns of a PRIMARY KEY must not be nullable");
+  }
+
+  for (const auto& constraint_definition : _constraint_definitions) {
+    Assert(is_primary_key == IsPrimaryKey::No || constraint_definition.is_primary_key == IsPrimaryKey::No,
+           "Table already has a PRIMARY KEY");
+    Assert(constraint_definition.column_ids != column_ids, "Constraint on these columns already exists");
+  }
+
+  if (!get_table_index(column_ids)) create_table_index(column_ids);
+
+  _constraint_definitions.emplace_back(column_ids, is_primary_key);
+
+  auto row_ids = PosList{};
+  row_ids.reserve(row_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _chunks[chunk_id]->size(); ++chunk_offset) {
+      row_ids.emplace_back(chunk_id, chunk_offset);
+    }
+  }
+
+  if (find_violated_unique_constraint(*this, row_ids, TransactionID{0})) {
+    _constraint_definitions.pop_back();
+    Fail("Rows in the table violate the constraint");
+  }
+}
+
+const TableConstraintDefinitions& Table::get_unique_constraints() const { return _constraint_definitions; }
 
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
@@ -204,6 +349,10 @@ size_t Table::estimate_memory_usage() const {
     bytes += column_definition.name.size();
   }
 
+  for (const auto& table_index : table_indexes()) {
+    bytes += table_index->estimate_memory_usage();
+  }
+
   // TODO(anybody) Statistics and Indices missing from Memory Usage Estimation
   // TODO(anybody) TableLayout missing
 
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -9,15 +10,19 @@
 #include "base_segment.hpp"
 #include "chunk.hpp"
 #include "proxy_chunk.hpp"
+#include "scheduler/job_batch.hpp"
 #include "storage/index/index_info.hpp"
 #include "storage/table_column_definition.hpp"
+#include "storage/table_constraint_definition.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/copyable_atomic.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
 
+class TableIndex;
 class TableStatistics;
 
 /**
@@ -101,7 +106,7 @@ class Table : private Noncopyable {
    */
   void append_chunk(const std::shared_ptr<Chunk>& chunk);
 
-  // Create and append a Chunk consisting of ValueSegments.
+  // Create and append a Chunk consisting of ValueSegments. It gets a DeltaIndex for each of the table's indexes.
   void append_mutable_chunk();
 
   /** @} */
@@ -140,6 +145,25 @@ class Table : private Noncopyable {
 
   std::unique_lock<std::mutex> acquire_append_mutex();
 
+  /**
+   * Held (shared) by the Insert operator from allocating its rows until they are written and added to the indexes.
+   * Creating an index holds it exclusively, so that it does not see rows that are allocated but not yet written.
+   */
+  std::shared_lock<std::shared_mutex> acquire_insert_mutex();
+
+  /**
+   * Held by the ChunkCompressionManager and the TableClusteringTask while they choose and compress chunks of the
+   * table, so that they do not compress the same chunks and the clustering sees a stable set of immutable chunks
+   */
+  std::unique_lock<std::mutex> acquire_compression_mutex();
+
+  /**
+   * Number of executed TableScans that restricted the column to a value or a range of values (see TableScan). Scans on
+   * references count for the referenced table. Used by the TableClusteringManager, the counts only grow.
+   */
+  void increment_column_scan_count(const ColumnID column_id) const;
+  uint64_t column_scan_count(const ColumnID column_id) const;
+
   void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) { _table_statistics = table_statistics; }
 
   std::shared_ptr<TableStatistics> table_statistics() { return _table_statistics; }
@@ -151,13 +175,66 @@ class Table : private Noncopyable {
   void create_index(const std::vector<ColumnID>& column_ids, const std::string& name = "") {
     SegmentIndexType index_type = get_index_type_of<Index>();
 
-    for (auto& chunk : _chunks) {
-      chunk->create_index<Index>(column_ids);
+    // Chunks that are appended once the index is registered get a DeltaIndex (see append_mutable_chunk()), the ones
+    // that exist at that point are indexed here. The mutable chunks are indexed once running inserts have written
+    // their rows and before new ones start, later rows are added to the DeltaIndexes by the Insert operator.
+    auto immutable_chunks = std::vector<std::shared_ptr<Chunk>>{};
+    {
+      const auto insert_lock = std::unique_lock<std::shared_mutex>{*_insert_mutex};
+      const auto append_lock = acquire_append_mutex();
+      IndexInfo i = {column_ids, name, index_type};
+      _indexes.emplace_back(i);
+
+      for (const auto& chunk : _chunks) {
+        if (chunk->is_mutable()) {
+          // Regular indexes need encoded segments, see Chunk::create_delta_index()
+          chunk->create_delta_index(column_ids, index_type);
+        } else {
+          immutable_chunks.emplace_back(chunk);
+        }
+      }
     }
-    IndexInfo i = {column_ids, name, index_type};
-    _indexes.emplace_back(i);
+
+    // The index of a chunk is independent of the other chunks, so the chunks are indexed in parallel
+    const auto index_chunk = [&](const size_t chunk_idx) {
+      immutable_chunks[chunk_idx]->create_index<Index>(column_ids);
+    };
+    JobBatch{immutable_chunks.size(), index_chunk}.schedule_and_wait();
   }
 
+  /**
+   * Removes the chunk indexes created by create_index() with the name @param name, including the DeltaIndexes of
+   * mutable chunks. Operators that were translated to scan the index before must not be executed afterwards.
+   */
+  void remove_index(const std::string& name);
+
+  /**
+   * Creates a TableIndex on @param column_ids over all rows of the table. The index is kept up to date as chunks and
+   * rows are appended to the table and as the Insert operator adds rows. Lookups may run concurrently, but Inserts
+   * into the table must not be in progress, as their rows could be missed.
+   */
+  std::shared_ptr<TableIndex> create_table_index(const std::vector<ColumnID>& column_ids);
+
+  // The TableIndexes at the time of the call. Indexes created concurrently are not included.
+  std::vector<std::shared_ptr<TableIndex>> table_indexes() const;
+
+  /**
+   * @return The first TableIndex that can be used for lookups on @param column_ids (see TableIndex::is_index_for()),
+   *         nullptr if there is none
+   */
+  std::shared_ptr<TableIndex> get_table_index(const std::vector<ColumnID>& column_ids) const;
+
+  /**
+   * Adds a PRIMARY KEY or UNIQUE constraint on @param column_ids. It is backed by a TableIndex on the columns, which
+   * is created if the table has none yet. The Insert operator checks the constraint when its transaction commits (see
+   * find_violated_unique_constraint()) and the optimizer uses it to detect redundant operations. The rows already in
+   * the table have to satisfy the constraint. A table has at most one PRIMARY KEY, whose columns must not be nullable.
+   */
+  void add_unique_constraint(const std::vector<ColumnID>& column_ids,
+                             const IsPrimaryKey is_primary_key = IsPrimaryKey::No);
+
+  const TableConstraintDefinitions& get_unique_constraints() const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
@@ -171,6 +248,13 @@ class Table : private Noncopyable {
   std::vector<std::shared_ptr<Chunk>> _chunks;
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
+  std::unique_ptr<std::shared_mutex> _insert_mutex;
+  std::unique_ptr<std::mutex> _compression_mutex;
+  mutable std::vector<copyable_atomic<uint64_t>> _column_scan_counts;
   std::vector<IndexInfo> _indexes;
+
+  // Replaced as a whole when an index is created, so that it can be read without locking. Use std::atomic_load/store.
+  std::shared_ptr<const std::vector<std::shared_ptr<TableIndex>>> _table_indexes;
+  TableConstraintDefinitions _constraint_definitions;
 };
 }  // namespace opossum
@@ -0,0 +1,211 @@
+#include "table_clustering_manager.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_manager.hpp"
+#include "resolve_type.hpp"
+#include "sql/sql_query_cache.hpp"
+#include "sql/sql_query_plan.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "tasks/table_clustering_task.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// Columns whose weight decayed below this value are forgotten
+constexpr float MIN_WORKLOAD_COLUMN_WEIGHT = 0.01f;
+
+}  // namespace
+
+namespace opossum {
+
+TableClusteringManager::TableClusteringManager() : TableClusteringManager(Options{}) {}
+
+TableClusteringManager::TableClusteringManager(const Options& options) : _options(options) {
+  Assert(_options.max_clustering_column_count > 0, "Need at least one clustering column");
+  _loop_thread = std::make_unique<PausableLoopThread>(_options.interval, [this](size_t) { run(); });
+}
+
+std::map<std::string, std::vector<ColumnID>> TableClusteringManager::run() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  _update_workload();
+
+  auto& storage_manager = StorageManager::get();
+
+  // Tables that were dropped are forgotten
+  for (auto clustered_table_iter = _clustered_tables.begin(); clustered_table_iter != _clustered_tables.end();) {
+    clustered_table_iter = storage_manager.has_table(clustered_table_iter->first)
+                               ? std::next(clustered_table_iter)
+                               : _clustered_tables.erase(clustered_table_iter);
+  }
+  for (auto scan_counts_iter = _column_scan_counts.begin(); scan_counts_iter != _column_scan_counts.end();) {
+    scan_counts_iter = storage_manager.has_table(scan_counts_iter->first) ? std::next(scan_counts_iter)
+                                                                          : _column_scan_counts.erase(scan_counts_iter);
+  }
+
+  auto clustered_columns = std::map<std::string, std::vector<ColumnID>>{};
+  for (const auto& workload_entry : _workload) {
+    const auto& table_name = workload_entry.first;
+    if (!storage_manager.has_table(table_name)) continue;
+
+    const auto table = storage_manager.get_table(table_name);
+    if (table->type() != TableType::Data || table->has_mvcc() != UseMvcc::Yes) continue;
+
+    const auto column_ids = _choose_clustering_columns(table_name);
+    if (column_ids.empty()) continue;
+
+    // If the clustering columns did not change, only the chunks appended since the last clustering are clustered, so
+    // that the chunks clustered before are not copied again in every run
+    const auto clustered_table_iter = _clustered_tables.find(table_name);
+    const auto is_clustered_by_columns =
+        clustered_table_iter != _clustered_tables.end() && clustered_table_iter->second.column_ids == column_ids;
+    const auto first_unclustered_chunk_id =
+        is_clustered_by_columns ? clustered_table_iter->second.chunk_count : ChunkID{0};
+    if (_count_live_immutable_chunks(*table, first_unclustered_chunk_id) < _options.min_unclustered_chunk_count) {
+      continue;
+    }
+
+    const auto task = std::make_shared<TableClusteringTask>(table_name, column_ids, _options.segment_encoding_spec,
+                                                            first_unclustered_chunk_id);
+    task->execute();
+
+    // A concurrent transaction modified the table, the next run tries again
+    if (!task->committed()) continue;
+
+    _clustered_tables[table_name] = ClusteredTable{column_ids, table->chunk_count()};
+    clustered_columns.emplace(table_name, column_ids);
+  }
+
+  for (const auto& clustered_table_entry : _clustered_tables) {
+    _reclaim_chunks(*storage_manager.get_table(clustered_table_entry.first));
+  }
+
+  // Cached plans were pruned with the statistics of the previous chunks
+  if (!clustered_columns.empty()) SQLQueryCache<SQLQueryPlan>::get().clear();
+
+  return clustered_columns;
+}
+
+void TableClusteringManager::resume() { _loop_thread->resume(); }
+
+void TableClusteringManager::pause() { _loop_thread->pause(); }
+
+std::map<std::string, std::vector<ColumnID>> TableClusteringManager::clustering_columns() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto clustering_columns = std::map<std::string, std::vector<ColumnID>>{};
+  for (const auto& clustered_table_entry : _clustered_tables) {
+    clustering_columns.emplace(clustered_table_entry.first, clustered_table_entry.second.column_ids);
+  }
+  return clustering_columns;
+}
+
+void TableClusteringManager::_update_workload() {
+  for (auto table_iter = _workload.begin(); table_iter != _workload.end();) {
+    auto& column_weights = table_iter->second;
+    for (auto column_iter = column_weights.begin(); column_iter != column_weights.end();) {
+      column_iter->second *= _options.workload_decay;
+      column_iter = column_iter->second < MIN_WORKLOAD_COLUMN_WEIGHT ? column_weights.erase(column_iter)
+                                                                     : std::next(column_iter);
+    }
+    table_iter = column_weights.empty() ? _workload.erase(table_iter) : std::next(table_iter);
+  }
+
+  // The scans executed since the last run add to the weights. The tables are taken from a snapshot of the
+  // StorageManager, so that tables can be added and dropped concurrently.
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    if (table->type() != TableType::Data) continue;
+
+    // The counts of a table that replaced a dropped one with the same name may be lower than the ones seen before
+    auto& previous_counts = _column_scan_counts[table_name];
+    previous_counts.resize(table->column_count(), 0u);
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      const auto count = table->column_scan_count(column_id);
+      const auto executed_scan_count = count >= previous_counts[column_id] ? count - previous_counts[column_id] : count;
+      previous_counts[column_id] = count;
+
+      if (executed_scan_count > 0) _workload[table_name][column_id] += static_cast<float>(executed_scan_count);
+    }
+  }
+}
+
+std::vector<ColumnID> TableClusteringManager::_choose_clustering_columns(const std::string& table_name) const {
+  auto weighted_columns = std::vector<std::pair<float, ColumnID>>{};
+  for (const auto& column_entry : _workload.at(table_name)) {
+    weighted_columns.emplace_back(column_entry.second, column_entry.first);
+  }
+
+  // By descending weight, ties by column id
+  std::sort(weighted_columns.begin(), weighted_columns.end(), [](const auto& left, const auto& right) {
+    return left.first > right.first || (left.first == right.first && left.second < right.second);
+  });
+
+  auto column_ids = std::vector<ColumnID>{};
+  for (const auto& weighted_column : weighted_columns) {
+    if (column_ids.size() == _options.max_clustering_column_count) break;
+    if (weighted_column.first < weighted_columns.front().first * _options.min_clustering_column_weight_share) break;
+    column_ids.emplace_back(weighted_column.second);
+  }
+  return column_ids;
+}
+
+size_t TableClusteringManager::_count_live_immutable_chunks(Table& table, const ChunkID first_chunk_id) {
+  // Inserts append chunks while holding the append mutex, so the chunks can be listed safely
+  const auto append_lock = table.acquire_append_mutex();
+
+  auto chunk_count = size_t{0};
+  for (auto chunk_id = first_chunk_id; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk->is_mutable() && !chunk->cleanup_commit_id()) ++chunk_count;
+  }
+  return chunk_count;
+}
+
+void TableClusteringManager::_reclaim_chunks(Table& table) {
+  // Rows deleted up to this commit id are not visible to any current or future transaction
+  const auto snapshot_commit_id = TransactionManager::get().lowest_active_snapshot_commit_id();
+
+  // Indexes are not created on the chunks while they are reclaimed, see IndexAdvisor
+  const auto compression_lock = table.acquire_compression_mutex();
+
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  {
+    const auto append_lock = table.acquire_append_mutex();
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      chunks.emplace_back(table.get_chunk(chunk_id));
+    }
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunks.size(); ++chunk_id) {
+    const auto& chunk = chunks[chunk_id];
+    const auto cleanup_commit_id = chunk->cleanup_commit_id();
+    if (!cleanup_commit_id || *cleanup_commit_id > snapshot_commit_id || chunk->size() == 0) continue;
+
+    // The table indexes need the values of the rows to remove them
+    for (const auto& table_index : table.table_indexes()) {
+      table_index->remove(*chunk, chunk_id, ChunkOffset{0}, chunk->size());
+    }
+
+    auto empty_segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        empty_segments.push_back(std::make_shared<ValueSegment<ColumnDataType>>(table.column_is_nullable(column_id)));
+      });
+    }
+    chunk->reclaim(empty_segments);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * The TableClusteringManager clusters the stored tables by the columns that their scans filter on most, so that the
+ * ChunkPruningRule can skip most chunks for range and equality predicates on these columns. Every run
+ *
+ *  1. adds the TableScans executed on the stored tables since the last run to the weights of the columns. Each
+ *     executed comparison of a column with a value or a parameter (=, <, <=, >, >=, BETWEEN) counts (see
+ *     Table::column_scan_count()). The weights of earlier runs decay.
+ *  2. chooses the clustering columns of each table: The column with the highest weight and, up to the maximum column
+ *     count, the columns whose weight is close to it. Tables with multiple clustering columns are Z-ordered.
+ *  3. clusters a table by a TableClusteringTask if the clustering columns changed or if enough immutable chunks were
+ *     appended since the last clustering, e.g., by the ChunkCompressionManager. If the columns changed, all immutable
+ *     chunks of the table are re-inserted. Otherwise, only the appended chunks are, so that the memory of the table
+ *     grows by one copy of the appended rows instead of a copy of the whole table per clustering.
+ *
+ * Tables without MVCC are not clustered, as their rows cannot be moved while they are read. After tables were
+ * clustered, the plan cache is cleared so that the chunks are pruned with the new statistics. The chunks that the rows
+ * were moved out of are freed in the first run in which no active transaction can see them anymore.
+ *
+ * The manager is created in a paused state, see resume().
+ */
+class TableClusteringManager : private Noncopyable {
+ public:
+  struct Options {
+    // Time between two runs in the background, see resume()
+    std::chrono::milliseconds interval = std::chrono::seconds(60);
+
+    // Factor by which the weights of the columns seen in earlier runs are reduced in every run
+    float workload_decay = 0.5f;
+
+    // Maximum number of columns a table is clustered by
+    size_t max_clustering_column_count = 2;
+
+    // Minimum weight of further clustering columns relative to the weight of the first one
+    float min_clustering_column_weight_share = 0.5f;
+
+    // Minimum number of unclustered immutable chunks for a table to be clustered
+    size_t min_unclustered_chunk_count = 4;
+
+    // Encoding of the clustered chunks, see TableClusteringTask
+    std::optional<SegmentEncodingSpec> segment_encoding_spec = SegmentEncodingSpec{};
+  };
+
+  TableClusteringManager();
+  explicit TableClusteringManager(const Options& options);
+
+  /**
+   * Evaluates the current workload and clusters the tables accordingly
+   * @return The clustering columns of the tables clustered in this run
+   */
+  std::map<std::string, std::vector<ColumnID>> run();
+
+  // Starts (or continues) running the manager periodically in a background thread
+  void resume();
+  void pause();
+
+  // The columns that the tables were clustered by most recently
+  std::map<std::string, std::vector<ColumnID>> clustering_columns() const;
+
+ protected:
+  struct ClusteredTable {
+    std::vector<ColumnID> column_ids;
+
+    // Number of chunks of the table after the clustering. Later chunks are not clustered.
+    ChunkID chunk_count;
+  };
+
+  void _update_workload();
+  std::vector<ColumnID> _choose_clustering_columns(const std::string& table_name) const;
+
+  // The number of immutable chunks from @param first_chunk_id on whose rows may still be visible
+  static size_t _count_live_immutable_chunks(Table& table, const ChunkID first_chunk_id);
+
+  // Frees the chunks of @param table whose rows are not visible to any transaction anymore, see Chunk::reclaim()
+  static void _reclaim_chunks(Table& table);
+
+  const Options _options;
+
+  // The weights of the filtered columns per table name
+  std::map<std::string, std::map<ColumnID, float>> _workload;
+
+  // The column scan counts of the tables in the previous run, see Table::column_scan_count()
+  std::map<std::string, std::vector<uint64_t>> _column_scan_counts;
+  std::map<std::string, ClusteredTable> _clustered_tables;
+  mutable std::mutex _mutex;
+
+  // Declared last, so that the thread is stopped before the other members are destroyed
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
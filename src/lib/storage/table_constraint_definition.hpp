@@ -0,0 +1,26 @@
+#pragma once
+
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A PRIMARY KEY or UNIQUE constraint on one or more columns of a Table, see Table::add_unique_constraint(). As in SQL,
+ * rows with a NULL in any of the columns do not violate a UNIQUE constraint, and the columns of a PRIMARY KEY are not
+ * nullable.
+ */
+struct TableConstraintDefinition final {
+  TableConstraintDefinition() = default;
+  TableConstraintDefinition(const std::vector<ColumnID>& column_ids, const IsPrimaryKey is_primary_key);
+
+  bool operator==(const TableConstraintDefinition& rhs) const;
+
+  std::vector<ColumnID> column_ids;
+  IsPrimaryKey is_primary_key{IsPrimaryKey::No};
+};
+
+using TableConstraintDefinitions = std::vector<TableConstraintDefinition>;
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#include "unique_constraint_checker.hpp"
+
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+bool row_conflicts(const Table& table, const RowID& row_id, const TransactionID transaction_id) {
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  if (!chunk->has_mvcc_data()) return true;
+
+  const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+  const auto row_tid = mvcc_data->tids[row_id.chunk_offset].load();
+  const auto begin_cid = mvcc_data->begin_cids[row_id.chunk_offset];
+  const auto end_cid = mvcc_data->end_cids[row_id.chunk_offset];
+
+  // Deleted by a committed transaction or inserted by a transaction that was rolled back (see Insert)
+  if (end_cid != MvccData::MAX_COMMIT_ID) return false;
+
+  // Committed row that this transaction is deleting. Unlocked rows have the transaction id 0.
+  if (begin_cid != MvccData::MAX_COMMIT_ID && row_tid != 0u && row_tid == transaction_id) return false;
+
+  return true;
+}
+
+}  // namespace
+
+std::optional<TableConstraintDefinition> find_violated_unique_constraint(const Table& table, const PosList& row_ids,
+                                                                         const TransactionID transaction_id) {
+  for (const auto& constraint : table.get_unique_constraints()) {
+    const auto table_index = table.get_table_index(constraint.column_ids);
+    Assert(table_index, "Unique constraints need a TableIndex");
+
+    auto values = std::vector<AllTypeVariant>(constraint.column_ids.size());
+    for (const auto& row_id : row_ids) {
+      const auto chunk = table.get_chunk(row_id.chunk_id);
+
+      auto has_null = false;
+      for (auto value_idx = size_t{0}; value_idx < values.size(); ++value_idx) {
+        values[value_idx] = (*chunk->get_segment(constraint.column_ids[value_idx]))[row_id.chunk_offset];
+        has_null |= variant_is_null(values[value_idx]);
+      }
+      if (has_null) continue;
+
+      for (const auto& matching_row_id : table_index->lookup(PredicateCondition::Equals, values)) {
+        if (matching_row_id == row_id) continue;
+        if (row_conflicts(table, matching_row_id, transaction_id)) return constraint;
+      }
+    }
+  }
+
+  return std::nullopt;
+}
+
+}  // namespace opossum
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "storage/pos_list.hpp"
+#include "storage/table_constraint_definition.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Checks whether the rows @param row_ids of @param table violate one of the table's unique constraints. The rows are
+ * looked up in the TableIndex that backs each constraint. Another row with the same values conflicts unless
+ *  - it has been deleted by a committed transaction or was inserted by a transaction that was rolled back, or
+ *  - it is being deleted by the transaction @param transaction_id itself (e.g., as part of an UPDATE). Pass 0 if the
+ *    rows are not checked on behalf of a transaction.
+ *
+ * In particular, rows of transactions that have not committed yet conflict. This is conservative: Of two transactions
+ * that insert the same key concurrently, at least one fails, even if the other one is rolled back later.
+ *
+ * @return The first violated constraint, std::nullopt if there is none
+ */
+std::optional<TableConstraintDefinition> find_violated_unique_constraint(const Table& table, const PosList& row_ids,
+                                                                         const TransactionID transaction_id);
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#include "bit_packed_compressor.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include "bit_packed_vector.hpp"
+
+namespace opossum {
+
+std::unique_ptr<const BaseCompressedVector> BitPackedCompressor::compress(const pmr_vector<uint32_t>& vector,
+                                                                          const PolymorphicAllocator<size_t>& alloc,
+                                                                          const UncompressedVectorInfo& meta_info) {
+  using Packing = SimdBp128Packing;
+
+  auto max_value = uint32_t{0u};
+  if (meta_info.max_value) {
+    max_value = *meta_info.max_value;
+  } else if (!vector.empty()) {
+    max_value = *std::max_element(vector.cbegin(), vector.cend());
+  }
+
+  auto bit_width = uint8_t{0u};
+  for (auto remaining_bits = max_value; remaining_bits != 0u; remaining_bits >>= 1u) {
+    ++bit_width;
+  }
+
+  // Each block occupies bit_width 128-bit words. The decompressor also reads the word after the one in which a value
+  // begins, so the data is padded by one word. With a bit width of zero, all values begin in the first word.
+  const auto block_count = (vector.size() + Packing::block_size - 1u) / Packing::block_size;
+  auto data = pmr_vector<uint128_t>(std::max(block_count * bit_width, size_t{1u}) + 1u, alloc);
+
+  alignas(16) auto block = std::array<uint32_t, Packing::block_size>{};
+  for (auto block_index = size_t{0u}; block_index < block_count; ++block_index) {
+    const auto block_begin = vector.cbegin() + block_index * Packing::block_size;
+    const auto block_end = vector.cbegin() + std::min((block_index + 1u) * Packing::block_size, vector.size());
+
+    // Fill remaining elements of the last block with zero
+    std::fill(std::copy(block_begin, block_end, block.begin()), block.end(), 0u);
+    Packing::pack_block(block.data(), data.data() + block_index * bit_width, bit_width);
+  }
+
+  return std::make_unique<BitPackedVector>(std::move(data), vector.size(), bit_width);
+}
+
+std::unique_ptr<BaseVectorCompressor> BitPackedCompressor::create_new() const {
+  return std::make_unique<BitPackedCompressor>();
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "storage/vector_compression/simd_bp128/oversized_types.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Implements constant-time point access into a BitPackedVector
+ *
+ * Within a block, SimdBp128Packing distributes the values round-robin over the four 32-bit lanes of the 128-bit
+ * words. Each lane is a continuous bit stream, in which a value may span two consecutive words.
+ */
+class BitPackedDecompressor : public BaseVectorDecompressor {
+ public:
+  using Packing = SimdBp128Packing;
+
+  static constexpr auto lane_count = 4u;
+  static constexpr auto bits_in_lane_word = 32u;
+
+ public:
+  explicit BitPackedDecompressor(const pmr_vector<uint128_t>& data, size_t size, uint8_t bit_width)
+      : _data{&data}, _size{size}, _bit_width{bit_width}, _mask{(uint64_t{1} << bit_width) - 1u} {}
+
+  uint32_t get(size_t i) final {
+    const auto block_index = i / Packing::block_size;
+    const auto index_in_block = i % Packing::block_size;
+    const auto lane = index_in_block % lane_count;
+    const auto bit_offset = (index_in_block / lane_count) * _bit_width;
+
+    const auto word = _data->data() + block_index * _bit_width + bit_offset / bits_in_lane_word;
+
+    // The padding word at the end of the data guarantees that the second word exists
+    const auto lane_bits = (uint64_t{word[1].data[lane]} << bits_in_lane_word) | word[0].data[lane];
+    return static_cast<uint32_t>((lane_bits >> (bit_offset % bits_in_lane_word)) & _mask);
+  }
+
+  size_t size() const final { return _size; }
+
+ private:
+  const pmr_vector<uint128_t>* _data;
+  const size_t _size;
+  const uint8_t _bit_width;
+  const uint64_t _mask;
+};
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#include "bit_packed_iterator.hpp"
+
+namespace opossum {
+
+BitPackedIterator::BitPackedIterator(const pmr_vector<uint128_t>* data, size_t size, uint8_t bit_width,
+                                     size_t absolute_index)
+    : _data{data},
+      _size{size},
+      _bit_width{bit_width},
+      _absolute_index{absolute_index},
+      _current_block{std::make_unique<std::array<uint32_t, Packing::block_size>>()},
+      _current_block_index{absolute_index % Packing::block_size} {
+  if (_data && _absolute_index < _size) {
+    _unpack_block(_absolute_index / Packing::block_size);
+    _current_block_index = _absolute_index % Packing::block_size;
+  }
+}
+
+BitPackedIterator::BitPackedIterator(const BitPackedIterator& other)
+    : _data{other._data},
+      _size{other._size},
+      _bit_width{other._bit_width},
+      _absolute_index{other._absolute_index},
+      _current_block{std::make_unique<std::array<uint32_t, Packing::block_size>>(*other._current_block)},
+      _current_block_index{other._current_block_index} {}
+
+void BitPackedIterator::_unpack_block(size_t block_index) {
+  const auto in = _data->data() + block_index * _bit_width;
+  Packing::unpack_block(in, _current_block->data(), _bit_width);
+
+  _current_block_index = 0u;
+}
+
+}  // namespace opossum
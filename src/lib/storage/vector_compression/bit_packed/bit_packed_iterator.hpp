@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/simd_bp128/oversized_types.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Sequentially decodes a BitPackedVector by unpacking one block of 128 values at a time
+ */
+class BitPackedIterator : public BaseCompressedVectorIterator<BitPackedIterator> {
+ public:
+  using Packing = SimdBp128Packing;
+
+ public:
+  BitPackedIterator(const pmr_vector<uint128_t>* data, size_t size, uint8_t bit_width, size_t absolute_index = 0u);
+  BitPackedIterator(const BitPackedIterator& other);
+
+  BitPackedIterator(BitPackedIterator&& other) = default;
+  ~BitPackedIterator() = default;
+
+ private:
+  friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+  void increment() {
+    ++_absolute_index;
+    ++_current_block_index;
+
+    if (_current_block_index >= Packing::block_size && _absolute_index < _size) {
+      _unpack_block(_absolute_index / Packing::block_size);
+    }
+  }
+
+  bool equal(const BitPackedIterator& other) const { return _absolute_index == other._absolute_index; }
+
+  uint32_t dereference() const { return (*_current_block)[_current_block_index]; }
+
+ private:
+  void _unpack_block(size_t block_index);
+
+ private:
+  const pmr_vector<uint128_t>* _data;
+  const size_t _size;
+  const uint8_t _bit_width;
+
+  size_t _absolute_index;
+
+  const std::unique_ptr<std::array<uint32_t, Packing::block_size>> _current_block;
+  size_t _current_block_index;
+};
+
+}  // namespace opossum
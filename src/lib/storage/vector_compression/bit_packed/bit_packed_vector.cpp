@@ -0,0 +1,33 @@
+#include "bit_packed_vector.hpp"
+
+namespace opossum {
+
+BitPackedVector::BitPackedVector(pmr_vector<uint128_t> data, size_t size, uint8_t bit_width)
+    : _data{std::move(data)}, _size{size}, _bit_width{bit_width} {}
+
+const pmr_vector<uint128_t>& BitPackedVector::data() const { return _data; }
+
+uint8_t BitPackedVector::bit_width() const { return _bit_width; }
+
+size_t BitPackedVector::on_size() const { return _size; }
+size_t BitPackedVector::on_data_size() const { return sizeof(uint128_t) * _data.size(); }
+
+std::unique_ptr<BaseVectorDecompressor> BitPackedVector::on_create_base_decompressor() const {
+  return std::unique_ptr<BaseVectorDecompressor>{on_create_decompressor()};
+}
+
+std::unique_ptr<BitPackedDecompressor> BitPackedVector::on_create_decompressor() const {
+  return std::make_unique<BitPackedDecompressor>(_data, _size, _bit_width);
+}
+
+BitPackedIterator BitPackedVector::on_begin() const { return BitPackedIterator{&_data, _size, _bit_width, 0u}; }
+
+BitPackedIterator BitPackedVector::on_end() const { return BitPackedIterator{nullptr, _size, _bit_width, _size}; }
+
+std::unique_ptr<const BaseCompressedVector> BitPackedVector::on_copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  auto data_copy = pmr_vector<uint128_t>{_data, alloc};
+  return std::make_unique<BitPackedVector>(std::move(data_copy), _size, _bit_width);
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/simd_bp128/oversized_types.hpp"
+
+#include "bit_packed_decompressor.hpp"
+#include "bit_packed_iterator.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Bit-packed vector with one bit width for all values
+ *
+ * Values are packed in blocks of 128 integers using the layout of SimdBp128Packing, so that the iterator can unpack
+ * whole blocks with SIMD instructions. Unlike in SimdBp128Vector, all blocks have the same bit width and hence the
+ * same size. This allows the decompressor to locate any value in constant time. The data is followed by a padding
+ * word, so that the decompressor can always read two consecutive words of a lane.
+ *
+ * Bit widths other than 8, 16, and 32 save memory compared to FixedSizeByteAlignedVector, e.g.,
+ * 11 bits for an attribute vector that references 2000 distinct values.
+ */
+class BitPackedVector : public CompressedVector<BitPackedVector> {
+ public:
+  explicit BitPackedVector(pmr_vector<uint128_t> data, size_t size, uint8_t bit_width);
+  ~BitPackedVector() = default;
+
+  const pmr_vector<uint128_t>& data() const;
+  uint8_t bit_width() const;
+
+  size_t on_size() const;
+  size_t on_data_size() const;
+
+  std::unique_ptr<BaseVectorDecompressor> on_create_base_decompressor() const;
+  std::unique_ptr<BitPackedDecompressor> on_create_decompressor() const;
+
+  BitPackedIterator on_begin() const;
+  BitPackedIterator on_end() const;
+
+  std::unique_ptr<const BaseCompressedVector> on_copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const;
+
+ private:
+  const pmr_vector<uint128_t> _data;
+  const size_t _size;
+  const uint8_t _bit_width;
+};
+
+}  // namespace opossum
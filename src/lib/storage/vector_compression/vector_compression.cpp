@@ -5,6 +5,7 @@
 
 #include "utils/assert.hpp"
 
+#include "bit_packed/bit_packed_compressor.hpp"
 #include "fixed_size_byte_aligned/fixed_size_byte_aligned_compressor.hpp"
 #include "simd_bp128/simd_bp128_compressor.hpp"
 
@@ -19,7 +20,8 @@ namespace {
  */
 const auto vector_compressor_for_type = std::map<VectorCompressionType, std::shared_ptr<BaseVectorCompressor>>{
     {VectorCompressionType::FixedSizeByteAligned, std::make_shared<FixedSizeByteAlignedCompressor>()},
-    {VectorCompressionType::SimdBp128, std::make_shared<SimdBp128Compressor>()}};
+    {VectorCompressionType::SimdBp128, std::make_shared<SimdBp128Compressor>()},
+    {VectorCompressionType::BitPacked, std::make_shared<BitPackedCompressor>()}};
 
 std::unique_ptr<BaseVectorCompressor> create_compressor_by_type(VectorCompressionType type) {
   Assert(type != VectorCompressionType::Invalid, "VectorCompressionType must be valid.");
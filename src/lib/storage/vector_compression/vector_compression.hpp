@@ -16,7 +16,7 @@ namespace opossum {
  * Also known as null suppression and
  * zero suppression in the literature.
  */
-enum class VectorCompressionType : uint8_t { Invalid, FixedSizeByteAligned, SimdBp128 };
+enum class VectorCompressionType : uint8_t { Invalid, FixedSizeByteAligned, SimdBp128, BitPacked };
 
 /**
  * @brief Meta information about an uncompressed vector
@@ -1,10 +1,12 @@
 #include "chunk_compression_task.hpp"
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/encoding_advisor.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 
@@ -16,33 +18,50 @@ namespace opossum {
 ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id)
     : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}} {}
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
-    : _table_name{table_name}, _chunk_ids{chunk_ids} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           const SegmentEncodingSpec& segment_encoding_spec)
+    : _table_name{table_name}, _chunk_ids{chunk_ids}, _segment_encoding_spec{segment_encoding_spec} {}
+
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           const std::shared_ptr<const EncodingAdvisor>& encoding_advisor)
+    : _table_name{table_name}, _chunk_ids{chunk_ids}, _encoding_advisor{encoding_advisor} {
+  Assert(_encoding_advisor, "EncodingAdvisor must not be null");
+}
 
 void ChunkCompressionTask::_on_execute() {
   auto table = StorageManager::get().get_table(_table_name);
 
   Assert(table != nullptr, "Table does not exist.");
 
+  // Neither the ChunkCompressionManager nor a TableClusteringTask compresses chunks of the table at the same time
+  const auto compression_lock = table->acquire_compression_mutex();
+
   for (auto chunk_id : _chunk_ids) {
     Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
 
     auto chunk = table->get_chunk(chunk_id);
 
-    DebugAssert(_chunk_is_completed(chunk, table->max_chunk_size()),
+    DebugAssert(chunk_is_completed(chunk, table->max_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
-    ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    if (_encoding_advisor) {
+      ChunkEncoder::encode_chunks(table, {chunk_id}, *_encoding_advisor);
+    } else {
+      ChunkEncoder::encode_chunks(table, {chunk_id}, _segment_encoding_spec);
+    }
   }
 }
 
-bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size) {
+bool ChunkCompressionTask::chunk_is_completed(const std::shared_ptr<const Chunk>& chunk,
+                                              const uint32_t max_chunk_size) {
   if (chunk->size() != max_chunk_size) return false;
 
-  auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+  if (chunk->has_mvcc_data()) {
+    auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
 
-  for (const auto begin_cid : mvcc_data->begin_cids) {
-    if (begin_cid == MvccData::MAX_COMMIT_ID) return false;
+    for (const auto begin_cid : mvcc_data->begin_cids) {
+      if (begin_cid == MvccData::MAX_COMMIT_ID) return false;
+    }
   }
 
   return true;
@@ -1,23 +1,27 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
 class Chunk;
+class EncodingAdvisor;
 
 /**
- * @brief Compresses a chunk of a table using the default encoding
+ * @brief Compresses a chunk of a table using the default encoding, a given encoding, or the encodings chosen by an
+ *        EncodingAdvisor
  *
  * The task compresses a chunk by sequentially compressing segments.
- * From each value segment, a dictionary segment is created that replaces the
+ * From each value segment, an encoded segment is created that replaces the
  * uncompressed segment. The exchange is done atomically. Since this can
  * happen during simultaneous access by transactions, operators need to be
  * designed such that they are aware that segment types might change from
- * ValueSegment<T> to DictionarySegment<T> during execution. Shared pointers
+ * ValueSegment<T> to an encoded segment during execution. Shared pointers
  * ensure that existing value segments remain valid.
  *
  * Exchanging segments does not interfere with the Delete operator because
@@ -29,25 +33,34 @@ class Chunk;
  *
  * Note: Reference segments are not invalidated by this task because the order in which
  *       records are stored does not change.
+ *
+ * The ChunkEncoder merges the delta indexes of the chunk (see Chunk::create_delta_index()) into regular
+ * indexes on the encoded segments.
  */
 class ChunkCompressionTask : public AbstractTask {
  public:
   explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
-  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
+  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                const SegmentEncodingSpec& segment_encoding_spec = {});
+  ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                       const std::shared_ptr<const EncodingAdvisor>& encoding_advisor);
 
- protected:
-  void _on_execute() override;
-
- private:
   /**
    * @brief Checks if a chunks is completed
    *
    * See class comment for further explanation
    */
-  bool _chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size);
+  static bool chunk_is_completed(const std::shared_ptr<const Chunk>& chunk, const uint32_t max_chunk_size);
+
+ protected:
+  void _on_execute() override;
 
  private:
   const std::string _table_name;
   const std::vector<ChunkID> _chunk_ids;
+  const SegmentEncodingSpec _segment_encoding_spec;
+
+  // If set, the encodings are chosen per segment instead of using _segment_encoding_spec
+  const std::shared_ptr<const EncodingAdvisor> _encoding_advisor;
 };
 }  // namespace opossum
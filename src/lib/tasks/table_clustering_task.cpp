@@ -0,0 +1,303 @@
+#include "table_clustering_task.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "tasks/chunk_compression_task.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+std::vector<std::optional<T>> materialize_values(const Table& table, const ColumnID column_id,
+                                                 const std::vector<RowID>& row_ids) {
+  auto accessors = std::vector<std::unique_ptr<BaseSegmentAccessor<T>>>(table.chunk_count());
+
+  auto values = std::vector<std::optional<T>>{};
+  values.reserve(row_ids.size());
+  for (const auto& row_id : row_ids) {
+    auto& accessor = accessors[row_id.chunk_id];
+    if (!accessor) accessor = create_segment_accessor<T>(table.get_chunk(row_id.chunk_id)->get_segment(column_id));
+    values.emplace_back(accessor->access(row_id.chunk_offset));
+  }
+  return values;
+}
+
+// The rank of each value among the distinct values, starting with 1. NULLs have the rank 0.
+template <typename T>
+std::vector<uint64_t> rank_values(const std::vector<std::optional<T>>& values) {
+  auto distinct_values = std::vector<T>{};
+  distinct_values.reserve(values.size());
+  for (const auto& value : values) {
+    if (value) distinct_values.emplace_back(*value);
+  }
+  std::sort(distinct_values.begin(), distinct_values.end());
+  distinct_values.erase(std::unique(distinct_values.begin(), distinct_values.end()), distinct_values.end());
+
+  auto ranks = std::vector<uint64_t>{};
+  ranks.reserve(values.size());
+  for (const auto& value : values) {
+    if (!value) {
+      ranks.emplace_back(0u);
+      continue;
+    }
+    const auto value_iter = std::lower_bound(distinct_values.cbegin(), distinct_values.cend(), *value);
+    ranks.emplace_back(std::distance(distinct_values.cbegin(), value_iter) + 1);
+  }
+  return ranks;
+}
+
+/**
+ * @return The positions of @param row_ids in the order of their Z-order values: The ranks of the values of each column
+ *         are scaled to an equal number of bits, which are interleaved starting with the most significant bit. For a
+ *         single column, this is the order of its values.
+ */
+std::vector<size_t> cluster_row_ids(const Table& table, const std::vector<ColumnID>& column_ids,
+                                    const std::vector<RowID>& row_ids) {
+  const auto bits_per_column = static_cast<uint32_t>(std::numeric_limits<uint64_t>::digits / column_ids.size());
+  const auto max_rank = bits_per_column == std::numeric_limits<uint64_t>::digits
+                            ? std::numeric_limits<uint64_t>::max()
+                            : (uint64_t{1} << bits_per_column) - 1u;
+
+  auto ranks_by_column = std::vector<std::vector<uint64_t>>{};
+  for (const auto column_id : column_ids) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      ranks_by_column.emplace_back(rank_values(materialize_values<ColumnDataType>(table, column_id, row_ids)));
+    });
+
+    auto& ranks = ranks_by_column.back();
+    const auto highest_rank = ranks.empty() ? uint64_t{0} : *std::max_element(ranks.cbegin(), ranks.cend());
+    auto shift = uint32_t{0};
+    while ((highest_rank >> shift) > max_rank) ++shift;
+    for (auto& rank : ranks) {
+      rank >>= shift;
+    }
+  }
+
+  auto z_values = std::vector<uint64_t>(row_ids.size(), 0u);
+  for (auto row_idx = size_t{0}; row_idx < row_ids.size(); ++row_idx) {
+    auto& z_value = z_values[row_idx];
+    for (auto bit = bits_per_column; bit-- > 0;) {
+      for (const auto& ranks : ranks_by_column) {
+        z_value = (z_value << 1u) | ((ranks[row_idx] >> bit) & 1u);
+      }
+    }
+  }
+
+  auto positions = std::vector<size_t>(row_ids.size());
+  std::iota(positions.begin(), positions.end(), size_t{0});
+  std::stable_sort(positions.begin(), positions.end(),
+                   [&](const auto left, const auto right) { return z_values[left] < z_values[right]; });
+  return positions;
+}
+
+// Materializes the rows @param row_ids of @param table into ValueSegments of chunks with the table's maximum size
+std::shared_ptr<Table> materialize_rows(const Table& table, const std::vector<RowID>& row_ids) {
+  const auto chunk_size = static_cast<size_t>(table.max_chunk_size());
+  const auto chunk_count = (row_ids.size() + chunk_size - 1) / chunk_size;
+  auto segments_by_chunk = std::vector<Segments>(chunk_count);
+
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto values = materialize_values<ColumnDataType>(table, column_id, row_ids);
+      for (auto chunk_idx = size_t{0}; chunk_idx < chunk_count; ++chunk_idx) {
+        const auto begin = values.cbegin() + chunk_idx * chunk_size;
+        const auto end = values.cbegin() + std::min((chunk_idx + 1) * chunk_size, values.size());
+
+        auto segment_values = std::vector<ColumnDataType>{};
+        auto segment_null_values = std::vector<bool>{};
+        segment_values.reserve(std::distance(begin, end));
+        segment_null_values.reserve(std::distance(begin, end));
+        for (auto value_iter = begin; value_iter != end; ++value_iter) {
+          segment_values.emplace_back(value_iter->value_or(ColumnDataType{}));
+          segment_null_values.emplace_back(!value_iter->has_value());
+        }
+
+        if (table.column_is_nullable(column_id)) {
+          segments_by_chunk[chunk_idx].push_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(segment_values, segment_null_values));
+        } else {
+          segments_by_chunk[chunk_idx].push_back(std::make_shared<ValueSegment<ColumnDataType>>(segment_values));
+        }
+      }
+    });
+  }
+
+  auto materialized_table =
+      std::make_shared<Table>(table.column_definitions(), TableType::Data, table.max_chunk_size());
+  for (const auto& segments : segments_by_chunk) {
+    materialized_table->append_chunk(segments);
+  }
+  return materialized_table;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TableClusteringTask::TableClusteringTask(const std::string& table_name, const std::vector<ColumnID>& column_ids,
+                                         const std::optional<SegmentEncodingSpec>& segment_encoding_spec,
+                                         const ChunkID first_chunk_id)
+    : _table_name{table_name},
+      _column_ids{column_ids},
+      _segment_encoding_spec{segment_encoding_spec},
+      _first_chunk_id{first_chunk_id} {
+  Assert(!_column_ids.empty(), "Need at least one column to cluster by");
+  Assert(_column_ids.size() <= std::numeric_limits<uint64_t>::digits, "Too many columns to cluster by");
+}
+
+bool TableClusteringTask::committed() const { return _committed; }
+
+void TableClusteringTask::_on_execute() {
+  const auto table = StorageManager::get().get_table(_table_name);
+  Assert(table->has_mvcc() == UseMvcc::Yes, "Tables can only be clustered under MVCC");
+  for (const auto column_id : _column_ids) {
+    Assert(column_id < table->column_count(), "Column with given ID does not exist.");
+  }
+
+  // The ChunkCompressionManager does not compress chunks of the table while it is clustered, so that the set of
+  // immutable chunks does not change and the clustered chunks are not compressed twice
+  const auto compression_lock = table->acquire_compression_mutex();
+
+  // The immutable chunks whose rows may still be visible are clustered. Inserts append chunks while holding the append
+  // mutex, so the chunks can be listed safely.
+  auto is_clustered_chunk = std::vector<bool>{};
+  auto clustered_chunk_ids = std::vector<ChunkID>{};
+  {
+    const auto append_lock = table->acquire_append_mutex();
+    is_clustered_chunk.resize(table->chunk_count(), false);
+    for (auto chunk_id = _first_chunk_id; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk->is_mutable() || chunk->cleanup_commit_id()) continue;
+
+      is_clustered_chunk[chunk_id] = true;
+      clustered_chunk_ids.emplace_back(chunk_id);
+    }
+  }
+  if (clustered_chunk_ids.empty()) return;
+
+  const auto context = TransactionManager::get().new_transaction_context();
+
+  // The rows of these chunks that are visible to the transaction. Validate outputs a chunk per input chunk.
+  const auto get_table = std::make_shared<GetTable>(_table_name);
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context_recursively(context);
+  get_table->execute();
+  validate->execute();
+
+  const auto validated_table = validate->get_output();
+  const auto rows_to_delete = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  auto row_ids = std::vector<RowID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < validated_table->chunk_count(); ++chunk_id) {
+    const auto chunk = validated_table->get_chunk(chunk_id);
+    const auto pos_list = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}))->pos_list();
+
+    const auto referenced_chunk_id = static_cast<size_t>(pos_list->front().chunk_id);
+    if (referenced_chunk_id >= is_clustered_chunk.size() || !is_clustered_chunk[referenced_chunk_id]) continue;
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      segments.push_back(chunk->get_segment(column_id));
+    }
+    rows_to_delete->append_chunk(segments);
+    row_ids.insert(row_ids.end(), pos_list->cbegin(), pos_list->cend());
+  }
+
+  if (!row_ids.empty()) {
+    const auto rows_to_delete_wrapper = std::make_shared<TableWrapper>(rows_to_delete);
+    rows_to_delete_wrapper->execute();
+
+    const auto delete_operator = std::make_shared<Delete>(_table_name, rows_to_delete_wrapper);
+    delete_operator->set_transaction_context(context);
+    delete_operator->execute();
+
+    // A concurrent transaction modified one of the rows
+    if (delete_operator->execute_failed()) {
+      context->rollback();
+      return;
+    }
+
+    const auto positions = cluster_row_ids(*table, _column_ids, row_ids);
+    auto clustered_row_ids = std::vector<RowID>{};
+    clustered_row_ids.reserve(row_ids.size());
+    for (const auto position : positions) {
+      clustered_row_ids.emplace_back(row_ids[position]);
+    }
+
+    const auto rows_to_insert_wrapper = std::make_shared<TableWrapper>(materialize_rows(*table, clustered_row_ids));
+    rows_to_insert_wrapper->execute();
+
+    const auto insert_operator = std::make_shared<Insert>(_table_name, rows_to_insert_wrapper);
+    insert_operator->set_transaction_context(context);
+    insert_operator->execute();
+  }
+
+  if (!context->commit()) return;
+  _committed = true;
+
+  // The rows of the clustered chunks were deleted by this transaction or before its snapshot. Rows that were inserted
+  // into the chunks by transactions that committed after the snapshot are still visible, so such chunks keep no
+  // cleanup commit id.
+  for (const auto chunk_id : clustered_chunk_ids) {
+    const auto chunk = table->get_chunk(chunk_id);
+    auto all_rows_deleted = true;
+    {
+      const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+      for (const auto end_cid : mvcc_data->end_cids) {
+        if (end_cid > context->commit_id()) {
+          all_rows_deleted = false;
+          break;
+        }
+      }
+    }
+    if (all_rows_deleted) chunk->set_cleanup_commit_id(context->commit_id());
+  }
+
+  if (!_segment_encoding_spec) return;
+
+  // Compress the chunks filled with the clustered rows, as the ChunkCompressionManager would, which is blocked by the
+  // compression mutex
+  auto completed_chunk_ids = std::vector<ChunkID>{};
+  {
+    const auto append_lock = table->acquire_append_mutex();
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk->is_mutable() || !ChunkCompressionTask::chunk_is_completed(chunk, table->max_chunk_size())) continue;
+      if (!std::dynamic_pointer_cast<const BaseValueSegment>(chunk->get_segment(ColumnID{0}))) continue;
+
+      completed_chunk_ids.emplace_back(chunk_id);
+    }
+  }
+  if (completed_chunk_ids.empty()) return;
+
+  ChunkEncoder::encode_chunks(table, completed_chunk_ids, *_segment_encoding_spec);
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "scheduler/abstract_task.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Clusters the immutable chunks of a table by one or more columns, so that the ChunkStatistics of the chunks
+ *        cover small value ranges and the ChunkPruningRule can skip most chunks for range predicates
+ *
+ * The rows of the table's immutable chunks (from a given chunk on) are re-inserted in the order of the clustering
+ * columns, all within one transaction:
+ *
+ *  1. The rows of the immutable chunks that are visible to the transaction are deleted (see Delete).
+ *  2. They are sorted by the clustering column or, for multiple columns, by their Z-order value, which interleaves the
+ *     bits of the ranks of the rows' values in each column. This keeps the value ranges of every clustering column
+ *     small within a chunk. NULLs come first.
+ *  3. They are inserted at the end of the table (see Insert), which forms new chunks of the table's maximum size.
+ *
+ * Concurrent transactions keep seeing the previous rows until the transaction committed. If another transaction
+ * modifies one of the rows concurrently, the clustering is rolled back (see committed()). After the commit, the task
+ * checks that all rows of each previous chunk were deleted up to its commit, which is recorded in the chunk's cleanup
+ * commit id, so that Validate skips it and the ChunkPruningRule excludes it (see Chunk::cleanup_commit_id()). Rows
+ * that other transactions inserted into a chunk after the snapshot of the clustering are still visible, so that chunk
+ * keeps no cleanup commit id. The previous chunks are not removed from the table, as this would change the RowIDs of
+ * the following chunks. Once no transaction can see their rows, the TableClusteringManager frees their data (see
+ * Chunk::reclaim()). Until then, queries that do not validate their input see the deleted rows as well, as after any
+ * Delete.
+ *
+ * If a SegmentEncodingSpec is given, the completed mutable chunks of the table (see ChunkCompressionTask) are
+ * compressed right away, which builds their ChunkStatistics. Otherwise, this is left to the ChunkCompressionManager.
+ * The task holds the compression mutex of the table (see Table::acquire_compression_mutex()) throughout, so that the
+ * ChunkCompressionManager does not compress the same chunks concurrently.
+ */
+class TableClusteringTask : public AbstractTask {
+ public:
+  TableClusteringTask(const std::string& table_name, const std::vector<ColumnID>& column_ids,
+                      const std::optional<SegmentEncodingSpec>& segment_encoding_spec = SegmentEncodingSpec{},
+                      const ChunkID first_chunk_id = ChunkID{0});
+
+  // Whether the rows were clustered and the transaction committed. Only valid after the task was executed.
+  bool committed() const;
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  const std::string _table_name;
+  const std::vector<ColumnID> _column_ids;
+  const std::optional<SegmentEncodingSpec> _segment_encoding_spec;
+
+  // Chunks before this one are not clustered, e.g., because they were clustered by the same columns before
+  const ChunkID _first_chunk_id;
+
+  bool _committed{false};
+};
+
+}  // namespace opossum
@@ -196,7 +196,9 @@ enum class HistogramType { EqualWidth, EqualHeight, EqualDistinctCount };
 enum class DescriptionMode { SingleLine, MultiLine };
 
 enum class UseMvcc : bool { Yes = true, No = false };
+enum class IsPrimaryKey : bool { Yes = true, No = false };
 enum class CleanupTemporaries : bool { Yes = true, No = false };
+enum class UsePipelining : bool { Yes = true, No = false };
 
 class Noncopyable {
  protected:
@@ -0,0 +1,136 @@
+#include "execution_trace.hpp"
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// The trace that everything executed on this thread is recorded in
+thread_local std::shared_ptr<opossum::ExecutionTrace> current_execution_trace;
+
+}  // namespace
+
+namespace opossum {
+
+ExecutionTrace::ScopedActivation::ScopedActivation(const std::shared_ptr<ExecutionTrace>& execution_trace)
+    : _is_activated(execution_trace != nullptr) {
+  if (!_is_activated) return;
+
+  _previous_execution_trace = std::move(::current_execution_trace);
+  ::current_execution_trace = execution_trace;
+}
+
+ExecutionTrace::ScopedActivation::~ScopedActivation() {
+  if (_is_activated) ::current_execution_trace = std::move(_previous_execution_trace);
+}
+
+ExecutionTrace::ExecutionTrace(const std::string& name) : _name(name), _begin(Clock::now()) {}
+
+const std::shared_ptr<ExecutionTrace>& ExecutionTrace::current() { return ::current_execution_trace; }
+
+void ExecutionTrace::add_complete_event(const std::string& name, const std::string& category,
+                                        const Clock::time_point begin, const Clock::time_point end,
+                                        const nlohmann::json& arguments) {
+  const auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(begin - _begin);
+  const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _events.emplace_back(Event{name, category, 'X', timestamp, duration, _current_thread_id(), arguments});
+}
+
+void ExecutionTrace::add_instant_event(const std::string& name, const std::string& category,
+                                       const nlohmann::json& arguments) {
+  const auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - _begin);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _events.emplace_back(
+      Event{name, category, 'i', timestamp, std::chrono::microseconds{0}, _current_thread_id(), arguments});
+}
+
+size_t ExecutionTrace::event_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _events.size();
+}
+
+nlohmann::json ExecutionTrace::to_chrome_trace() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto trace_events = nlohmann::json::array();
+
+  // Metadata events name the process and the threads in the viewer
+  trace_events.push_back({{"name", "process_name"}, {"ph", "M"}, {"pid", 0}, {"args", {{"name", _name}}}});
+  for (const auto& [thread_id, thread_name] : _thread_names) {
+    trace_events.push_back(
+        {{"name", "thread_name"}, {"ph", "M"}, {"pid", 0}, {"tid", thread_id}, {"args", {{"name", thread_name}}}});
+    // Sort workers by their id, other threads come first
+    trace_events.push_back({{"name", "thread_sort_index"},
+                            {"ph", "M"},
+                            {"pid", 0},
+                            {"tid", thread_id},
+                            {"args", {{"sort_index", thread_id}}}});
+  }
+
+  for (const auto& event : _events) {
+    auto trace_event = nlohmann::json{{"name", event.name},
+                                      {"cat", event.category},
+                                      {"ph", std::string(1, event.phase)},
+                                      {"ts", event.timestamp.count()},
+                                      {"pid", 0},
+                                      {"tid", event.thread_id},
+                                      {"args", event.arguments}};
+    if (event.phase == 'X') trace_event["dur"] = event.duration.count();
+    // Instant events are scoped to their thread
+    if (event.phase == 'i') trace_event["s"] = "t";
+    trace_events.push_back(std::move(trace_event));
+  }
+
+  return {{"traceEvents", trace_events}, {"displayTimeUnit", "ms"}};
+}
+
+void ExecutionTrace::write_chrome_trace(const std::string& file_path) const {
+  auto file = std::ofstream{file_path};
+  Assert(file.is_open(), "Could not open '" + file_path + "' for writing the trace");
+  file << to_chrome_trace().dump() << std::endl;
+}
+
+int64_t ExecutionTrace::_current_thread_id() {
+  if (const auto worker = Worker::get_this_thread_worker()) {
+    const auto thread_id = static_cast<int64_t>(worker->id());
+    if (!_thread_names.count(thread_id)) {
+      _thread_names.emplace(thread_id, "Worker " + std::to_string(worker->id()) + " (CPU " +
+                                           std::to_string(worker->cpu_id()) + ", node " +
+                                           std::to_string(worker->queue()->node_id()) + ")");
+    }
+    return thread_id;
+  }
+
+  const auto non_worker_thread_id_iter = _non_worker_thread_ids.find(std::this_thread::get_id());
+  if (non_worker_thread_id_iter != _non_worker_thread_ids.end()) return non_worker_thread_id_iter->second;
+
+  const auto thread_id = -static_cast<int64_t>(_non_worker_thread_ids.size()) - 1;
+  _non_worker_thread_ids.emplace(std::this_thread::get_id(), thread_id);
+  _thread_names.emplace(thread_id, "Thread " + std::to_string(-thread_id));
+  return thread_id;
+}
+
+TraceScope::TraceScope(const std::string& name, const std::string& category)
+    : _execution_trace(ExecutionTrace::current()),
+      _name(_execution_trace ? name : std::string{}),
+      _category(_execution_trace ? category : std::string{}),
+      _begin(_execution_trace ? ExecutionTrace::Clock::now() : ExecutionTrace::Clock::time_point{}) {}
+
+TraceScope::~TraceScope() {
+  if (_execution_trace) {
+    _execution_trace->add_complete_event(_name, _category, _begin, ExecutionTrace::Clock::now(), _arguments);
+  }
+}
+
+nlohmann::json& TraceScope::arguments() { return _arguments; }
+
+}  // namespace opossum
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "json.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Records what happened during the execution of a query - which Worker executed which task when, how long tasks waited
+ * in a TaskQueue, which tasks were stolen, and the phases of the operators - and exports it in the Chrome trace event
+ * format. The resulting file can be opened in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Tracing is enabled for everything executed while an ExecutionTrace is active on the current thread (see
+ * ScopedActivation). Tasks remember the trace that was active when they were created and activate it while they are
+ * executed, so the trace also follows the query onto the Workers:
+ *
+ *   auto trace = std::make_shared<ExecutionTrace>("TPC-H 6");
+ *   {
+ *     const auto activation = ExecutionTrace::ScopedActivation{trace};
+ *     SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+ *   }
+ *   trace->write_chrome_trace("tpch-6.json");
+ *
+ * Alternatively, use SQLPipelineBuilder::with_execution_trace(). Without an active trace, the overhead of the tracing
+ * is a thread-local lookup per task and per traced operator phase.
+ */
+class ExecutionTrace : private Noncopyable {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * Activates an ExecutionTrace for the current thread for its lifetime and restores the previously active trace (if
+   * any) afterwards. Activating a nullptr leaves the currently active trace untouched.
+   */
+  class ScopedActivation : private Noncopyable {
+   public:
+    explicit ScopedActivation(const std::shared_ptr<ExecutionTrace>& execution_trace);
+    ~ScopedActivation();
+
+   private:
+    const bool _is_activated;
+    std::shared_ptr<ExecutionTrace> _previous_execution_trace;
+  };
+
+  /**
+   * @param name    Shown as the name of the traced process, e.g., the query
+   */
+  explicit ExecutionTrace(const std::string& name = "");
+
+  /**
+   * @return The trace that is active on the current thread, nullptr if tracing is disabled
+   */
+  static const std::shared_ptr<ExecutionTrace>& current();
+
+  /**
+   * Records an event that lasted from @param begin to @param end on the current thread
+   */
+  void add_complete_event(const std::string& name, const std::string& category, const Clock::time_point begin,
+                          const Clock::time_point end, const nlohmann::json& arguments = nlohmann::json::object());
+
+  /**
+   * Records an event without a duration that happened now on the current thread
+   */
+  void add_instant_event(const std::string& name, const std::string& category,
+                         const nlohmann::json& arguments = nlohmann::json::object());
+
+  size_t event_count() const;
+
+  /**
+   * @return The trace in the Chrome trace event format ({"traceEvents": [...]})
+   */
+  nlohmann::json to_chrome_trace() const;
+
+  void write_chrome_trace(const std::string& file_path) const;
+
+ private:
+  struct Event {
+    std::string name;
+    std::string category;
+    char phase;
+    std::chrono::microseconds timestamp;
+    std::chrono::microseconds duration;
+    int64_t thread_id;
+    nlohmann::json arguments;
+  };
+
+  // Workers are identified by their WorkerID, other threads get negative ids. Requires _mutex to be locked.
+  int64_t _current_thread_id();
+
+  const std::string _name;
+  const Clock::time_point _begin;
+
+  mutable std::mutex _mutex;
+  std::vector<Event> _events;
+  std::unordered_map<int64_t, std::string> _thread_names;
+  std::unordered_map<std::thread::id, int64_t> _non_worker_thread_ids;
+};
+
+/**
+ * Records the time between its construction and destruction as an event in the ExecutionTrace that is active on the
+ * current thread. Does nothing if no trace is active. Used for operators and their phases:
+ *
+ *   {
+ *     auto trace_scope = TraceScope{"Build", "JoinHash"};
+ *     hash_tables = build(...);
+ *   }
+ */
+class TraceScope : private Noncopyable {
+ public:
+  TraceScope(const std::string& name, const std::string& category);
+  ~TraceScope();
+
+  /**
+   * Attaches additional information to the event. Ignored if no trace is active.
+   */
+  nlohmann::json& arguments();
+
+ private:
+  const std::shared_ptr<ExecutionTrace> _execution_trace;
+  const std::string _name;
+  const std::string _category;
+  const ExecutionTrace::Clock::time_point _begin;
+  nlohmann::json _arguments = nlohmann::json::object();
+};
+
+}  // namespace opossum
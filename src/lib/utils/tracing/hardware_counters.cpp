@@ -0,0 +1,195 @@
+#include "hardware_counters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+
+namespace {
+
+using opossum::HardwareCounterValues;
+
+// Reads the counters of the calling thread. The perf events are opened on first use and closed when the thread ends.
+class ThreadCounters : private opossum::Noncopyable {
+ public:
+  ThreadCounters() {
+#if defined(__linux__)
+    // The order matches the members of HardwareCounterValues
+    const auto configs = std::array<uint64_t, COUNTER_COUNT>{PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                             PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+    for (auto counter_idx = size_t{0}; counter_idx < COUNTER_COUNT; ++counter_idx) {
+      auto attributes = perf_event_attr{};
+      std::memset(&attributes, 0, sizeof(attributes));
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.size = sizeof(attributes);
+      attributes.config = configs[counter_idx];
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv = 1;
+      attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      // All counters form one group with the cycles counter, so that they are scheduled together and read at once
+      const auto group_fd = _fds[0];
+      _fds[counter_idx] = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, group_fd, 0));
+
+      // Without a cycles counter, nothing is counted. Other counters might not be supported by the CPU (e.g., in VMs).
+      if (_fds[0] < 0) return;
+      if (_fds[counter_idx] >= 0) _counter_indices[_open_counter_count++] = counter_idx;
+    }
+#endif
+  }
+
+  ~ThreadCounters() {
+#if defined(__linux__)
+    for (const auto fd : _fds) {
+      if (fd >= 0) close(fd);
+    }
+#endif
+  }
+
+  bool is_open() const { return _fds[0] >= 0; }
+
+  // @return false if the counters could not be read
+  bool read(HardwareCounterValues& values) const {
+#if defined(__linux__)
+    if (!is_open()) return false;
+
+    // Layout of a group read: number of counters, time enabled, time running, one value per counter
+    auto buffer = std::array<uint64_t, 3 + COUNTER_COUNT>{};
+    if (::read(_fds[0], buffer.data(), sizeof(buffer)) < 0 || buffer[0] != _open_counter_count) return false;
+
+    // If more events are opened in the system than the CPU has counters for, the kernel multiplexes them and the values
+    // have to be extrapolated to the time the counters were enabled
+    const auto time_enabled = buffer[1];
+    const auto time_running = buffer[2];
+    const auto scale = [&](const uint64_t value) {
+      if (time_running == 0 || time_running == time_enabled) return value;
+      return static_cast<uint64_t>(static_cast<double>(value) * time_enabled / time_running);
+    };
+
+    auto counts = std::array<uint64_t, COUNTER_COUNT>{};
+    for (auto open_counter_idx = size_t{0}; open_counter_idx < _open_counter_count; ++open_counter_idx) {
+      counts[_counter_indices[open_counter_idx]] = scale(buffer[3 + open_counter_idx]);
+    }
+    values = HardwareCounterValues{counts[0], counts[1], counts[2], counts[3]};
+    return true;
+#else
+    return false;
+#endif
+  }
+
+ private:
+  static constexpr auto COUNTER_COUNT = size_t{4};
+
+  std::array<int, COUNTER_COUNT> _fds{-1, -1, -1, -1};
+
+  // The counters that could be opened, in the order in which they appear in a group read
+  std::array<size_t, COUNTER_COUNT> _counter_indices{};
+  size_t _open_counter_count{0};
+};
+
+const ThreadCounters& thread_counters() {
+  thread_local const ThreadCounters counters;
+  return counters;
+}
+
+// The HardwareCounters that everything executed on this thread is counted into
+thread_local std::shared_ptr<opossum::HardwareCounters> current_hardware_counters;
+
+// The counter values of this thread when the current attribution last changed
+thread_local HardwareCounterValues last_thread_values;
+
+// Counts everything since the last call into the current attribution
+void flush_current_attribution() {
+  auto values = HardwareCounterValues{};
+  if (!thread_counters().read(values)) return;
+
+  if (current_hardware_counters) {
+    // Extrapolated values are not necessarily monotonic
+    const auto delta = [](const uint64_t now, const uint64_t before) { return now > before ? now - before : 0; };
+    current_hardware_counters->add({delta(values.cycles, last_thread_values.cycles),
+                                    delta(values.instructions, last_thread_values.instructions),
+                                    delta(values.llc_misses, last_thread_values.llc_misses),
+                                    delta(values.branch_misses, last_thread_values.branch_misses)});
+  }
+
+  last_thread_values = values;
+}
+
+}  // namespace
+
+namespace opossum {
+
+HardwareCounterValues& HardwareCounterValues::operator+=(const HardwareCounterValues& rhs) {
+  cycles += rhs.cycles;
+  instructions += rhs.instructions;
+  llc_misses += rhs.llc_misses;
+  branch_misses += rhs.branch_misses;
+  return *this;
+}
+
+nlohmann::json HardwareCounterValues::to_json() const {
+  return {{"cycles", cycles},
+          {"instructions", instructions},
+          {"llc_misses", llc_misses},
+          {"branch_misses", branch_misses}};
+}
+
+std::string HardwareCounterValues::to_string() const {
+  auto stream = std::stringstream{};
+  stream << cycles << " cycles, " << instructions << " instructions, " << llc_misses << " LLC misses, "
+         << branch_misses << " branch misses";
+  return stream.str();
+}
+
+std::atomic_bool HardwareCounters::_is_enabled{false};
+
+HardwareCounters::ScopedAttribution::ScopedAttribution(const std::shared_ptr<HardwareCounters>& hardware_counters) {
+  // Nothing changes if nothing was counted before and nothing is counted now
+  if (!hardware_counters && !::current_hardware_counters) return;
+  if (!thread_counters().is_open()) return;
+
+  _is_attributed = true;
+  flush_current_attribution();
+  _previous_hardware_counters = std::move(::current_hardware_counters);
+  ::current_hardware_counters = hardware_counters;
+}
+
+HardwareCounters::ScopedAttribution::~ScopedAttribution() {
+  if (!_is_attributed) return;
+
+  flush_current_attribution();
+  ::current_hardware_counters = std::move(_previous_hardware_counters);
+}
+
+bool HardwareCounters::is_enabled() { return _is_enabled; }
+
+void HardwareCounters::set_enabled(const bool enabled) { _is_enabled = enabled; }
+
+bool HardwareCounters::is_available() {
+  static const auto is_available = thread_counters().is_open();
+  return is_available;
+}
+
+const std::shared_ptr<HardwareCounters>& HardwareCounters::current() { return ::current_hardware_counters; }
+
+void HardwareCounters::add(const HardwareCounterValues& values) {
+  _cycles += values.cycles;
+  _instructions += values.instructions;
+  _llc_misses += values.llc_misses;
+  _branch_misses += values.branch_misses;
+}
+
+HardwareCounterValues HardwareCounters::values() const {
+  return HardwareCounterValues{_cycles, _instructions, _llc_misses, _branch_misses};
+}
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "json.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct HardwareCounterValues {
+  uint64_t cycles{0};
+  uint64_t instructions{0};
+  uint64_t llc_misses{0};
+  uint64_t branch_misses{0};
+
+  HardwareCounterValues& operator+=(const HardwareCounterValues& rhs);
+
+  nlohmann::json to_json() const;
+  std::string to_string() const;
+};
+
+/**
+ * Collects the CPU cycles, retired instructions, last level cache misses, and branch misses that were caused by some
+ * unit of work (usually an operator), summed up over all threads that worked on it. The values are read from Linux'
+ * perf_event_open interface, which counts per thread (and only while the thread is running).
+ *
+ * Counting is opt-in (see set_enabled()) as it costs a few system calls per executed task. While a HardwareCounters
+ * instance is attributed on a thread (see ScopedAttribution), everything executed on that thread is counted into it.
+ * Attributions nest, but are exclusive: Nothing that is counted into an inner attribution is also counted into the
+ * outer one. Tasks remember the attribution that was active when they were created and restore it while they are
+ * executed, so that the jobs an operator spawns are counted into the operator even if other Workers execute them.
+ * Tasks of other queries that a Worker executes while waiting for the jobs are not.
+ *
+ * If perf_event_open is not available (e.g., not on Linux, in a container, or due to
+ * /proc/sys/kernel/perf_event_paranoid), nothing is counted and is_available() returns false.
+ */
+class HardwareCounters : private Noncopyable {
+ public:
+  /**
+   * Makes @param hardware_counters the target of all counts on the current thread for its lifetime and restores the
+   * previous target afterwards. Attributing a nullptr stops counting until the attribution ends.
+   */
+  class ScopedAttribution : private Noncopyable {
+   public:
+    explicit ScopedAttribution(const std::shared_ptr<HardwareCounters>& hardware_counters);
+    ~ScopedAttribution();
+
+   private:
+    bool _is_attributed{false};
+    std::shared_ptr<HardwareCounters> _previous_hardware_counters;
+  };
+
+  static bool is_enabled();
+  static void set_enabled(bool enabled);
+
+  /**
+   * @return Whether the counters can be opened on this system (checked once)
+   */
+  static bool is_available();
+
+  /**
+   * @return The HardwareCounters that are attributed on the current thread, nullptr if nothing is counted
+   */
+  static const std::shared_ptr<HardwareCounters>& current();
+
+  // Thread-safe
+  void add(const HardwareCounterValues& values);
+
+  HardwareCounterValues values() const;
+
+ private:
+  static std::atomic_bool _is_enabled;
+
+  std::atomic<uint64_t> _cycles{0};
+  std::atomic<uint64_t> _instructions{0};
+  std::atomic<uint64_t> _llc_misses{0};
+  std::atomic<uint64_t> _branch_misses{0};
+};
+
+}  // namespace opossum
@@ -108,4 +108,22 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, LowestActiveSnapshotCommitId) {
+  auto context_1 = manager().new_transaction_context();
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), context_1->snapshot_commit_id());
+
+  // The snapshot of a committed transaction stays active while its context is referenced
+  ASSERT_TRUE(context_1->commit());
+  auto context_2 = manager().new_transaction_context();
+  EXPECT_GT(context_2->snapshot_commit_id(), context_1->snapshot_commit_id());
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), context_1->snapshot_commit_id());
+
+  context_1.reset();
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), context_2->snapshot_commit_id());
+
+  // Without active transactions, it is the snapshot that new transactions get
+  context_2.reset();
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), manager().last_commit_id());
+}
+
 }  // namespace opossum
@@ -15,6 +15,7 @@
 #include "operators/join_hash.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/print.hpp"
+#include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -93,6 +94,12 @@ class OperatorsAggregateTest : public BaseTest {
     _table_wrapper_1_1_null_dict = std::make_shared<TableWrapper>(std::move(test_table));
     _table_wrapper_1_1_null_dict->execute();
 
+    test_table = load_table("src/test/tables/aggregateoperator/groupby_int_1gb_1agg/input.tbl", 2);
+    ChunkEncoder::encode_all_chunks(test_table, EncodingType::RunLength);
+
+    _table_wrapper_1_1_run_length = std::make_shared<TableWrapper>(std::move(test_table));
+    _table_wrapper_1_1_run_length->execute();
+
     _table_wrapper_int_int = std::make_shared<TableWrapper>(load_table("src/test/tables/int_int.tbl", 2));
     _table_wrapper_int_int->execute();
   }
@@ -125,7 +132,7 @@ class OperatorsAggregateTest : public BaseTest {
       _table_wrapper_join_2, _table_wrapper_1_2, _table_wrapper_2_1, _table_wrapper_2_2, _table_wrapper_2_0_null,
       _table_wrapper_3_1, _table_wrapper_3_2, _table_wrapper_3_0_null, _table_wrapper_1_1_string,
       _table_wrapper_1_1_string_null, _table_wrapper_1_1_dict, _table_wrapper_1_1_null_dict, _table_wrapper_2_0_a,
-      _table_wrapper_2_o_b, _table_wrapper_int_int;
+      _table_wrapper_2_o_b, _table_wrapper_int_int, _table_wrapper_1_1_run_length;
 };
 
 TEST_F(OperatorsAggregateTest, OperatorName) {
@@ -245,6 +252,67 @@ TEST_F(OperatorsAggregateTest, DictionarySingleAggregateCount) {
                     "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/count.tbl", 1);
 }
 
+TEST_F(OperatorsAggregateTest, RunLengthSingleAggregateMax) {
+  this->test_output(_table_wrapper_1_1_run_length, {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}},
+                    "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/max.tbl", 1);
+}
+
+TEST_F(OperatorsAggregateTest, RunLengthSingleAggregateSum) {
+  this->test_output(_table_wrapper_1_1_run_length, {{ColumnID{1}, AggregateFunction::Sum}}, {ColumnID{0}},
+                    "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/sum.tbl", 1);
+}
+
+TEST_F(OperatorsAggregateTest, RunLengthSingleAggregateAvg) {
+  this->test_output(_table_wrapper_1_1_run_length, {{ColumnID{1}, AggregateFunction::Avg}}, {ColumnID{0}},
+                    "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/avg.tbl", 1);
+}
+
+TEST_F(OperatorsAggregateTest, RunLengthSingleAggregateCountDistinct) {
+  this->test_output(_table_wrapper_1_1_run_length, {{ColumnID{1}, AggregateFunction::CountDistinct}}, {ColumnID{0}},
+                    "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/count_distinct.tbl", 1);
+}
+
+TEST_F(OperatorsAggregateTest, RunLengthLongRuns) {
+  // Runs that span several chunks and groups, some of them only containing NULLs
+  const auto create_table = [] {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::Int, true);
+    column_definitions.emplace_back("c", DataType::Double, true);
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 500);
+    for (auto row_idx = 0; row_idx < 1'000; ++row_idx) {
+      const auto run_idx = row_idx / 70;
+      table->append({row_idx / 30 % 4, run_idx % 3 == 1 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{run_idx},
+                     run_idx % 5 == 2 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{run_idx * 0.5}});
+    }
+    return table;
+  };
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(create_table());
+  table_wrapper->execute();
+
+  const auto encoded_table = create_table();
+  ChunkEncoder::encode_all_chunks(encoded_table, EncodingType::RunLength);
+  const auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+  encoded_table_wrapper->execute();
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{
+      {ColumnID{0}, AggregateFunction::Sum},           {ColumnID{1}, AggregateFunction::Count},
+      {ColumnID{1}, AggregateFunction::CountDistinct}, {ColumnID{2}, AggregateFunction::Avg},
+      {ColumnID{2}, AggregateFunction::Max},           {ColumnID{2}, AggregateFunction::Sum}};
+
+  for (const auto& groupby_column_ids :
+       {std::vector<ColumnID>{}, std::vector<ColumnID>{ColumnID{0}}, std::vector<ColumnID>{ColumnID{1}}}) {
+    const auto aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+
+    const auto encoded_aggregate = std::make_shared<Aggregate>(encoded_table_wrapper, aggregates, groupby_column_ids);
+    encoded_aggregate->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(encoded_aggregate->get_output(), aggregate->get_output());
+  }
+}
+
 TEST_F(OperatorsAggregateTest, TwoAggregateAvgMax) {
   this->test_output(_table_wrapper_1_2, {{ColumnID{1}, AggregateFunction::Max}, {ColumnID{2}, AggregateFunction::Avg}},
                     {ColumnID{0}}, "src/test/tables/aggregateoperator/groupby_int_1gb_2agg/max_avg.tbl", 1);
@@ -467,6 +535,28 @@ TEST_F(OperatorsAggregateTest, ThreeGroupbyCountStar) {
                     "src/test/tables/aggregateoperator/groupby_int_3gb_0agg/count_star.tbl", 1, false);
 }
 
+TEST_F(OperatorsAggregateTest, SortedGroups) {
+  // The chunks of a Sort's output are ordered by the group-by column, so that equal keys follow each other
+  const auto sorted_1_1_null = std::make_shared<Sort>(_table_wrapper_1_1_null, ColumnID{0}, OrderByMode::Ascending, 2u);
+  sorted_1_1_null->execute();
+
+  this->test_output(sorted_1_1_null, {{ColumnID{1}, AggregateFunction::Sum}}, {ColumnID{0}},
+                    "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/sum_null.tbl", 1, false);
+  this->test_output(sorted_1_1_null, {{ColumnID{1}, AggregateFunction::CountDistinct}}, {ColumnID{0}},
+                    "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/count_distinct_null.tbl", 1, false);
+  this->test_output(sorted_1_1_null, {{std::nullopt, AggregateFunction::Count}}, {ColumnID{0}},
+                    "src/test/tables/aggregateoperator/groupby_int_1gb_0agg/count_star.tbl", 1, false);
+  this->test_output(sorted_1_1_null, {}, {ColumnID{0}},
+                    "src/test/tables/aggregateoperator/groupby_int_1gb_0agg/result_null.tbl", 1, false);
+
+  const auto sorted_2_0_null =
+      std::make_shared<Sort>(_table_wrapper_2_0_null, ColumnID{2}, OrderByMode::Descending, 2u);
+  sorted_2_0_null->execute();
+
+  this->test_output(sorted_2_0_null, {{std::nullopt, AggregateFunction::Count}}, {ColumnID{0}, ColumnID{2}},
+                    "src/test/tables/aggregateoperator/groupby_int_2gb_0agg/count_star.tbl", 1, false);
+}
+
 TEST_F(OperatorsAggregateTest, DictionarySingleAggregateMaxWithNull) {
   this->test_output(_table_wrapper_1_1_null_dict, {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}},
                     "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/max_null.tbl", 1, false);
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -14,6 +15,7 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -214,6 +216,54 @@ TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnlySomeChunks) {
   }
 }
 
+TYPED_TEST(OperatorsIndexScanTest, IndexesDroppedAfterPlanning) {
+  const auto table = std::const_pointer_cast<Table>(this->_int_int->get_output());
+
+  auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                          PredicateCondition::Between, std::vector<AllTypeVariant>{4},
+                                          std::vector<AllTypeVariant>{9});
+  scan->set_included_chunk_ids(this->_chunk_ids);
+  scan->pin_indexes(*table);
+
+  // E.g., the IndexAdvisor drops the index while the plan is waiting to be executed
+  for (const auto& chunk_id : this->_chunk_ids) {
+    const auto chunk = table->get_chunk(chunk_id);
+    chunk->remove_index(chunk->get_index(this->_index_type, this->_column_ids));
+  }
+
+  scan->execute();
+
+  this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, {104, 106, 108, 104, 106, 108});
+}
+
+TYPED_TEST(OperatorsIndexScanTest, MultipleKeyRanges) {
+  // Like `a IN (4, 5, 12) OR a BETWEEN 2 AND 6 OR a = NULL`. The overlapping ranges return each row once.
+  const auto key_ranges = std::vector<IndexKeyRange>{
+      IndexKeyRange::equal_to({12}), IndexKeyRange::equal_to({4}), IndexKeyRange{{2}, true, {6}, true},
+      IndexKeyRange::equal_to({5}), IndexKeyRange::equal_to({NullValue{}})};
+
+  for (const auto& table : {this->_int_int, this->_int_int_small_chunk}) {
+    auto scan = std::make_shared<IndexScan>(table, this->_index_type, this->_column_ids, key_ranges);
+    scan->execute();
+
+    this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, {102, 102, 104, 104, 106, 106, 112, 112});
+  }
+}
+
+TYPED_TEST(OperatorsIndexScanTest, PositionsAreOrdered) {
+  auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                          PredicateCondition::GreaterThan, std::vector<AllTypeVariant>{0});
+  scan->execute();
+
+  const auto output = scan->get_output();
+  for (auto chunk_id = ChunkID{0u}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto segment = output->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    const auto& pos_list = *std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+    EXPECT_TRUE(std::is_sorted(pos_list.cbegin(), pos_list.cend()));
+    EXPECT_TRUE(pos_list.references_single_chunk());
+  }
+}
+
 TYPED_TEST(OperatorsIndexScanTest, OperatorName) {
   const auto right_values = std::vector<AllTypeVariant>(this->_column_ids.size(), AllTypeVariant{0});
 
@@ -231,4 +281,61 @@ TYPED_TEST(OperatorsIndexScanTest, InvalidIndexTypeThrows) {
   EXPECT_THROW(scan->execute(), std::logic_error);
 }
 
+class OperatorsIndexScanCompositeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunk 0 holds (9, 10, 11) and (10, 10, 10), chunk 1 holds (11, 10, 11) and (9, 10, 9)
+    auto table = load_table("src/test/tables/int_int_int.tbl", 2);
+    ChunkEncoder::encode_all_chunks(table);
+    table->create_index<CompositeGroupKeyIndex>({ColumnID{0}, ColumnID{2}});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  // The values of column c of the matching rows, sorted
+  std::vector<int32_t> _scan(const std::vector<ColumnID>& column_ids, const std::vector<IndexKeyRange>& key_ranges) {
+    auto scan =
+        std::make_shared<IndexScan>(_table_wrapper, SegmentIndexType::CompositeGroupKey, column_ids, key_ranges);
+    scan->execute();
+
+    const auto output = scan->get_output();
+    auto values = std::vector<int32_t>{};
+    for (auto row_idx = size_t{0}; row_idx < output->row_count(); ++row_idx) {
+      values.emplace_back(output->get_value<int32_t>(ColumnID{2}, row_idx));
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsIndexScanCompositeTest, PrefixOfIndex) {
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+
+  // a IN (9, 11)
+  EXPECT_EQ(_scan(column_ids, {IndexKeyRange::equal_to({9}), IndexKeyRange::equal_to({11})}),
+            (std::vector<int32_t>{9, 11, 11}));
+
+  // a < 10
+  EXPECT_EQ(_scan(column_ids, {IndexKeyRange{{}, true, {10}, false}}), (std::vector<int32_t>{9, 11}));
+}
+
+TEST_F(OperatorsIndexScanCompositeTest, RangeOnSecondColumn) {
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{2}};
+
+  // a = 9 AND c > 9
+  EXPECT_EQ(_scan(column_ids, {IndexKeyRange{{9, 9}, false, {9}, true}}), (std::vector<int32_t>{11}));
+
+  // a IN (9, 11) AND c BETWEEN 10 AND 11
+  const auto between_ranges = std::vector<IndexKeyRange>{IndexKeyRange{{9, 10}, true, {9, 11}, true},
+                                                         IndexKeyRange{{11, 10}, true, {11, 11}, true}};
+  EXPECT_EQ(_scan(column_ids, between_ranges), (std::vector<int32_t>{11, 11}));
+
+  // a IN (8, 10) AND c >= 0, where 8 is not part of the dictionary
+  EXPECT_EQ(_scan(column_ids, {IndexKeyRange{{8, 0}, true, {8}, true}, IndexKeyRange{{10, 0}, true, {10}, true}}),
+            (std::vector<int32_t>{10}));
+}
+
 }  // namespace opossum
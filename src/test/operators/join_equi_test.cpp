@@ -16,6 +16,7 @@
 #include "operators/join_mpsm.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
+#include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/union_all.hpp"
 #include "storage/storage_manager.hpp"
@@ -155,6 +156,24 @@ TYPED_TEST(JoinEquiTest, InnerRefJoin) {
                                              "src/test/tables/joinoperators/int_inner_join.tbl", 1);
 }
 
+TYPED_TEST(JoinEquiTest, JoinSortedInputs) {
+  // The output chunks of a Sort are ordered by the join column, so that the JoinSortMerge does not sort them again
+  auto sort_a = std::make_shared<Sort>(this->_table_wrapper_a, ColumnID{0}, OrderByMode::Ascending, 2u);
+  sort_a->execute();
+  auto sort_b = std::make_shared<Sort>(this->_table_wrapper_b, ColumnID{0}, OrderByMode::Descending, 2u);
+  sort_b->execute();
+
+  this->template test_join_output<TypeParam>(sort_a, sort_b, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                             PredicateCondition::Equals, JoinMode::Inner,
+                                             "src/test/tables/joinoperators/int_inner_join.tbl", 1);
+
+  if constexpr (!std::is_same_v<TypeParam, JoinHash>) {
+    this->template test_join_output<TypeParam>(sort_a, sort_b, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                               PredicateCondition::Equals, JoinMode::Outer,
+                                               "src/test/tables/joinoperators/int_outer_join.tbl", 1);
+  }
+}
+
 TYPED_TEST(JoinEquiTest, InnerValueDictJoin) {
   this->template test_join_output<TypeParam>(this->_table_wrapper_a, this->_table_wrapper_b_dict,
                                              ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
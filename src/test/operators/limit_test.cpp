@@ -8,9 +8,13 @@
 #include "gtest/gtest.h"
 
 #include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
 #include "operators/limit.hpp"
+#include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/union_all.hpp"
+#include "scheduler/operator_task.hpp"
 #include "types.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -118,4 +122,55 @@ TEST_F(OperatorsLimitTest, Limit10ReferenceSegment) {
   test_limit_10();
 }
 
+TEST_F(OperatorsLimitTest, RowBudgetStopsInputsEarly) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_int3.tbl", 3));
+  const auto a = PQPColumnExpression::from_table(*_table_wrapper->get_output(), "a");
+  const auto b = PQPColumnExpression::from_table(*_table_wrapper->get_output(), "b");
+
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_(a, -1));
+  const auto projection = std::make_shared<Projection>(table_scan, expression_vector(a, b));
+  const auto limit = std::make_shared<Limit>(projection, to_expression(int64_t{2}));
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(limit, CleanupTemporaries::No);
+  EXPECT_EQ(limit->row_budget(), std::nullopt);
+  EXPECT_EQ(projection->row_budget(), 2u);
+  EXPECT_EQ(table_scan->row_budget(), 2u);
+  EXPECT_EQ(table_wrapper->row_budget(), std::nullopt);
+
+  for (const auto& task : tasks) {
+    task->schedule();
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(limit->get_output(), load_table("src/test/tables/int_int3_limit_2.tbl", 3));
+
+  // The first chunk already contains enough rows, so the other chunks are neither scanned nor projected
+  EXPECT_EQ(table_scan->get_output()->row_count(), 3u);
+  EXPECT_EQ(projection->get_output()->row_count(), 3u);
+}
+
+TEST_F(OperatorsLimitTest, NoRowBudgetForSharedInputs) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_int3.tbl", 3));
+  const auto table_scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, -1);
+  const auto limit = std::make_shared<Limit>(table_scan, to_expression(int64_t{2}));
+  const auto union_all = std::make_shared<UnionAll>(limit, table_scan);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(union_all, CleanupTemporaries::No);
+  EXPECT_EQ(table_scan->row_budget(), std::nullopt);
+
+  for (const auto& task : tasks) {
+    task->schedule();
+  }
+
+  EXPECT_EQ(union_all->get_output()->row_count(), 10u);
+}
+
+TEST_F(OperatorsLimitTest, LimitWithRowBudget) {
+  const auto limit = std::make_shared<Limit>(_table_wrapper, to_expression(int64_t{4}));
+  limit->set_row_budget(2);
+  EXPECT_EQ(limit->input_row_budget(), 2u);
+
+  limit->execute();
+  EXPECT_TABLE_EQ_ORDERED(limit->get_output(), load_table("src/test/tables/int_int3_limit_2.tbl", 3));
+}
+
 }  // namespace opossum
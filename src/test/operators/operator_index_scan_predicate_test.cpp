@@ -0,0 +1,88 @@
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "operators/operator_index_scan_predicate.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorIndexScanPredicateTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    node = MockNode::make(
+        MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Float, "b"}, {DataType::String, "c"}});
+    a = node->get_column("a");
+    b = node->get_column("b");
+    c = node->get_column("c");
+  }
+
+  std::shared_ptr<MockNode> node;
+  LQPColumnReference a, b, c;
+};
+
+TEST_F(OperatorIndexScanPredicateTest, SingleComparison) {
+  const auto greater_than = OperatorIndexScanPredicate::from_expression(*greater_than_(a, 5), *node);
+  ASSERT_TRUE(greater_than);
+  EXPECT_EQ(greater_than->column_ids, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(greater_than->key_ranges, (std::vector<IndexKeyRange>{IndexKeyRange{{5}, false, {}, true}}));
+
+  // `5 > a` becomes `a < 5`
+  const auto less_than = OperatorIndexScanPredicate::from_expression(*greater_than_(5, a), *node);
+  ASSERT_TRUE(less_than);
+  EXPECT_EQ(less_than->key_ranges, (std::vector<IndexKeyRange>{IndexKeyRange{{}, true, {5}, false}}));
+
+  const auto between = OperatorIndexScanPredicate::from_expression(*between_(c, "x", "y"), *node);
+  ASSERT_TRUE(between);
+  EXPECT_EQ(between->column_ids, std::vector<ColumnID>{ColumnID{2}});
+  EXPECT_EQ(between->key_ranges, (std::vector<IndexKeyRange>{IndexKeyRange{{"x"}, true, {"y"}, true}}));
+}
+
+TEST_F(OperatorIndexScanPredicateTest, InList) {
+  const auto in_list = OperatorIndexScanPredicate::from_expression(*in_(a, list_(3, 1)), *node);
+  ASSERT_TRUE(in_list);
+  EXPECT_EQ(in_list->column_ids, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(in_list->key_ranges,
+            (std::vector<IndexKeyRange>{IndexKeyRange::equal_to({3}), IndexKeyRange::equal_to({1})}));
+}
+
+TEST_F(OperatorIndexScanPredicateTest, CompositePrefix) {
+  const auto in_and_between =
+      OperatorIndexScanPredicate::from_expression(*and_(in_(a, list_(1, 2)), between_(b, 5.0f, 7.0f)), *node);
+  ASSERT_TRUE(in_and_between);
+  EXPECT_EQ(in_and_between->column_ids, (std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}));
+  EXPECT_EQ(in_and_between->key_ranges, (std::vector<IndexKeyRange>{IndexKeyRange{{1, 5.0f}, true, {1, 7.0f}, true},
+                                                                    IndexKeyRange{{2, 5.0f}, true, {2, 7.0f}, true}}));
+
+  // Open bounds of the last column are limited to the prefix
+  const auto equals_and_greater_than =
+      OperatorIndexScanPredicate::from_expression(*and_(equals_(b, 1.0f), greater_than_(a, 2)), *node);
+  ASSERT_TRUE(equals_and_greater_than);
+  EXPECT_EQ(equals_and_greater_than->column_ids, (std::vector<ColumnID>{ColumnID{1}, ColumnID{0}}));
+  EXPECT_EQ(equals_and_greater_than->key_ranges,
+            (std::vector<IndexKeyRange>{IndexKeyRange{{1.0f, 2}, false, {1.0f}, true}}));
+
+  const auto three_columns =
+      OperatorIndexScanPredicate::from_expression(*and_(and_(equals_(a, 1), equals_(b, 2.0f)), equals_(c, "x")), *node);
+  ASSERT_TRUE(three_columns);
+  EXPECT_EQ(three_columns->column_ids, (std::vector<ColumnID>{ColumnID{0}, ColumnID{1}, ColumnID{2}}));
+  EXPECT_EQ(three_columns->key_ranges, (std::vector<IndexKeyRange>{IndexKeyRange::equal_to({1, 2.0f, "x"})}));
+}
+
+TEST_F(OperatorIndexScanPredicateTest, Unsupported) {
+  // Two columns
+  EXPECT_FALSE(OperatorIndexScanPredicate::from_expression(*greater_than_(a, b), *node));
+
+  // A range that is followed by other predicates
+  EXPECT_FALSE(OperatorIndexScanPredicate::from_expression(*and_(less_than_(a, 1), equals_(b, 2.0f)), *node));
+
+  // A column that is restricted twice
+  EXPECT_FALSE(OperatorIndexScanPredicate::from_expression(*and_(equals_(a, 1), less_than_(a, 2)), *node));
+
+  EXPECT_FALSE(OperatorIndexScanPredicate::from_expression(*not_in_(a, list_(1, 2)), *node));
+  EXPECT_FALSE(OperatorIndexScanPredicate::from_expression(*like_(c, "x%"), *node));
+  EXPECT_FALSE(OperatorIndexScanPredicate::from_expression(*or_(equals_(a, 1), equals_(a, 2)), *node));
+}
+
+}  // namespace opossum
@@ -0,0 +1,138 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/operator_pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorPipelineTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->execute();
+
+    _a = PQPColumnExpression::from_table(*_table_wrapper->get_output(), "a");
+    _b = PQPColumnExpression::from_table(*_table_wrapper->get_output(), "b");
+
+    _build_table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float2.tbl", 2));
+    _build_table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _build_table_wrapper;
+  std::shared_ptr<PQPColumnExpression> _a, _b;
+};
+
+TEST_F(OperatorPipelineTest, ScanAndProjectionProduceSameResultAsRegularExecution) {
+  const auto scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 200));
+  const auto projection = std::make_shared<Projection>(scan, expression_vector(add_(_a, _b), _a));
+
+  const auto reference_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 200));
+  const auto reference_projection =
+      std::make_shared<Projection>(reference_scan, expression_vector(add_(_a, _b), _a));
+  reference_scan->execute();
+  reference_projection->execute();
+
+  auto pipeline = OperatorPipeline{{scan, projection}};
+  pipeline.execute();
+
+  // Only the top operator materializes its output
+  EXPECT_EQ(scan->get_output(), nullptr);
+  ASSERT_NE(projection->get_output(), nullptr);
+  EXPECT_TABLE_EQ_ORDERED(projection->get_output(), reference_projection->get_output());
+}
+
+TEST_F(OperatorPipelineTest, ForwardingProjectionOnReferences) {
+  const auto scan_a = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 200));
+  const auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(_b, 458.0f));
+  const auto projection = std::make_shared<Projection>(scan_b, expression_vector(_b));
+
+  auto pipeline = OperatorPipeline{{scan_a, scan_b, projection}};
+  pipeline.execute();
+
+  const auto output = projection->get_output();
+  ASSERT_EQ(output->row_count(), 1u);
+  EXPECT_EQ(output->type(), TableType::References);
+  EXPECT_FLOAT_EQ(output->get_value<float>(ColumnID{0}, 0u), 457.7f);
+}
+
+TEST_F(OperatorPipelineTest, StackedScans) {
+  // The second scan scans the single-chunk tables that the first one emits with one impl
+  const auto scan_a = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 0));
+  const auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(_a, 10'000));
+
+  auto pipeline = OperatorPipeline{{scan_a, scan_b}};
+  pipeline.execute();
+
+  EXPECT_EQ(scan_b->get_output()->row_count(), 2u);
+  EXPECT_NE(scan_b->description(DescriptionMode::SingleLine).find("SingleColumnScan"), std::string::npos);
+}
+
+TEST_F(OperatorPipelineTest, ScanAndJoinHashProbe) {
+  // The chunks emitted by the scan are probed against the hash table of the right input one by one
+  const auto scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 100));
+  const auto join = std::make_shared<JoinHash>(_build_table_wrapper, scan, JoinMode::Inner,
+                                               ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  EXPECT_EQ(join->pipelined_input_side(), OperatorInputSide::Right);
+
+  const auto reference_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 100));
+  const auto reference_join =
+      std::make_shared<JoinHash>(_build_table_wrapper, reference_scan, JoinMode::Inner,
+                                 ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  reference_scan->execute();
+  reference_join->execute();
+
+  auto pipeline = OperatorPipeline{{scan, join}};
+  pipeline.execute();
+
+  EXPECT_EQ(scan->get_output(), nullptr);
+  ASSERT_NE(join->get_output(), nullptr);
+  EXPECT_EQ(join->get_output()->row_count(), 3u);
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), reference_join->get_output());
+}
+
+TEST_F(OperatorPipelineTest, SemiJoinHashProbeStreamsIntoProjection) {
+  // Semi joins probe their left input, the output of the join is passed on to the projection chunk by chunk
+  const auto scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 200));
+  const auto join = std::make_shared<JoinHash>(scan, _build_table_wrapper, JoinMode::Semi,
+                                               ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  const auto projection = std::make_shared<Projection>(join, expression_vector(_b));
+  EXPECT_EQ(join->pipelined_input_side(), OperatorInputSide::Left);
+
+  auto pipeline = OperatorPipeline{{scan, join, projection}};
+  pipeline.execute();
+
+  const auto output = projection->get_output();
+  ASSERT_EQ(output->row_count(), 1u);
+  EXPECT_FLOAT_EQ(output->get_value<float>(ColumnID{0}, 0u), 458.7f);
+  EXPECT_EQ(join->get_output(), nullptr);
+}
+
+TEST_F(OperatorPipelineTest, RejectsPipelineBreakers) {
+  const auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{0});
+  const auto projection = std::make_shared<Projection>(sort, expression_vector(_a));
+
+  EXPECT_TRUE(sort->is_pipeline_breaker());
+  EXPECT_FALSE(projection->is_pipeline_breaker());
+  EXPECT_THROW((OperatorPipeline{{sort, projection}}), std::logic_error);
+
+  // Full outer joins need all rows of both inputs
+  const auto join = std::make_shared<JoinHash>(_table_wrapper, _build_table_wrapper, JoinMode::Outer,
+                                               ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  EXPECT_EQ(join->pipelined_input_side(), std::nullopt);
+}
+
+}  // namespace opossum
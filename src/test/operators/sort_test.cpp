@@ -214,4 +214,17 @@ TEST_P(OperatorsSortTest, DescendingSortOfOneDictSegment) {
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, OutputChunksAreOrdered) {
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::DescendingNullsLast}) {
+    auto sort = std::make_shared<Sort>(_table_wrapper_null, ColumnID{1}, order_by_mode, 2u);
+    sort->execute();
+
+    const auto output = sort->get_output();
+    ASSERT_GT(output->chunk_count(), 1u);
+    for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      EXPECT_EQ(output->get_chunk(chunk_id)->ordered_by(), std::make_pair(ColumnID{1}, order_by_mode));
+    }
+  }
+}
+
 }  // namespace opossum
@@ -68,7 +68,8 @@ auto formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
 
 INSTANTIATE_TEST_CASE_P(EncodingTypes, OperatorsTableScanStringTest,
                         ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary,
-                                          EncodingType::FixedStringDictionary, EncodingType::RunLength),
+                                          EncodingType::FixedStringDictionary, EncodingType::RunLength,
+                                          EncodingType::FrontCodedDictionary, EncodingType::FSST),
                         formatter);
 
 TEST_P(OperatorsTableScanStringTest, ScanEquals) {
@@ -87,6 +88,18 @@ TEST_P(OperatorsTableScanStringTest, ScanNotEquals) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanStringTest, ScanLikeWithoutWildcard) {
+  auto scan = create_table_scan(_gt_string_compressed, ColumnID{1}, PredicateCondition::Like, "Reeperbahn");
+  scan->execute();
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_equals.tbl", 1);
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+
+  auto not_like_scan = create_table_scan(_gt_string_compressed, ColumnID{1}, PredicateCondition::NotLike, "Reeperbahn");
+  not_like_scan->execute();
+  expected_result = load_table("src/test/tables/int_string_like_not_equals.tbl", 1);
+  EXPECT_TABLE_EQ_UNORDERED(not_like_scan->get_output(), expected_result);
+}
+
 TEST_P(OperatorsTableScanStringTest, ScanLessThan) {
   auto scan = create_table_scan(_gt_string_compressed, ColumnID{1}, PredicateCondition::LessThan, "Schiff");
   scan->execute();
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -225,7 +226,7 @@ auto formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
 
 INSTANTIATE_TEST_CASE_P(EncodingTypes, OperatorsTableScanTest,
                         ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength,
-                                          EncodingType::FrameOfReference),
+                                          EncodingType::FrameOfReference, EncodingType::PFORDelta),
                         formatter);
 
 TEST_P(OperatorsTableScanTest, DoubleScan) {
@@ -662,6 +663,115 @@ TEST_P(OperatorsTableScanTest, SetParameters) {
   EXPECT_EQ(*scan_c->predicate(), *greater_than_equals_(column, uncorrelated_parameter_(ParameterID{4})));
 }
 
+TEST_P(OperatorsTableScanTest, ScanLongRuns) {
+  // Ten runs of 100 rows each, the fourth run only contains NULLs
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, true);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto row_idx = 0; row_idx < 1'000; ++row_idx) {
+    table->append({row_idx / 100 == 3 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row_idx / 100}});
+  }
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expect_row_count = [&](const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                    const std::optional<AllTypeVariant>& value2, const size_t row_count) {
+    const auto scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, value, value2);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), row_count);
+  };
+
+  expect_row_count(PredicateCondition::Equals, 5, std::nullopt, 100);
+  expect_row_count(PredicateCondition::NotEquals, 5, std::nullopt, 800);
+  expect_row_count(PredicateCondition::LessThan, 4, std::nullopt, 300);
+  expect_row_count(PredicateCondition::GreaterThanEquals, 4, std::nullopt, 600);
+  expect_row_count(PredicateCondition::Between, 2, 6, 400);
+}
+
+TEST_P(OperatorsTableScanTest, ScanDisjointValueRanges) {
+  // The values of each 2048 rows lie in a different range, so that encodings working on blocks can skip blocks
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Long, true);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 5'000);
+  for (auto row_idx = int64_t{0}; row_idx < 5'000; ++row_idx) {
+    const auto value = (row_idx / 2'048) * 1'000'000 + row_idx % 300;
+    table->append({row_idx % 100 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value}});
+  }
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expect_row_count = [&](const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                    const std::optional<AllTypeVariant>& value2, const size_t row_count) {
+    const auto scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, value, value2);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), row_count);
+  };
+
+  constexpr auto min_value = std::numeric_limits<int64_t>::min();
+  constexpr auto max_value = std::numeric_limits<int64_t>::max();
+
+  expect_row_count(PredicateCondition::Equals, int64_t{1'000'005}, std::nullopt, 7);
+  expect_row_count(PredicateCondition::NotEquals, int64_t{500}, std::nullopt, 4'950);
+  expect_row_count(PredicateCondition::LessThan, min_value, std::nullopt, 0);
+  expect_row_count(PredicateCondition::LessThanEquals, max_value, std::nullopt, 4'950);
+  expect_row_count(PredicateCondition::GreaterThan, max_value, std::nullopt, 0);
+  expect_row_count(PredicateCondition::GreaterThanEquals, int64_t{2'000'000}, std::nullopt, 895);
+  expect_row_count(PredicateCondition::Between, int64_t{250}, int64_t{1'000'010}, 370);
+}
+
+TEST_P(OperatorsTableScanTest, ScanSortedChunks) {
+  // The values of each chunk of ten rows are sorted with two NULLs first. The chunk encoder finds the order.
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, true);
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+    auto values = std::vector<std::optional<int32_t>>{};
+    for (auto row_idx = 0; row_idx < 35; ++row_idx) {
+      const auto value = order_by_mode == OrderByMode::Ascending ? row_idx / 3 : 100 - row_idx / 3;
+      values.emplace_back(row_idx % 10 < 2 ? std::nullopt : std::optional<int32_t>{value});
+      table->append({values.back() ? AllTypeVariant{*values.back()} : AllTypeVariant{NULL_VALUE}});
+    }
+    ChunkEncoder::encode_all_chunks(table, _encoding_type);
+    ASSERT_EQ(table->get_chunk(ChunkID{0})->ordered_by(), std::make_pair(ColumnID{0}, order_by_mode));
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    const auto expect_matches = [&](const PredicateCondition predicate_condition, const int32_t value,
+                                    const std::optional<int32_t>& value2, const auto& predicate) {
+      const auto scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, value,
+                                          value2 ? std::optional<AllTypeVariant>{*value2} : std::nullopt);
+      scan->execute();
+
+      const auto expected_row_count = std::count_if(values.cbegin(), values.cend(), [&](const auto& row_value) {
+        return row_value && predicate(*row_value);
+      });
+      EXPECT_EQ(scan->get_output()->row_count(), static_cast<size_t>(expected_row_count)) << "value " << value;
+
+      // The matches keep the order of the input
+      for (auto chunk_id = ChunkID{0}; chunk_id < scan->get_output()->chunk_count(); ++chunk_id) {
+        EXPECT_EQ(scan->get_output()->get_chunk(chunk_id)->ordered_by(), std::make_pair(ColumnID{0}, order_by_mode));
+      }
+    };
+
+    for (const auto value : {-5, 0, 4, 5, 11, 91, 95, 200}) {
+      expect_matches(PredicateCondition::Equals, value, std::nullopt, [&](const auto v) { return v == value; });
+      expect_matches(PredicateCondition::NotEquals, value, std::nullopt, [&](const auto v) { return v != value; });
+      expect_matches(PredicateCondition::LessThan, value, std::nullopt, [&](const auto v) { return v < value; });
+      expect_matches(PredicateCondition::LessThanEquals, value, std::nullopt, [&](const auto v) { return v <= value; });
+      expect_matches(PredicateCondition::GreaterThan, value, std::nullopt, [&](const auto v) { return v > value; });
+      expect_matches(PredicateCondition::GreaterThanEquals, value, std::nullopt,
+                     [&](const auto v) { return v >= value; });
+      expect_matches(PredicateCondition::Between, value, value + 6,
+                     [&](const auto v) { return v >= value && v <= value + 6; });
+    }
+  }
+}
+
 TEST_P(OperatorsTableScanTest, GetImpl) {
   /**
    * Test that the correct scanning backend is chosen
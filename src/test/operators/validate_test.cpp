@@ -85,4 +85,20 @@ TEST_F(OperatorsValidateTest, ScanValidate) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, SkipsCleanedUpChunks) {
+  // None of the rows of the first chunk are visible to transactions that start at or after commit id 2
+  _test_table->get_chunk(ChunkID{0})->set_cleanup_commit_id(2u);
+
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(std::make_shared<TransactionContext>(1u, 3u));
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 1u);
+
+  // Older transactions still see the rows
+  auto old_validate = std::make_shared<Validate>(_table_wrapper);
+  old_validate->set_transaction_context(std::make_shared<TransactionContext>(1u, 1u));
+  old_validate->execute();
+  EXPECT_EQ(old_validate->get_output()->row_count(), 4u);
+}
+
 }  // namespace opossum
@@ -43,6 +43,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/union_positions.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/load_table.hpp"
@@ -506,6 +507,41 @@ TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   EXPECT_EQ(*table_scan_op->predicate(), *between_(b, 42, 1337));
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodeCompositeIndexScan) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  std::vector<ColumnID> index_column_ids = {ColumnID{0}, ColumnID{1}};
+  std::vector<ChunkID> index_chunk_ids = {ChunkID{0}, ChunkID{2}};
+  table->get_chunk(index_chunk_ids[0])->create_index<CompositeGroupKeyIndex>(index_column_ids);
+  table->get_chunk(index_chunk_ids[1])->create_index<CompositeGroupKeyIndex>(index_column_ids);
+
+  const auto a = stored_table_node->get_column("a");
+  const auto b = stored_table_node->get_column("b");
+  auto predicate_node = PredicateNode::make(and_(equals_(a, 42), less_than_(b, 1.0f)));
+  predicate_node->set_left_input(stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  /**
+   * Check PQP
+   */
+  const auto union_op = std::dynamic_pointer_cast<UnionPositions>(op);
+  ASSERT_TRUE(union_op);
+
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op->input_left());
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_EQ(get_included_chunk_ids(index_scan_op), index_chunk_ids);
+  EXPECT_EQ(index_scan_op->key_ranges(), (std::vector<IndexKeyRange>{IndexKeyRange{{42}, true, {42, 1.0f}, false}}));
+
+  const auto table_scan_op = std::dynamic_pointer_cast<const TableScan>(op->input_right());
+  ASSERT_TRUE(table_scan_op);
+  EXPECT_EQ(get_excluded_chunk_ids(table_scan_op), index_chunk_ids);
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   if (!IS_DEBUG) return;
 
@@ -22,6 +22,7 @@
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/storage_manager.hpp"
+#include "testing_assert.hpp"
 #include "utils/assert.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -168,4 +169,65 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, IndexScanWithInList) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  // Every value of c occurs about 50 times
+  auto column_statistics = std::vector<std::shared_ptr<const BaseColumnStatistics>>{};
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10, 0, 20));
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10, 0, 20));
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 20'000, 0, 20'000));
+  table->set_table_statistics(
+      std::make_shared<TableStatistics>(TableStatistics{TableType::Data, 1'000'000, column_statistics}));
+
+  auto predicate_node_0 = PredicateNode::make(in_(c, list_(1, 2, 3)));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, CompositeIndexScanCombinesPredicates) {
+  table->create_index<CompositeGroupKeyIndex>({ColumnID{0}, ColumnID{2}});
+
+  auto statistics_mock = generate_mock_statistics(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  auto predicate_node_0 = PredicateNode::make(greater_than_(c, 19'900));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto predicate_node_1 = PredicateNode::make(equals_(a, 5));
+  predicate_node_1->set_left_input(predicate_node_0);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_1);
+
+  // The predicates are combined in the order of the index columns
+  const auto expected_lqp = PredicateNode::make(and_(equals_(a, 5), greater_than_(c, 19'900)), stored_table_node);
+  EXPECT_LQP_EQ(reordered, expected_lqp);
+  EXPECT_EQ(std::static_pointer_cast<PredicateNode>(reordered)->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, PicksMostSelectiveIndex) {
+  table->create_index<GroupKeyIndex>({ColumnID{0}});
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  auto statistics_mock = generate_mock_statistics(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  auto predicate_node_0 = PredicateNode::make(equals_(a, 5));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto predicate_node_1 = PredicateNode::make(greater_than_(c, 19'900));
+  predicate_node_1->set_left_input(predicate_node_0);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_1);
+
+  // The more selective predicate on c is moved to the table
+  EXPECT_EQ(reordered, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->left_input(), predicate_node_1);
+  EXPECT_EQ(predicate_node_1->left_input(), stored_table_node);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::IndexScan);
+}
+
 }  // namespace opossum
@@ -0,0 +1,145 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/redundant_aggregate_rule.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "storage/storage_manager.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class RedundantAggregateRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    // Column b of int_int3 and column a of int_float are unique, column a of int_int3 is not
+    const auto table_a = load_table("src/test/tables/int_int3.tbl");
+    table_a->add_unique_constraint({ColumnID{1}});
+    StorageManager::get().add_table("table_a", table_a);
+
+    const auto table_b = load_table("src/test/tables/int_float.tbl");
+    table_b->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+    StorageManager::get().add_table("table_b", table_b);
+
+    node_a = StoredTableNode::make("table_a");
+    a_a = node_a->get_column("a");
+    a_b = node_a->get_column("b");
+
+    node_b = StoredTableNode::make("table_b");
+    b_a = node_b->get_column("a");
+    b_b = node_b->get_column("b");
+
+    // The constraints only hold for the rows visible to a transaction
+    validate_a = ValidateNode::make(node_a);
+    validate_b = ValidateNode::make(node_b);
+
+    rule = std::make_shared<RedundantAggregateRule>();
+  }
+
+  std::shared_ptr<StoredTableNode> node_a, node_b;
+  std::shared_ptr<ValidateNode> validate_a, validate_b;
+  LQPColumnReference a_a, a_b, b_a, b_b;
+  std::shared_ptr<RedundantAggregateRule> rule;
+};
+
+TEST_F(RedundantAggregateRuleTest, RemoveDistinctOnUniqueColumn) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(a_b), expression_vector(),
+    PredicateNode::make(greater_than_(a_a, 3),
+      validate_a));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(a_b),
+    PredicateNode::make(greater_than_(a_a, 3),
+      validate_a));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(RedundantAggregateRuleTest, RemoveGroupByOnSupersetOfUniqueColumns) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(a_a, a_b), expression_vector(),
+    validate_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(a_a, a_b),
+    validate_a);
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(RedundantAggregateRuleTest, KeepGroupByOnNonUniqueColumn) {
+  const auto input_lqp = AggregateNode::make(expression_vector(a_a), expression_vector(), validate_a);
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, AggregateNode::make(expression_vector(a_a), expression_vector(), validate_a));
+}
+
+TEST_F(RedundantAggregateRuleTest, KeepGroupByOnUnvalidatedTable) {
+  // Without validation, the input contains all versions of the rows, which might share the values of unique columns
+  const auto input_lqp = AggregateNode::make(expression_vector(a_b), expression_vector(), node_a);
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, AggregateNode::make(expression_vector(a_b), expression_vector(), node_a));
+}
+
+TEST_F(RedundantAggregateRuleTest, KeepAggregatesWithAggregateFunctions) {
+  // Removing the AggregateNode would change the data type of SUM(a)
+  const auto input_lqp = AggregateNode::make(expression_vector(a_b), expression_vector(sum_(a_a)), validate_a);
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, AggregateNode::make(expression_vector(a_b), expression_vector(sum_(a_a)), validate_a));
+}
+
+TEST_F(RedundantAggregateRuleTest, RemoveGroupByAboveOneToOneJoin) {
+  // Each row of table_a finds at most one row of table_b, so the join output is unique on b of table_a
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(a_b, b_b), expression_vector(),
+    JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+      validate_a,
+      validate_b));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(a_b, b_b),
+    JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+      validate_a,
+      validate_b));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(RedundantAggregateRuleTest, KeepGroupByAboveOneToManyJoin) {
+  // The join column of table_a is not unique, so rows of table_b might be duplicated
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(b_a), expression_vector(),
+    JoinNode::make(JoinMode::Inner, equals_(b_a, a_a),
+      validate_b,
+      validate_a));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -1,4 +1,5 @@
 #include <memory>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -9,6 +10,7 @@
 #include "operators/get_table.hpp"
 #include "operators/table_scan.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_batch.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
@@ -254,4 +256,89 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   CurrentScheduler::get()->finish();
 }
 
+TEST_F(SchedulerTest, JobBatchWithoutScheduler) {
+  auto executed = std::vector<size_t>(5, 0);
+
+  auto batch = JobBatch{executed.size(), [&](const size_t job_index) { ++executed[job_index]; }};
+  batch.schedule();
+  EXPECT_FALSE(batch.is_done());
+  batch.wait();
+
+  EXPECT_TRUE(batch.is_done());
+  EXPECT_EQ(executed, std::vector<size_t>(5, 1));
+}
+
+TEST_F(SchedulerTest, JobBatchWithScheduler) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto executed = std::vector<std::atomic_uint>(1'000);
+
+  auto batch = JobBatch{executed.size(), [&](const size_t job_index) { ++executed[job_index]; }};
+  batch.schedule_and_wait();
+
+  EXPECT_TRUE(batch.is_done());
+  for (const auto& count : executed) {
+    EXPECT_EQ(count, 1u);
+  }
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, NestedJobBatches) {
+  Topology::use_default_topology(1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  std::atomic_uint counter{0};
+
+  JobBatch{10, [&](const size_t) { JobBatch{3, [&](const size_t) { counter++; }}.schedule_and_wait(); }}
+      .schedule_and_wait();
+
+  EXPECT_EQ(counter, 30u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, EmptyJobBatch) {
+  auto batch = JobBatch{0, [](const size_t) { FAIL(); }};
+  batch.schedule_and_wait();
+  EXPECT_TRUE(batch.is_done());
+}
+
+TEST_F(SchedulerTest, MovedJobBatch) {
+  auto executed = std::vector<size_t>(5, 0);
+
+  auto batch = JobBatch{executed.size(), [&](const size_t job_index) { ++executed[job_index]; }};
+  batch.schedule();
+
+  // The moved-from batch does not wait for the jobs when it is destroyed, the batch it was moved to does
+  {
+    auto moved_batch = std::move(batch);
+    EXPECT_EQ(moved_batch.job_count(), 5u);
+  }
+  EXPECT_EQ(executed, std::vector<size_t>(5, 1));
+}
+
+TEST_F(SchedulerTest, JobBatchWithThrowingJob) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  std::atomic_uint counter{0};
+  auto batch = JobBatch{100, [&](const size_t job_index) {
+                          ++counter;
+                          if (job_index == 42) throw std::logic_error("Job failed");
+                        }};
+  batch.schedule();
+
+  // The other jobs are executed nonetheless and wait() returns once all of them finished
+  EXPECT_THROW(batch.wait(), std::logic_error);
+  EXPECT_TRUE(batch.is_done());
+  EXPECT_EQ(counter, 100u);
+
+  // The exception is only rethrown once
+  EXPECT_NO_THROW(batch.wait());
+
+  CurrentScheduler::get()->finish();
+}
+
 }  // namespace opossum
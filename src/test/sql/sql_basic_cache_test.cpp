@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
@@ -302,4 +306,15 @@ TYPED_TEST(CacheTest, ResizeShrink) {
   ASSERT_EQ(cache.get(3), 6);
 }
 
+TYPED_TEST(CacheTest, Snapshot) {
+  TypeParam cache(3);
+
+  cache.set(1, 2);
+  cache.set(2, 4);
+
+  auto entries = cache.snapshot();
+  std::sort(entries.begin(), entries.end());
+  ASSERT_EQ(entries, (std::vector<std::pair<int, int>>{{1, 2}, {2, 4}}));
+}
+
 }  // namespace opossum
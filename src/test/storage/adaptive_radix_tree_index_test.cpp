@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <random>
 #include <set>
 #include <string>
@@ -236,4 +237,22 @@ TEST_F(AdaptiveRadixTreeIndexTest, DenseVectorOfRandomInts) {
   _search_elements(values);
 }
 
+TEST_F(AdaptiveRadixTreeIndexTest, PartialKeyLowerBound16) {
+  // Unused slots of an ARTNode16 are filled with 255
+  auto partial_keys = std::array<uint8_t, 16>{};
+  partial_keys.fill(255u);
+  std::iota(partial_keys.begin(), partial_keys.begin() + 5, uint8_t{10});
+
+  EXPECT_EQ(partial_key_lower_bound_16(partial_keys, 0u), 0u);
+  EXPECT_EQ(partial_key_lower_bound_16(partial_keys, 10u), 0u);
+  EXPECT_EQ(partial_key_lower_bound_16(partial_keys, 12u), 2u);
+  EXPECT_EQ(partial_key_lower_bound_16(partial_keys, 15u), 5u);
+  EXPECT_EQ(partial_key_lower_bound_16(partial_keys, 255u), 5u);
+
+  // Keys above 127 must be compared as unsigned values
+  std::iota(partial_keys.begin(), partial_keys.end(), uint8_t{120});
+  EXPECT_EQ(partial_key_lower_bound_16(partial_keys, 130u), 10u);
+  EXPECT_EQ(partial_key_lower_bound_16(partial_keys, 200u), 16u);
+}
+
 }  // namespace opossum
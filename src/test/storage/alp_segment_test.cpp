@@ -0,0 +1,166 @@
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/alp_segment.hpp"
+#include "storage/alp_segment/alp_segment_iterable.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageALPSegmentTest : public BaseTest {
+ protected:
+  template <typename T>
+  std::shared_ptr<ValueSegment<T>> _create_value_segment(const std::vector<std::optional<T>>& values) {
+    auto value_segment = std::make_shared<ValueSegment<T>>(true);
+    for (const auto& value : values) {
+      if (value) {
+        value_segment->append(*value);
+      } else {
+        value_segment->append(NULL_VALUE);
+      }
+    }
+    return value_segment;
+  }
+
+  template <typename T>
+  std::shared_ptr<ALPSegment<T>> _encode(const std::shared_ptr<ValueSegment<T>>& value_segment) {
+    return std::dynamic_pointer_cast<ALPSegment<T>>(
+        encode_segment(EncodingType::ALP, data_type_from_type<T>(), value_segment));
+  }
+
+  // Compares bit patterns so that NaN and -0.0 are checked as well
+  template <typename T>
+  static bool _bitwise_equal(const T lhs, const T rhs) {
+    return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+  }
+
+  template <typename T>
+  void _expect_values(const ALPSegment<T>& segment, const std::vector<std::optional<T>>& values) {
+    ASSERT_EQ(segment.size(), values.size());
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      const auto value = segment.get_typed_value(chunk_offset);
+      ASSERT_EQ(value.has_value(), values[chunk_offset].has_value());
+      if (value) {
+        EXPECT_TRUE(_bitwise_equal(*value, *values[chunk_offset])) << "at chunk offset " << chunk_offset;
+      }
+    }
+
+    auto value_count = size_t{0};
+    ALPSegmentIterable<T>{segment}.for_each([&](const auto& value) {
+      const auto& expected_value = values[value_count];
+      EXPECT_EQ(value.is_null(), !expected_value);
+      if (expected_value) {
+        EXPECT_TRUE(_bitwise_equal(value.value(), *expected_value)) << "at chunk offset " << value_count;
+      }
+      ++value_count;
+    });
+    EXPECT_EQ(value_count, values.size());
+  }
+};
+
+TEST_F(StorageALPSegmentTest, SensorValues) {
+  auto values = std::vector<std::optional<double>>{};
+  for (auto value_idx = 0; value_idx < 1'000; ++value_idx) {
+    values.emplace_back(static_cast<double>(2'000 + (value_idx * 37) % 500) / 100.0);
+  }
+
+  const auto value_segment = _create_value_segment(values);
+  const auto segment = _encode(value_segment);
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ(segment->encoding_type(), EncodingType::ALP);
+  _expect_values(*segment, values);
+
+  // With two decimal places, all values are restored from integers between 2000 and 2499
+  EXPECT_EQ(segment->blocks()[0].exponent, 2u);
+  EXPECT_EQ(segment->blocks()[0].base, 2'000);
+  EXPECT_EQ(segment->blocks()[0].bit_width, 9u);
+  EXPECT_TRUE(segment->exception_values().empty());
+  EXPECT_LT(segment->estimate_memory_usage() * 3, value_segment->estimate_memory_usage());
+}
+
+TEST_F(StorageALPSegmentTest, FloatValues) {
+  auto values = std::vector<std::optional<float>>{};
+  for (auto value_idx = 0; value_idx < 300; ++value_idx) {
+    values.emplace_back(static_cast<float>(value_idx % 50) * 0.5f - 10.0f);
+  }
+
+  const auto segment = _encode(_create_value_segment(values));
+  _expect_values(*segment, values);
+
+  EXPECT_EQ(segment->blocks()[0].exponent, 1u);
+  EXPECT_TRUE(segment->exception_values().empty());
+}
+
+TEST_F(StorageALPSegmentTest, Exceptions) {
+  auto values = std::vector<std::optional<double>>{};
+  for (auto value_idx = 0; value_idx < 200; ++value_idx) {
+    values.emplace_back(static_cast<double>(value_idx) * 0.25);
+  }
+
+  values[3] = std::numeric_limits<double>::quiet_NaN();
+  values[4] = std::numeric_limits<double>::infinity();
+  values[5] = -std::numeric_limits<double>::infinity();
+  values[6] = -0.0;
+  values[7] = 1.0 / 3.0;
+  values[8] = std::numeric_limits<double>::max();
+  values[9] = std::numeric_limits<double>::denorm_min();
+  values[150] = 1e12;
+
+  const auto segment = _encode(_create_value_segment(values));
+  _expect_values(*segment, values);
+
+  // The values of the first block cannot be restored from integers, the large value is too far from the others
+  EXPECT_EQ(segment->blocks()[0].exponent, 2u);
+  EXPECT_EQ(segment->exception_values().size(), 8u);
+}
+
+TEST_F(StorageALPSegmentTest, NullValues) {
+  auto values = std::vector<std::optional<double>>(128, std::nullopt);
+  for (auto value_idx = 0; value_idx < 150; ++value_idx) {
+    values.emplace_back(value_idx % 7 == 0 ? std::nullopt : std::optional<double>{-1.5 * value_idx});
+  }
+
+  const auto segment = _encode(_create_value_segment(values));
+  ASSERT_EQ(segment->blocks().size(), 3u);
+  _expect_values(*segment, values);
+
+  EXPECT_EQ(segment->blocks()[0].bit_width, 0u);
+  EXPECT_EQ(segment->blocks()[1].exponent, 1u);
+}
+
+TEST_F(StorageALPSegmentTest, PointAccess) {
+  auto values = std::vector<std::optional<double>>{};
+  for (auto value_idx = 0; value_idx < 500; ++value_idx) {
+    values.emplace_back(value_idx % 11 == 0 ? std::nullopt : std::optional<double>{value_idx / 1000.0});
+  }
+
+  const auto segment = _encode(_create_value_segment(values));
+
+  auto position_filter = std::make_shared<PosList>();
+  for (auto chunk_offset = ChunkOffset{499}; chunk_offset > 0; chunk_offset -= 3) {
+    position_filter->emplace_back(RowID{ChunkID{0}, chunk_offset});
+  }
+  position_filter->guarantee_single_chunk();
+
+  auto position_idx = size_t{0};
+  ALPSegmentIterable<double>{*segment}.for_each(position_filter, [&](const auto& value) {
+    const auto& expected_value = values[(*position_filter)[position_idx].chunk_offset];
+    EXPECT_EQ(value.is_null(), !expected_value);
+    if (expected_value) {
+      EXPECT_EQ(value.value(), *expected_value);
+    }
+    ++position_idx;
+  });
+  EXPECT_EQ(position_idx, position_filter->size());
+}
+
+}  // namespace opossum
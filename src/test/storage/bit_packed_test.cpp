@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/vector_compression/bit_packed/bit_packed_compressor.hpp"
+#include "storage/vector_compression/bit_packed/bit_packed_vector.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BitPackedTest : public BaseTest, public ::testing::WithParamInterface<uint8_t> {
+ protected:
+  void SetUp() override {
+    _bit_size = GetParam();
+    _min = _bit_size == 0u ? 0u : 1ul << (_bit_size - 1u);
+    _max = (1ul << _bit_size) - 1u;
+  }
+
+  pmr_vector<uint32_t> generate_sequence(size_t count) {
+    auto sequence = pmr_vector<uint32_t>(count);
+    auto value = _min;
+    for (auto& elem : sequence) {
+      elem = value;
+
+      value += 1u;
+      if (value > _max) value = _min;
+    }
+
+    return sequence;
+  }
+
+  std::unique_ptr<const BaseCompressedVector> compress(const pmr_vector<uint32_t>& vector) {
+    auto compressor = BitPackedCompressor{};
+    auto compressed_vector = compressor.compress(vector, vector.get_allocator());
+    EXPECT_EQ(compressed_vector->size(), vector.size());
+
+    return compressed_vector;
+  }
+
+  uint8_t _bit_size;
+
+ private:
+  uint32_t _min;
+  uint32_t _max;
+};
+
+auto formatter = [](const ::testing::TestParamInfo<uint8_t> info) {
+  return std::to_string(static_cast<uint32_t>(info.param));
+};
+
+INSTANTIATE_TEST_CASE_P(BitSizes, BitPackedTest, ::testing::Range(uint8_t{0}, uint8_t{33}), formatter);
+
+TEST_P(BitPackedTest, DecompressSequenceUsingIterators) {
+  const auto sequence = generate_sequence(4'200);
+  const auto compressed_sequence_base = compress(sequence);
+
+  auto compressed_sequence = dynamic_cast<const BitPackedVector*>(compressed_sequence_base.get());
+  ASSERT_NE(compressed_sequence, nullptr);
+  EXPECT_EQ(compressed_sequence->bit_width(), _bit_size);
+
+  auto seq_it = sequence.cbegin();
+  auto compressed_seq_it = compressed_sequence->cbegin();
+  const auto compressed_seq_end = compressed_sequence->cend();
+  for (; compressed_seq_it != compressed_seq_end; seq_it++, compressed_seq_it++) {
+    EXPECT_EQ(*seq_it, *compressed_seq_it);
+  }
+  EXPECT_EQ(seq_it, sequence.cend());
+}
+
+TEST_P(BitPackedTest, DecompressSequenceUsingDecompressor) {
+  const auto sequence = generate_sequence(4'200);
+  const auto compressed_sequence = compress(sequence);
+
+  auto decompressor = compressed_sequence->create_base_decompressor();
+
+  auto seq_it = sequence.cbegin();
+  const auto seq_end = sequence.cend();
+  auto index = 0u;
+  for (; seq_it != seq_end; seq_it++, index++) {
+    EXPECT_EQ(*seq_it, decompressor->get(index));
+  }
+}
+
+TEST_P(BitPackedTest, RandomAccessUsingDecompressor) {
+  const auto sequence = generate_sequence(1'000);
+  const auto compressed_sequence = compress(sequence);
+
+  auto indices = std::vector<size_t>(sequence.size());
+  std::iota(indices.begin(), indices.end(), size_t{0});
+  std::shuffle(indices.begin(), indices.end(), std::mt19937{});
+
+  auto decompressor = compressed_sequence->create_base_decompressor();
+  for (const auto index : indices) {
+    EXPECT_EQ(sequence[index], decompressor->get(index));
+  }
+}
+
+class BitPackedCompressorTest : public BaseTest {};
+
+TEST_F(BitPackedCompressorTest, UsesBitWidthOfMaxValue) {
+  // 2000 distinct values need 11 bits instead of the 16 bits of FixedSizeByteAligned
+  auto sequence = pmr_vector<uint32_t>(10'000);
+  for (auto index = size_t{0}; index < sequence.size(); ++index) {
+    sequence[index] = static_cast<uint32_t>((index * 7) % 2'000);
+  }
+
+  const auto bit_packed = compress_vector(sequence, VectorCompressionType::BitPacked, {}, {1'999});
+  const auto byte_aligned = compress_vector(sequence, VectorCompressionType::FixedSizeByteAligned, {}, {1'999});
+
+  EXPECT_EQ(dynamic_cast<const BitPackedVector&>(*bit_packed).bit_width(), 11u);
+  EXPECT_LT(bit_packed->data_size(), byte_aligned->data_size() * 3 / 4);
+}
+
+}  // namespace opossum
@@ -11,6 +11,8 @@
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index_impl.hpp"
+#include "storage/segment_encoding_utils.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -65,4 +67,31 @@ TEST_F(BTreeIndexTest, IndexProbes) {
   EXPECT_EQ(index->upper_bound({"inbox"}) - begin, 8);
 }
 
+TEST_F(BTreeIndexTest, DictionarySegment) {
+  auto nullable_values = std::vector<std::string>{"hotel", "delta", "", "delta", "apple"};
+  auto null_values = std::vector<bool>{false, false, true, false, false};
+  const auto value_segment = std::make_shared<ValueSegment<std::string>>(nullable_values, null_values);
+  const auto dictionary_segment = encode_segment(EncodingType::Dictionary, DataType::String, value_segment);
+
+  const auto dictionary_index =
+      std::make_shared<BTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({dictionary_segment}));
+
+  // The NULL is not indexed and rows with the same value are ordered by their chunk offset
+  EXPECT_EQ(std::vector<ChunkOffset>(dictionary_index->cbegin(), dictionary_index->cend()),
+            (std::vector<ChunkOffset>{4, 1, 3, 0}));
+  EXPECT_EQ(dictionary_index->lower_bound({"delta"}) - dictionary_index->cbegin(), 1);
+  EXPECT_EQ(dictionary_index->upper_bound({"delta"}) - dictionary_index->cbegin(), 3);
+  EXPECT_EQ(dictionary_index->lower_bound({"zulu"}), dictionary_index->cend());
+}
+
+TEST_F(BTreeIndexTest, BulkLoadFromSortedValues) {
+  const auto impl = BTreeIndexImpl<int32_t>{{1, 1, 4, 7}, {3, 0, 2, 1}};
+
+  EXPECT_EQ(std::vector<ChunkOffset>(impl.cbegin(), impl.cend()), (std::vector<ChunkOffset>{3, 0, 2, 1}));
+  EXPECT_EQ(impl.lower_bound(1) - impl.cbegin(), 0);
+  EXPECT_EQ(impl.upper_bound(1) - impl.cbegin(), 2);
+  EXPECT_EQ(impl.lower_bound(5) - impl.cbegin(), 3);
+  EXPECT_EQ(impl.upper_bound(7), impl.cend());
+}
+
 }  // namespace opossum
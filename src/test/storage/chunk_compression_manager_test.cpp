@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk_compression_manager.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ChunkCompressionManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunk 0 holds 12345 and 123, chunk 1 holds 1234
+    _table = load_table("src/test/tables/int_float.tbl", 2);
+    StorageManager::get().add_table("table_a", _table);
+
+    _table->create_index<GroupKeyIndex>({ColumnID{0}});
+  }
+
+  void _insert_into_table_a(const std::shared_ptr<TransactionContext>& context) {
+    auto table_to_insert = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    table_to_insert->execute();
+
+    auto insert = std::make_shared<Insert>("table_a", table_to_insert);
+    insert->set_transaction_context(context);
+    insert->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkCompressionManagerTest, CompressesCompletedChunks) {
+  auto options = ChunkCompressionManager::Options{};
+  options.segment_encoding_spec = SegmentEncodingSpec{EncodingType::RunLength};
+  ChunkCompressionManager chunk_compression_manager{options};
+
+  // The last chunk is not full
+  const auto compressed_chunk_ids = chunk_compression_manager.run();
+  ASSERT_EQ(compressed_chunk_ids.size(), 1u);
+  EXPECT_EQ(compressed_chunk_ids.at("table_a"), (std::vector<ChunkID>{ChunkID{0}}));
+  EXPECT_TRUE(chunk_compression_manager.run().empty());
+
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  EXPECT_FALSE(chunk->is_mutable());
+  EXPECT_NE(chunk->statistics(), nullptr);
+  EXPECT_TRUE(chunk->delta_indexes().empty());
+  EXPECT_NE(chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}), nullptr);
+
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    const auto segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(column_id));
+    ASSERT_NE(segment, nullptr);
+    EXPECT_EQ(segment->encoding_type(), EncodingType::RunLength);
+  }
+
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_EQ(chunk_compression_manager.compressed_chunk_count(), 1u);
+}
+
+TEST_F(ChunkCompressionManagerTest, WaitsForInsertsToFinish) {
+  const auto table_index = _table->create_table_index({ColumnID{0}});
+  ChunkCompressionManager chunk_compression_manager{};
+  chunk_compression_manager.run();
+
+  // 12345 is inserted into chunk 1, 123 and 1234 into the new chunk 2. Both chunks are full, but the insert is not
+  // committed yet.
+  auto context = TransactionManager::get().new_transaction_context();
+  _insert_into_table_a(context);
+  ASSERT_EQ(_table->chunk_count(), 3u);
+  EXPECT_TRUE(chunk_compression_manager.run().empty());
+
+  context->commit();
+  const auto compressed_chunk_ids = chunk_compression_manager.run();
+  ASSERT_EQ(compressed_chunk_ids.size(), 1u);
+  EXPECT_EQ(compressed_chunk_ids.at("table_a"), (std::vector<ChunkID>{ChunkID{1}, ChunkID{2}}));
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_FALSE(_table->get_chunk(chunk_id)->is_mutable());
+    EXPECT_NE(_table->get_chunk(chunk_id)->statistics(), nullptr);
+  }
+
+  // The RowIDs did not change, so the TableIndex is still valid
+  const auto row_ids = table_index->lookup(PredicateCondition::Equals, {123});
+  auto sorted_row_ids = std::vector<RowID>{row_ids.cbegin(), row_ids.cend()};
+  std::sort(sorted_row_ids.begin(), sorted_row_ids.end());
+  EXPECT_EQ(sorted_row_ids, (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{2}, ChunkOffset{0}}}));
+}
+
+TEST_F(ChunkCompressionManagerTest, RunsInBackground) {
+  auto options = ChunkCompressionManager::Options{};
+  options.interval = std::chrono::milliseconds(10);
+  ChunkCompressionManager chunk_compression_manager{options};
+  chunk_compression_manager.resume();
+
+  for (auto attempt = 0; attempt < 500 && chunk_compression_manager.compressed_chunk_count() == 0; ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  chunk_compression_manager.pause();
+
+  EXPECT_EQ(chunk_compression_manager.compressed_chunk_count(), 1u);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->is_mutable());
+}
+
+}  // namespace opossum
@@ -1,12 +1,16 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "all_type_variant.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/base_encoded_segment.hpp"
 #include "storage/base_value_segment.hpp"
 #include "storage/chunk.hpp"
@@ -146,4 +150,58 @@ TEST_F(ChunkEncoderTest, EncodeMultipleChunksUsingSameEncoding) {
   verify_encoding(_table->get_chunk(ChunkID{1u}), unencoded_chunk_spec);
 }
 
+TEST_F(ChunkEncoderTest, FindsSortedColumn) {
+  // Column 0 is unsorted, column 1 is sorted descendingly with NULLs first, and column 2 holds a single value
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::Float, true);
+  column_definitions.emplace_back("c", DataType::Int);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 5);
+  table->append({3, NULL_VALUE, 7});
+  table->append({1, 4.5f, 7});
+  table->append({2, 4.5f, 7});
+  table->append({5, 2.0f, 7});
+
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->ordered_by(), std::make_pair(ColumnID{1}, OrderByMode::Descending));
+
+  // A NULL after the first value breaks the order
+  const auto unsorted_table = std::make_shared<Table>(column_definitions, TableType::Data, 5);
+  unsorted_table->append({1, 4.5f, 7});
+  unsorted_table->append({2, NULL_VALUE, 7});
+  unsorted_table->append({3, 2.0f, 7});
+
+  ChunkEncoder::encode_all_chunks(unsorted_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_EQ(unsorted_table->get_chunk(ChunkID{0})->ordered_by(), std::make_pair(ColumnID{0}, OrderByMode::Ascending));
+
+  // The order set by the producer of a chunk is kept
+  _table->get_chunk(ChunkID{0})->set_ordered_by(std::make_pair(ColumnID{2}, OrderByMode::AscendingNullsLast));
+  ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Unencoded});
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->ordered_by(), std::make_pair(ColumnID{2}, OrderByMode::AscendingNullsLast));
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->ordered_by(), std::make_pair(ColumnID{0}, OrderByMode::Ascending));
+}
+
+TEST_F(ChunkEncoderTest, EncodeWholeTableWithScheduler) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto chunk_encoding_spec =
+      ChunkEncodingSpec{{EncodingType::Dictionary}, {EncodingType::RunLength}, {EncodingType::FrameOfReference}};
+  ChunkEncoder::encode_all_chunks(_table, chunk_encoding_spec);
+
+  for (auto chunk_id = ChunkID{0u}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    verify_encoding(chunk, chunk_encoding_spec);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_NE(chunk->statistics(), nullptr);
+  }
+
+  // The values did not change
+  for (auto row_id = 0u; row_id < _table->row_count(); ++row_id) {
+    for (auto column_id = ColumnID{0u}; column_id < _table->column_count(); ++column_id) {
+      EXPECT_EQ(_table->get_value<int32_t>(column_id, row_id), static_cast<int32_t>(row_id));
+    }
+  }
+}
+
 }  // namespace opossum
@@ -1,4 +1,5 @@
 #include <memory>
+#include <utility>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
@@ -69,6 +70,18 @@ TEST_F(StorageChunkTest, RetrieveSegment) {
   EXPECT_EQ(base_segment->size(), 4u);
 }
 
+TEST_F(StorageChunkTest, OrderedBy) {
+  chunk = std::make_shared<Chunk>(Segments({vs_int, vs_str}));
+  EXPECT_FALSE(chunk->ordered_by());
+
+  chunk->set_ordered_by(std::make_pair(ColumnID{1}, OrderByMode::Descending));
+  EXPECT_EQ(chunk->ordered_by(), std::make_pair(ColumnID{1}, OrderByMode::Descending));
+
+  // Appending a row may break the order
+  chunk->append({2, "two"});
+  EXPECT_FALSE(chunk->ordered_by());
+}
+
 TEST_F(StorageChunkTest, UnknownColumnType) {
   // Exception will only be thrown in debug builds
   if (IS_DEBUG) {
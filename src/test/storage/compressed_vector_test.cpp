@@ -78,7 +78,8 @@ auto formatter = [](const ::testing::TestParamInfo<VectorCompressionType> info)
 
 INSTANTIATE_TEST_CASE_P(VectorCompressionTypes, CompressedVectorTest,
                         ::testing::Values(VectorCompressionType::SimdBp128,
-                                          VectorCompressionType::FixedSizeByteAligned),
+                                          VectorCompressionType::FixedSizeByteAligned,
+                                          VectorCompressionType::BitPacked),
                         formatter);
 
 TEST_P(CompressedVectorTest, DecodeIncreasingSequenceUsingIterators) {
@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <optional>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/index/adaptive_radix_tree/concurrent_adaptive_radix_tree.hpp"
+
+namespace opossum {
+
+class ConcurrentAdaptiveRadixTreeTest : public BaseTest {
+ protected:
+  using Entries = std::vector<std::pair<uint64_t, uint64_t>>;
+
+  ConcurrentAdaptiveRadixTree _tree;
+};
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, InsertAndLookup) {
+  EXPECT_TRUE(_tree.insert(17u, 1u));
+  EXPECT_TRUE(_tree.insert(0x0102030405060708u, 2u));
+  EXPECT_TRUE(_tree.insert(0x0102030405060709u, 3u));
+  EXPECT_EQ(_tree.size(), 3u);
+
+  // Existing keys keep their value
+  EXPECT_FALSE(_tree.insert(17u, 4u));
+  EXPECT_EQ(_tree.size(), 3u);
+
+  EXPECT_EQ(_tree.lookup(17u), 1u);
+  EXPECT_EQ(_tree.lookup(0x0102030405060708u), 2u);
+  EXPECT_EQ(_tree.lookup(0x0102030405060709u), 3u);
+  EXPECT_EQ(_tree.lookup(18u), std::nullopt);
+  EXPECT_EQ(_tree.lookup(0x0102030405060700u), std::nullopt);
+  EXPECT_EQ(_tree.lookup(0x0102000405060708u), std::nullopt);
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, Remove) {
+  for (auto key = uint64_t{0}; key < 10; ++key) {
+    _tree.insert(key << 8, key);
+  }
+
+  EXPECT_TRUE(_tree.remove(3u << 8));
+  EXPECT_FALSE(_tree.remove(3u << 8));
+  EXPECT_FALSE(_tree.remove(3u));
+  EXPECT_EQ(_tree.size(), 9u);
+  EXPECT_EQ(_tree.lookup(3u << 8), std::nullopt);
+  EXPECT_EQ(_tree.lookup(4u << 8), 4u);
+
+  // Removing keys until a single key remains below the inner nodes collapses them
+  for (auto key = uint64_t{0}; key < 9; ++key) {
+    _tree.remove(key << 8);
+  }
+  EXPECT_EQ(_tree.size(), 1u);
+  EXPECT_EQ(_tree.lookup(9u << 8), 9u);
+  EXPECT_EQ(_tree.range(0u, 1000000u), (Entries{{9u << 8, 9u}}));
+
+  EXPECT_TRUE(_tree.insert(3u << 8, 3u));
+  EXPECT_EQ(_tree.lookup(3u << 8), 3u);
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, Range) {
+  auto expected_entries = Entries{};
+  for (auto key = uint64_t{0}; key < 1000; ++key) {
+    _tree.insert(key * 1000, key);
+    if (key * 1000 >= 1500 && key * 1000 <= 300000) expected_entries.emplace_back(key * 1000, key);
+  }
+
+  EXPECT_EQ(_tree.range(1500u, 300000u), expected_entries);
+  EXPECT_EQ(_tree.range(2000u, 2000u), (Entries{{2000u, 2u}}));
+  EXPECT_TRUE(_tree.range(2001u, 2999u).empty());
+  EXPECT_TRUE(_tree.range(3000u, 2000u).empty());
+  EXPECT_EQ(_tree.range(0u, std::numeric_limits<uint64_t>::max()).size(), 1000u);
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, MatchesMap) {
+  // Keys with long common prefixes and a few random ones exercise prefix splits and all node sizes
+  auto map = std::map<uint64_t, uint64_t>{};
+  auto random_engine = std::mt19937_64{42};
+
+  for (auto operation = uint64_t{0}; operation < 50'000; ++operation) {
+    const auto key = operation % 3 == 0 ? random_engine() : (random_engine() % 5'000) << (random_engine() % 4 * 8);
+    switch (random_engine() % 3) {
+      case 0:
+        EXPECT_EQ(_tree.insert(key, operation), map.emplace(key, operation).second);
+        break;
+      case 1:
+        EXPECT_EQ(_tree.remove(key), map.erase(key) == 1);
+        break;
+      default:
+        const auto iter = map.find(key);
+        EXPECT_EQ(_tree.lookup(key), iter == map.end() ? std::nullopt : std::optional<uint64_t>{iter->second});
+    }
+  }
+
+  EXPECT_EQ(_tree.size(), map.size());
+  EXPECT_EQ(_tree.range(0u, std::numeric_limits<uint64_t>::max()), Entries(map.cbegin(), map.cend()));
+  EXPECT_EQ(_tree.range(1'000u, 1'000'000u), Entries(map.lower_bound(1'000u), map.upper_bound(1'000'000u)));
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, ConcurrentModifications) {
+  constexpr auto THREAD_COUNT = uint64_t{8};
+  constexpr auto KEY_COUNT = uint64_t{20'000};
+
+  // Each thread inserts and removes its own keys while looking up those of the others
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = uint64_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto round = 0; round < 3; ++round) {
+        for (auto value = thread_id; value < KEY_COUNT; value += THREAD_COUNT) {
+          ASSERT_TRUE(_tree.insert(value * 7919, value));
+        }
+
+        for (auto value = uint64_t{0}; value < KEY_COUNT; value += 97) {
+          const auto lookup_result = _tree.lookup(value * 7919);
+          if (lookup_result) {
+            ASSERT_EQ(*lookup_result, value);
+          }
+        }
+
+        const auto entries = _tree.range(1'000u, 10'000'000u);
+        ASSERT_TRUE(std::is_sorted(entries.cbegin(), entries.cend()));
+
+        if (round == 2) break;
+        for (auto value = thread_id; value < KEY_COUNT; value += THREAD_COUNT) {
+          ASSERT_TRUE(_tree.remove(value * 7919));
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(_tree.size(), KEY_COUNT);
+  for (auto value = uint64_t{0}; value < KEY_COUNT; ++value) {
+    EXPECT_EQ(_tree.lookup(value * 7919), value);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/delta_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+
+namespace opossum {
+
+class DeltaIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunk 0 holds 12345 and 123, chunk 1 holds 1234
+    _table = load_table("src/test/tables/int_float.tbl", 2);
+    StorageManager::get().add_table("table_a", _table);
+
+    _table->create_index<GroupKeyIndex>({ColumnID{0}});
+  }
+
+  std::shared_ptr<Insert> _insert_into_table_a(const std::shared_ptr<TransactionContext>& context) {
+    auto table_to_insert = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    table_to_insert->execute();
+
+    auto insert = std::make_shared<Insert>("table_a", table_to_insert);
+    insert->set_transaction_context(context);
+    insert->execute();
+    return insert;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(DeltaIndexTest, CreatedForMutableChunks) {
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  EXPECT_EQ(chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}), nullptr);
+
+  const auto delta_index = chunk->get_delta_index({ColumnID{0}});
+  ASSERT_NE(delta_index, nullptr);
+  EXPECT_EQ(delta_index->merge_type(), SegmentIndexType::GroupKey);
+  EXPECT_EQ(delta_index->size(), 2u);
+  EXPECT_EQ(delta_index->lookup(PredicateCondition::Equals, {123}), (std::vector<ChunkOffset>{1}));
+  EXPECT_EQ(delta_index->lookup(PredicateCondition::GreaterThan, {123}), (std::vector<ChunkOffset>{0}));
+  EXPECT_EQ(chunk->get_delta_index({ColumnID{1}}), nullptr);
+}
+
+TEST_F(DeltaIndexTest, MaintainedByAppend) {
+  _table->append({7, 1.0f});
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->get_delta_index({ColumnID{0}})->size(), 2u);
+
+  // The new chunk gets a DeltaIndex, too
+  _table->append({7, 2.0f});
+  const auto delta_index = _table->get_chunk(ChunkID{2})->get_delta_index({ColumnID{0}});
+  ASSERT_NE(delta_index, nullptr);
+  EXPECT_EQ(delta_index->lookup(PredicateCondition::Equals, {7}), (std::vector<ChunkOffset>{0}));
+}
+
+TEST_F(DeltaIndexTest, MaintainedByInsertAndRollback) {
+  auto context = TransactionManager::get().new_transaction_context();
+  _insert_into_table_a(context);
+
+  // 12345 is inserted into chunk 1, 123 and 1234 into the new chunk 2
+  ASSERT_EQ(_table->chunk_count(), 3u);
+  const auto delta_index_1 = _table->get_chunk(ChunkID{1})->get_delta_index({ColumnID{0}});
+  const auto delta_index_2 = _table->get_chunk(ChunkID{2})->get_delta_index({ColumnID{0}});
+  ASSERT_NE(delta_index_2, nullptr);
+  EXPECT_EQ(delta_index_1->lookup(PredicateCondition::Equals, {12345}), (std::vector<ChunkOffset>{1}));
+  EXPECT_EQ(delta_index_2->lookup(PredicateCondition::LessThan, {2000}), (std::vector<ChunkOffset>{0, 1}));
+
+  context->rollback();
+
+  EXPECT_EQ(delta_index_1->size(), 1u);
+  EXPECT_TRUE(delta_index_1->lookup(PredicateCondition::Equals, {12345}).empty());
+  EXPECT_EQ(delta_index_2->size(), 0u);
+}
+
+TEST_F(DeltaIndexTest, CreatedDuringConcurrentInserts) {
+  // Rows that are allocated but not yet written when the index is created have to be indexed exactly once, with the
+  // values that are inserted
+  auto insert_thread = std::thread{[&]() {
+    for (auto insert_idx = 0; insert_idx < 200; ++insert_idx) {
+      auto context = TransactionManager::get().new_transaction_context();
+      _insert_into_table_a(context);
+      context->commit();
+    }
+  }};
+  _table->create_index<GroupKeyIndex>({ColumnID{1}});
+  insert_thread.join();
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    const auto delta_index = chunk->get_delta_index({ColumnID{1}});
+    ASSERT_NE(delta_index, nullptr);
+    EXPECT_EQ(delta_index->size(), chunk->size());
+
+    const auto& segment = *chunk->get_segment(ColumnID{1});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      const auto matches = delta_index->lookup(PredicateCondition::Equals, {segment[chunk_offset]});
+      EXPECT_NE(std::find(matches.cbegin(), matches.cend(), chunk_offset), matches.cend());
+    }
+  }
+}
+
+TEST_F(DeltaIndexTest, IndexScanOnMutableChunks) {
+  auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  const auto values = std::vector<AllTypeVariant>{1234};
+  auto index_scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::GroupKey, column_ids,
+                                                PredicateCondition::GreaterThanEquals, values);
+  index_scan->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(index_scan->get_output(), load_table("src/test/tables/int_float_filtered2.tbl", 1));
+}
+
+TEST_F(DeltaIndexTest, MergedOnCompression) {
+  auto context = TransactionManager::get().new_transaction_context();
+  _insert_into_table_a(context);
+  context->commit();
+
+  auto compression = std::make_unique<ChunkCompressionTask>("table_a", std::vector<ChunkID>{ChunkID{0}, ChunkID{1}});
+  compression->execute();
+
+  for (const auto chunk_id : {ChunkID{0}, ChunkID{1}}) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_TRUE(chunk->delta_indexes().empty());
+    EXPECT_NE(chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}), nullptr);
+  }
+
+  // The last chunk is not full and still mutable
+  EXPECT_EQ(_table->get_chunk(ChunkID{2})->delta_indexes().size(), 1u);
+}
+
+TEST_F(DeltaIndexTest, MergedByChunkEncoder) {
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  ChunkEncoder::encode_chunk(chunk, _table->column_data_types());
+
+  EXPECT_TRUE(chunk->delta_indexes().empty());
+  const auto index = chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}});
+  ASSERT_NE(index, nullptr);
+  EXPECT_EQ(std::vector<ChunkOffset>(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{1, 0}));
+}
+
+}  // namespace opossum
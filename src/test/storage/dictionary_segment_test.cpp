@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -121,6 +122,35 @@ TEST_F(StorageDictionarySegmentTest, CompressNullableSegmentInt) {
   EXPECT_TRUE(variant_is_null((*dict_segment)[4]));
 }
 
+TEST_F(StorageDictionarySegmentTest, CompressSegmentWithManyDuplicates) {
+  // With many duplicates, the dictionary is built with a hash map
+  vs_str = std::make_shared<ValueSegment<std::string>>(true);
+  for (auto value = 0; value < 1'000; ++value) {
+    if (value % 10 == 0) {
+      vs_str->append(NULL_VALUE);
+    } else {
+      vs_str->append(std::string{"value_"} + std::to_string(value % 7));
+    }
+  }
+
+  auto segment = encode_segment(EncodingType::Dictionary, DataType::String, vs_str);
+  auto dict_segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(segment);
+
+  EXPECT_EQ(dict_segment->size(), 1'000u);
+  EXPECT_EQ(dict_segment->unique_values_count(), 7u);
+
+  auto dict = dict_segment->dictionary();
+  EXPECT_TRUE(std::is_sorted(dict->cbegin(), dict->cend()));
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1'000; ++chunk_offset) {
+    if (chunk_offset % 10 == 0) {
+      EXPECT_TRUE(variant_is_null((*dict_segment)[chunk_offset]));
+    } else {
+      EXPECT_EQ((*dict_segment)[chunk_offset], (*vs_str)[chunk_offset]);
+    }
+  }
+}
+
 TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
   for (int i = 0; i <= 10; i += 2) vs_int->append(i);
 
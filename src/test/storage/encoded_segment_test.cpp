@@ -123,9 +123,12 @@ INSTANTIATE_TEST_CASE_P(
     SegmentEncodingSpecs, EncodedSegmentTest,
     ::testing::Values(SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128},
                       SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned},
+                      SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacked},
                       SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::SimdBp128},
                       SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::FixedSizeByteAligned},
-                      SegmentEncodingSpec{EncodingType::RunLength}),
+                      SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::BitPacked},
+                      SegmentEncodingSpec{EncodingType::RunLength},
+                      SegmentEncodingSpec{EncodingType::PFORDelta}),
     formatter);
 
 TEST_P(EncodedSegmentTest, SequentiallyReadNotNullableIntSegment) {
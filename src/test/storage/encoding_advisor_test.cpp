@@ -0,0 +1,177 @@
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk_access_counter.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class EncodingAdvisorTest : public BaseTest {
+ protected:
+  template <typename T, typename Functor>
+  static std::shared_ptr<ValueSegment<T>> _create_segment(const size_t size, const Functor& value_for_row) {
+    auto values = pmr_concurrent_vector<T>{};
+    for (auto row_idx = size_t{0}; row_idx < size; ++row_idx) {
+      values.push_back(value_for_row(row_idx));
+    }
+    return std::make_shared<ValueSegment<T>>(std::move(values));
+  }
+
+  // Values with long runs
+  static std::shared_ptr<ValueSegment<int32_t>> _create_run_segment() {
+    return _create_segment<int32_t>(10'000, [](const size_t row_idx) { return static_cast<int32_t>(row_idx / 1'000); });
+  }
+
+  // Distinct values with two decimal places
+  static std::shared_ptr<ValueSegment<double>> _create_price_segment() {
+    return _create_segment<double>(10'000, [](const size_t row_idx) {
+      return static_cast<double>(row_idx * 7'919 % 100'000) / 100.0;
+    });
+  }
+};
+
+TEST_F(EncodingAdvisorTest, EstimateCandidates) {
+  const auto segment = _create_run_segment();
+  const auto candidates = EncodingAdvisor{}.estimate_candidates(segment, DataType::Int, 0.0f);
+
+  // Unencoded, RunLength, PFORDelta, and Dictionary and FrameOfReference with each of the three vector compressions
+  ASSERT_EQ(candidates.size(), 9u);
+  for (auto candidate_idx = size_t{1}; candidate_idx < candidates.size(); ++candidate_idx) {
+    EXPECT_LE(candidates[candidate_idx - 1].cost, candidates[candidate_idx].cost);
+  }
+
+  for (const auto& candidate : candidates) {
+    if (candidate.spec.encoding_type == EncodingType::Unencoded) {
+      // The sample's memory usage extrapolated to the segment's size
+      EXPECT_NEAR(candidate.memory_usage, segment->estimate_memory_usage(), segment->estimate_memory_usage() / 100);
+      EXPECT_FLOAT_EQ(candidate.decode_cost, 1.0f);
+    }
+  }
+}
+
+TEST_F(EncodingAdvisorTest, ChooseBySegmentContent) {
+  const auto advisor = EncodingAdvisor{};
+
+  EXPECT_EQ(advisor.advise_segment(_create_run_segment(), DataType::Int, 0.0f).encoding_type, EncodingType::RunLength);
+  EXPECT_EQ(advisor.advise_segment(_create_price_segment(), DataType::Double, 0.0f).encoding_type, EncodingType::ALP);
+
+  const auto timestamp_segment = _create_segment<int64_t>(10'000, [](const size_t row_idx) {
+    return static_cast<int64_t>(1'500'000'000'000 + row_idx * 1'000 + row_idx % 7);
+  });
+  EXPECT_EQ(advisor.advise_segment(timestamp_segment, DataType::Long, 0.0f).encoding_type, EncodingType::PFORDelta);
+
+  // Values with many digits cannot be compressed
+  const auto random_segment =
+      _create_segment<double>(10'000, [](const size_t row_idx) { return std::sqrt(static_cast<double>(row_idx)); });
+  EXPECT_EQ(advisor.advise_segment(random_segment, DataType::Double, 0.0f).encoding_type, EncodingType::Unencoded);
+}
+
+TEST_F(EncodingAdvisorTest, SmallSampleSize) {
+  auto options = EncodingAdvisor::Options{};
+  options.sample_size = 100;
+  options.sample_stretch_count = 3;
+  const auto advisor = EncodingAdvisor{options};
+
+  const auto segment = _create_run_segment();
+  const auto candidates = advisor.estimate_candidates(segment, DataType::Int, 0.0f);
+  EXPECT_EQ(candidates.front().spec.encoding_type, EncodingType::RunLength);
+
+  // The memory usage is extrapolated from the sample of 99 values
+  for (const auto& candidate : candidates) {
+    if (candidate.spec.encoding_type == EncodingType::Unencoded) {
+      EXPECT_GT(candidate.memory_usage, segment->size() * sizeof(int32_t));
+    }
+  }
+
+  EXPECT_EQ(advisor.advise_segment(std::make_shared<ValueSegment<int32_t>>(), DataType::Int, 0.0f).encoding_type,
+            EncodingType::Dictionary);
+}
+
+TEST_F(EncodingAdvisorTest, AccessedChunksDecodeFaster) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Double, false);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  // The first chunk is never accessed, the second one frequently
+  table->append_chunk({_create_price_segment()});
+
+  const auto access_counter = std::make_shared<ChunkAccessCounter>(PolymorphicAllocator<uint64_t>{});
+  access_counter->process();
+  access_counter->increment(1'000);
+  access_counter->process();
+  table->append_chunk({_create_price_segment()}, std::nullopt, access_counter);
+
+  auto options = EncodingAdvisor::Options{};
+  options.access_decode_weight = 100.0f;
+  const auto advisor = EncodingAdvisor{options};
+
+  const auto chunk_encoding_specs = advisor.advise_chunks(*table, {ChunkID{0}, ChunkID{1}});
+  ASSERT_EQ(chunk_encoding_specs.size(), 2u);
+  EXPECT_EQ(chunk_encoding_specs.at(ChunkID{0}).at(0).encoding_type, EncodingType::ALP);
+  EXPECT_EQ(chunk_encoding_specs.at(ChunkID{1}).at(0).encoding_type, EncodingType::Unencoded);
+}
+
+TEST_F(EncodingAdvisorTest, EncodeAllChunks) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::Double, false);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  table->append_chunk({_create_run_segment(), _create_price_segment()});
+
+  ChunkEncoder::encode_all_chunks(table, EncodingAdvisor{});
+
+  const auto chunk = table->get_chunk(ChunkID{0});
+  const auto segment_a = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(ColumnID{0}));
+  const auto segment_b = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment_a && segment_b);
+  EXPECT_EQ(segment_a->encoding_type(), EncodingType::RunLength);
+  EXPECT_EQ(segment_b->encoding_type(), EncodingType::ALP);
+  EXPECT_FALSE(chunk->is_mutable());
+}
+
+TEST_F(EncodingAdvisorTest, EncodeIndexedChunks) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::Double, false);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  table->append_chunk({_create_run_segment(), _create_price_segment()});
+
+  // The DeltaIndexes of the mutable chunk are merged into indexes that need dictionary segments
+  table->create_index<GroupKeyIndex>({ColumnID{0}});
+  table->create_index<CompositeGroupKeyIndex>({ColumnID{0}, ColumnID{1}});
+
+  const auto chunk = table->get_chunk(ChunkID{0});
+  const auto value_segment = std::dynamic_pointer_cast<const BaseValueSegment>(chunk->get_segment(ColumnID{1}));
+  const auto candidates = EncodingAdvisor{}.estimate_candidates(value_segment, DataType::Double, 0.0f,
+                                                                {SegmentIndexType::CompositeGroupKey});
+  ASSERT_FALSE(candidates.empty());
+  for (const auto& candidate : candidates) {
+    EXPECT_EQ(candidate.spec.encoding_type, EncodingType::Dictionary);
+    EXPECT_EQ(candidate.spec.vector_compression_type, VectorCompressionType::FixedSizeByteAligned);
+  }
+
+  ChunkEncoder::encode_all_chunks(table, EncodingAdvisor{});
+
+  for (const auto column_id : {ColumnID{0}, ColumnID{1}}) {
+    const auto segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(column_id));
+    ASSERT_TRUE(segment);
+    EXPECT_EQ(segment->encoding_type(), EncodingType::Dictionary);
+  }
+  EXPECT_TRUE(chunk->delta_indexes().empty());
+  EXPECT_NE(chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}), nullptr);
+  EXPECT_NE(chunk->get_index(SegmentIndexType::CompositeGroupKey, std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}),
+            nullptr);
+}
+
+}  // namespace opossum
@@ -0,0 +1,181 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_segment/dictionary_segment_iterable.hpp"
+#include "storage/front_coded_dictionary_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrontCodedDictionarySegmentTest : public BaseTest {
+ protected:
+  // Sorted and unique URL-like strings with long common prefixes, spanning several blocks
+  static std::vector<std::string> _urls(const size_t count) {
+    auto urls = std::vector<std::string>{};
+    for (auto url_idx = size_t{0}; url_idx < count; ++url_idx) {
+      auto number = std::to_string(url_idx);
+      urls.emplace_back("https://www.example.com/products/" + std::string(5 - number.size(), '0') + number);
+    }
+    return urls;
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> vs_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, CompressSegmentString) {
+  vs_str->append("Bill");
+  vs_str->append("Steve");
+  vs_str->append("Alexander");
+  vs_str->append("Steve");
+  vs_str->append("Hasso");
+  vs_str->append("Bill");
+
+  auto segment = encode_segment(EncodingType::FrontCodedDictionary, DataType::String, vs_str);
+  auto dict_segment = std::dynamic_pointer_cast<FrontCodedDictionarySegment<std::string>>(segment);
+  ASSERT_NE(dict_segment, nullptr);
+
+  // Test attribute_vector size
+  EXPECT_EQ(dict_segment->size(), 6u);
+  EXPECT_EQ(dict_segment->attribute_vector()->size(), 6u);
+
+  // Test dictionary size (uniqueness)
+  EXPECT_EQ(dict_segment->unique_values_count(), 4u);
+
+  // Test sorting
+  auto dict = dict_segment->dictionary();
+  EXPECT_EQ(*dict, (pmr_vector<std::string>{"Alexander", "Bill", "Hasso", "Steve"}));
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, Decode) {
+  for (const auto& url : _urls(100)) {
+    vs_str->append(url);
+  }
+
+  auto segment = encode_segment(EncodingType::FrontCodedDictionary, DataType::String, vs_str);
+  auto dict_segment = std::dynamic_pointer_cast<FrontCodedDictionarySegment<std::string>>(segment);
+
+  EXPECT_EQ(dict_segment->encoding_type(), EncodingType::FrontCodedDictionary);
+  EXPECT_EQ(dict_segment->compressed_vector_type(), CompressedVectorType::FixedSize1ByteAligned);
+
+  const auto urls = _urls(100);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < urls.size(); ++chunk_offset) {
+    EXPECT_EQ((*dict_segment)[chunk_offset], AllTypeVariant(urls[chunk_offset]));
+  }
+
+  auto decoded_values = std::vector<std::string>{};
+  auto iterable = DictionarySegmentIterable<std::string, FrontCodedStringVector>{*dict_segment};
+  iterable.for_each([&](const auto& value) { decoded_values.emplace_back(value.value()); });
+  EXPECT_EQ(decoded_values, urls);
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, EmptyAndLongStrings) {
+  const auto long_string = std::string(300, 'x');
+
+  vs_str->append(long_string);
+  vs_str->append("");
+  vs_str->append(long_string + "y");
+
+  auto segment = encode_segment(EncodingType::FrontCodedDictionary, DataType::String, vs_str);
+  auto dict_segment = std::dynamic_pointer_cast<FrontCodedDictionarySegment<std::string>>(segment);
+
+  EXPECT_EQ(*dict_segment->dictionary(), (pmr_vector<std::string>{"", long_string, long_string + "y"}));
+  EXPECT_EQ(dict_segment->get_typed_value(0), long_string);
+  EXPECT_EQ(dict_segment->get_typed_value(1), "");
+  EXPECT_EQ(dict_segment->get_typed_value(2), long_string + "y");
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, CopyUsingAllocator) {
+  vs_str->append("Bill");
+  vs_str->append("Steve");
+  vs_str->append("Alexander");
+
+  auto segment = encode_segment(EncodingType::FrontCodedDictionary, DataType::String, vs_str);
+  auto dict_segment = std::dynamic_pointer_cast<FrontCodedDictionarySegment<std::string>>(segment);
+
+  auto alloc = PolymorphicAllocator<size_t>{};
+  auto base_segment = dict_segment->copy_using_allocator(alloc);
+  auto dict_segment_copy = std::dynamic_pointer_cast<FrontCodedDictionarySegment<std::string>>(base_segment);
+
+  EXPECT_EQ(*dict_segment_copy->dictionary(), (pmr_vector<std::string>{"Alexander", "Bill", "Steve"}));
+  EXPECT_EQ(dict_segment_copy->get_typed_value(1), "Steve");
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, LowerUpperBound) {
+  vs_str->append("A");
+  vs_str->append("C");
+  vs_str->append("E");
+  vs_str->append("G");
+  vs_str->append("I");
+  vs_str->append("K");
+
+  auto segment = encode_segment(EncodingType::FrontCodedDictionary, DataType::String, vs_str);
+  auto dict_segment = std::dynamic_pointer_cast<FrontCodedDictionarySegment<std::string>>(segment);
+
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant("E")), ValueID{2});
+  EXPECT_EQ(dict_segment->upper_bound(AllTypeVariant("E")), ValueID{3});
+
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant("F")), ValueID{3});
+  EXPECT_EQ(dict_segment->upper_bound(AllTypeVariant("F")), ValueID{3});
+
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant("0")), ValueID{0});
+  EXPECT_EQ(dict_segment->upper_bound(AllTypeVariant("0")), ValueID{0});
+
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant("Z")), INVALID_VALUE_ID);
+  EXPECT_EQ(dict_segment->upper_bound(AllTypeVariant("Z")), INVALID_VALUE_ID);
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, LowerUpperBoundAcrossBlocks) {
+  const auto urls = _urls(100);
+  const auto dictionary = FrontCodedStringVector{urls.cbegin(), urls.cend()};
+  ASSERT_EQ(dictionary.size(), 100u);
+
+  for (auto pos = size_t{0}; pos < urls.size(); ++pos) {
+    EXPECT_EQ(dictionary.get_string_at(pos), urls[pos]);
+    EXPECT_EQ(dictionary.lower_bound(urls[pos]), pos);
+    EXPECT_EQ(dictionary.upper_bound(urls[pos]), pos + 1);
+
+    // A string between urls[pos] and urls[pos + 1]
+    EXPECT_EQ(dictionary.lower_bound(urls[pos] + "a"), pos + 1);
+    EXPECT_EQ(dictionary.upper_bound(urls[pos] + "a"), pos + 1);
+  }
+
+  EXPECT_EQ(dictionary.lower_bound(""), 0u);
+  EXPECT_EQ(dictionary.lower_bound("https://"), 0u);
+  EXPECT_EQ(dictionary.upper_bound("z"), 100u);
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, NullValues) {
+  std::shared_ptr<ValueSegment<std::string>> vs_str = std::make_shared<ValueSegment<std::string>>(true);
+
+  vs_str->append("A");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("E");
+
+  auto segment = encode_segment(EncodingType::FrontCodedDictionary, DataType::String, vs_str);
+  auto dict_segment = std::dynamic_pointer_cast<FrontCodedDictionarySegment<std::string>>(segment);
+
+  EXPECT_EQ(dict_segment->null_value_id(), 2u);
+  EXPECT_TRUE(variant_is_null((*dict_segment)[1]));
+  EXPECT_EQ((*dict_segment)[2], AllTypeVariant("E"));
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, MemoryUsageEstimation) {
+  for (const auto& url : _urls(1'000)) {
+    vs_str->append(url);
+  }
+
+  const auto front_coded_segment = encode_segment(EncodingType::FrontCodedDictionary, DataType::String, vs_str);
+  const auto dictionary_segment = encode_segment(EncodingType::Dictionary, DataType::String, vs_str);
+
+  // The URLs share a prefix of at least 33 characters, which only the first string of each block stores. The estimation
+  // of the DictionarySegment does not even include the memory that the strings allocate.
+  EXPECT_LT(front_coded_segment->estimate_memory_usage() * 3, dictionary_segment->estimate_memory_usage());
+}
+
+}  // namespace opossum
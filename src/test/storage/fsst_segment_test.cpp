@@ -0,0 +1,159 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFSSTSegmentTest : public BaseTest {
+ protected:
+  // Distinct comment-like strings that share many substrings, but no common prefix
+  static std::vector<std::string> _comments(const size_t count) {
+    auto comments = std::vector<std::string>{};
+    for (auto comment_idx = size_t{0}; comment_idx < count; ++comment_idx) {
+      comments.emplace_back(std::to_string(comment_idx) + " carefully final packages sleep quickly " +
+                            std::to_string(comment_idx * 7) + " among the furiously regular deposits");
+    }
+    return comments;
+  }
+
+  std::shared_ptr<FSSTSegment<std::string>> _encode(const std::shared_ptr<ValueSegment<std::string>>& value_segment) {
+    return std::dynamic_pointer_cast<FSSTSegment<std::string>>(
+        encode_segment(EncodingType::FSST, DataType::String, value_segment));
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> vs_str = std::make_shared<ValueSegment<std::string>>(true);
+};
+
+TEST_F(StorageFSSTSegmentTest, CompressNullableSegmentString) {
+  vs_str->append("Bill");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("");
+  vs_str->append("Steve");
+
+  const auto segment = _encode(vs_str);
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ(segment->encoding_type(), EncodingType::FSST);
+  EXPECT_EQ(segment->size(), 4u);
+  EXPECT_EQ(segment->offsets().size(), 5u);
+
+  EXPECT_EQ((*segment)[0], AllTypeVariant{"Bill"});
+  EXPECT_TRUE(variant_is_null((*segment)[1]));
+  EXPECT_EQ((*segment)[2], AllTypeVariant{""});
+  EXPECT_EQ((*segment)[3], AllTypeVariant{"Steve"});
+  EXPECT_EQ(segment->get_typed_value(1), std::nullopt);
+}
+
+TEST_F(StorageFSSTSegmentTest, Decode) {
+  const auto comments = _comments(200);
+  for (const auto& comment : comments) {
+    vs_str->append(comment);
+  }
+
+  const auto segment = _encode(vs_str);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < comments.size(); ++chunk_offset) {
+    EXPECT_EQ(segment->get_typed_value(chunk_offset), comments[chunk_offset]);
+  }
+
+  auto decoded_values = std::vector<std::string>{};
+  FSSTSegmentIterable<std::string>{*segment}.for_each(
+      [&](const auto& value) { decoded_values.emplace_back(value.value()); });
+  EXPECT_EQ(decoded_values, comments);
+}
+
+TEST_F(StorageFSSTSegmentTest, IterateWithPositionFilter) {
+  const auto comments = _comments(50);
+  for (const auto& comment : comments) {
+    vs_str->append(comment);
+  }
+  vs_str->append(NULL_VALUE);
+
+  const auto segment = _encode(vs_str);
+  const auto position_filter = std::make_shared<PosList>(
+      PosList{{ChunkID{0}, ChunkOffset{42}}, {ChunkID{0}, ChunkOffset{50}}, {ChunkID{0}, ChunkOffset{3}}});
+  position_filter->guarantee_single_chunk();
+
+  auto decoded_values = std::vector<std::string>{};
+  auto null_count = size_t{0};
+  FSSTSegmentIterable<std::string>{*segment}.with_iterators(position_filter, [&](auto it, auto end) {
+    for (; it != end; ++it) {
+      if (it->is_null()) {
+        ++null_count;
+      } else {
+        decoded_values.emplace_back(it->value());
+      }
+    }
+  });
+  EXPECT_EQ(decoded_values, (std::vector<std::string>{comments[42], comments[3]}));
+  EXPECT_EQ(null_count, 1u);
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressedValuesAreComparable) {
+  const auto comments = _comments(100);
+  for (const auto& comment : comments) {
+    vs_str->append(comment);
+  }
+
+  const auto segment = _encode(vs_str);
+  const auto& symbol_table = segment->symbol_table();
+
+  EXPECT_EQ(segment->compressed_value(17), symbol_table.compress(comments[17]));
+  EXPECT_NE(segment->compressed_value(17), symbol_table.compress(comments[18]));
+  EXPECT_NE(segment->compressed_value(17), symbol_table.compress(comments[17] + "x"));
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressesRepetitiveStrings) {
+  auto total_length = size_t{0};
+  for (const auto& comment : _comments(1'000)) {
+    vs_str->append(comment);
+    total_length += comment.size();
+  }
+
+  const auto segment = _encode(vs_str);
+  EXPECT_GT(segment->symbol_table().symbol_count(), 0u);
+  EXPECT_LT(segment->compressed_values().size() * 2, total_length);
+  EXPECT_LT(segment->estimate_memory_usage(), total_length);
+}
+
+TEST_F(StorageFSSTSegmentTest, CopyUsingAllocator) {
+  const auto comments = _comments(10);
+  for (const auto& comment : comments) {
+    vs_str->append(comment);
+  }
+
+  const auto segment = _encode(vs_str);
+  const auto copied_base_segment = segment->copy_using_allocator(PolymorphicAllocator<size_t>{});
+  const auto copied_segment = std::dynamic_pointer_cast<FSSTSegment<std::string>>(copied_base_segment);
+  ASSERT_NE(copied_segment, nullptr);
+  EXPECT_EQ(&copied_segment->symbol_table(), &segment->symbol_table());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < comments.size(); ++chunk_offset) {
+    EXPECT_EQ(copied_segment->get_typed_value(chunk_offset), comments[chunk_offset]);
+  }
+}
+
+TEST_F(StorageFSSTSegmentTest, SymbolTableEscapesUnknownBytes) {
+  const auto symbol_table = FSSTSymbolTable{{"abc", "a", "bcd"}};
+  EXPECT_EQ(symbol_table.symbol_count(), 3u);
+  EXPECT_EQ(symbol_table.symbol(2), "bcd");
+
+  // "abc" is preferred over "a", "x" and the NUL byte are escaped
+  const auto value = std::string{"abcxa\0bcd", 9};
+  const auto compressed_value = symbol_table.compress(value);
+  const auto expected_value = std::string{"\x00\xff" "x" "\x01\xff\x00\x02", 7};
+  EXPECT_EQ(compressed_value, expected_value);
+
+  auto decompressed_value = std::string{"garbage"};
+  symbol_table.decompress(compressed_value, decompressed_value);
+  EXPECT_EQ(decompressed_value, value);
+}
+
+}  // namespace opossum
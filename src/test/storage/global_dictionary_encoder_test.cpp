@@ -0,0 +1,212 @@
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/global_dictionary_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class GlobalDictionaryEncoderTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = _create_table();
+
+    // Three full chunks and a mutable one
+    _append_rows({"Bob", "Alice", "Bob", std::nullopt, "Carol", "Alice", "Carol", "Carol", "Bob", "Alice"});
+  }
+
+  static std::shared_ptr<Table> _create_table() {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::String, true);
+    column_definitions.emplace_back("b", DataType::Int, false);
+    return std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  }
+
+  void _append_rows(const std::vector<std::optional<std::string>>& values) {
+    for (const auto& value : values) {
+      _table->append({value ? AllTypeVariant{*value} : NULL_VALUE, static_cast<int32_t>(_values.size())});
+      _values.emplace_back(value);
+    }
+  }
+
+  // An unencoded table with the rows appended so far
+  std::shared_ptr<Table> _expected_table() const {
+    auto table = _create_table();
+    for (auto row_idx = size_t{0}; row_idx < _values.size(); ++row_idx) {
+      table->append({_values[row_idx] ? AllTypeVariant{*_values[row_idx]} : NULL_VALUE, static_cast<int32_t>(row_idx)});
+    }
+    return table;
+  }
+
+  static SegmentEncodingSpec _global_dictionary_spec() {
+    auto spec = SegmentEncodingSpec{EncodingType::Dictionary};
+    spec.global_dictionary = true;
+    return spec;
+  }
+
+  std::shared_ptr<const DictionarySegment<std::string>> _segment(const ChunkID chunk_id) const {
+    return std::dynamic_pointer_cast<const DictionarySegment<std::string>>(
+        _table->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+  }
+
+  // Checks that the encoded chunks [0, @param chunk_count) share one dictionary and that the values did not change
+  void _expect_global_dictionary(const ChunkID chunk_count) {
+    const auto dictionary = _segment(ChunkID{0})->dictionary();
+    EXPECT_TRUE(std::is_sorted(dictionary->cbegin(), dictionary->cend()));
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto segment = _segment(chunk_id);
+      ASSERT_NE(segment, nullptr);
+      EXPECT_EQ(segment->dictionary(), dictionary);
+      EXPECT_EQ(segment->null_value_id(), static_cast<ValueID>(dictionary->size()));
+    }
+
+    EXPECT_TABLE_EQ_ORDERED(_table, _expected_table());
+  }
+
+  std::shared_ptr<Table> _table;
+  std::vector<std::optional<std::string>> _values;
+};
+
+TEST_F(GlobalDictionaryEncoderTest, EncodeAllChunks) {
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}, ChunkID{2}}, _global_dictionary_spec());
+
+  _expect_global_dictionary(ChunkID{3});
+  EXPECT_EQ(*_segment(ChunkID{0})->dictionary(), (pmr_vector<std::string>{"Alice", "Bob", "Carol"}));
+
+  // The statistics are built for each chunk
+  EXPECT_NE(_table->get_chunk(ChunkID{1})->statistics(), nullptr);
+
+  // The last chunk is not encoded
+  EXPECT_EQ(_segment(ChunkID{3}), nullptr);
+}
+
+TEST_F(GlobalDictionaryEncoderTest, ExtendDictionary) {
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}}, _global_dictionary_spec());
+  const auto dictionary = _segment(ChunkID{0})->dictionary();
+
+  // All values of chunk 2 are in the dictionary already
+  ChunkEncoder::encode_chunks(_table, {ChunkID{2}}, _global_dictionary_spec());
+  EXPECT_EQ(_segment(ChunkID{2})->dictionary(), dictionary);
+
+  // Chunk 3 holds new values, so the dictionary is rebuilt and the value ids of the other chunks are translated
+  _append_rows({"Aaron", "Zoe"});
+  ChunkEncoder::encode_chunks(_table, {ChunkID{3}}, _global_dictionary_spec());
+
+  EXPECT_NE(_segment(ChunkID{0})->dictionary(), dictionary);
+  _expect_global_dictionary(ChunkID{4});
+  EXPECT_EQ(*_segment(ChunkID{0})->dictionary(), (pmr_vector<std::string>{"Aaron", "Alice", "Bob", "Carol", "Zoe"}));
+}
+
+TEST_F(GlobalDictionaryEncoderTest, IndexScanOnRebuiltDictionary) {
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}, ChunkID{2}}, _global_dictionary_spec());
+  _table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(column_ids);
+
+  // Chunk 3 holds new values, so the segment of chunk 0 is exchanged. The DeltaIndex of chunk 3 is merged into an
+  // index on its final segment.
+  _append_rows({"Aaron", "Zoe"});
+  _table->get_chunk(ChunkID{3})->create_delta_index(column_ids, SegmentIndexType::GroupKey);
+  ChunkEncoder::encode_chunks(_table, {ChunkID{3}}, _global_dictionary_spec());
+
+  for (const auto chunk_id : {ChunkID{0}, ChunkID{3}}) {
+    const auto index = _table->get_chunk(chunk_id)->get_index(SegmentIndexType::GroupKey, column_ids);
+    ASSERT_NE(index, nullptr);
+    EXPECT_EQ(index->get_indexed_segments(), std::vector<std::shared_ptr<const BaseSegment>>{_segment(chunk_id)});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  const auto index_scan = std::make_shared<IndexScan>(table_wrapper, SegmentIndexType::GroupKey, column_ids,
+                                                      PredicateCondition::LessThan, std::vector<AllTypeVariant>{"Bob"});
+  index_scan->set_included_chunk_ids({ChunkID{0}, ChunkID{3}});
+  index_scan->execute();
+
+  auto row_ids = std::vector<int32_t>{};
+  const auto output = index_scan->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& segment = *output->get_chunk(chunk_id)->get_segment(ColumnID{1});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+      row_ids.emplace_back(type_cast<int32_t>(segment[chunk_offset]));
+    }
+  }
+  std::sort(row_ids.begin(), row_ids.end());
+  EXPECT_EQ(row_ids, (std::vector<int32_t>{1, 9, 10}));
+}
+
+TEST_F(GlobalDictionaryEncoderTest, MergeSegmentDictionaries) {
+  // Chunks encoded with dictionaries of their own are merged into the global dictionary
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_NE(_segment(ChunkID{0})->dictionary(), _segment(ChunkID{1})->dictionary());
+
+  auto spec = _global_dictionary_spec();
+  spec.vector_compression_type = VectorCompressionType::SimdBp128;
+  ChunkEncoder::encode_chunks(_table, {ChunkID{2}}, spec);
+
+  _expect_global_dictionary(ChunkID{3});
+}
+
+TEST_F(GlobalDictionaryEncoderTest, GroupByValueIds) {
+  // The mutable chunk holds values that are in the dictionary and one that is not
+  _append_rows({"Dave", "Carol"});
+  const auto unencoded_table = _expected_table();
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}, ChunkID{2}}, _global_dictionary_spec());
+
+  const auto aggregate = [](const std::shared_ptr<Table>& table) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}};
+    auto aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, std::vector<ColumnID>{ColumnID{0}});
+    aggregate->execute();
+    return aggregate->get_output();
+  };
+
+  const auto result = aggregate(_table);
+  EXPECT_EQ(result->row_count(), 5u);
+  EXPECT_TABLE_EQ_UNORDERED(result, aggregate(unencoded_table));
+}
+
+TEST_F(GlobalDictionaryEncoderTest, GroupByValueIdsOfReferences) {
+  // The scan references rows of the encoded chunks, including the NULL, and of the mutable chunk
+  _append_rows({"Dave", "Carol"});
+  const auto unencoded_table = _expected_table();
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}, ChunkID{2}}, _global_dictionary_spec());
+
+  const auto aggregate = [](const std::shared_ptr<Table>& table) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    const auto b = PQPColumnExpression::from_table(*table, "b");
+    const auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(b, 2));
+    table_scan->execute();
+
+    const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}};
+    auto aggregate = std::make_shared<Aggregate>(table_scan, aggregates, std::vector<ColumnID>{ColumnID{0}});
+    aggregate->execute();
+    return aggregate->get_output();
+  };
+
+  const auto result = aggregate(_table);
+  EXPECT_EQ(result->row_count(), 5u);
+  EXPECT_TABLE_EQ_UNORDERED(result, aggregate(unencoded_table));
+}
+
+}  // namespace opossum
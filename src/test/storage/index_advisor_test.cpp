@@ -0,0 +1,211 @@
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "sql/sql_query_cache.hpp"
+#include "sql/sql_query_plan.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/index_advisor.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class IndexAdvisorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::Int);
+    column_definitions.emplace_back("c", DataType::Int);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+
+    for (auto row_idx = 0; row_idx < 10'000; ++row_idx) {
+      _table->append({row_idx, row_idx % 10, row_idx % 50});
+    }
+    ChunkEncoder::encode_all_chunks(_table);
+    StorageManager::get().add_table("table_a", _table);
+
+    SQLQueryCache<SQLQueryPlan>::get().clear();
+  }
+
+  void TearDown() override { SQLQueryCache<SQLQueryPlan>::get().clear(); }
+
+  // Executes a scan of table_a with @param predicate and caches its plan, as the SQLPipeline would
+  void _cache_scan(const std::string& query, const std::shared_ptr<AbstractExpression>& predicate) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->execute();
+    std::make_shared<TableScan>(get_table, predicate)->execute();
+
+    _cache_plan(query, predicate);
+  }
+
+  // Caches a plan that scans table_a with @param predicate without executing it
+  void _cache_plan(const std::string& query, const std::shared_ptr<AbstractExpression>& predicate) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    const auto table_scan = std::make_shared<TableScan>(get_table, predicate);
+
+    SQLQueryPlan plan{CleanupTemporaries::Yes};
+    plan.add_tree_by_root(table_scan);
+    SQLQueryCache<SQLQueryPlan>::get().set(query, plan);
+  }
+
+  std::shared_ptr<AbstractExpression> _column(const ColumnID column_id) const {
+    return PQPColumnExpression::from_table(*_table, column_id);
+  }
+
+  IndexAdvisor::Options _options() const {
+    auto options = IndexAdvisor::Options{};
+    options.interval = std::chrono::milliseconds(10);
+    return options;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(IndexAdvisorTest, CreatesIndexForSelectiveScan) {
+  _cache_scan("SELECT * FROM table_a WHERE a = 5", equals_(_column(ColumnID{0}), 5));
+
+  IndexAdvisor index_advisor{_options()};
+  const auto decisions = index_advisor.run();
+
+  ASSERT_EQ(decisions.size(), 1u);
+  EXPECT_EQ(decisions[0].action, IndexAdvisorDecision::Action::Create);
+  EXPECT_EQ(decisions[0].table_name, "table_a");
+  EXPECT_EQ(decisions[0].column_ids, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_GT(decisions[0].benefit, 0.0f);
+  EXPECT_GT(decisions[0].memory_usage, 0u);
+
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  EXPECT_NE(_table->get_chunk(ChunkID{0})->get_index(SegmentIndexType::GroupKey, column_ids), nullptr);
+  EXPECT_EQ(_table->get_indexes().size(), 1u);
+
+  // The plan cache is cleared so that the queries are optimized with the new index
+  EXPECT_EQ(SQLQueryCache<SQLQueryPlan>::get().size(), 0u);
+  EXPECT_EQ(index_advisor.decisions().size(), 1u);
+
+  // The index is kept while the workload does not change
+  _cache_scan("SELECT * FROM table_a WHERE a = 5", equals_(_column(ColumnID{0}), 5));
+  EXPECT_TRUE(index_advisor.run().empty());
+  EXPECT_EQ(_table->get_indexes().size(), 1u);
+}
+
+TEST_F(IndexAdvisorTest, IgnoresUnselectiveScan) {
+  _cache_scan("SELECT * FROM table_a WHERE b = 3", equals_(_column(ColumnID{1}), 3));
+
+  IndexAdvisor index_advisor{_options()};
+  EXPECT_TRUE(index_advisor.run().empty());
+  EXPECT_TRUE(_table->get_indexes().empty());
+}
+
+TEST_F(IndexAdvisorTest, CreatesCompositeIndexForCombinedPredicates) {
+  // Neither b = 3 nor c = 7 is selective enough on its own, but both together are
+  _cache_scan("SELECT * FROM table_a WHERE b = 3 AND c = 7",
+              and_(equals_(_column(ColumnID{1}), 3), equals_(_column(ColumnID{2}), 7)));
+
+  IndexAdvisor index_advisor{_options()};
+  const auto decisions = index_advisor.run();
+
+  ASSERT_EQ(decisions.size(), 1u);
+  EXPECT_EQ(decisions[0].action, IndexAdvisorDecision::Action::Create);
+  EXPECT_EQ(decisions[0].column_ids.size(), 2u);
+  ASSERT_EQ(_table->get_indexes().size(), 1u);
+  EXPECT_EQ(_table->get_indexes()[0].type, SegmentIndexType::CompositeGroupKey);
+}
+
+TEST_F(IndexAdvisorTest, RespectsMemoryBudget) {
+  _cache_scan("SELECT * FROM table_a WHERE a = 5", equals_(_column(ColumnID{0}), 5));
+
+  auto options = _options();
+  options.memory_budget = 1'000;
+  IndexAdvisor index_advisor{options};
+
+  EXPECT_TRUE(index_advisor.run().empty());
+  EXPECT_TRUE(_table->get_indexes().empty());
+}
+
+TEST_F(IndexAdvisorTest, DropsIndexWhenWorkloadChanges) {
+  _cache_scan("SELECT * FROM table_a WHERE a = 5", equals_(_column(ColumnID{0}), 5));
+
+  auto options = _options();
+  options.workload_decay = 0.0f;
+  IndexAdvisor index_advisor{options};
+
+  ASSERT_EQ(index_advisor.run().size(), 1u);
+  EXPECT_EQ(_table->get_indexes().size(), 1u);
+
+  // The scan is not seen again and forgotten immediately
+  const auto decisions = index_advisor.run();
+  ASSERT_EQ(decisions.size(), 1u);
+  EXPECT_EQ(decisions[0].action, IndexAdvisorDecision::Action::Drop);
+  EXPECT_EQ(decisions[0].column_ids, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_TRUE(_table->get_indexes().empty());
+
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->get_index(SegmentIndexType::GroupKey, column_ids), nullptr);
+  EXPECT_EQ(index_advisor.decisions().size(), 2u);
+}
+
+TEST_F(IndexAdvisorTest, ForgetsCachedScansThatAreNotExecuted) {
+  _cache_scan("SELECT * FROM table_a WHERE a = 5", equals_(_column(ColumnID{0}), 5));
+
+  IndexAdvisor index_advisor{_options()};
+  ASSERT_EQ(index_advisor.run().size(), 1u);
+
+  // The plan stays cached, but is not executed anymore. The weight of its scan decays until it is forgotten.
+  auto decisions = std::vector<IndexAdvisorDecision>{};
+  auto run_count = 0;
+  while (decisions.empty() && run_count < 20) {
+    _cache_plan("SELECT * FROM table_a WHERE a = 5", equals_(_column(ColumnID{0}), 5));
+    decisions = index_advisor.run();
+    ++run_count;
+  }
+
+  ASSERT_EQ(decisions.size(), 1u);
+  EXPECT_EQ(decisions[0].action, IndexAdvisorDecision::Action::Drop);
+  EXPECT_GT(run_count, 1);
+  EXPECT_TRUE(_table->get_indexes().empty());
+}
+
+TEST_F(IndexAdvisorTest, KeepsExistingIndexes) {
+  _table->create_index<GroupKeyIndex>({ColumnID{0}}, "user_index");
+  _cache_scan("SELECT * FROM table_a WHERE a = 5", equals_(_column(ColumnID{0}), 5));
+
+  auto options = _options();
+  options.workload_decay = 0.0f;
+  IndexAdvisor index_advisor{options};
+
+  // The scan is already served by the existing index, which is not dropped when the scan is forgotten
+  EXPECT_TRUE(index_advisor.run().empty());
+  EXPECT_TRUE(index_advisor.run().empty());
+  ASSERT_EQ(_table->get_indexes().size(), 1u);
+  EXPECT_EQ(_table->get_indexes()[0].name, "user_index");
+}
+
+TEST_F(IndexAdvisorTest, RunsInBackground) {
+  _cache_scan("SELECT * FROM table_a WHERE a = 5", equals_(_column(ColumnID{0}), 5));
+
+  IndexAdvisor index_advisor{_options()};
+  index_advisor.resume();
+  for (auto attempt = 0; attempt < 500 && index_advisor.decisions().empty(); ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  index_advisor.pause();
+
+  EXPECT_EQ(index_advisor.decisions().size(), 1u);
+  EXPECT_EQ(_table->get_indexes().size(), 1u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,175 @@
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/pfor_delta_segment.hpp"
+#include "storage/pfor_delta_segment/pfor_delta_iterable.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StoragePFORDeltaSegmentTest : public BaseTest {
+ protected:
+  template <typename T>
+  std::shared_ptr<PFORDeltaSegment<T>> _encode(const std::vector<std::optional<T>>& values) {
+    auto value_segment = std::make_shared<ValueSegment<T>>(true);
+    for (const auto& value : values) {
+      if (value) {
+        value_segment->append(*value);
+      } else {
+        value_segment->append(NULL_VALUE);
+      }
+    }
+
+    return std::dynamic_pointer_cast<PFORDeltaSegment<T>>(
+        encode_segment(EncodingType::PFORDelta, data_type_from_type<T>(), value_segment));
+  }
+
+  template <typename T>
+  void _expect_values(const PFORDeltaSegment<T>& segment, const std::vector<std::optional<T>>& values) {
+    ASSERT_EQ(segment.size(), values.size());
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      EXPECT_EQ(segment.get_typed_value(chunk_offset), values[chunk_offset]);
+    }
+
+    auto decoded_values = std::vector<std::optional<T>>{};
+    PFORDeltaIterable<T>{segment}.for_each([&](const auto& value) {
+      decoded_values.emplace_back(value.is_null() ? std::nullopt : std::optional<T>{value.value()});
+    });
+    EXPECT_EQ(decoded_values, values);
+  }
+};
+
+TEST_F(StoragePFORDeltaSegmentTest, SortedValues) {
+  auto values = std::vector<std::optional<int32_t>>{};
+  for (auto value = 1'000'000; value < 1'003'000; value += 3) {
+    values.emplace_back(value);
+  }
+
+  const auto segment = _encode(values);
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ(segment->encoding_type(), EncodingType::PFORDelta);
+  _expect_values(*segment, values);
+
+  // All deltas are equal, so no bits are needed for the offsets
+  EXPECT_EQ(segment->blocks().size(), 8u);
+  EXPECT_EQ(segment->blocks()[0].bit_width, 0u);
+  EXPECT_EQ(segment->blocks()[0].min_delta, 3);
+  EXPECT_TRUE(segment->packed_offsets().empty());
+  EXPECT_TRUE(segment->exception_values().empty());
+}
+
+TEST_F(StoragePFORDeltaSegmentTest, TimestampsWithJumps) {
+  auto values = std::vector<std::optional<int64_t>>{};
+  auto timestamp = int64_t{1'500'000'000'000};
+  for (auto value_idx = 0; value_idx < 1'000; ++value_idx) {
+    timestamp += value_idx % 7;
+    if (value_idx % 300 == 5) timestamp += int64_t{10'000'000'000};
+    values.emplace_back(timestamp);
+  }
+
+  const auto segment = _encode(values);
+  _expect_values(*segment, values);
+
+  // The jumps are stored as exceptions, while the other deltas only need three bits
+  EXPECT_EQ(segment->exception_values().size(), 4u);
+  EXPECT_EQ(segment->blocks()[0].bit_width, 3u);
+  EXPECT_LT(segment->estimate_memory_usage(), values.size() * sizeof(int64_t) / 4);
+}
+
+TEST_F(StoragePFORDeltaSegmentTest, NullsAndExtremeValues) {
+  const auto values = std::vector<std::optional<int64_t>>{std::nullopt,
+                                                          std::numeric_limits<int64_t>::max(),
+                                                          std::numeric_limits<int64_t>::min(),
+                                                          std::nullopt,
+                                                          0,
+                                                          -1,
+                                                          std::numeric_limits<int64_t>::max()};
+
+  const auto segment = _encode(values);
+  _expect_values(*segment, values);
+
+  EXPECT_EQ(segment->blocks()[0].minimum, std::numeric_limits<int64_t>::min());
+  EXPECT_EQ(segment->blocks()[0].maximum, std::numeric_limits<int64_t>::max());
+}
+
+TEST_F(StoragePFORDeltaSegmentTest, PointAccess) {
+  auto values = std::vector<std::optional<int32_t>>{};
+  for (auto value_idx = 0; value_idx < 500; ++value_idx) {
+    values.emplace_back(value_idx % 11 == 0 ? std::nullopt : std::optional<int32_t>{value_idx * value_idx});
+  }
+
+  const auto segment = _encode(values);
+
+  auto position_filter = std::make_shared<PosList>();
+  for (auto chunk_offset = ChunkOffset{499}; chunk_offset > 0; chunk_offset -= 3) {
+    position_filter->emplace_back(RowID{ChunkID{0}, chunk_offset});
+  }
+  position_filter->guarantee_single_chunk();
+
+  auto position_idx = size_t{0};
+  PFORDeltaIterable<int32_t>{*segment}.for_each(position_filter, [&](const auto& value) {
+    const auto& expected_value = values[(*position_filter)[position_idx].chunk_offset];
+    EXPECT_EQ(value.is_null(), !expected_value);
+    if (expected_value) {
+      EXPECT_EQ(value.value(), *expected_value);
+    }
+    ++position_idx;
+  });
+  EXPECT_EQ(position_idx, position_filter->size());
+}
+
+TEST_F(StoragePFORDeltaSegmentTest, BlockMinimaAndMaxima) {
+  auto values = std::vector<std::optional<int32_t>>(128, std::nullopt);
+  for (auto value = 0; value < 128; ++value) {
+    values.emplace_back(1'000 - value);
+  }
+
+  const auto segment = _encode(values);
+  ASSERT_EQ(segment->blocks().size(), 2u);
+
+  // A block that only contains NULLs has a minimum larger than its maximum
+  EXPECT_GT(segment->blocks()[0].minimum, segment->blocks()[0].maximum);
+  EXPECT_EQ(segment->blocks()[1].minimum, 873);
+  EXPECT_EQ(segment->blocks()[1].maximum, 1'000);
+  _expect_values(*segment, values);
+}
+
+TEST_F(StoragePFORDeltaSegmentTest, ScanSkipsBlocks) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Long, true);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto row_idx = int64_t{0}; row_idx < 1'000; ++row_idx) {
+    table->append({row_idx % 100 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row_idx * 10}});
+  }
+  ChunkEncoder::encode_all_chunks(table, EncodingType::PFORDelta);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expect_row_count = [&](const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                    const std::optional<AllTypeVariant>& value2, const size_t row_count) {
+    const auto scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, value, value2);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), row_count);
+  };
+
+  expect_row_count(PredicateCondition::Equals, int64_t{4'990}, std::nullopt, 1);
+  expect_row_count(PredicateCondition::Equals, int64_t{4'995}, std::nullopt, 0);
+  expect_row_count(PredicateCondition::NotEquals, int64_t{4'990}, std::nullopt, 989);
+  expect_row_count(PredicateCondition::LessThan, int64_t{2'000}, std::nullopt, 198);
+  expect_row_count(PredicateCondition::GreaterThanEquals, int64_t{2'000}, std::nullopt, 792);
+  expect_row_count(PredicateCondition::Between, int64_t{1'280}, int64_t{2'555}, 127);
+}
+
+}  // namespace opossum
@@ -57,6 +57,17 @@ TEST_F(StorageManagerTest, DropTable) {
   EXPECT_THROW(sm.drop_table("first_table"), std::exception);
 }
 
+TEST_F(StorageManagerTest, TablesSnapshot) {
+  auto& sm = StorageManager::get();
+  const auto tables = sm.tables();
+  sm.drop_table("first_table");
+
+  // Tables dropped after the snapshot was taken remain valid in it
+  ASSERT_EQ(tables.size(), 2u);
+  EXPECT_NE(tables.at("first_table"), nullptr);
+  EXPECT_EQ(sm.tables().size(), 1u);
+}
+
 TEST_F(StorageManagerTest, DoesNotHaveTable) {
   auto& sm = StorageManager::get();
   EXPECT_EQ(sm.has_table("third_table"), false);
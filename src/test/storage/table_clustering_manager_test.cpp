@@ -0,0 +1,205 @@
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "sql/sql_query_cache.hpp"
+#include "sql/sql_query_plan.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/table_clustering_manager.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class TableClusteringManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = _create_table(UseMvcc::Yes);
+    StorageManager::get().add_table("table_a", _table);
+
+    SQLQueryCache<SQLQueryPlan>::get().clear();
+  }
+
+  void TearDown() override { SQLQueryCache<SQLQueryPlan>::get().clear(); }
+
+  static std::shared_ptr<Table> _create_table(const UseMvcc use_mvcc) {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::Int);
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10, use_mvcc);
+
+    for (auto row_idx = 0; row_idx < 100; ++row_idx) {
+      table->append({(row_idx * 37) % 100, (row_idx * 53) % 100});
+    }
+    ChunkEncoder::encode_all_chunks(table);
+    return table;
+  }
+
+  // Executes a scan of @param table_name with @param predicate, on the validated rows if the table has MVCC
+  void _execute_scan(const std::shared_ptr<AbstractExpression>& predicate, const std::string& table_name = "table_a") {
+    const auto get_table = std::make_shared<GetTable>(table_name);
+    get_table->execute();
+
+    auto scan_input = std::shared_ptr<AbstractOperator>{get_table};
+    if (StorageManager::get().get_table(table_name)->has_mvcc() == UseMvcc::Yes) {
+      scan_input = std::make_shared<Validate>(get_table);
+      scan_input->set_transaction_context(TransactionManager::get().new_transaction_context());
+      scan_input->execute();
+    }
+
+    const auto table_scan = std::make_shared<TableScan>(scan_input, predicate);
+    table_scan->execute();
+  }
+
+  std::shared_ptr<AbstractExpression> _column(const ColumnID column_id) const {
+    return PQPColumnExpression::from_table(*_table, column_id);
+  }
+
+  TableClusteringManager::Options _options() const {
+    auto options = TableClusteringManager::Options{};
+    options.interval = std::chrono::milliseconds(10);
+    return options;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TableClusteringManagerTest, ClustersByHotColumn) {
+  _execute_scan(less_than_(_column(ColumnID{1}), 30));
+  _execute_scan(between_(_column(ColumnID{1}), 10, 20));
+  _execute_scan(and_(less_than_equals_(50, _column(ColumnID{1})), not_equals_(_column(ColumnID{0}), 3)));
+  _execute_scan(equals_(_column(ColumnID{0}), 5));
+  EXPECT_EQ(_table->column_scan_count(ColumnID{0}), 1u);
+  EXPECT_EQ(_table->column_scan_count(ColumnID{1}), 3u);
+
+  SQLQueryCache<SQLQueryPlan>::get().set("SELECT * FROM table_a WHERE b < 30", SQLQueryPlan{CleanupTemporaries::Yes});
+
+  TableClusteringManager table_clustering_manager{_options()};
+  const auto clustered_columns = table_clustering_manager.run();
+
+  const auto expected_columns = std::map<std::string, std::vector<ColumnID>>{{"table_a", {ColumnID{1}}}};
+  EXPECT_EQ(clustered_columns, expected_columns);
+  EXPECT_EQ(table_clustering_manager.clustering_columns(), expected_columns);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->cleanup_commit_id());
+  EXPECT_EQ(_table->chunk_count(), 20u);
+
+  // The plan cache is cleared so that the queries are pruned with the new chunk statistics
+  EXPECT_EQ(SQLQueryCache<SQLQueryPlan>::get().size(), 0u);
+
+  // The table is not clustered again while no chunks are appended
+  EXPECT_TRUE(table_clustering_manager.run().empty());
+  EXPECT_EQ(_table->chunk_count(), 20u);
+
+  // Only the appended chunks are clustered, the chunks clustered before are kept
+  for (auto row_idx = 0; row_idx < 40; ++row_idx) {
+    _table->append({row_idx, row_idx});
+  }
+  ChunkEncoder::encode_chunks(_table, {ChunkID{20}, ChunkID{21}, ChunkID{22}, ChunkID{23}});
+  EXPECT_EQ(table_clustering_manager.run(), expected_columns);
+  EXPECT_EQ(_table->chunk_count(), 28u);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{10})->cleanup_commit_id());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{20})->cleanup_commit_id());
+}
+
+TEST_F(TableClusteringManagerTest, ReclaimsChunksOnceNoTransactionSeesThem) {
+  _execute_scan(less_than_(_column(ColumnID{1}), 30));
+
+  // A transaction that started before the clustering still sees the rows of the previous chunks
+  auto context = TransactionManager::get().new_transaction_context();
+
+  TableClusteringManager table_clustering_manager{_options()};
+  ASSERT_FALSE(table_clustering_manager.run().empty());
+  ASSERT_TRUE(_table->get_chunk(ChunkID{0})->cleanup_commit_id());
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 10u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->statistics());
+
+  context.reset();
+  EXPECT_TRUE(table_clustering_manager.run().empty());
+
+  // The previous chunks are kept empty, so that the RowIDs of the clustered chunks do not change
+  ASSERT_EQ(_table->chunk_count(), 20u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{10}; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_EQ(chunk->size(), 0u);
+    EXPECT_FALSE(chunk->statistics());
+  }
+  for (auto chunk_id = ChunkID{10}; chunk_id < ChunkID{20}; ++chunk_id) {
+    EXPECT_EQ(_table->get_chunk(chunk_id)->size(), 10u);
+  }
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(TransactionManager::get().new_transaction_context());
+  get_table->execute();
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 100u);
+}
+
+TEST_F(TableClusteringManagerTest, ClustersByMultipleHotColumns) {
+  _execute_scan(less_than_(_column(ColumnID{0}), 30));
+  _execute_scan(greater_than_(_column(ColumnID{1}), 60));
+
+  TableClusteringManager table_clustering_manager{_options()};
+  const auto expected_columns =
+      std::map<std::string, std::vector<ColumnID>>{{"table_a", {ColumnID{0}, ColumnID{1}}}};
+  EXPECT_EQ(table_clustering_manager.run(), expected_columns);
+}
+
+TEST_F(TableClusteringManagerTest, ReclustersWhenWorkloadChanges) {
+  _execute_scan(less_than_(_column(ColumnID{1}), 30));
+
+  TableClusteringManager table_clustering_manager{_options()};
+  EXPECT_EQ(table_clustering_manager.run().at("table_a"), std::vector<ColumnID>{ColumnID{1}});
+
+  // The weight of b decays, while a is filtered by more and more queries
+  for (auto query_idx = 0; query_idx < 4; ++query_idx) {
+    _execute_scan(equals_(_column(ColumnID{0}), query_idx));
+  }
+
+  EXPECT_EQ(table_clustering_manager.run().at("table_a"), std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(_table->chunk_count(), 30u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{19})->cleanup_commit_id());
+}
+
+TEST_F(TableClusteringManagerTest, IgnoresSmallTablesAndTablesWithoutMvcc) {
+  StorageManager::get().add_table("table_b", _create_table(UseMvcc::No));
+  _execute_scan(less_than_(_column(ColumnID{1}), 30));
+  _execute_scan(less_than_(_column(ColumnID{1}), 30), "table_b");
+
+  auto options = _options();
+  options.min_unclustered_chunk_count = 11;
+  TableClusteringManager table_clustering_manager{options};
+  EXPECT_TRUE(table_clustering_manager.run().empty());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->cleanup_commit_id());
+}
+
+TEST_F(TableClusteringManagerTest, RunsInBackground) {
+  _execute_scan(less_than_(_column(ColumnID{1}), 30));
+
+  TableClusteringManager table_clustering_manager{_options()};
+  table_clustering_manager.resume();
+  for (auto attempt = 0; attempt < 500 && table_clustering_manager.clustering_columns().empty(); ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  table_clustering_manager.pause();
+
+  EXPECT_EQ(table_clustering_manager.clustering_columns().size(), 1u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->cleanup_commit_id());
+}
+
+}  // namespace opossum
@@ -0,0 +1,201 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/index_scan.hpp"
+#include "operators/join_index.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class TableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::String);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+
+    _table->append({3, "c"});
+    _table->append({1, "b"});
+    _table->append({2, "a"});
+    _table->append({1, "a"});
+    _table->append({NullValue{}, "d"});
+  }
+
+  static std::vector<RowID> row_ids(const PosList& pos_list) { return {pos_list.cbegin(), pos_list.cend()}; }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TableIndexTest, SingleColumnLookup) {
+  const auto index = _table->create_table_index({ColumnID{0}});
+
+  // The NULL is not indexed
+  EXPECT_EQ(index->size(), 4u);
+
+  EXPECT_EQ(row_ids(index->lookup(PredicateCondition::Equals, {1})),
+            (std::vector<RowID>{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 0}}));
+  EXPECT_EQ(row_ids(index->lookup(PredicateCondition::NotEquals, {1})),
+            (std::vector<RowID>{RowID{ChunkID{0}, 2}, RowID{ChunkID{0}, 0}}));
+  EXPECT_EQ(row_ids(index->lookup(PredicateCondition::LessThan, {2})),
+            (std::vector<RowID>{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 0}}));
+  EXPECT_EQ(index->lookup(PredicateCondition::LessThanEquals, {2}).size(), 3u);
+  EXPECT_EQ(row_ids(index->lookup(PredicateCondition::GreaterThan, {2})), (std::vector<RowID>{RowID{ChunkID{0}, 0}}));
+  EXPECT_EQ(index->lookup(PredicateCondition::GreaterThanEquals, {2}).size(), 2u);
+  EXPECT_EQ(index->lookup(PredicateCondition::Between, {2}, {3}).size(), 2u);
+  EXPECT_TRUE(index->lookup(PredicateCondition::Between, {3}, {2}).empty());
+  EXPECT_TRUE(index->lookup(PredicateCondition::Equals, {NullValue{}}).empty());
+
+  // Values are cast to the column type
+  EXPECT_EQ(index->lookup(PredicateCondition::Equals, {int64_t{3}}).size(), 1u);
+}
+
+TEST_F(TableIndexTest, CompositeLookup) {
+  const auto index = _table->create_table_index({ColumnID{1}, ColumnID{0}});
+
+  EXPECT_TRUE(index->is_index_for({ColumnID{1}}));
+  EXPECT_TRUE(index->is_index_for({ColumnID{1}, ColumnID{0}}));
+  EXPECT_FALSE(index->is_index_for({ColumnID{0}}));
+  EXPECT_FALSE(index->is_index_for({}));
+
+  // Prefix lookups only compare the leading column
+  EXPECT_EQ(row_ids(index->lookup(PredicateCondition::Equals, {"a"})),
+            (std::vector<RowID>{RowID{ChunkID{1}, 0}, RowID{ChunkID{0}, 2}}));
+  EXPECT_EQ(row_ids(index->lookup(PredicateCondition::Equals, {"a", 2})), (std::vector<RowID>{RowID{ChunkID{0}, 2}}));
+  EXPECT_EQ(index->lookup(PredicateCondition::GreaterThan, {"a"}).size(), 2u);
+  EXPECT_EQ(index->lookup(PredicateCondition::LessThan, {"b", 1}).size(), 2u);
+  EXPECT_EQ(index->lookup(PredicateCondition::Between, {"a", 2}, {"b", 1}).size(), 2u);
+}
+
+TEST_F(TableIndexTest, RangeLookup) {
+  const auto index = _table->create_table_index({ColumnID{0}});
+
+  EXPECT_EQ(row_ids(index->lookup(IndexKeyRange{{1}, false, {3}, false})), (std::vector<RowID>{RowID{ChunkID{0}, 2}}));
+  EXPECT_EQ(index->lookup(IndexKeyRange{{}, true, {2}, true}).size(), 3u);
+  EXPECT_TRUE(index->lookup(IndexKeyRange{{3}, true, {2}, true}).empty());
+
+  // Bounds of composite indexes may be prefixes
+  const auto composite_index = _table->create_table_index({ColumnID{1}, ColumnID{0}});
+  EXPECT_EQ(row_ids(composite_index->lookup(IndexKeyRange{{"a", 1}, false, {"b"}, true})),
+            (std::vector<RowID>{RowID{ChunkID{0}, 2}, RowID{ChunkID{0}, 1}}));
+}
+
+TEST_F(TableIndexTest, BoundsNotRepresentableInColumnType) {
+  const auto index = _table->create_table_index({ColumnID{0}});
+
+  // Values of the int column are not compared to truncated bounds
+  EXPECT_TRUE(index->lookup(PredicateCondition::Equals, {2.5}).empty());
+  EXPECT_EQ(index->lookup(PredicateCondition::LessThan, {2.5}).size(), 3u);
+  EXPECT_EQ(index->lookup(PredicateCondition::GreaterThan, {1.5f}).size(), 2u);
+  EXPECT_EQ(index->lookup(PredicateCondition::LessThanEquals, {1.0}).size(), 2u);
+  EXPECT_EQ(index->lookup(PredicateCondition::NotEquals, {2.5}).size(), 4u);
+
+  // Bounds beyond the range of the column type
+  EXPECT_TRUE(index->lookup(PredicateCondition::GreaterThan, {1e20}).empty());
+  EXPECT_EQ(index->lookup(PredicateCondition::LessThan, {1e20}).size(), 4u);
+  EXPECT_TRUE(index->lookup(PredicateCondition::Equals, {int64_t{5'000'000'000}}).empty());
+  EXPECT_EQ(index->lookup(PredicateCondition::GreaterThan, {int64_t{-5'000'000'000}}).size(), 4u);
+
+  // In composite bounds, the first inexact value decides the comparison
+  const auto composite_index = _table->create_table_index({ColumnID{1}, ColumnID{0}});
+  EXPECT_TRUE(composite_index->lookup(PredicateCondition::Equals, {"a", 1.5}).empty());
+  EXPECT_EQ(composite_index->lookup(PredicateCondition::LessThan, {"a", 2.5}).size(), 2u);
+  EXPECT_EQ(row_ids(composite_index->lookup(PredicateCondition::GreaterThanEquals, {"a", 1e20})),
+            (std::vector<RowID>{RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 0}}));
+}
+
+TEST_F(TableIndexTest, ThreeColumnLookup) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::String);
+  column_definitions.emplace_back("c", DataType::Double);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  table->append({1, "x", 2.0});
+  table->append({1, "x", 1.0});
+  table->append({1, "y", 0.5});
+  table->append({0, "z", 3.0});
+
+  const auto index = table->create_table_index({ColumnID{0}, ColumnID{1}, ColumnID{2}});
+  EXPECT_EQ(index->size(), 4u);
+
+  EXPECT_EQ(row_ids(index->lookup(PredicateCondition::Equals, {1})),
+            (std::vector<RowID>{RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}}));
+  EXPECT_EQ(row_ids(index->lookup(PredicateCondition::Equals, {1, "x", 2.0})),
+            (std::vector<RowID>{RowID{ChunkID{0}, 0}}));
+  EXPECT_EQ(index->lookup(PredicateCondition::LessThan, {1, "x", 2.0}).size(), 2u);
+  EXPECT_EQ(index->lookup(PredicateCondition::Between, {1, "x"}, {1, "y", 0.5}).size(), 3u);
+
+  // Values are cast to the column types
+  EXPECT_EQ(index->lookup(PredicateCondition::Equals, {int64_t{1}, "x", 1}).size(), 1u);
+}
+
+TEST_F(TableIndexTest, MaintainedOnAppend) {
+  const auto index = _table->create_table_index({ColumnID{0}});
+
+  _table->append({1, "e"});
+  EXPECT_EQ(row_ids(index->lookup(PredicateCondition::Equals, {1})),
+            (std::vector<RowID>{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 2}}));
+
+  const auto other_table = load_table("src/test/tables/int_float.tbl", 10);
+  const auto int_segment = other_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  auto strings = std::vector<std::string>{"x", "y", "z"};
+  _table->append_chunk({int_segment, std::make_shared<ValueSegment<std::string>>(strings)});
+
+  EXPECT_EQ(index->size(), 8u);
+  EXPECT_EQ(row_ids(index->lookup(PredicateCondition::Equals, {123})), (std::vector<RowID>{RowID{ChunkID{2}, 1}}));
+}
+
+TEST_F(TableIndexTest, ValidAfterEncoding) {
+  const auto index = _table->create_table_index({ColumnID{0}});
+  ChunkEncoder::encode_all_chunks(_table);
+
+  const auto pos_list = index->lookup(PredicateCondition::Equals, {2});
+  ASSERT_EQ(pos_list.size(), 1u);
+  EXPECT_EQ(pos_list[0], (RowID{ChunkID{0}, 2}));
+  EXPECT_EQ((*_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[2], AllTypeVariant{2});
+}
+
+TEST_F(TableIndexTest, IndexScanUsesTableIndex) {
+  _table->create_table_index({ColumnID{0}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  auto scan = std::make_shared<IndexScan>(table_wrapper, SegmentIndexType::GroupKey, column_ids,
+                                          PredicateCondition::LessThanEquals, std::vector<AllTypeVariant>{2});
+  scan->execute();
+
+  const auto output = scan->get_output();
+  ASSERT_EQ(output->row_count(), 3u);
+  EXPECT_EQ(output->get_value<std::string>(ColumnID{1}, 0u), "b");
+  EXPECT_EQ(output->get_value<std::string>(ColumnID{1}, 1u), "a");
+  EXPECT_EQ(output->get_value<std::string>(ColumnID{1}, 2u), "a");
+}
+
+TEST_F(TableIndexTest, JoinIndexUsesTableIndex) {
+  _table->create_table_index({ColumnID{0}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  // The matches of 3 are 1, 2, and 1, the matches of 2 are 1 and 1
+  auto join = std::make_shared<JoinIndex>(table_wrapper, table_wrapper, JoinMode::Inner,
+                                          ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::GreaterThan);
+  join->execute();
+
+  EXPECT_EQ(join->get_output()->row_count(), 5u);
+
+  const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(join->performance_data());
+  EXPECT_TRUE(performance_data.table_index_used);
+  EXPECT_EQ(performance_data.chunks_scanned_without_index, 0u);
+}
+
+}  // namespace opossum
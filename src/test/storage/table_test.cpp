@@ -8,6 +8,11 @@
 #include "gtest/gtest.h"
 
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -179,4 +184,26 @@ TEST_F(StorageTableTest, MemoryUsageEstimation) {
                                                      sizeof(TransactionID) + 2 * sizeof(CommitID));
 }
 
+TEST_F(StorageTableTest, CreateIndexWithScheduler) {
+  for (auto value = 0; value < 10; ++value) {
+    t->append({value, "Hello"});
+  }
+  ChunkEncoder::encode_all_chunks(t);
+
+  // The chunk indexes are built by JobTasks
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  t->create_index<GroupKeyIndex>({ColumnID{0}}, "index");
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  ASSERT_EQ(t->get_indexes().size(), 1u);
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  for (auto chunk_id = ChunkID{0}; chunk_id < t->chunk_count(); ++chunk_id) {
+    const auto index = t->get_chunk(chunk_id)->get_index(SegmentIndexType::GroupKey, column_ids);
+    ASSERT_TRUE(index);
+    EXPECT_EQ(*index->cbegin(), ChunkOffset{0});
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,149 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/unique_constraint_checker.hpp"
+
+namespace opossum {
+
+class UniqueConstraintTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Column a holds 12345, 123, and 1234
+    _table = load_table("src/test/tables/int_float.tbl", 2);
+    StorageManager::get().add_table("table_a", _table);
+
+    _table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+  }
+
+  std::shared_ptr<Insert> _insert(const std::shared_ptr<TransactionContext>& context, const int32_t value) {
+    auto values_to_insert = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+    values_to_insert->append({value, 1.0f});
+    auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+    table_wrapper->execute();
+
+    auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+    return insert;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(UniqueConstraintTest, AddConstraint) {
+  EXPECT_EQ(_table->get_unique_constraints(),
+            (TableConstraintDefinitions{{std::vector<ColumnID>{ColumnID{0}}, IsPrimaryKey::Yes}}));
+  EXPECT_NE(_table->get_table_index({ColumnID{0}}), nullptr);
+
+  _table->add_unique_constraint({ColumnID{1}, ColumnID{0}});
+  EXPECT_EQ(_table->get_unique_constraints().size(), 2u);
+  EXPECT_EQ(_table->get_unique_constraints().back().is_primary_key, IsPrimaryKey::No);
+}
+
+TEST_F(UniqueConstraintTest, InvalidConstraints) {
+  // A second PRIMARY KEY and a second constraint on the same columns
+  EXPECT_THROW(_table->add_unique_constraint({ColumnID{1}}, IsPrimaryKey::Yes), std::logic_error);
+  EXPECT_THROW(_table->add_unique_constraint({ColumnID{0}}), std::logic_error);
+
+  // Nullable columns cannot be part of a PRIMARY KEY
+  const auto nullable_table = load_table("src/test/tables/int_float_with_null.tbl", 2);
+  EXPECT_THROW(nullable_table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes), std::logic_error);
+
+  // The rows of the table have to satisfy the constraint
+  const auto table_with_duplicates = load_table("src/test/tables/int_int2.tbl", 2);
+  EXPECT_THROW(table_with_duplicates->add_unique_constraint({ColumnID{0}}), std::logic_error);
+  EXPECT_TRUE(table_with_duplicates->get_unique_constraints().empty());
+}
+
+TEST_F(UniqueConstraintTest, InsertNewKey) {
+  auto context = TransactionManager::get().new_transaction_context();
+  _insert(context, 7);
+
+  EXPECT_TRUE(context->commit());
+  EXPECT_EQ(context->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(_table->get_table_index({ColumnID{0}})->size(), 4u);
+}
+
+TEST_F(UniqueConstraintTest, InsertExistingKeyRollsBack) {
+  auto context = TransactionManager::get().new_transaction_context();
+  const auto insert = _insert(context, 123);
+  EXPECT_FALSE(insert->execute_failed());
+
+  EXPECT_FALSE(context->commit());
+  EXPECT_EQ(context->phase(), TransactionPhase::RolledBack);
+  EXPECT_EQ(_table->get_table_index({ColumnID{0}})->size(), 3u);
+}
+
+TEST_F(UniqueConstraintTest, DuplicateWithinTransaction) {
+  auto context = TransactionManager::get().new_transaction_context();
+  _insert(context, 7);
+  _insert(context, 7);
+
+  EXPECT_FALSE(context->commit());
+}
+
+TEST_F(UniqueConstraintTest, ConcurrentInsertsOfSameKey) {
+  auto context_a = TransactionManager::get().new_transaction_context();
+  auto context_b = TransactionManager::get().new_transaction_context();
+  _insert(context_a, 7);
+  _insert(context_b, 7);
+
+  // Both transactions see the uncommitted row of the other one. The first one to commit fails, which removes its row.
+  EXPECT_FALSE(context_a->commit());
+  EXPECT_TRUE(context_b->commit());
+}
+
+TEST_F(UniqueConstraintTest, ReinsertDeletedKey) {
+  auto context = TransactionManager::get().new_transaction_context();
+
+  // Delete the row with 123 and insert it again, as an UPDATE of the row would
+  auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->set_transaction_context(context);
+  get_table->execute();
+  auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(context);
+  validate->execute();
+  auto table_scan = create_table_scan(validate, ColumnID{0}, PredicateCondition::Equals, 123);
+  table_scan->execute();
+  auto delete_op = std::make_shared<Delete>("table_a", table_scan);
+  delete_op->set_transaction_context(context);
+  delete_op->execute();
+
+  _insert(context, 123);
+  EXPECT_TRUE(context->commit());
+
+  // Now that the deletion is committed, the key can be inserted again
+  auto next_context = TransactionManager::get().new_transaction_context();
+  _insert(next_context, 123);
+  EXPECT_FALSE(next_context->commit());
+}
+
+TEST_F(UniqueConstraintTest, NullsDoNotViolateUniqueConstraints) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+  table->append({NullValue{}});
+  table->append({NullValue{}});
+  table->append({1});
+  table->add_unique_constraint({ColumnID{0}});
+
+  EXPECT_FALSE(find_violated_unique_constraint(*table, PosList{RowID{ChunkID{0}, 0}}, TransactionID{0}));
+
+  table->append({1});
+  EXPECT_EQ(find_violated_unique_constraint(*table, PosList{RowID{ChunkID{0}, 3}}, TransactionID{0}),
+            (TableConstraintDefinition{{ColumnID{0}}, IsPrimaryKey::No}));
+}
+
+}  // namespace opossum
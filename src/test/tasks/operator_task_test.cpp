@@ -9,6 +9,8 @@
 #include "operators/abstract_join_operator.hpp"
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/operator_pipeline.hpp"
+#include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/union_positions.hpp"
 #include "scheduler/operator_task.hpp"
@@ -59,6 +61,57 @@ TEST_F(OperatorTaskTest, SingleDependencyTasksFromOperatorTest) {
   EXPECT_EQ(gt->get_output(), nullptr);
 }
 
+TEST_F(OperatorTaskTest, PipelinedTasksFromOperatorTest) {
+  auto gt = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+  auto ts = std::make_shared<TableScan>(gt, equals_(a, 1234));
+  auto projection = std::make_shared<Projection>(ts, expression_vector(a, b));
+
+  auto tasks = OperatorTask::make_tasks_from_operator(projection, CleanupTemporaries::Yes, UsePipelining::Yes);
+
+  // The TableScan and the Projection are merged into a single task
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_EQ(tasks[0]->get_pipeline(), nullptr);
+  ASSERT_NE(tasks[1]->get_pipeline(), nullptr);
+  EXPECT_EQ(tasks[1]->get_pipeline()->operators().size(), 2u);
+  EXPECT_EQ(tasks[1]->get_operator(), projection);
+
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  auto expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
+  EXPECT_TABLE_EQ_UNORDERED(expected_result, projection->get_output());
+  EXPECT_EQ(ts->get_output(), nullptr);
+  EXPECT_EQ(gt->get_output(), nullptr);
+}
+
+TEST_F(OperatorTaskTest, PipelinedJoinProbeTasksFromOperatorTest) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto gt_b = std::make_shared<GetTable>("table_b");
+  auto a = PQPColumnExpression::from_table(*_test_table_b, "a");
+  auto ts = std::make_shared<TableScan>(gt_b, greater_than_(a, 100));
+  auto join = std::make_shared<JoinHash>(gt_a, ts, JoinMode::Inner, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                         PredicateCondition::Equals);
+
+  auto tasks = OperatorTask::make_tasks_from_operator(join, CleanupTemporaries::Yes, UsePipelining::Yes);
+
+  // The TableScan feeds the probe side of the JoinHash, both GetTables are executed before
+  ASSERT_EQ(tasks.size(), 3u);
+  ASSERT_NE(tasks[2]->get_pipeline(), nullptr);
+  EXPECT_EQ(tasks[2]->get_pipeline()->operators(), (std::vector<std::shared_ptr<AbstractOperator>>{ts, join}));
+  EXPECT_EQ(tasks[2]->predecessors().size(), 2u);
+
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  auto expected_result = load_table("src/test/tables/joinoperators/int_inner_join.tbl", 2);
+  EXPECT_TABLE_EQ_UNORDERED(expected_result, join->get_output());
+  EXPECT_EQ(ts->get_output(), nullptr);
+}
+
 TEST_F(OperatorTaskTest, DoubleDependencyTasksFromOperatorTest) {
   auto gt_a = std::make_shared<GetTable>("table_a");
   auto gt_b = std::make_shared<GetTable>("table_b");
@@ -0,0 +1,237 @@
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "optimizer/strategy/chunk_pruning_rule.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/table_clustering_task.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class TableClusteringTaskTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::Int);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 10, UseMvcc::Yes);
+    _expected_table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+
+    // Ten chunks whose values of both columns are spread over the whole value range
+    for (auto row_idx = 0; row_idx < 100; ++row_idx) {
+      _table->append({(row_idx * 37) % 100, (row_idx * 53) % 100});
+      _expected_table->append({(row_idx * 37) % 100, (row_idx * 53) % 100});
+    }
+    ChunkEncoder::encode_all_chunks(_table);
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  // The rows of table_a that are visible to a new transaction
+  std::shared_ptr<const Table> _validated_table() const {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context_recursively(TransactionManager::get().new_transaction_context());
+    get_table->execute();
+    validate->execute();
+    return validate->get_output();
+  }
+
+  // Number of chunks with visible rows that the chunk statistics cannot prune for all of @param predicates
+  size_t _count_unpruned_chunks(const std::vector<std::pair<ColumnID, AllTypeVariant>>& less_than_predicates) const {
+    auto chunk_count = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      const auto chunk = _table->get_chunk(chunk_id);
+      if (chunk->cleanup_commit_id()) continue;
+
+      const auto statistics = chunk->statistics();
+      if (!statistics) {
+        ++chunk_count;
+        continue;
+      }
+
+      auto can_prune = false;
+      for (const auto& predicate : less_than_predicates) {
+        can_prune |= statistics->can_prune(predicate.first, PredicateCondition::LessThan, predicate.second);
+      }
+      if (!can_prune) ++chunk_count;
+    }
+    return chunk_count;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _expected_table;
+};
+
+TEST_F(TableClusteringTaskTest, ClusterBySingleColumn) {
+  EXPECT_EQ(_count_unpruned_chunks({{ColumnID{0}, 10}}), 9u);
+
+  const auto task = std::make_shared<TableClusteringTask>("table_a", std::vector<ColumnID>{ColumnID{0}});
+  task->execute();
+  ASSERT_TRUE(task->committed());
+
+  // The previous chunks are kept, but none of their rows are visible anymore
+  ASSERT_EQ(_table->chunk_count(), 20u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{10}; ++chunk_id) {
+    EXPECT_TRUE(_table->get_chunk(chunk_id)->cleanup_commit_id());
+  }
+
+  EXPECT_TABLE_EQ_UNORDERED(_validated_table(), _expected_table);
+
+  // The rows were inserted in the order of a and the chunks were compressed
+  auto expected_value = int32_t{0};
+  for (auto chunk_id = ChunkID{10}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_FALSE(chunk->cleanup_commit_id());
+
+    const auto segment = chunk->get_segment(ColumnID{0});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_EQ(type_cast<int32_t>((*segment)[chunk_offset]), expected_value++);
+    }
+  }
+
+  EXPECT_EQ(_count_unpruned_chunks({{ColumnID{0}, 10}}), 1u);
+  EXPECT_EQ(_count_unpruned_chunks({{ColumnID{0}, 35}}), 4u);
+}
+
+TEST_F(TableClusteringTaskTest, PruneAllButClusteredChunks) {
+  // The chunks excluded by the ChunkPruningRule for `a < 10`
+  const auto excluded_chunk_ids = [&]() {
+    const auto stored_table_node = std::make_shared<StoredTableNode>("table_a");
+    const auto predicate_node =
+        std::make_shared<PredicateNode>(less_than_(LQPColumnReference(stored_table_node, ColumnID{0}), 10));
+    predicate_node->set_left_input(stored_table_node);
+    ChunkPruningRule{}.apply_to(predicate_node);
+    return stored_table_node->excluded_chunk_ids();
+  };
+
+  // A transaction that started before the clustering still sees the rows of the previous chunks
+  auto context = TransactionManager::get().new_transaction_context();
+
+  const auto task = std::make_shared<TableClusteringTask>("table_a", std::vector<ColumnID>{ColumnID{0}});
+  task->execute();
+  ASSERT_TRUE(task->committed());
+  ASSERT_EQ(_table->chunk_count(), 20u);
+
+  auto expected_chunk_ids = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{10}; ++chunk_id) {
+    if (_table->get_chunk(chunk_id)->statistics()->can_prune(ColumnID{0}, PredicateCondition::LessThan, 10)) {
+      expected_chunk_ids.emplace_back(chunk_id);
+    }
+  }
+  for (auto chunk_id = ChunkID{11}; chunk_id < ChunkID{20}; ++chunk_id) {
+    expected_chunk_ids.emplace_back(chunk_id);
+  }
+  EXPECT_EQ(excluded_chunk_ids(), expected_chunk_ids);
+
+  // Once no transaction sees the previous chunks anymore, they are excluded regardless of their statistics and only
+  // the clustered chunk holding the values 0 to 9 is scanned
+  context.reset();
+  expected_chunk_ids.clear();
+  for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{20}; ++chunk_id) {
+    if (chunk_id != ChunkID{10}) expected_chunk_ids.emplace_back(chunk_id);
+  }
+  EXPECT_EQ(excluded_chunk_ids(), expected_chunk_ids);
+}
+
+TEST_F(TableClusteringTaskTest, ClusterByMultipleColumns) {
+  const auto predicates = std::vector<std::pair<ColumnID, AllTypeVariant>>{{ColumnID{0}, 30}, {ColumnID{1}, 30}};
+  EXPECT_EQ(_count_unpruned_chunks(predicates), 10u);
+
+  const auto task =
+      std::make_shared<TableClusteringTask>("table_a", std::vector<ColumnID>{ColumnID{0}, ColumnID{1}});
+  task->execute();
+  ASSERT_TRUE(task->committed());
+
+  EXPECT_TABLE_EQ_UNORDERED(_validated_table(), _expected_table);
+
+  // The Z-order keeps the value ranges of both columns small, so that chunks are pruned for either predicate
+  EXPECT_LE(_count_unpruned_chunks(predicates), 3u);
+  EXPECT_GT(_count_unpruned_chunks({{ColumnID{0}, 30}}), _count_unpruned_chunks(predicates));
+}
+
+TEST_F(TableClusteringTaskTest, ClusterAgain) {
+  const auto column_ids = std::vector<ColumnID>{ColumnID{1}};
+  std::make_shared<TableClusteringTask>("table_a", column_ids)->execute();
+  std::make_shared<TableClusteringTask>("table_a", column_ids)->execute();
+
+  // Only the chunks of the first clustering are clustered again
+  ASSERT_EQ(_table->chunk_count(), 30u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{19})->cleanup_commit_id());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{20})->cleanup_commit_id());
+
+  EXPECT_TABLE_EQ_UNORDERED(_validated_table(), _expected_table);
+  EXPECT_EQ(_count_unpruned_chunks({{ColumnID{1}, 10}}), 1u);
+}
+
+TEST_F(TableClusteringTaskTest, ClusterFromFirstChunk) {
+  const auto task = std::make_shared<TableClusteringTask>("table_a", std::vector<ColumnID>{ColumnID{0}},
+                                                          SegmentEncodingSpec{}, ChunkID{6});
+  task->execute();
+  ASSERT_TRUE(task->committed());
+
+  // Only the rows of the last four chunks were re-inserted
+  ASSERT_EQ(_table->chunk_count(), 14u);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{5})->cleanup_commit_id());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{6})->cleanup_commit_id());
+  EXPECT_TABLE_EQ_UNORDERED(_validated_table(), _expected_table);
+}
+
+TEST_F(TableClusteringTaskTest, ConflictingTransaction) {
+  // A concurrent transaction deletes a row without committing
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto validate = std::make_shared<Validate>(get_table);
+  const auto table_scan =
+      std::make_shared<TableScan>(validate, equals_(PQPColumnExpression::from_table(*_table, "a"), 5));
+  const auto delete_operator = std::make_shared<Delete>("table_a", table_scan);
+  delete_operator->set_transaction_context_recursively(context);
+  get_table->execute();
+  validate->execute();
+  table_scan->execute();
+  delete_operator->execute();
+  ASSERT_FALSE(delete_operator->execute_failed());
+
+  const auto task = std::make_shared<TableClusteringTask>("table_a", std::vector<ColumnID>{ColumnID{0}});
+  task->execute();
+  EXPECT_FALSE(task->committed());
+
+  // The clustering was rolled back
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->cleanup_commit_id());
+  EXPECT_EQ(_table->chunk_count(), 10u);
+  EXPECT_TABLE_EQ_UNORDERED(_validated_table(), _expected_table);
+
+  context->rollback();
+}
+
+TEST_F(TableClusteringTaskTest, WithoutCompression) {
+  const auto task =
+      std::make_shared<TableClusteringTask>("table_a", std::vector<ColumnID>{ColumnID{0}}, std::nullopt);
+  task->execute();
+  ASSERT_TRUE(task->committed());
+
+  // The clustered chunks are left to the ChunkCompressionManager
+  ASSERT_EQ(_table->chunk_count(), 20u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{10})->is_mutable());
+  EXPECT_TABLE_EQ_UNORDERED(_validated_table(), _expected_table);
+}
+
+}  // namespace opossum
@@ -0,0 +1,142 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+#include "utils/tracing/execution_trace.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class ExecutionTraceTest : public BaseTest {
+ protected:
+  // Returns the non-metadata events of @param category
+  static std::vector<nlohmann::json> events_of_category(const ExecutionTrace& execution_trace,
+                                                        const std::string& category) {
+    auto events = std::vector<nlohmann::json>{};
+    for (const auto& event : execution_trace.to_chrome_trace()["traceEvents"]) {
+      if (event["ph"] != "M" && event["cat"] == category) events.emplace_back(event);
+    }
+    return events;
+  }
+};
+
+TEST_F(ExecutionTraceTest, NothingIsRecordedWithoutActivation) {
+  const auto execution_trace = std::make_shared<ExecutionTrace>("query");
+
+  EXPECT_EQ(ExecutionTrace::current(), nullptr);
+  {
+    auto trace_scope = TraceScope{"Phase", "Test"};
+    auto task = std::make_shared<JobTask>([]() {});
+    task->schedule();
+  }
+
+  EXPECT_EQ(execution_trace->event_count(), 0u);
+}
+
+TEST_F(ExecutionTraceTest, ScopedActivation) {
+  const auto outer_trace = std::make_shared<ExecutionTrace>();
+  const auto inner_trace = std::make_shared<ExecutionTrace>();
+
+  {
+    const auto outer_activation = ExecutionTrace::ScopedActivation{outer_trace};
+    EXPECT_EQ(ExecutionTrace::current(), outer_trace);
+
+    {
+      const auto inner_activation = ExecutionTrace::ScopedActivation{inner_trace};
+      EXPECT_EQ(ExecutionTrace::current(), inner_trace);
+    }
+    EXPECT_EQ(ExecutionTrace::current(), outer_trace);
+
+    {
+      // Activating no trace leaves the current one active
+      const auto null_activation = ExecutionTrace::ScopedActivation{nullptr};
+      EXPECT_EQ(ExecutionTrace::current(), outer_trace);
+    }
+  }
+
+  EXPECT_EQ(ExecutionTrace::current(), nullptr);
+}
+
+TEST_F(ExecutionTraceTest, RecordsTasksAndOperators) {
+  const auto execution_trace = std::make_shared<ExecutionTrace>("query");
+
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_(a, 200));
+
+  {
+    const auto activation = ExecutionTrace::ScopedActivation{execution_trace};
+    for (const auto& task : OperatorTask::make_tasks_from_operator(table_scan, CleanupTemporaries::Yes)) {
+      task->schedule();
+    }
+
+    auto trace_scope = TraceScope{"Phase", "Test"};
+    trace_scope.arguments()["answer"] = 42;
+  }
+
+  const auto task_events = events_of_category(*execution_trace, "Task");
+  ASSERT_EQ(task_events.size(), 2u);
+  EXPECT_EQ(task_events[0]["ph"], "X");
+  EXPECT_TRUE(task_events[0].count("dur"));
+  // Tasks that were executed without a Scheduler never waited in a queue
+  EXPECT_FALSE(task_events[0]["args"].count("queue_wait_us"));
+
+  const auto operator_events = events_of_category(*execution_trace, "Operator");
+  ASSERT_EQ(operator_events.size(), 2u);
+  EXPECT_EQ(operator_events[0]["name"], "TableWrapper");
+  EXPECT_EQ(operator_events[1]["name"], "TableScan");
+  EXPECT_EQ(operator_events[1]["args"]["output_rows"], 2);
+
+  const auto test_events = events_of_category(*execution_trace, "Test");
+  ASSERT_EQ(test_events.size(), 1u);
+  EXPECT_EQ(test_events[0]["args"]["answer"], 42);
+
+  const auto chrome_trace = execution_trace->to_chrome_trace();
+  EXPECT_EQ(chrome_trace["traceEvents"][0]["name"], "process_name");
+  EXPECT_EQ(chrome_trace["traceEvents"][0]["args"]["name"], "query");
+}
+
+TEST_F(ExecutionTraceTest, TraceFollowsTasksOntoWorkers) {
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto execution_trace = std::make_shared<ExecutionTrace>();
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  {
+    const auto activation = ExecutionTrace::ScopedActivation{execution_trace};
+    for (auto task_idx = 0; task_idx < 8; ++task_idx) {
+      // Tasks spawned by traced tasks are traced as well
+      tasks.emplace_back(std::make_shared<JobTask>([]() {
+        EXPECT_NE(ExecutionTrace::current(), nullptr);
+        auto nested_task = std::make_shared<JobTask>([]() {});
+        nested_task->schedule();
+        CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{nested_task});
+      }));
+    }
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  CurrentScheduler::get()->finish();
+
+  const auto task_events = events_of_category(*execution_trace, "Task");
+  ASSERT_EQ(task_events.size(), 16u);
+  for (const auto& task_event : task_events) {
+    EXPECT_GE(task_event["tid"], 0);
+    EXPECT_TRUE(task_event["args"].count("queue_wait_us"));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,116 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "utils/tracing/hardware_counters.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+// perf_event_open is often unavailable (e.g., in containers or VMs). Tests that depend on actual counts return early
+// in that case.
+class HardwareCountersTest : public BaseTest {
+ protected:
+  void TearDown() override { HardwareCounters::set_enabled(false); }
+
+  static void busy_loop() {
+    volatile auto sum = uint64_t{0};
+    for (auto i = uint64_t{0}; i < 1'000'000; ++i) sum += i;
+  }
+};
+
+TEST_F(HardwareCountersTest, ValuesAddUp) {
+  auto values = HardwareCounterValues{1, 2, 3, 4};
+  values += HardwareCounterValues{10, 20, 30, 40};
+  EXPECT_EQ(values.cycles, 11u);
+  EXPECT_EQ(values.instructions, 22u);
+  EXPECT_EQ(values.llc_misses, 33u);
+  EXPECT_EQ(values.branch_misses, 44u);
+
+  const auto hardware_counters = std::make_shared<HardwareCounters>();
+  hardware_counters->add(values);
+  hardware_counters->add(values);
+  EXPECT_EQ(hardware_counters->values().instructions, 44u);
+  EXPECT_EQ(hardware_counters->values().to_json()["branch_misses"], 88);
+}
+
+TEST_F(HardwareCountersTest, NestedAttributionsAreExclusive) {
+  if (!HardwareCounters::is_available()) return;
+
+  const auto outer_counters = std::make_shared<HardwareCounters>();
+  const auto inner_counters = std::make_shared<HardwareCounters>();
+
+  {
+    const auto outer_attribution = HardwareCounters::ScopedAttribution{outer_counters};
+    EXPECT_EQ(HardwareCounters::current(), outer_counters);
+    {
+      const auto inner_attribution = HardwareCounters::ScopedAttribution{inner_counters};
+      EXPECT_EQ(HardwareCounters::current(), inner_counters);
+      busy_loop();
+    }
+    {
+      // Nothing is counted while a nullptr is attributed
+      const auto null_attribution = HardwareCounters::ScopedAttribution{nullptr};
+      EXPECT_EQ(HardwareCounters::current(), nullptr);
+      busy_loop();
+    }
+    EXPECT_EQ(HardwareCounters::current(), outer_counters);
+  }
+  EXPECT_EQ(HardwareCounters::current(), nullptr);
+
+  EXPECT_GT(inner_counters->values().instructions, 1'000'000u);
+  EXPECT_LT(outer_counters->values().instructions, inner_counters->values().instructions);
+}
+
+TEST_F(HardwareCountersTest, CountersFollowTasksOntoWorkers) {
+  if (!HardwareCounters::is_available()) return;
+
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto hardware_counters = std::make_shared<HardwareCounters>();
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  {
+    const auto attribution = HardwareCounters::ScopedAttribution{hardware_counters};
+    for (auto task_idx = 0; task_idx < 8; ++task_idx) {
+      tasks.emplace_back(std::make_shared<JobTask>([]() { busy_loop(); }));
+    }
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  CurrentScheduler::get()->finish();
+
+  EXPECT_GT(hardware_counters->values().instructions, 8'000'000u);
+}
+
+TEST_F(HardwareCountersTest, OperatorPerformanceData) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto uncounted_scan = std::make_shared<TableScan>(table_wrapper, greater_than_(a, 200));
+  uncounted_scan->execute();
+  EXPECT_FALSE(uncounted_scan->performance_data().hardware_counters);
+
+  HardwareCounters::set_enabled(true);
+  const auto counted_scan = std::make_shared<TableScan>(table_wrapper, greater_than_(a, 200));
+  counted_scan->execute();
+  ASSERT_TRUE(counted_scan->performance_data().hardware_counters);
+  if (HardwareCounters::is_available()) {
+    EXPECT_GT(counted_scan->performance_data().hardware_counters->instructions, 0u);
+  }
+}
+
+}  // namespace opossum